@@ -1,13 +1,18 @@
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string_view>
 #include <type_traits>
 
 #include "common.h"
+#include "expressions.h"
+#include "predicates.h"
 #include "detail/maybe_vector.h"
+#include "detail/string_column.h"
 
 namespace milvus {
 namespace bitset {
@@ -82,6 +87,12 @@ class BitsetBase {
    template<typename, typename, bool>
    friend class Bitset;
 
+   template<typename, typename, bool>
+   friend class BitsetBase;
+
+   template<typename>
+   friend class BitsetExprLeaf;
+
 public:
     using policy_type = PolicyT;
     using data_type = typename policy_type::data_type;
@@ -531,6 +542,45 @@ public:
         return as_derived();
     }
 
+    // Inplace ternary logic, this = f(this, b, c), in a single pass.
+    // f is given by a truth table in the format of vpternlog, which can
+    //   be built from TERNARY_A / TERNARY_B / TERNARY_C constants,
+    //   for example, `TERNARY_A & (TERNARY_B | ~TERNARY_C)` for
+    //   this = this & (b | ~c).
+    template<uint8_t TruthTable, typename I1, bool R1, typename I2, bool R2>
+    inline void inplace_ternary(
+        const BitsetBase<PolicyT, I1, R1>& b,
+        const BitsetBase<PolicyT, I2, R2>& c,
+        const size_t size
+    ) {
+        range_checker::le(size, this->size());
+        range_checker::le(size, b.size());
+        range_checker::le(size, c.size());
+
+        policy_type::template op_ternary<TruthTable>(
+            this->data(),
+            b.data(),
+            c.data(),
+            this->offset(),
+            b.offset(),
+            c.offset(),
+            size
+        );
+    }
+
+    // Inplace ternary logic. Given bitsets / bitset views are expected
+    //   to have the same size.
+    template<uint8_t TruthTable, typename I1, bool R1, typename I2, bool R2>
+    inline void inplace_ternary(
+        const BitsetBase<PolicyT, I1, R1>& b,
+        const BitsetBase<PolicyT, I2, R2>& c
+    ) {
+        range_checker::eq(b.size(), this->size());
+        range_checker::eq(c.size(), this->size());
+
+        this->template inplace_ternary<TruthTable>(b, c, this->size());
+    }
+
     // Find the index of the first bit set to either true (default), or false.
     inline std::optional<size_t> find_first(const bool is_set = true) const {
         return policy_type::op_find(this->data(), this->offset(), this->size(), 0, is_set);
@@ -576,8 +626,15 @@ public:
         );
     }
 
-    // Compare two arrays element-wise
-    template<typename T, typename U>
+    // Compare two arrays element-wise.
+    // Compare / range / arith functions merge the result with the existing
+    //   bits according to Mode, see CombineMode. The default one overwrites
+    //   the bits, while And / Or / AndNot allow to evaluate multi-predicate
+    //   filters without temporary bitsets.
+    // And evaluates a predicate only for rows whose bits are currently set,
+    //   if there are few of them, so expensive predicates are not 
+    //   evaluated for rows that are already filtered out.
+    template<typename T, typename U, CombineMode Mode = CombineMode::Store>
     void inplace_compare_column(
         const T* const __restrict t,
         const U* const __restrict u,
@@ -585,29 +642,29 @@ public:
         CompareOpType op
     ) {
         if (op == CompareOpType::EQ) {
-            this->inplace_compare_column<T, U, CompareOpType::EQ>(t, u, size);
+            this->inplace_compare_column<T, U, CompareOpType::EQ, Mode>(t, u, size);
         }
         else if (op == CompareOpType::GE) {
-            this->inplace_compare_column<T, U, CompareOpType::GE>(t, u, size);
+            this->inplace_compare_column<T, U, CompareOpType::GE, Mode>(t, u, size);
         }
         else if (op == CompareOpType::GT) {
-            this->inplace_compare_column<T, U, CompareOpType::GT>(t, u, size);
+            this->inplace_compare_column<T, U, CompareOpType::GT, Mode>(t, u, size);
         }
         else if (op == CompareOpType::LE) {
-            this->inplace_compare_column<T, U, CompareOpType::LE>(t, u, size);
+            this->inplace_compare_column<T, U, CompareOpType::LE, Mode>(t, u, size);
         }
         else if (op == CompareOpType::LT) {
-            this->inplace_compare_column<T, U, CompareOpType::LT>(t, u, size);
+            this->inplace_compare_column<T, U, CompareOpType::LT, Mode>(t, u, size);
         }
         else if (op == CompareOpType::NE) {
-            this->inplace_compare_column<T, U, CompareOpType::NE>(t, u, size);
+            this->inplace_compare_column<T, U, CompareOpType::NE, Mode>(t, u, size);
         }
         else {
             // unimplemented
         }
     }
 
-    template<typename T, typename U, CompareOpType Op>
+    template<typename T, typename U, CompareOpType Op, CombineMode Mode = CombineMode::Store>
     void inplace_compare_column(
         const T* const __restrict t,
         const U* const __restrict u,
@@ -615,7 +672,7 @@ public:
     ) {
         range_checker::le(size, this->size());
 
-        policy_type::template op_compare_column<T, U, Op>(
+        policy_type::template op_compare_column<T, U, Op, Mode>(
             this->data(),
             this->offset(),
             t,
@@ -625,7 +682,7 @@ public:
     }
 
     // Compare elements of an given array with a given value
-    template<typename T>
+    template<typename T, CombineMode Mode = CombineMode::Store>
     void inplace_compare_val(
         const T* const __restrict t,
         const size_t size,
@@ -633,29 +690,29 @@ public:
         CompareOpType op
     ) {
         if (op == CompareOpType::EQ) {
-            this->inplace_compare_val<T, CompareOpType::EQ>(t, size, value);
+            this->inplace_compare_val<T, CompareOpType::EQ, Mode>(t, size, value);
         }
         else if (op == CompareOpType::GE) {
-            this->inplace_compare_val<T, CompareOpType::GE>(t, size, value);
+            this->inplace_compare_val<T, CompareOpType::GE, Mode>(t, size, value);
         }
         else if (op == CompareOpType::GT) {
-            this->inplace_compare_val<T, CompareOpType::GT>(t, size, value);
+            this->inplace_compare_val<T, CompareOpType::GT, Mode>(t, size, value);
         }
         else if (op == CompareOpType::LE) {
-            this->inplace_compare_val<T, CompareOpType::LE>(t, size, value);
+            this->inplace_compare_val<T, CompareOpType::LE, Mode>(t, size, value);
         }
         else if (op == CompareOpType::LT) {
-            this->inplace_compare_val<T, CompareOpType::LT>(t, size, value);
+            this->inplace_compare_val<T, CompareOpType::LT, Mode>(t, size, value);
         }
         else if (op == CompareOpType::NE) {
-            this->inplace_compare_val<T, CompareOpType::NE>(t, size, value);
+            this->inplace_compare_val<T, CompareOpType::NE, Mode>(t, size, value);
         }
         else {
             // unimplemented
         }
     }
 
-    template<typename T, CompareOpType Op>
+    template<typename T, CompareOpType Op, CombineMode Mode = CombineMode::Store>
     void inplace_compare_val(
         const T* const __restrict t,
         const size_t size,
@@ -663,7 +720,7 @@ public:
     ) {
         range_checker::le(size, this->size());
 
-        policy_type::template op_compare_val<T, Op>(
+        policy_type::template op_compare_val<T, Op, Mode>(
             this->data(),
             this->offset(),
             t,
@@ -672,8 +729,51 @@ public:
         );
     }
 
-    //
+    // Check whether elements of a given array are present in a given
+    //   set of values (SQL IN).
+    template<typename T>
+    void inplace_in_values(
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        this->inplace_in_values<T, InValuesType::In>(t, size, values, n_values);
+    }
+
+    // Check whether elements of a given array are absent from a given
+    //   set of values (SQL NOT IN).
     template<typename T>
+    void inplace_not_in_values(
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        this->inplace_in_values<T, InValuesType::NotIn>(t, size, values, n_values);
+    }
+
+    template<typename T, InValuesType Op>
+    void inplace_in_values(
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        range_checker::le(size, this->size());
+
+        policy_type::template op_in_values<T, Op>(
+            this->data(),
+            this->offset(),
+            t,
+            size,
+            values,
+            n_values
+        );
+    }
+
+    //
+    template<typename T, CombineMode Mode = CombineMode::Store>
     void inplace_within_range_column(
         const T* const __restrict lower,
         const T* const __restrict upper,
@@ -682,19 +782,19 @@ public:
         const RangeType op
     ) {
         if (op == RangeType::IncInc) {
-            this->inplace_within_range_column<T, RangeType::IncInc>(lower, upper, values, size);
+            this->inplace_within_range_column<T, RangeType::IncInc, Mode>(lower, upper, values, size);
         } else if (op == RangeType::IncExc) {
-            this->inplace_within_range_column<T, RangeType::IncExc>(lower, upper, values, size);            
+            this->inplace_within_range_column<T, RangeType::IncExc, Mode>(lower, upper, values, size);            
         } else if (op == RangeType::ExcInc) {
-            this->inplace_within_range_column<T, RangeType::ExcInc>(lower, upper, values, size);
+            this->inplace_within_range_column<T, RangeType::ExcInc, Mode>(lower, upper, values, size);
         } else if (op == RangeType::ExcExc) {
-            this->inplace_within_range_column<T, RangeType::ExcExc>(lower, upper, values, size);
+            this->inplace_within_range_column<T, RangeType::ExcExc, Mode>(lower, upper, values, size);
         } else {
             // unimplemented
         }            
     }
 
-    template<typename T, RangeType Op>
+    template<typename T, RangeType Op, CombineMode Mode = CombineMode::Store>
     void inplace_within_range_column(
         const T* const __restrict lower,
         const T* const __restrict upper,
@@ -703,7 +803,7 @@ public:
     ) {
         range_checker::le(size, this->size());
 
-        policy_type::template op_within_range_column<T, Op>(
+        policy_type::template op_within_range_column<T, Op, Mode>(
             this->data(),
             this->offset(),
             lower,
@@ -714,7 +814,7 @@ public:
     }
 
     //
-    template<typename T>
+    template<typename T, CombineMode Mode = CombineMode::Store>
     void inplace_within_range_val(
         const T& lower,
         const T& upper,
@@ -723,19 +823,19 @@ public:
         const RangeType op
     ) {
         if (op == RangeType::IncInc) {
-            this->inplace_within_range_val<T, RangeType::IncInc>(lower, upper, values, size);
+            this->inplace_within_range_val<T, RangeType::IncInc, Mode>(lower, upper, values, size);
         } else if (op == RangeType::IncExc) {
-            this->inplace_within_range_val<T, RangeType::IncExc>(lower, upper, values, size);            
+            this->inplace_within_range_val<T, RangeType::IncExc, Mode>(lower, upper, values, size);            
         } else if (op == RangeType::ExcInc) {
-            this->inplace_within_range_val<T, RangeType::ExcInc>(lower, upper, values, size);
+            this->inplace_within_range_val<T, RangeType::ExcInc, Mode>(lower, upper, values, size);
         } else if (op == RangeType::ExcExc) {
-            this->inplace_within_range_val<T, RangeType::ExcExc>(lower, upper, values, size);
+            this->inplace_within_range_val<T, RangeType::ExcExc, Mode>(lower, upper, values, size);
         } else {
             // unimplemented
         }            
     }
 
-    template<typename T, RangeType Op>
+    template<typename T, RangeType Op, CombineMode Mode = CombineMode::Store>
     void inplace_within_range_val(
         const T& lower,
         const T& upper,
@@ -744,7 +844,7 @@ public:
     ) {
         range_checker::le(size, this->size());
 
-        policy_type::template op_within_range_val<T, Op>(
+        policy_type::template op_within_range_val<T, Op, Mode>(
             this->data(),
             this->offset(),
             lower,
@@ -754,8 +854,293 @@ public:
         );
     }
 
-    //
+    // Compare strings with a given value. Strings are stored in the
+    //   Arrow-like layout: `offsets` contains (size + 1) elements, and
+    //   i-th string occupies bytes [offsets[i], offsets[i + 1]) of `data`.
+    // Arrays of std::string and std::string_view are compared using
+    //   inplace_compare_val().
+    template<typename OffsetT, CombineMode Mode = CombineMode::Store>
+    void inplace_compare_string_val(
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const std::string_view value,
+        const CompareOpType op
+    ) {
+        if (op == CompareOpType::EQ) {
+            this->inplace_compare_string_val<OffsetT, CompareOpType::EQ, Mode>(data, offsets, size, value);
+        }
+        else if (op == CompareOpType::GE) {
+            this->inplace_compare_string_val<OffsetT, CompareOpType::GE, Mode>(data, offsets, size, value);
+        }
+        else if (op == CompareOpType::GT) {
+            this->inplace_compare_string_val<OffsetT, CompareOpType::GT, Mode>(data, offsets, size, value);
+        }
+        else if (op == CompareOpType::LE) {
+            this->inplace_compare_string_val<OffsetT, CompareOpType::LE, Mode>(data, offsets, size, value);
+        }
+        else if (op == CompareOpType::LT) {
+            this->inplace_compare_string_val<OffsetT, CompareOpType::LT, Mode>(data, offsets, size, value);
+        }
+        else if (op == CompareOpType::NE) {
+            this->inplace_compare_string_val<OffsetT, CompareOpType::NE, Mode>(data, offsets, size, value);
+        }
+        else {
+            // unimplemented
+        }
+    }
+
+    template<typename OffsetT, CompareOpType Op, CombineMode Mode = CombineMode::Store>
+    void inplace_compare_string_val(
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const std::string_view value
+    ) {
+        range_checker::le(size, this->size());
+
+        policy_type::template op_compare_string_val<detail::StringOffsetsColumn<OffsetT>, Op, Mode>(
+            this->data(),
+            this->offset(),
+            detail::StringOffsetsColumn<OffsetT>{data, offsets},
+            size,
+            value
+        );
+    }
+
+    // Same as inplace_within_range_val(), but for strings in the
+    //   Arrow-like layout, see inplace_compare_string_val().
+    template<typename OffsetT, CombineMode Mode = CombineMode::Store>
+    void inplace_within_range_string_val(
+        const std::string_view lower,
+        const std::string_view upper,
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const RangeType op
+    ) {
+        if (op == RangeType::IncInc) {
+            this->inplace_within_range_string_val<OffsetT, RangeType::IncInc, Mode>(lower, upper, data, offsets, size);
+        } else if (op == RangeType::IncExc) {
+            this->inplace_within_range_string_val<OffsetT, RangeType::IncExc, Mode>(lower, upper, data, offsets, size);
+        } else if (op == RangeType::ExcInc) {
+            this->inplace_within_range_string_val<OffsetT, RangeType::ExcInc, Mode>(lower, upper, data, offsets, size);
+        } else if (op == RangeType::ExcExc) {
+            this->inplace_within_range_string_val<OffsetT, RangeType::ExcExc, Mode>(lower, upper, data, offsets, size);
+        } else {
+            // unimplemented
+        }
+    }
+
+    template<typename OffsetT, RangeType Op, CombineMode Mode = CombineMode::Store>
+    void inplace_within_range_string_val(
+        const std::string_view lower,
+        const std::string_view upper,
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size
+    ) {
+        range_checker::le(size, this->size());
+
+        policy_type::template op_within_range_string_val<detail::StringOffsetsColumn<OffsetT>, Op, Mode>(
+            this->data(),
+            this->offset(),
+            lower,
+            upper,
+            detail::StringOffsetsColumn<OffsetT>{data, offsets},
+            size
+        );
+    }
+
+    // Check whether strings start with a given prefix (SQL LIKE 'abc%').
+    //   Strings are stored in the Arrow-like layout, 
+    //   see inplace_compare_string_val().
+    template<typename OffsetT>
+    void inplace_prefix_match(
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const std::string_view prefix
+    ) {
+        range_checker::le(size, this->size());
+
+        policy_type::template op_prefix_match<detail::StringOffsetsColumn<OffsetT>>(
+            this->data(),
+            this->offset(),
+            detail::StringOffsetsColumn<OffsetT>{data, offsets},
+            size,
+            prefix
+        );
+    }
+
+    // Same, but for arrays of std::string or std::string_view.
     template<typename T>
+    void inplace_prefix_match(
+        const T* const __restrict t,
+        const size_t size,
+        const std::string_view prefix
+    ) {
+        static_assert(detail::is_string_type_v<T>, "strings are expected");
+
+        range_checker::le(size, this->size());
+
+        policy_type::template op_prefix_match<const T*>(
+            this->data(),
+            this->offset(),
+            t,
+            size,
+            prefix
+        );
+    }
+
+    // Nullable columns. A given validity bitmap contains 1 for non-NULL
+    //   elements and 0 for NULL ones (the Arrow convention). A predicate
+    //   is evaluated for all elements and then the validity bitmap is 
+    //   ANDed into the result, so a comparison with NULL is false.
+    template<typename T, typename I, bool R>
+    void inplace_compare_val(
+        const T* const __restrict t,
+        const size_t size,
+        const T& value,
+        const CompareOpType op,
+        const BitsetBase<PolicyT, I, R>& validity
+    ) {
+        this->inplace_apply_validity(validity, size, 
+            [=](auto& chunk, const size_t chunk_start) {
+                chunk.inplace_compare_val(t + chunk_start, chunk.size(), value, op);
+            }
+        );
+    }
+
+    //
+    template<typename T, typename U, typename I, bool R>
+    void inplace_compare_column(
+        const T* const __restrict t,
+        const U* const __restrict u,
+        const size_t size,
+        const CompareOpType op,
+        const BitsetBase<PolicyT, I, R>& validity
+    ) {
+        this->inplace_apply_validity(validity, size, 
+            [=](auto& chunk, const size_t chunk_start) {
+                chunk.inplace_compare_column(t + chunk_start, u + chunk_start, chunk.size(), op);
+            }
+        );
+    }
+
+    //
+    template<typename T, typename I, bool R>
+    void inplace_within_range_column(
+        const T* const __restrict lower,
+        const T* const __restrict upper,
+        const T* const __restrict values,
+        const size_t size,
+        const RangeType op,
+        const BitsetBase<PolicyT, I, R>& validity
+    ) {
+        this->inplace_apply_validity(validity, size, 
+            [=](auto& chunk, const size_t chunk_start) {
+                chunk.inplace_within_range_column(
+                    lower + chunk_start, upper + chunk_start, values + chunk_start, chunk.size(), op
+                );
+            }
+        );
+    }
+
+    //
+    template<typename T, typename I, bool R>
+    void inplace_within_range_val(
+        const T& lower,
+        const T& upper,
+        const T* const __restrict values,
+        const size_t size,
+        const RangeType op,
+        const BitsetBase<PolicyT, I, R>& validity
+    ) {
+        this->inplace_apply_validity(validity, size, 
+            [=](auto& chunk, const size_t chunk_start) {
+                chunk.inplace_within_range_val(lower, upper, values + chunk_start, chunk.size(), op);
+            }
+        );
+    }
+
+    //
+    template<typename OffsetT, typename I, bool R>
+    void inplace_compare_string_val(
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const std::string_view value,
+        const CompareOpType op,
+        const BitsetBase<PolicyT, I, R>& validity
+    ) {
+        this->inplace_apply_validity(validity, size, 
+            [=](auto& chunk, const size_t chunk_start) {
+                chunk.inplace_compare_string_val(data, offsets + chunk_start, chunk.size(), value, op);
+            }
+        );
+    }
+
+    //
+    template<typename OffsetT, typename I, bool R>
+    void inplace_within_range_string_val(
+        const std::string_view lower,
+        const std::string_view upper,
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const RangeType op,
+        const BitsetBase<PolicyT, I, R>& validity
+    ) {
+        this->inplace_apply_validity(validity, size, 
+            [=](auto& chunk, const size_t chunk_start) {
+                chunk.inplace_within_range_string_val(
+                    lower, upper, data, offsets + chunk_start, chunk.size(), op
+                );
+            }
+        );
+    }
+
+    // SQL IS NULL, see the validity bitmap convention above.
+    template<typename I, bool R>
+    void inplace_is_null(const BitsetBase<PolicyT, I, R>& validity, const size_t size) {
+        range_checker::le(size, this->size());
+        range_checker::le(size, validity.size());
+
+        policy_type::op_copy(validity.data(), validity.offset(), this->data(), this->offset(), size);
+        policy_type::op_flip(this->data(), this->offset(), size);
+    }
+
+    // SQL IS NOT NULL, see the validity bitmap convention above.
+    template<typename I, bool R>
+    void inplace_is_not_null(const BitsetBase<PolicyT, I, R>& validity, const size_t size) {
+        range_checker::le(size, this->size());
+        range_checker::le(size, validity.size());
+
+        policy_type::op_copy(validity.data(), validity.offset(), this->data(), this->offset(), size);
+    }
+
+    // Evaluates a conjunction of predicates (see predicates.h) for 
+    //   rows [0, size), such as
+    //   inplace_conjunction(size, compare_val(a, x, GT), within_range_val(y, z, b, IncInc)).
+    // Rows are processed in blocks, all predicates are applied to a block
+    //   before moving to the next one, and the rest of predicates are 
+    //   skipped once a block becomes all-zero. 
+    // Predicates may be nested using all_of() and any_of().
+    template<typename... PredicatesT>
+    void inplace_conjunction(const size_t size, const PredicatesT&... predicates) {
+        this->inplace_predicates<CombineMode::And>(size, predicates...);
+    }
+
+    // Same as inplace_conjunction(), but for a disjunction of predicates.
+    //   The rest of predicates are skipped once a block becomes all-one.
+    template<typename... PredicatesT>
+    void inplace_disjunction(const size_t size, const PredicatesT&... predicates) {
+        this->inplace_predicates<CombineMode::Or>(size, predicates...);
+    }
+
+    //
+    template<typename T, CombineMode Mode = CombineMode::Store>
     void inplace_arith_compare(
         const T* const __restrict src,
         const ArithHighPrecisionType<T>& right_operand,
@@ -766,81 +1151,81 @@ public:
     ) {
         if (a_op == ArithOpType::Add) {
             if (cmp_op == CompareOpType::EQ) {
-                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::EQ>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::EQ, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GE) {
-                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::GE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::GE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GT) {
-                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::GT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::GT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LE) {
-                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::LE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::LE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LT) {
-                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::LT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::LT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::NE) {
-                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::NE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Add, CompareOpType::NE, Mode>(src, right_operand, value, size);
             } else {
                 // unimplemented
             }
         } else if (a_op == ArithOpType::Sub) {
             if (cmp_op == CompareOpType::EQ) {
-                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::EQ>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::EQ, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GE) {
-                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::GE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::GE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GT) {
-                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::GT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::GT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LE) {
-                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::LE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::LE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LT) {
-                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::LT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::LT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::NE) {
-                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::NE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Sub, CompareOpType::NE, Mode>(src, right_operand, value, size);
             } else {
                 // unimplemented
             }
         } else if (a_op == ArithOpType::Mul) {
             if (cmp_op == CompareOpType::EQ) {
-                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::EQ>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::EQ, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GE) {
-                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::GE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::GE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GT) {
-                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::GT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::GT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LE) {
-                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::LE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::LE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LT) {
-                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::LT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::LT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::NE) {
-                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::NE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mul, CompareOpType::NE, Mode>(src, right_operand, value, size);
             } else {
                 // unimplemented
             }
         } else if (a_op == ArithOpType::Div) {
             if (cmp_op == CompareOpType::EQ) {
-                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::EQ>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::EQ, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GE) {
-                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::GE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::GE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GT) {
-                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::GT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::GT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LE) {
-                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::LE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::LE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LT) {
-                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::LT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::LT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::NE) {
-                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::NE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Div, CompareOpType::NE, Mode>(src, right_operand, value, size);
             } else {
                 // unimplemented
             }
         } else if (a_op == ArithOpType::Mod) {
             if (cmp_op == CompareOpType::EQ) {
-                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::EQ>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::EQ, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GE) {
-                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::GE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::GE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::GT) {
-                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::GT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::GT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LE) {
-                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::LE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::LE, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::LT) {
-                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::LT>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::LT, Mode>(src, right_operand, value, size);
             } else if (cmp_op == CompareOpType::NE) {
-                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::NE>(src, right_operand, value, size);
+                this->inplace_arith_compare<T, ArithOpType::Mod, CompareOpType::NE, Mode>(src, right_operand, value, size);
             } else {
                 // unimplemented
             }
@@ -849,7 +1234,7 @@ public:
         }
     }
 
-    template<typename T, ArithOpType AOp, CompareOpType CmpOp>
+    template<typename T, ArithOpType AOp, CompareOpType CmpOp, CombineMode Mode = CombineMode::Store>
     void inplace_arith_compare(
         const T* const __restrict src,
         const ArithHighPrecisionType<T>& right_operand,
@@ -858,7 +1243,7 @@ public:
     ) {
         range_checker::le(size, this->size());
 
-        policy_type::template op_arith_compare<T, AOp, CmpOp>(
+        policy_type::template op_arith_compare<T, AOp, CmpOp, Mode>(
             this->data(),
             this->offset(),
             src,
@@ -868,6 +1253,19 @@ public:
         );
     }
 
+    // Evaluate an expression, such as (a & b) | c, into this bitset.
+    //   A given expression is expected to have the same size.
+    template<BitwiseOpType Op, typename LeftT, typename RightT>
+    void inplace_assign(const BitsetExpr<Op, LeftT, RightT>& expr) {
+        static_assert(std::is_same_v<PolicyT, typename BitsetExpr<Op, LeftT, RightT>::policy_type>);
+        range_checker::eq(expr.size(), this->size());
+
+        expr.for_each_block([this](const data_type* const block, const size_t block_start, const size_t block_size) {
+            policy_type::op_copy(block, 0, this->data(), this->offset() + block_start, block_size);
+            return true;
+        });
+    }
+
     //
     // Inplace and. Also, counts the number of active bits.
     template<typename I, bool R>
@@ -901,6 +1299,54 @@ public:
 
 
 private:
+    //
+    template<CombineMode ListMode, typename... PredicatesT>
+    void inplace_predicates(const size_t size, const PredicatesT&... predicates) {
+        static_assert(sizeof...(PredicatesT) > 0, "at least one predicate is expected");
+
+        range_checker::le(size, this->size());
+
+        for (size_t offset = 0; offset < size; offset += detail::PREDICATE_BLOCK_BITS) {
+            const size_t block_size = std::min(detail::PREDICATE_BLOCK_BITS, size - offset);
+
+            auto block = this->view(offset, block_size);
+            detail::evaluate_predicates<CombineMode::Store, ListMode>(block, offset, predicates...);
+        }
+    }
+
+    // The number of bits, which are evaluated before a validity bitmap
+    //   is applied to them. The produced bits are still in L1 cache 
+    //   when they are ANDed with the validity bitmap.
+    static constexpr size_t VALIDITY_CHUNK_BITS = 4096;
+
+    // Calls func(BitsetView& chunk, const size_t chunk_start) for 
+    //   consecutive chunks of [0, size) and ANDs every chunk
+    //   with a given validity bitmap right after it was produced.
+    template<typename I, bool R, typename FuncT>
+    void inplace_apply_validity(
+        const BitsetBase<PolicyT, I, R>& validity, 
+        const size_t size, 
+        FuncT func
+    ) {
+        range_checker::le(size, this->size());
+        range_checker::le(size, validity.size());
+
+        for (size_t chunk_start = 0; chunk_start < size; chunk_start += VALIDITY_CHUNK_BITS) {
+            const size_t chunk_size = std::min(VALIDITY_CHUNK_BITS, size - chunk_start);
+
+            auto chunk = this->view(chunk_start, chunk_size);
+            func(chunk, chunk_start);
+
+            policy_type::op_and(
+                this->data(),
+                validity.data(),
+                this->offset() + chunk_start,
+                validity.offset() + chunk_start,
+                chunk_size
+            );
+        }
+    }
+
     // Return the starting bit offset in our container.
     inline size_t offset() const {
         return as_derived().offset_impl();
@@ -946,6 +1392,13 @@ public:
     BitsetView(void* data, const size_t offset, const size_t size) :
         Data{reinterpret_cast<data_type*>(data)}, Size{size}, Offset{offset} {}
 
+    // Evaluate an expression into the referenced bits.
+    template<BitwiseOpType Op, typename LeftT, typename RightT>
+    BitsetView& operator =(const BitsetExpr<Op, LeftT, RightT>& expr) {
+        this->inplace_assign(expr);
+        return *this;
+    }
+
 private:
     // the referenced bits are [Offset, Offset + Size)
     data_type* Data = nullptr;
@@ -1017,6 +1470,22 @@ public:
         );
     }
 
+    // Evaluate an expression, such as (a & b) | c.
+    template<BitwiseOpType Op, typename LeftT, typename RightT>
+    Bitset(const BitsetExpr<Op, LeftT, RightT>& expr) : 
+        Data(get_required_size_in_container_elements(expr.size())), Size{expr.size()} 
+    {
+        this->inplace_assign(expr);
+    }
+
+    // Evaluate an expression. The bitset is resized to its size.
+    template<BitwiseOpType Op, typename LeftT, typename RightT>
+    Bitset& operator =(const BitsetExpr<Op, LeftT, RightT>& expr) {
+        this->resize(expr.size());
+        this->inplace_assign(expr);
+        return *this;
+    }
+
     // Clone a current bitset (Rust style).
     Bitset clone() const {
         Bitset cloned;
@@ -1091,26 +1560,6 @@ public:
         Data.reserve(capacity_in_container_elements);
     }
 
-    // Return a new bitset, equal to a | b
-    template<typename I1, bool R1, typename I2, bool R2>
-    friend Bitset operator|(
-        const BitsetBase<PolicyT, I1, R1>& a, 
-        const BitsetBase<PolicyT, I2, R2>& b
-    ) {
-        Bitset clone(a);
-        return std::move(clone |= b);
-    }
-
-    // Return a new bitset, equal to a - b
-    template<typename I1, bool R1, typename I2, bool R2>
-    friend Bitset operator-(
-        const BitsetBase<PolicyT, I1, R1>& a, 
-        const BitsetBase<PolicyT, I2, R2>& b
-    ) {
-        Bitset clone(a);
-        return std::move(clone -= b);
-    }
-
 protected:
     // the container
     container_type Data;
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <type_traits>
 
 namespace milvus {
@@ -91,6 +92,55 @@ struct RangeOperator {
     }
 };
 
+// v IN (a, b, ...) or v NOT IN (a, b, ...)
+enum class InValuesType {
+    In,
+    NotIn
+};
+
+// How the result of a predicate is merged into the existing bits:
+//   bits = pred, bits &= pred, bits |= pred or bits &= ~pred.
+// Allows to evaluate multi-predicate filters without temporary bitsets.
+enum class CombineMode {
+    Store,
+    And,
+    Or,
+    AndNot
+};
+
+template<CombineMode Mode>
+struct CombineOperator {
+    template<typename T>
+    static inline T combine(const T& dst, const T& src) {
+        if constexpr (Mode == CombineMode::Store) {
+            return src;
+        } else if constexpr (Mode == CombineMode::And) {
+            return (dst & src);
+        } else if constexpr (Mode == CombineMode::Or) {
+            return (dst | src);
+        } else if constexpr (Mode == CombineMode::AndNot) {
+            if constexpr (std::is_same_v<T, bool>) {
+                return (dst && !src);
+            } else {
+                return (dst & T(~src));
+            }
+        } else {
+            // unimplemented
+            static_assert(always_false_v<T>, "unimplemented");
+        }
+    }
+};
+
+// Truth tables for inplace_ternary(), which computes a = f(a, b, c).
+//   A truth table follows the convention of vpternlog: bit
+//   ((a << 2) | (b << 1) | c) is the result for given bits of a, b, c.
+//   So, a truth table for any function can be written using the
+//   following constants, for example,
+//   `TERNARY_A & (TERNARY_B | ~TERNARY_C)` for a & (b | ~c).
+constexpr uint8_t TERNARY_A = 0xF0;
+constexpr uint8_t TERNARY_B = 0xCC;
+constexpr uint8_t TERNARY_C = 0xAA;
+
 //
 template<RangeType Op>
 struct Range2Compare {
@@ -111,9 +161,14 @@ enum class ArithOpType {
     Mod
 };
 
+// Integer types up to 32 bits are evaluated exactly using int64_t.
+// uint64_t does not fit into int64_t, so it uses the modular arithmetic 
+//   of uint64_t, similar to the C++ semantics.
 template<typename T>
 using ArithHighPrecisionType = 
-    std::conditional_t<std::is_integral_v<T> && !std::is_same_v<bool, T>, int64_t, T>;
+    std::conditional_t<std::is_integral_v<T> && !std::is_same_v<bool, T>, 
+        std::conditional_t<std::is_same_v<uint64_t, T>, uint64_t, int64_t>, 
+        T>;
 
 template<ArithOpType AOp, CompareOpType CmpOp>
 struct ArithCompareOperator {
@@ -128,7 +183,23 @@ struct ArithCompareOperator {
         } else if constexpr (AOp == ArithOpType::Div) {
             return CompareOperator<CmpOp>::compare(left / right, value);
         } else if constexpr (AOp == ArithOpType::Mod) {
-            return CompareOperator<CmpOp>::compare(fmod(left, right), value);
+            if constexpr (std::is_integral_v<T>) {
+                // fmod() is not exact for large 64-bit values.
+                // Division by zero is kept as fmod(), which produces NaN.
+                if (right == 0) {
+                    return CompareOperator<CmpOp>::compare(fmod(left, right), value);
+                }
+                // -1 is handled separately to avoid INT64_MIN % -1 overflow
+                if constexpr (std::is_signed_v<ArithHighPrecisionType<T>>) {
+                    if (right == -1) {
+                        return CompareOperator<CmpOp>::compare(ArithHighPrecisionType<T>(0), value);
+                    }
+                }
+
+                return CompareOperator<CmpOp>::compare(left % right, value);
+            } else {
+                return CompareOperator<CmpOp>::compare(fmod(left, right), value);
+            }
         } else {
             // unimplemented
             static_assert(always_false_v<T>, "unimplemented");
@@ -136,6 +207,46 @@ struct ArithCompareOperator {
     }
 };
 
+// Checks whether `left AOp right ?? value` can be computed using type U
+//   instead of ArithHighPrecisionType<T> for every possible `left` of type T,
+//   which allows SIMD code to use narrow lanes. Add, Sub and Mul are supported.
+template<typename T, typename U>
+struct ArithNarrowing {
+    static_assert(std::is_integral_v<T> && std::is_integral_v<U>);
+    static_assert(sizeof(T) < sizeof(U) && sizeof(U) < sizeof(int64_t));
+
+    template<ArithOpType AOp>
+    static inline bool fits(const ArithHighPrecisionType<T>& right, const ArithHighPrecisionType<T>& value) {
+        constexpr int64_t t_min = std::numeric_limits<T>::min();
+        constexpr int64_t t_max = std::numeric_limits<T>::max();
+        constexpr int64_t u_min = std::numeric_limits<U>::min();
+        constexpr int64_t u_max = std::numeric_limits<U>::max();
+
+        if (value < u_min || value > u_max) {
+            return false;
+        }
+
+        if constexpr (AOp == ArithOpType::Add) {
+            // [t_min + right, t_max + right]
+            return (right >= u_min - t_min) && (right <= u_max - t_max);
+        } else if constexpr (AOp == ArithOpType::Sub) {
+            // [t_min - right, t_max - right]
+            return (right >= t_max - u_max) && (right <= t_min - u_min);
+        } else if constexpr (AOp == ArithOpType::Mul) {
+            // this also prevents an overflow of int64_t below
+            if (right < u_min || right > u_max) {
+                return false;
+            }
+
+            const int64_t r0 = t_min * right;
+            const int64_t r1 = t_max * right;
+            return (r0 >= u_min) && (r0 <= u_max) && (r1 >= u_min) && (r1 <= u_max);
+        } else {
+            return false;
+        }
+    }
+};
+
 // This is related for a special handling of A/B vs C comparison.
 //   A multiplication operation is used instead of a division,
 //   and it is needed to invert signs and change comparison operators
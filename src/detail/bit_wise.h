@@ -3,8 +3,11 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <string_view>
 
+#include "in_values.h"
 #include "proxy.h"
+#include "string_column.h"
 
 namespace milvus {
 namespace bitset {
@@ -57,6 +60,21 @@ struct BitWiseBitsetPolicy {
         return const_proxy_type{element, shift};
     }
 
+    // Writes a single bit, merging it with the existing one.
+    template<CombineMode Mode>
+    static inline void op_write_bit(
+        data_type* const __restrict data, 
+        const size_t idx,
+        const bool value
+    ) {
+        auto proxy = get_proxy(data, idx);
+        if constexpr (Mode == CombineMode::Store) {
+            proxy = value;
+        } else {
+            proxy = CombineOperator<Mode>::combine(bool(proxy), value);
+        }
+    }
+
     static inline data_type op_read(
         const data_type* const data,
         const size_t start,
@@ -320,6 +338,29 @@ struct BitWiseBitsetPolicy {
         }
     }
 
+    template<uint8_t TruthTable>
+    static inline void op_ternary(
+        data_type* const left,
+        const data_type* const b,
+        const data_type* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size
+    ) {
+        // todo: check if intersect
+
+        for (size_t i = 0; i < size; i++) {
+            auto proxy_left = get_proxy(left, start_left + i);
+            const bool bit_b = get_proxy(b, start_b + i);
+            const bool bit_c = get_proxy(c, start_c + i);
+
+            const size_t idx =
+                ((proxy_left ? 1 : 0) << 2) | ((bit_b ? 1 : 0) << 1) | (bit_c ? 1 : 0);
+            proxy_left = ((TruthTable >> idx) & 1) != 0;
+        }
+    }
+
     //
     static inline std::optional<size_t> op_find(
         const data_type* const data, 
@@ -339,7 +380,7 @@ struct BitWiseBitsetPolicy {
     }
 
     //
-    template<typename T, typename U, CompareOpType Op>
+    template<typename T, typename U, CompareOpType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_compare_column(
         data_type* const __restrict data, 
         const size_t start,
@@ -348,12 +389,12 @@ struct BitWiseBitsetPolicy {
         const size_t size
     ) {
         for (size_t i = 0; i < size; i++) {
-            get_proxy(data, start + i) = CompareOperator<Op>::compare(t[i], u[i]);
+            op_write_bit<Mode>(data, start + i, CompareOperator<Op>::compare(t[i], u[i]));
         }
     }
 
     //
-    template<typename T, CompareOpType Op>
+    template<typename T, CompareOpType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_compare_val(
         data_type* const __restrict data, 
         const size_t start,
@@ -362,11 +403,55 @@ struct BitWiseBitsetPolicy {
         const T& value
     ) {
         for (size_t i = 0; i < size; i++) {
-            get_proxy(data, start + i) = CompareOperator<Op>::compare(t[i], value);
+            op_write_bit<Mode>(data, start + i, CompareOperator<Op>::compare(t[i], value));
+        }
+    }
+
+    //
+    template<typename T, InValuesType Op>
+    static inline void op_in_values(
+        data_type* const __restrict data, 
+        const size_t start,
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        for (size_t i = 0; i < size; i++) {
+            const bool found = in_values_linear(t[i], values, n_values);
+            get_proxy(data, start + i) = (Op == InValuesType::In) ? found : !found;
         }
     }
 
-    template<typename T, RangeType Op>
+    //
+    template<typename ColumnT, CompareOpType Op, CombineMode Mode = CombineMode::Store>
+    static inline void op_compare_string_val(
+        data_type* const __restrict data, 
+        const size_t start,
+        const ColumnT column,
+        const size_t size,
+        const std::string_view value
+    ) {
+        for (size_t i = 0; i < size; i++) {
+            op_write_bit<Mode>(data, start + i, CompareOperator<Op>::compare(std::string_view(column[i]), value));
+        }
+    }
+
+    //
+    template<typename ColumnT>
+    static inline void op_prefix_match(
+        data_type* const __restrict data, 
+        const size_t start,
+        const ColumnT column,
+        const size_t size,
+        const std::string_view prefix
+    ) {
+        for (size_t i = 0; i < size; i++) {
+            get_proxy(data, start + i) = string_starts_with(std::string_view(column[i]), prefix);
+        }
+    }
+
+    template<typename T, RangeType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_within_range_column(
         data_type* const __restrict data, 
         const size_t start,
@@ -376,12 +461,12 @@ struct BitWiseBitsetPolicy {
         const size_t size
     ) {
         for (size_t i = 0; i < size; i++) {
-            get_proxy(data, start + i) = RangeOperator<Op>::within_range(lower[i], upper[i], values[i]);
+            op_write_bit<Mode>(data, start + i, RangeOperator<Op>::within_range(lower[i], upper[i], values[i]));
         }
     }
 
     //
-    template<typename T, RangeType Op>
+    template<typename T, RangeType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_within_range_val(
         data_type* const __restrict data, 
         const size_t start,
@@ -391,12 +476,27 @@ struct BitWiseBitsetPolicy {
         const size_t size
     ) {
         for (size_t i = 0; i < size; i++) {
-            get_proxy(data, start + i) = RangeOperator<Op>::within_range(lower, upper, values[i]);
+            op_write_bit<Mode>(data, start + i, RangeOperator<Op>::within_range(lower, upper, values[i]));
+        }
+    }
+
+    //
+    template<typename ColumnT, RangeType Op, CombineMode Mode = CombineMode::Store>
+    static inline void op_within_range_string_val(
+        data_type* const __restrict data, 
+        const size_t start,
+        const std::string_view lower,
+        const std::string_view upper,
+        const ColumnT column,
+        const size_t size
+    ) {
+        for (size_t i = 0; i < size; i++) {
+            op_write_bit<Mode>(data, start + i, RangeOperator<Op>::within_range(lower, upper, std::string_view(column[i])));
         }
     }
 
     //
-    template<typename T,  ArithOpType AOp, CompareOpType CmpOp>
+    template<typename T, ArithOpType AOp, CompareOpType CmpOp, CombineMode Mode = CombineMode::Store>
     static inline void op_arith_compare(
         data_type* const __restrict data, 
         const size_t start,
@@ -406,7 +506,7 @@ struct BitWiseBitsetPolicy {
         const size_t size
     ) {
         for (size_t i = 0; i < size; i++) {
-            get_proxy(data, start + i) = ArithCompareOperator<AOp, CmpOp>::compare(src[i], right_operand, value);
+            op_write_bit<Mode>(data, start + i, ArithCompareOperator<AOp, CmpOp>::compare(src[i], right_operand, value));
         }
     }
 
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstdint>
+
+namespace milvus {
+namespace bitset {
+namespace detail {
+
+// A signed 64-bit divisor, which is known in advance. This allows to
+//   replace a division with a multiplication by a magic number and
+//   shifts. The result matches the C++ truncating division.
+// The math is borrowed from https://github.com/ridiculousfish/libdivide
+//
+// SIMD code uses the fields as follows:
+// * if magic == 0, then the divisor is +-2^shift:
+//     q = (x + ((x >> 63) & mask)) >> shift;
+//     q = negative ? -q : q;
+// * otherwise:
+//     q = mulhi(x, magic);
+//     q += add ? (negative ? -x : x) : 0;
+//     q >>= shift;
+//     q += (q < 0);
+// All shifts are arithmetic ones.
+struct DivisorI64 {
+    int64_t divisor = 0;
+    int64_t magic = 0;
+    uint32_t shift = 0;
+    bool add = false;
+    bool negative = false;
+
+    // divisor must not be 0
+    explicit DivisorI64(const int64_t d) : divisor{d} {
+        const uint64_t ud = static_cast<uint64_t>(d);
+        const uint64_t abs_d = (d < 0) ? (0 - ud) : ud;
+        const uint32_t floor_log_2_d = 63 - __builtin_clzll(abs_d);
+
+        negative = (d < 0);
+
+        if ((abs_d & (abs_d - 1)) == 0) {
+            // a power of 2
+            magic = 0;
+            shift = floor_log_2_d;
+            return;
+        }
+
+        // 2^(63 + floor_log_2_d) / abs_d
+        const unsigned __int128 numer =
+            (static_cast<unsigned __int128>(1) << (63 + floor_log_2_d));
+        uint64_t proposed_m = static_cast<uint64_t>(numer / abs_d);
+        const uint64_t rem = static_cast<uint64_t>(numer % abs_d);
+
+        const uint64_t e = abs_d - rem;
+        if (e < (uint64_t(1) << floor_log_2_d)) {
+            // this power works
+            shift = floor_log_2_d - 1;
+        } else {
+            // need to use the 65-bit multiplier
+            proposed_m += proposed_m;
+            const uint64_t twice_rem = rem + rem;
+            if (twice_rem >= abs_d || twice_rem < rem) {
+                proposed_m += 1;
+            }
+
+            shift = floor_log_2_d;
+            add = true;
+        }
+
+        proposed_m += 1;
+        magic = static_cast<int64_t>(proposed_m);
+        if (negative) {
+            magic = static_cast<int64_t>(0 - proposed_m);
+        }
+    }
+
+    // a scalar reference
+    inline int64_t divide(const int64_t x) const {
+        if (magic == 0) {
+            const uint64_t mask = (uint64_t(1) << shift) - 1;
+            const int64_t q = static_cast<int64_t>(
+                static_cast<uint64_t>(x) + (static_cast<uint64_t>(x >> 63) & mask)) >> shift;
+            return negative ? static_cast<int64_t>(0 - static_cast<uint64_t>(q)) : q;
+        } else {
+            uint64_t uq = static_cast<uint64_t>(
+                (static_cast<__int128>(x) * static_cast<__int128>(magic)) >> 64);
+            if (add) {
+                uq += negative ? (0 - static_cast<uint64_t>(x)) : static_cast<uint64_t>(x);
+            }
+
+            int64_t q = static_cast<int64_t>(uq) >> shift;
+            q += (q < 0);
+            return q;
+        }
+    }
+};
+
+}
+}
+}
@@ -1,12 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <optional>
+#include <string_view>
 #include <type_traits>
 
 #include "proxy.h"
 #include "element_wise.h"
+#include "string_column.h"
 
 namespace milvus {
 namespace bitset {
@@ -162,6 +167,11 @@ struct VectorizedElementWiseBitsetPolicy {
         const size_t start, 
         const size_t size
     ) {
+        size_t count = 0;
+        if (VectorizedT::template forward_op_count<ElementT>(data, start, size, count)) {
+            return count;
+        }
+
         return ElementWiseBitsetPolicy<ElementT>::op_count(data, start, size);
     }
 
@@ -199,6 +209,21 @@ struct VectorizedElementWiseBitsetPolicy {
         }
     }
 
+    template<uint8_t TruthTable>
+    static inline void op_ternary(
+        data_type* const left,
+        const data_type* const b,
+        const data_type* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size
+    ) {
+        if (!VectorizedT::template forward_op_ternary<ElementT>(left, b, c, start_left, start_b, start_c, size, TruthTable)) {
+            ElementWiseBitsetPolicy<ElementT>::template op_ternary<TruthTable>(left, b, c, start_left, start_b, start_c, size);
+        }
+    }
+
     static void op_fill(
         data_type* const data,
         const size_t start,
@@ -218,11 +243,16 @@ struct VectorizedElementWiseBitsetPolicy {
         const size_t starting_idx,
         const bool is_set
     ) {
+        std::optional<size_t> result;
+        if (VectorizedT::template forward_op_find<ElementT>(data, start, size, starting_idx, is_set, result)) {
+            return result;
+        }
+
         return ElementWiseBitsetPolicy<ElementT>::op_find(data, start, size, starting_idx, is_set);
     }
 
     //
-    template<typename T, typename U, CompareOpType Op>
+    template<typename T, typename U, CompareOpType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_compare_column(
         data_type* const __restrict data, 
         const size_t start,
@@ -230,9 +260,9 @@ struct VectorizedElementWiseBitsetPolicy {
         const U* const __restrict u,
         const size_t size
     ) {
-        op_func(start, size, 
+        op_func<Mode>(data, start, size, 
             [data, t, u](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
-                ElementWiseBitsetPolicy<ElementT>::template op_compare_column<T, U, Op>(
+                ElementWiseBitsetPolicy<ElementT>::template op_compare_column<T, U, Op, Mode>(
                     data, 
                     starting_bit, 
                     t + ptr_offset,
@@ -240,9 +270,9 @@ struct VectorizedElementWiseBitsetPolicy {
                     nbits
                 );
             },
-            [data, t, u](const size_t starting_element, const size_t ptr_offset, const size_t nbits){
+            [t, u](data_type* const dst, const size_t ptr_offset, const size_t nbits){
                 return VectorizedT::template op_compare_column<T, U, Op>(
-                    reinterpret_cast<uint8_t*>(data + starting_element),
+                    reinterpret_cast<uint8_t*>(dst),
                     t + ptr_offset,
                     u + ptr_offset,
                     nbits
@@ -252,7 +282,7 @@ struct VectorizedElementWiseBitsetPolicy {
     }
 
     //
-    template<typename T, CompareOpType Op>
+    template<typename T, CompareOpType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_compare_val(
         data_type* const __restrict data, 
         const size_t start,
@@ -260,9 +290,14 @@ struct VectorizedElementWiseBitsetPolicy {
         const size_t size,
         const T& value
     ) {
-        op_func(start, size, 
+        if constexpr (is_string_type_v<T>) {
+            op_compare_string_val<const T*, Op, Mode>(data, start, t, size, std::string_view(value));
+            return;
+        }
+
+        op_func<Mode>(data, start, size, 
             [data, t, value](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
-                ElementWiseBitsetPolicy<ElementT>::template op_compare_val<T, Op>(
+                ElementWiseBitsetPolicy<ElementT>::template op_compare_val<T, Op, Mode>(
                     data, 
                     starting_bit, 
                     t + ptr_offset,
@@ -270,9 +305,9 @@ struct VectorizedElementWiseBitsetPolicy {
                     value
                 );
             },
-            [data, t, value](const size_t starting_element, const size_t ptr_offset, const size_t nbits){
+            [t, value](data_type* const dst, const size_t ptr_offset, const size_t nbits){
                 return VectorizedT::template op_compare_val<T, Op>(
-                    reinterpret_cast<uint8_t*>(data + starting_element),
+                    reinterpret_cast<uint8_t*>(dst),
                     t + ptr_offset,
                     nbits,
                     value
@@ -281,8 +316,119 @@ struct VectorizedElementWiseBitsetPolicy {
         );
     }
 
+    // Strings are compared using their 8-byte prefixes, which are
+    //   compared as integers by SIMD code. Full strings are compared
+    //   only for rows whose prefix is equal to the prefix of a value.
+    template<typename ColumnT, CompareOpType Op, CombineMode Mode = CombineMode::Store>
+    static inline void op_compare_string_val(
+        data_type* const __restrict data, 
+        const size_t start,
+        const ColumnT column,
+        const size_t size,
+        const std::string_view value
+    ) {
+        op_func<Mode>(data, start, size, 
+            [data, column, value](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
+                ElementWiseBitsetPolicy<ElementT>::template op_compare_string_val<ColumnT, Op, Mode>(
+                    data, 
+                    starting_bit, 
+                    column + ptr_offset,
+                    nbits, 
+                    value
+                );
+            },
+            [column, value](data_type* const dst, const size_t ptr_offset, const size_t nbits){
+                return op_string_prefix_impl<ColumnT>(
+                    reinterpret_cast<uint8_t*>(dst),
+                    column + ptr_offset,
+                    nbits,
+                    [value](const uint64_t* const prefixes, const auto& block, const size_t nrows, uint64_t& mask) {
+                        return op_string_prefix_mask<Op>(prefixes, block, nrows, value, mask);
+                    }
+                );
+            }
+        );
+    }
+
+    // Only the Arrow-like layout has SIMD kernels.
+    template<typename ColumnT>
+    static inline void op_prefix_match(
+        data_type* const __restrict data, 
+        const size_t start,
+        const ColumnT column,
+        const size_t size,
+        const std::string_view prefix
+    ) {
+        op_func(data, start, size, 
+            [data, column, prefix](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
+                ElementWiseBitsetPolicy<ElementT>::template op_prefix_match<ColumnT>(
+                    data, 
+                    starting_bit, 
+                    column + ptr_offset,
+                    nbits, 
+                    prefix
+                );
+            },
+            [column, prefix](data_type* const dst, const size_t ptr_offset, const size_t nbits){
+                if constexpr (is_string_offsets_column_v<ColumnT>) {
+                    return VectorizedT::template op_prefix_match<typename ColumnT::offset_type>(
+                        reinterpret_cast<uint8_t*>(dst),
+                        column.data,
+                        column.offsets + ptr_offset,
+                        nbits,
+                        prefix.data(),
+                        prefix.size()
+                    );
+                } else {
+                    return false;
+                }
+            }
+        );
+    }
+
     //
-    template<typename T, RangeType Op>
+    template<typename T, InValuesType Op>
+    static inline void op_in_values(
+        data_type* const __restrict data, 
+        const size_t start,
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        // large sets of values are sorted once for the whole range
+        if (n_values > IN_VALUES_MAX_BROADCAST) {
+            ElementWiseBitsetPolicy<ElementT>::template op_in_values<T, Op>(
+                data, start, t, size, values, n_values
+            );
+            return;
+        }
+
+        op_func(data, start, size, 
+            [data, t, values, n_values](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
+                ElementWiseBitsetPolicy<ElementT>::template op_in_values<T, Op>(
+                    data, 
+                    starting_bit, 
+                    t + ptr_offset,
+                    nbits, 
+                    values,
+                    n_values
+                );
+            },
+            [t, values, n_values](data_type* const dst, const size_t ptr_offset, const size_t nbits){
+                return VectorizedT::template op_in_values<T, Op>(
+                    reinterpret_cast<uint8_t*>(dst),
+                    t + ptr_offset,
+                    nbits,
+                    values,
+                    n_values
+                );
+            }
+        );
+    }
+
+    //
+    template<typename T, RangeType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_within_range_column(
         data_type* const __restrict data, 
         const size_t start,
@@ -291,9 +437,9 @@ struct VectorizedElementWiseBitsetPolicy {
         const T* const __restrict values,
         const size_t size
     ) {
-        op_func(start, size, 
+        op_func<Mode>(data, start, size, 
             [data, lower, upper, values](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
-                ElementWiseBitsetPolicy<ElementT>::template op_within_range_column<T, Op>(
+                ElementWiseBitsetPolicy<ElementT>::template op_within_range_column<T, Op, Mode>(
                     data, 
                     starting_bit, 
                     lower + ptr_offset, 
@@ -302,9 +448,9 @@ struct VectorizedElementWiseBitsetPolicy {
                     nbits
                 );
             },
-            [data, lower, upper, values](const size_t starting_element, const size_t ptr_offset, const size_t nbits){
+            [lower, upper, values](data_type* const dst, const size_t ptr_offset, const size_t nbits){
                 return VectorizedT::template op_within_range_column<T, Op>(
-                    reinterpret_cast<uint8_t*>(data + starting_element),
+                    reinterpret_cast<uint8_t*>(dst),
                     lower + ptr_offset,
                     upper + ptr_offset,
                     values + ptr_offset,
@@ -315,7 +461,7 @@ struct VectorizedElementWiseBitsetPolicy {
     }
 
     //
-    template<typename T, RangeType Op>
+    template<typename T, RangeType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_within_range_val(
         data_type* const __restrict data, 
         const size_t start,
@@ -324,9 +470,16 @@ struct VectorizedElementWiseBitsetPolicy {
         const T* const __restrict values,
         const size_t size
     ) {
-        op_func(start, size, 
+        if constexpr (is_string_type_v<T>) {
+            op_within_range_string_val<const T*, Op, Mode>(
+                data, start, std::string_view(lower), std::string_view(upper), values, size
+            );
+            return;
+        }
+
+        op_func<Mode>(data, start, size, 
             [data, lower, upper, values](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
-                ElementWiseBitsetPolicy<ElementT>::template op_within_range_val<T, Op>(
+                ElementWiseBitsetPolicy<ElementT>::template op_within_range_val<T, Op, Mode>(
                     data, 
                     starting_bit, 
                     lower, 
@@ -335,9 +488,9 @@ struct VectorizedElementWiseBitsetPolicy {
                     nbits
                 );
             },
-            [data, lower, upper, values](const size_t starting_element, const size_t ptr_offset, const size_t nbits){
+            [lower, upper, values](data_type* const dst, const size_t ptr_offset, const size_t nbits){
                 return VectorizedT::template op_within_range_val<T, Op>(
-                    reinterpret_cast<uint8_t*>(data + starting_element),
+                    reinterpret_cast<uint8_t*>(dst),
                     lower,
                     upper,
                     values + ptr_offset,
@@ -348,7 +501,55 @@ struct VectorizedElementWiseBitsetPolicy {
     }
 
     //
-    template<typename T, ArithOpType AOp, CompareOpType CmpOp>
+    template<typename ColumnT, RangeType Op, CombineMode Mode = CombineMode::Store>
+    static inline void op_within_range_string_val(
+        data_type* const __restrict data, 
+        const size_t start,
+        const std::string_view lower,
+        const std::string_view upper,
+        const ColumnT column,
+        const size_t size
+    ) {
+        // lower ? v && v ? upper
+        constexpr CompareOpType lower_op = 
+            (Range2Compare<Op>::lower == CompareOpType::LE) ? 
+                CompareOpType::GE : CompareOpType::GT;
+        constexpr CompareOpType upper_op = Range2Compare<Op>::upper;
+
+        op_func<Mode>(data, start, size, 
+            [data, lower, upper, column](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
+                ElementWiseBitsetPolicy<ElementT>::template op_within_range_string_val<ColumnT, Op, Mode>(
+                    data, 
+                    starting_bit, 
+                    lower, 
+                    upper, 
+                    column + ptr_offset,
+                    nbits
+                );
+            },
+            [lower, upper, column](data_type* const dst, const size_t ptr_offset, const size_t nbits){
+                return op_string_prefix_impl<ColumnT>(
+                    reinterpret_cast<uint8_t*>(dst),
+                    column + ptr_offset,
+                    nbits,
+                    [lower, upper](const uint64_t* const prefixes, const auto& block, const size_t nrows, uint64_t& mask) {
+                        uint64_t mask_lower = 0;
+                        uint64_t mask_upper = 0;
+                        if (!op_string_prefix_mask<lower_op>(prefixes, block, nrows, lower, mask_lower) ||
+                            !op_string_prefix_mask<upper_op>(prefixes, block, nrows, upper, mask_upper)) {
+                            return false;
+                        }
+
+                        mask = mask_lower & mask_upper;
+                        return true;
+                    }
+                );
+            }
+        );
+    }
+
+    //
+    template<typename T, ArithOpType AOp, CompareOpType CmpOp, CombineMode Mode = CombineMode::Store>
     static inline void op_arith_compare(
         data_type* const __restrict data, 
         const size_t start,
@@ -357,9 +558,9 @@ struct VectorizedElementWiseBitsetPolicy {
         const ArithHighPrecisionType<T>& value,
         const size_t size
     ) {
-        op_func(start, size, 
+        op_func<Mode>(data, start, size, 
             [data, src, right_operand, value](const size_t starting_bit, const size_t ptr_offset, const size_t nbits){
-                ElementWiseBitsetPolicy<ElementT>::template op_arith_compare<T, AOp, CmpOp>(
+                ElementWiseBitsetPolicy<ElementT>::template op_arith_compare<T, AOp, CmpOp, Mode>(
                     data, 
                     starting_bit, 
                     src + ptr_offset,
@@ -368,9 +569,9 @@ struct VectorizedElementWiseBitsetPolicy {
                     nbits
                 );
             },
-            [data, src, right_operand, value](const size_t starting_element, const size_t ptr_offset, const size_t nbits){
+            [src, right_operand, value](data_type* const dst, const size_t ptr_offset, const size_t nbits){
                 return VectorizedT::template op_arith_compare<T, AOp, CmpOp>(
-                    reinterpret_cast<uint8_t*>(data + starting_element),
+                    reinterpret_cast<uint8_t*>(dst),
                     src + ptr_offset,
                     right_operand,
                     value,
@@ -388,6 +589,11 @@ struct VectorizedElementWiseBitsetPolicy {
         const size_t start_right, 
         const size_t size
     ) {
+        size_t count = 0;
+        if (VectorizedT::template forward_op_and_with_count<ElementT>(left, right, start_left, start_right, size, count)) {
+            return count;
+        }
+
         return ElementWiseBitsetPolicy<ElementT>::op_and_with_count(
             left, right, start_left, start_right, size
         );
@@ -400,15 +606,135 @@ struct VectorizedElementWiseBitsetPolicy {
         const size_t start_right, 
         const size_t size
     ) {
+        size_t count = 0;
+        if (VectorizedT::template forward_op_or_with_count<ElementT>(left, right, start_left, start_right, size, count)) {
+            return count;
+        }
+
         return ElementWiseBitsetPolicy<ElementT>::op_or_with_count(
             left, right, start_left, start_right, size
         );
     }
 
+    // Gathers prefixes of strings for blocks of 64 rows and invokes
+    //   bool FuncMask(const uint64_t* prefixes, const ColumnT block, const size_t nrows, uint64_t& mask)
+    //   for every block. Returns false if SIMD code is not available.
+    template<typename ColumnT, typename FuncMask>
+    static inline bool op_string_prefix_impl(
+        uint8_t* const __restrict res_u8,
+        const ColumnT column,
+        const size_t size,
+        FuncMask func_mask
+    ) {
+        // the restriction of the API
+        assert((size % 8) == 0);
+
+        constexpr size_t BLOCK_SIZE = 64;
+        uint64_t prefixes[BLOCK_SIZE];
+
+        for (size_t i = 0; i < size; i += BLOCK_SIZE) {
+            const size_t nrows = std::min(BLOCK_SIZE, size - i);
+            const ColumnT block = column + i;
+            get_string_prefixes(block, nrows, prefixes);
+
+            // nothing is written to res_u8 for the first block in case of a failure
+            uint64_t mask = 0;
+            if (!func_mask(prefixes, block, nrows, mask)) {
+                return false;
+            }
+
+            std::memcpy(res_u8 + i / 8, &mask, nrows / 8);
+        }
+
+        return true;
+    }
+
+    // Produces a mask for (block[j] Op value) for nrows <= 64 rows, given
+    //   prefixes of rows. Returns false if SIMD code is not available.
+    template<CompareOpType Op, typename ColumnT>
+    static inline bool op_string_prefix_mask(
+        const uint64_t* const __restrict prefixes,
+        const ColumnT block,
+        const size_t nrows,
+        const std::string_view value,
+        uint64_t& mask
+    ) {
+        const uint64_t value_prefix = get_string_prefix(value);
+
+        uint64_t mask_eq = 0;
+        if (!VectorizedT::template op_compare_val<uint64_t, CompareOpType::EQ>(
+                reinterpret_cast<uint8_t*>(&mask_eq), prefixes, nrows, value_prefix)) {
+            return false;
+        }
+
+        uint64_t mask_lt = 0;
+        if constexpr (Op != CompareOpType::EQ && Op != CompareOpType::NE) {
+            if (!VectorizedT::template op_compare_val<uint64_t, CompareOpType::LT>(
+                    reinterpret_cast<uint8_t*>(&mask_lt), prefixes, nrows, value_prefix)) {
+                return false;
+            }
+        }
+
+        // rows that are decided by prefixes
+        uint64_t result = 0;
+        if constexpr (Op == CompareOpType::LT || Op == CompareOpType::LE) {
+            result = mask_lt;
+        } else if constexpr (Op == CompareOpType::GT || Op == CompareOpType::GE) {
+            result = ~(mask_lt | mask_eq);
+        } else if constexpr (Op == CompareOpType::NE) {
+            result = ~mask_eq;
+        }
+
+        // rows with equal prefixes
+        uint64_t ties = mask_eq;
+        while (ties != 0) {
+            const auto j = CtzHelper<uint64_t>::ctz(ties);
+            if (CompareOperator<Op>::compare(std::string_view(block[j]), value)) {
+                result |= (uint64_t(1) << j);
+            }
+            ties &= (ties - 1);
+        }
+
+        mask = (nrows == 64) ? result : (result & ((uint64_t(1) << nrows) - 1));
+        return true;
+    }
+
+    // The number of bits, which are produced by SIMD code into a 
+    //   temporary buffer on the stack before being merged with 
+    //   the existing bits for CombineMode other than Store.
+    static constexpr size_t COMBINE_BUFFER_BITS = 2048;
+
+    // CombineMode::And evaluates a predicate only for rows, which are 
+    //   currently set, if less than 1 / SELECTIVE_DENSITY_RATIO of the 
+    //   rows of a chunk are set. Zero words are skipped entirely.
+    static constexpr size_t SELECTIVE_DENSITY_RATIO = 16;
+
+    // Merges bits of a buffer into [start, start + size) of data.
+    template<CombineMode Mode>
+    static inline void op_combine(
+        data_type* const data,
+        const data_type* const buffer,
+        const size_t start,
+        const size_t size
+    ) {
+        if constexpr (Mode == CombineMode::And) {
+            op_and(data, buffer, start, 0, size);
+        } else if constexpr (Mode == CombineMode::Or) {
+            op_or(data, buffer, start, 0, size);
+        } else if constexpr (Mode == CombineMode::AndNot) {
+            op_sub(data, buffer, start, 0, size);
+        } else {
+            // unimplemented
+            static_assert(Mode != CombineMode::Store, "unimplemented");
+        }
+    }
+
     // void FuncBaseline(const size_t starting_bit, const size_t ptr_offset, const size_t nbits)
-    // bool FuncVectorized(const size_t starting_element, const size_t ptr_offset, const size_t nbits)
-    template<typename FuncBaseline, typename FuncVectorized>
+    // bool FuncVectorized(data_type* const dst, const size_t ptr_offset, const size_t nbits)
+    // FuncBaseline is expected to apply Mode, FuncVectorized always stores.
+    template<CombineMode Mode = CombineMode::Store, typename FuncBaseline, typename FuncVectorized>
     static inline void op_func(
+        data_type* const __restrict data,
         const size_t start,
         const size_t size,
         FuncBaseline func_baseline,
@@ -448,10 +774,37 @@ struct VectorizedElementWiseBitsetPolicy {
             const size_t starting_bit_idx = start_element * data_bits;
             const size_t nbits = (end_element - start_element) * data_bits;
 
-            // check if vectorized implementation is available
-            if (!func_vectorized(start_element, ptr_offset, nbits)) {
-                // vectorized implementation is not available, invoke the default one
-                func_baseline(starting_bit_idx, ptr_offset, nbits);
+            if constexpr (Mode == CombineMode::Store) {
+                // check if vectorized implementation is available
+                if (!func_vectorized(data + start_element, ptr_offset, nbits)) {
+                    // vectorized implementation is not available, invoke the default one
+                    func_baseline(starting_bit_idx, ptr_offset, nbits);
+                }
+            } else {
+                // the buffer stays in L1 cache
+                data_type buffer[COMBINE_BUFFER_BITS / data_bits];
+
+                for (size_t i = 0; i < nbits; i += COMBINE_BUFFER_BITS) {
+                    const size_t chunk_bits = std::min(COMBINE_BUFFER_BITS, nbits - i);
+
+                    if constexpr (Mode == CombineMode::And) {
+                        // if few rows are currently set, then evaluate 
+                        //   only them, otherwise evaluate the chunk densely
+                        const size_t n_alive = op_count(data, starting_bit_idx + i, chunk_bits);
+                        if (n_alive * SELECTIVE_DENSITY_RATIO < chunk_bits) {
+                            func_baseline(starting_bit_idx + i, ptr_offset + i, chunk_bits);
+                            continue;
+                        }
+                    }
+
+                    if (!func_vectorized(buffer, ptr_offset + i, chunk_bits)) {
+                        // vectorized implementation is not available, invoke the default one
+                        func_baseline(starting_bit_idx + i, ptr_offset + i, nbits - i);
+                        break;
+                    }
+
+                    op_combine<Mode>(data, buffer, starting_bit_idx + i, chunk_bits);
+                }
             }
         
             //
@@ -3,11 +3,15 @@
 #include <cstddef>
 #include <cstdint>
 #include <optional>
+#include <string_view>
 
 #include "proxy.h"
 
 #include "ctz.h"
+#include "in_values.h"
 #include "popcount.h"
+#include "string_column.h"
+#include "ternary_logic.h"
 
 #include "maybe_vector.h"
 
@@ -843,7 +847,7 @@ struct ElementWiseBitsetPolicy {
     }
 
     //
-    template<typename T, typename U, CompareOpType Op>
+    template<typename T, typename U, CompareOpType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_compare_column(
         data_type* const __restrict data, 
         const size_t start,
@@ -851,14 +855,14 @@ struct ElementWiseBitsetPolicy {
         const U* const __restrict u,
         const size_t size
     ) {
-        op_func(data, start, size, 
+        op_func<Mode>(data, start, size, 
             [t, u](const size_t bit_idx) {
                 return CompareOperator<Op>::compare(t[bit_idx], u[bit_idx]);
             });
     }
 
     //
-    template<typename T, CompareOpType Op>
+    template<typename T, CompareOpType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_compare_val(
         data_type* const __restrict data, 
         const size_t start,
@@ -866,14 +870,71 @@ struct ElementWiseBitsetPolicy {
         const size_t size,
         const T& value
     ) {
-        op_func(data, start, size, 
+        op_func<Mode>(data, start, size, 
             [t, value](const size_t bit_idx) {
                 return CompareOperator<Op>::compare(t[bit_idx], value);
             });
     }
 
     //
-    template<typename T, RangeType Op>
+    template<typename T, InValuesType Op>
+    static inline void op_in_values(
+        data_type* const __restrict data, 
+        const size_t start,
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        constexpr bool is_in = (Op == InValuesType::In);
+
+        if (n_values <= IN_VALUES_MAX_BROADCAST) {
+            op_func(data, start, size, 
+                [t, values, n_values](const size_t bit_idx) {
+                    return (in_values_linear(t[bit_idx], values, n_values) == is_in);
+                });
+        } else {
+            const InValuesSorted<T> sorted(values, n_values);
+
+            op_func(data, start, size, 
+                [t, &sorted](const size_t bit_idx) {
+                    return (sorted.contains(t[bit_idx]) == is_in);
+                });
+        }
+    }
+
+    //
+    template<typename ColumnT, CompareOpType Op, CombineMode Mode = CombineMode::Store>
+    static inline void op_compare_string_val(
+        data_type* const __restrict data, 
+        const size_t start,
+        const ColumnT column,
+        const size_t size,
+        const std::string_view value
+    ) {
+        op_func<Mode>(data, start, size, 
+            [column, value](const size_t bit_idx) {
+                return CompareOperator<Op>::compare(std::string_view(column[bit_idx]), value);
+            });
+    }
+
+    //
+    template<typename ColumnT>
+    static inline void op_prefix_match(
+        data_type* const __restrict data, 
+        const size_t start,
+        const ColumnT column,
+        const size_t size,
+        const std::string_view prefix
+    ) {
+        op_func(data, start, size, 
+            [column, prefix](const size_t bit_idx) {
+                return string_starts_with(std::string_view(column[bit_idx]), prefix);
+            });
+    }
+
+    //
+    template<typename T, RangeType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_within_range_column(
         data_type* const __restrict data, 
         const size_t start,
@@ -882,14 +943,14 @@ struct ElementWiseBitsetPolicy {
         const T* const __restrict values,
         const size_t size
     ) {
-        op_func(data, start, size, 
+        op_func<Mode>(data, start, size, 
             [lower, upper, values](const size_t bit_idx) {
                 return RangeOperator<Op>::within_range(lower[bit_idx], upper[bit_idx], values[bit_idx]);
             });
     }
 
     //
-    template<typename T, RangeType Op>
+    template<typename T, RangeType Op, CombineMode Mode = CombineMode::Store>
     static inline void op_within_range_val(
         data_type* const __restrict data, 
         const size_t start,
@@ -898,14 +959,30 @@ struct ElementWiseBitsetPolicy {
         const T* const __restrict values,
         const size_t size
     ) {
-        op_func(data, start, size, 
+        op_func<Mode>(data, start, size, 
             [lower, upper, values](const size_t bit_idx) {
                 return RangeOperator<Op>::within_range(lower, upper, values[bit_idx]);
             });
     }
 
     //
-    template<typename T, ArithOpType AOp, CompareOpType CmpOp>
+    template<typename ColumnT, RangeType Op, CombineMode Mode = CombineMode::Store>
+    static inline void op_within_range_string_val(
+        data_type* const __restrict data, 
+        const size_t start,
+        const std::string_view lower,
+        const std::string_view upper,
+        const ColumnT column,
+        const size_t size
+    ) {
+        op_func<Mode>(data, start, size, 
+            [lower, upper, column](const size_t bit_idx) {
+                return RangeOperator<Op>::within_range(lower, upper, std::string_view(column[bit_idx]));
+            });
+    }
+
+    //
+    template<typename T, ArithOpType AOp, CompareOpType CmpOp, CombineMode Mode = CombineMode::Store>
     static inline void op_arith_compare(
         data_type* const __restrict data, 
         const size_t start,
@@ -914,7 +991,7 @@ struct ElementWiseBitsetPolicy {
         const ArithHighPrecisionType<T>& value,
         const size_t size
     ) {
-        op_func(data, start, size, 
+        op_func<Mode>(data, start, size, 
             [src, right_operand, value](const size_t bit_idx) {
                 return ArithCompareOperator<AOp, CmpOp>::compare(src[bit_idx], right_operand, value);
             });
@@ -974,6 +1051,40 @@ struct ElementWiseBitsetPolicy {
         return inactive;
     }
 
+    // left = f(left, b, c), f is given by a truth table of vpternlog format
+    template<uint8_t TruthTable>
+    static BITSET_ALWAYS_INLINE inline void op_ternary(
+        data_type* const left,
+        const data_type* const b,
+        const data_type* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size
+    ) {
+        op_func(left, b, c, start_left, start_b, start_c, size,
+            [](const data_type left_v, const data_type b_v, const data_type c_v) {
+                return ternary_logic<TruthTable, ScalarLogicOps<data_type>>(left_v, b_v, c_v);
+            });
+    }
+
+    // same as above, but the truth table is known in runtime only
+    static inline void op_ternary(
+        data_type* const left,
+        const data_type* const b,
+        const data_type* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size,
+        const uint8_t truth_table
+    ) {
+        op_func(left, b, c, start_left, start_b, start_c, size,
+            [truth_table](const data_type left_v, const data_type b_v, const data_type c_v) {
+                return ternary_logic<data_type>(left_v, b_v, c_v, truth_table);
+            });
+    }
+
 
     // data_type Func(const data_type left_v, const data_type right_v);
     template<typename Func>
@@ -1076,7 +1187,7 @@ struct ElementWiseBitsetPolicy {
         const size_t size_b = (size / data_bits) * data_bits;
 
         // check a specific case
-        bool all_aligned = true;
+        bool all_aligned = (start_left % data_bits == 0);
         for (size_t i = 0; i < n_rights; i++) {
             if (start_rights[i] % data_bits != 0) {
                 all_aligned = false;
@@ -1167,8 +1278,79 @@ struct ElementWiseBitsetPolicy {
         }
     }
 
-    // bool Func(const size_t bit_idx);
+    // data_type Func(const data_type left_v, const data_type b_v, const data_type c_v);
     template<typename Func>
+    static BITSET_ALWAYS_INLINE inline void op_func(
+        data_type* const left,
+        const data_type* const b,
+        const data_type* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size,
+        Func func
+    ) {
+        if (size == 0) [[unlikely]] {
+            return;
+        }
+
+        // process big blocks
+        const size_t size_b = (size / data_bits) * data_bits;
+        if ((start_left % data_bits) == 0 &&
+            (start_b % data_bits) == 0 &&
+            (start_c % data_bits) == 0) {
+            // plain "memcpy".
+            // A compiler auto-vectorization is expected.
+            const size_t start_left_idx = start_left / data_bits;
+            const size_t start_b_idx = start_b / data_bits;
+            const size_t start_c_idx = start_c / data_bits;
+
+            for (size_t i = 0, j = 0; i < size_b; i += data_bits, j += 1) {
+                data_type& left_v = left[start_left_idx + j];
+                const data_type b_v = b[start_b_idx + j];
+                const data_type c_v = c[start_c_idx + j];
+
+                left_v = func(left_v, b_v, c_v);
+            }
+        } else {
+            // general case. Unoptimized.
+            for (size_t i = 0; i < size_b; i += data_bits) {
+                const data_type left_v = op_read(left, start_left + i, data_bits);
+                const data_type b_v = op_read(b, start_b + i, data_bits);
+                const data_type c_v = op_read(c, start_c + i, data_bits);
+
+                op_write(left, start_left + i, data_bits, func(left_v, b_v, c_v));
+            }
+        }
+
+        // process leftovers
+        if (size_b != size) {
+            const data_type left_v = op_read(left, start_left + size_b, size - size_b);
+            const data_type b_v = op_read(b, start_b + size_b, size - size_b);
+            const data_type c_v = op_read(c, start_c + size_b, size - size_b);
+
+            op_write(left, start_left + size_b, size - size_b, func(left_v, b_v, c_v));
+        }
+    }
+
+    // Writes nbits of value, merging them with the existing bits.
+    template<CombineMode Mode>
+    static inline void op_write_combined(
+        data_type* const data,
+        const size_t start,
+        const size_t nbits,
+        const data_type value
+    ) {
+        if constexpr (Mode == CombineMode::Store) {
+            op_write(data, start, nbits, value);
+        } else {
+            const data_type existing = op_read(data, start, nbits);
+            op_write(data, start, nbits, CombineOperator<Mode>::combine(existing, value));
+        }
+    }
+
+    // bool Func(const size_t bit_idx);
+    template<CombineMode Mode = CombineMode::Store, typename Func>
     static BITSET_ALWAYS_INLINE inline void op_func(
         data_type* const __restrict data, 
         const size_t start,
@@ -1196,7 +1378,7 @@ struct ElementWiseBitsetPolicy {
                 bits |= (data_type(bit ? 1 : 0) << j); 
             }
 
-            op_write(data, start, size, bits);
+            op_write_combined<Mode>(data, start, size, bits);
             return;
         }
 
@@ -1213,7 +1395,7 @@ struct ElementWiseBitsetPolicy {
                 bits |= (data_type(bit ? 1 : 0) << j); 
             }
 
-            op_write(data, start, n_bits, bits);
+            op_write_combined<Mode>(data, start, n_bits, bits);
 
             // start from the next element
             start_element += 1;
@@ -1223,13 +1405,29 @@ struct ElementWiseBitsetPolicy {
         // process the middle
         {
             for (size_t i = start_element; i < end_element; i++) {
+                if constexpr (Mode == CombineMode::And) {
+                    // evaluate only rows, which are currently set
+                    data_type alive = data[i];
+                    data_type bits = 0;
+                    while (alive != 0) {
+                        const auto j = CtzHelper<data_type>::ctz(alive);
+                        const bool bit = func(ptr_offset + j);
+                        bits |= (data_type(bit ? 1 : 0) << j);
+                        alive &= (alive - 1);
+                    }
+
+                    data[i] = bits;
+                    ptr_offset += data_bits;
+                    continue;
+                }
+
                 data_type bits = 0;
                 for (size_t j = 0; j < data_bits; j++) {
                     const bool bit = func(ptr_offset + j);
                     bits |= (data_type(bit ? 1 : 0) << j); 
                 }
 
-                data[i] = bits;
+                data[i] = CombineOperator<Mode>::combine(data[i], bits);
                 ptr_offset += data_bits;
             }
         }
@@ -1243,7 +1441,7 @@ struct ElementWiseBitsetPolicy {
             }
 
             const size_t starting_bit_idx = end_element * data_bits; 
-            op_write(data, starting_bit_idx, end_shift, bits);
+            op_write_combined<Mode>(data, starting_bit_idx, end_shift, bits);
         }
     }
 };
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include "../common.h"
+
+namespace milvus {
+namespace bitset {
+namespace detail {
+
+// The maximum number of values, for which IN is evaluated by
+//   comparing every element against every value. SIMD code broadcasts
+//   every value into a register. Larger sets of values are sorted
+//   and are probed using a binary search.
+constexpr size_t IN_VALUES_MAX_BROADCAST = 16;
+
+// Equality does not depend on the signedness of integers, so SIMD code
+//   is free to compare integers using lanes of either signedness.
+template<typename T, typename = void>
+struct InValuesLaneType {
+    using signed_type = T;
+    using unsigned_type = T;
+};
+
+template<typename T>
+struct InValuesLaneType<T, std::enable_if_t<std::is_integral_v<T>>> {
+    using signed_type = std::make_signed_t<T>;
+    using unsigned_type = std::make_unsigned_t<T>;
+};
+
+// A scalar reference for small sets of values.
+template<typename T>
+inline bool in_values_linear(
+    const T& value,
+    const T* const __restrict values,
+    const size_t n_values
+) {
+    for (size_t j = 0; j < n_values; j++) {
+        if (value == values[j]) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+// A sorted set of values for large IN lists.
+template<typename T>
+struct InValuesSorted {
+    std::vector<T> sorted;
+
+    InValuesSorted(const T* const __restrict values, const size_t n_values) {
+        sorted.reserve(n_values);
+        for (size_t j = 0; j < n_values; j++) {
+            // NaN never matches anything, also it breaks the ordering
+            if (values[j] == values[j]) {
+                sorted.push_back(values[j]);
+            }
+        }
+
+        std::sort(sorted.begin(), sorted.end());
+        sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+    }
+
+    // a branchless binary search for the last element <= value
+    inline bool contains(const T& value) const {
+        size_t n = sorted.size();
+        if (n == 0) {
+            return false;
+        }
+
+        const T* base = sorted.data();
+        while (n > 1) {
+            const size_t half = n / 2;
+            base = (base[half] <= value) ? (base + half) : base;
+            n -= half;
+        }
+
+        return (*base == value);
+    }
+};
+
+}
+}
+}
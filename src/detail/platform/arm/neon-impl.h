@@ -4,16 +4,22 @@
 
 #include <arm_neon.h>
 
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
+#include <utility>
 
 #include "neon-decl.h"
 
 #include "../../../common.h"
+#include "../../divide.h"
 #include "../../element_wise.h"
+#include "../../ternary_logic.h"
+#include "../../in_values.h"
 
 namespace milvus {
 namespace bitset {
@@ -139,6 +145,31 @@ struct CmpHelper<CompareOpType::EQ> {
                 vceqq_s64(a.val[2], b.val[2]), vceqq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint8x8_t compare(const uint8x8_t a, const uint8x8_t b) {
+        return vceq_u8(a, b);
+    }
+
+    static inline uint8x16x2_t compare(const uint8x16x2_t a, const uint8x16x2_t b) {
+        return {vceqq_u8(a.val[0], b.val[0]), vceqq_u8(a.val[1], b.val[1])};
+    }
+
+    static inline uint16x8_t compare(const uint16x8_t a, const uint16x8_t b) {
+        return vceqq_u16(a, b);
+    }
+
+    static inline uint16x8x2_t compare(const uint16x8x2_t a, const uint16x8x2_t b) {
+        return {vceqq_u16(a.val[0], b.val[0]), vceqq_u16(a.val[1], b.val[1])};
+    }
+
+    static inline uint32x4x2_t compare(const uint32x4x2_t a, const uint32x4x2_t b) {
+        return {vceqq_u32(a.val[0], b.val[0]), vceqq_u32(a.val[1], b.val[1])};
+    }
+
+    static inline uint64x2x4_t compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vceqq_u64(a.val[0], b.val[0]), vceqq_u64(a.val[1], b.val[1]),
+                vceqq_u64(a.val[2], b.val[2]), vceqq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vceqq_f32(a.val[0], b.val[0]), vceqq_f32(a.val[1], b.val[1])};
     }
@@ -176,6 +207,31 @@ struct CmpHelper<CompareOpType::GE> {
                 vcgeq_s64(a.val[2], b.val[2]), vcgeq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint8x8_t compare(const uint8x8_t a, const uint8x8_t b) {
+        return vcge_u8(a, b);
+    }
+
+    static inline uint8x16x2_t compare(const uint8x16x2_t a, const uint8x16x2_t b) {
+        return {vcgeq_u8(a.val[0], b.val[0]), vcgeq_u8(a.val[1], b.val[1])};
+    }
+
+    static inline uint16x8_t compare(const uint16x8_t a, const uint16x8_t b) {
+        return vcgeq_u16(a, b);
+    }
+
+    static inline uint16x8x2_t compare(const uint16x8x2_t a, const uint16x8x2_t b) {
+        return {vcgeq_u16(a.val[0], b.val[0]), vcgeq_u16(a.val[1], b.val[1])};
+    }
+
+    static inline uint32x4x2_t compare(const uint32x4x2_t a, const uint32x4x2_t b) {
+        return {vcgeq_u32(a.val[0], b.val[0]), vcgeq_u32(a.val[1], b.val[1])};
+    }
+
+    static inline uint64x2x4_t compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vcgeq_u64(a.val[0], b.val[0]), vcgeq_u64(a.val[1], b.val[1]),
+                vcgeq_u64(a.val[2], b.val[2]), vcgeq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vcgeq_f32(a.val[0], b.val[0]), vcgeq_f32(a.val[1], b.val[1])};
     }
@@ -213,6 +269,31 @@ struct CmpHelper<CompareOpType::GT> {
                 vcgtq_s64(a.val[2], b.val[2]), vcgtq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint8x8_t compare(const uint8x8_t a, const uint8x8_t b) {
+        return vcgt_u8(a, b);
+    }
+
+    static inline uint8x16x2_t compare(const uint8x16x2_t a, const uint8x16x2_t b) {
+        return {vcgtq_u8(a.val[0], b.val[0]), vcgtq_u8(a.val[1], b.val[1])};
+    }
+
+    static inline uint16x8_t compare(const uint16x8_t a, const uint16x8_t b) {
+        return vcgtq_u16(a, b);
+    }
+
+    static inline uint16x8x2_t compare(const uint16x8x2_t a, const uint16x8x2_t b) {
+        return {vcgtq_u16(a.val[0], b.val[0]), vcgtq_u16(a.val[1], b.val[1])};
+    }
+
+    static inline uint32x4x2_t compare(const uint32x4x2_t a, const uint32x4x2_t b) {
+        return {vcgtq_u32(a.val[0], b.val[0]), vcgtq_u32(a.val[1], b.val[1])};
+    }
+
+    static inline uint64x2x4_t compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vcgtq_u64(a.val[0], b.val[0]), vcgtq_u64(a.val[1], b.val[1]),
+                vcgtq_u64(a.val[2], b.val[2]), vcgtq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vcgtq_f32(a.val[0], b.val[0]), vcgtq_f32(a.val[1], b.val[1])};
     }
@@ -250,6 +331,31 @@ struct CmpHelper<CompareOpType::LE> {
                 vcleq_s64(a.val[2], b.val[2]), vcleq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint8x8_t compare(const uint8x8_t a, const uint8x8_t b) {
+        return vcle_u8(a, b);
+    }
+
+    static inline uint8x16x2_t compare(const uint8x16x2_t a, const uint8x16x2_t b) {
+        return {vcleq_u8(a.val[0], b.val[0]), vcleq_u8(a.val[1], b.val[1])};
+    }
+
+    static inline uint16x8_t compare(const uint16x8_t a, const uint16x8_t b) {
+        return vcleq_u16(a, b);
+    }
+
+    static inline uint16x8x2_t compare(const uint16x8x2_t a, const uint16x8x2_t b) {
+        return {vcleq_u16(a.val[0], b.val[0]), vcleq_u16(a.val[1], b.val[1])};
+    }
+
+    static inline uint32x4x2_t compare(const uint32x4x2_t a, const uint32x4x2_t b) {
+        return {vcleq_u32(a.val[0], b.val[0]), vcleq_u32(a.val[1], b.val[1])};
+    }
+
+    static inline uint64x2x4_t compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vcleq_u64(a.val[0], b.val[0]), vcleq_u64(a.val[1], b.val[1]),
+                vcleq_u64(a.val[2], b.val[2]), vcleq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vcleq_f32(a.val[0], b.val[0]), vcleq_f32(a.val[1], b.val[1])};
     }
@@ -287,6 +393,31 @@ struct CmpHelper<CompareOpType::LT> {
                 vcltq_s64(a.val[2], b.val[2]), vcltq_s64(a.val[3], b.val[3])};
     }
 
+    static inline uint8x8_t compare(const uint8x8_t a, const uint8x8_t b) {
+        return vclt_u8(a, b);
+    }
+
+    static inline uint8x16x2_t compare(const uint8x16x2_t a, const uint8x16x2_t b) {
+        return {vcltq_u8(a.val[0], b.val[0]), vcltq_u8(a.val[1], b.val[1])};
+    }
+
+    static inline uint16x8_t compare(const uint16x8_t a, const uint16x8_t b) {
+        return vcltq_u16(a, b);
+    }
+
+    static inline uint16x8x2_t compare(const uint16x8x2_t a, const uint16x8x2_t b) {
+        return {vcltq_u16(a.val[0], b.val[0]), vcltq_u16(a.val[1], b.val[1])};
+    }
+
+    static inline uint32x4x2_t compare(const uint32x4x2_t a, const uint32x4x2_t b) {
+        return {vcltq_u32(a.val[0], b.val[0]), vcltq_u32(a.val[1], b.val[1])};
+    }
+
+    static inline uint64x2x4_t compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vcltq_u64(a.val[0], b.val[0]), vcltq_u64(a.val[1], b.val[1]),
+                vcltq_u64(a.val[2], b.val[2]), vcltq_u64(a.val[3], b.val[3])};
+    }
+
     static inline uint32x4x2_t compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vcltq_f32(a.val[0], b.val[0]), vcltq_f32(a.val[1], b.val[1])};
     }
@@ -324,6 +455,31 @@ struct CmpHelper<CompareOpType::NE> {
                 vmvnq_u64(vceqq_s64(a.val[2], b.val[2])), vmvnq_u64(vceqq_s64(a.val[3], b.val[3]))};
     }
 
+    static inline uint8x8_t compare(const uint8x8_t a, const uint8x8_t b) {
+        return vmvn_u8(vceq_u8(a, b));
+    }
+
+    static inline uint8x16x2_t compare(const uint8x16x2_t a, const uint8x16x2_t b) {
+        return {vmvnq_u8(vceqq_u8(a.val[0], b.val[0])), vmvnq_u8(vceqq_u8(a.val[1], b.val[1]))};
+    }
+
+    static inline uint16x8_t compare(const uint16x8_t a, const uint16x8_t b) {
+        return vmvnq_u16(vceqq_u16(a, b));
+    }
+
+    static inline uint16x8x2_t compare(const uint16x8x2_t a, const uint16x8x2_t b) {
+        return {vmvnq_u16(vceqq_u16(a.val[0], b.val[0])), vmvnq_u16(vceqq_u16(a.val[1], b.val[1]))};
+    }
+
+    static inline uint32x4x2_t compare(const uint32x4x2_t a, const uint32x4x2_t b) {
+        return {vmvnq_u32(vceqq_u32(a.val[0], b.val[0])), vmvnq_u32(vceqq_u32(a.val[1], b.val[1]))};
+    }
+
+    static inline uint64x2x4_t compare(const uint64x2x4_t a, const uint64x2x4_t b) {
+        return {vmvnq_u64(vceqq_u64(a.val[0], b.val[0])), vmvnq_u64(vceqq_u64(a.val[1], b.val[1])),
+                vmvnq_u64(vceqq_u64(a.val[2], b.val[2])), vmvnq_u64(vceqq_u64(a.val[3], b.val[3]))};
+    }
+
     static inline uint32x4x2_t compare(const float32x4x2_t a, const float32x4x2_t b) {
         return {vmvnq_u32(vceqq_f32(a.val[0], b.val[0])), vmvnq_u32(vceqq_f32(a.val[1], b.val[1]))};
     }
@@ -467,120 +623,61 @@ bool OpCompareValImpl<int64_t, Op>::op_compare_val(
 }
 
 template<CompareOpType Op>
-bool OpCompareValImpl<float, Op>::op_compare_val(
-    uint8_t* const __restrict res_u8,
-    const float* const __restrict src, 
-    const size_t size, 
-    const float& val
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-
-    //
-    const float32x4x2_t target = {vdupq_n_f32(val), vdupq_n_f32(val)};
-
-    // todo: aligned reads & writes
-
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const float32x4x2_t v0 = {vld1q_f32(src + i), vld1q_f32(src + i + 4)};
-        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0, target);
-        const uint8_t mmask = movemask(cmp);
-
-        res_u8[i / 8] = mmask;
-    }
-
-    return true;
-}
-
-template<CompareOpType Op>
-bool OpCompareValImpl<double, Op>::op_compare_val(
+bool OpCompareValImpl<uint8_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict src, 
+    const uint8_t* const __restrict src, 
     const size_t size, 
-    const double& val 
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-
-    //
-    const float64x2x4_t target = {vdupq_n_f64(val), vdupq_n_f64(val), vdupq_n_f64(val), vdupq_n_f64(val)};
-
-    // todo: aligned reads & writes
-
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const float64x2x4_t v0 = {vld1q_f64(src + i), vld1q_f64(src + i + 2), vld1q_f64(src + i + 4), vld1q_f64(src + i + 6)};
-        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0, target);
-        const uint8_t mmask = movemask(cmp);
-
-        res_u8[i / 8] = mmask;
-    }
-
-    return true;
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-
-//
-template<CompareOpType Op>
-bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
-    uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict left, 
-    const int8_t* const __restrict right, 
-    const size_t size
+    const uint8_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
     uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+    const uint8x16x2_t target = {vdupq_n_u8(val), vdupq_n_u8(val)};
 
     // todo: aligned reads & writes
 
     const size_t size32 = (size / 32) * 32;
     for (size_t i = 0; i < size32; i += 32) {
-        const int8x16x2_t v0l = {vld1q_s8(left + i), vld1q_s8(left + i + 16)};
-        const int8x16x2_t v0r = {vld1q_s8(right + i), vld1q_s8(right + i + 16)};
-        const uint8x16x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8x16x2_t v0 = {vld1q_u8(src + i), vld1q_u8(src + i + 16)};
+        const uint8x16x2_t cmp = CmpHelper<Op>::compare(v0, target);
         const uint32_t mmask = movemask(cmp);
 
         res_u32[i / 32] = mmask;
     }
 
     for (size_t i = size32; i < size; i += 8) {
-        const int8x8_t v0l = vld1_s8(left + i);
-        const int8x8_t v0r = vld1_s8(right + i);
-        const uint8x8_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8x8_t v0 = vld1_u8(src + i);
+        const uint8x8_t cmp = CmpHelper<Op>::compare(v0, vdup_n_u8(val));
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
-    }    
+    }
 
     return true;
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint16_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict left, 
-    const int16_t* const __restrict right, 
-    const size_t size
+    const uint16_t* const __restrict src, 
+    const size_t size, 
+    const uint16_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+    const uint16x8x2_t target = {vdupq_n_u16(val), vdupq_n_u16(val)};
 
     // todo: aligned reads & writes
 
     const size_t size16 = (size / 16) * 16;
     for (size_t i = 0; i < size16; i += 16) {
-        const int16x8x2_t v0l = {vld1q_s16(left + i), vld1q_s16(left + i + 8)};
-        const int16x8x2_t v0r = {vld1q_s16(right + i), vld1q_s16(right + i + 8)};
-        const uint16x8x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint16x8x2_t v0 = {vld1q_u16(src + i), vld1q_u16(src + i + 8)};
+        const uint16x8x2_t cmp = CmpHelper<Op>::compare(v0, target);
         const uint16_t mmask = movemask(cmp);
 
         res_u16[i / 16] = mmask;
@@ -588,9 +685,8 @@ bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
 
     if (size16 != size) {
         // 8 elements to process
-        const int16x8_t v0l = vld1q_s16(left + size16);
-        const int16x8_t v0r = vld1q_s16(right + size16);
-        const uint16x8_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint16x8_t v0 = vld1q_u16(src + size16);
+        const uint16x8_t cmp = CmpHelper<Op>::compare(v0, target.val[0]);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[size16 / 8] = mmask;
@@ -600,22 +696,24 @@ bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint32_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict left, 
-    const int32_t* const __restrict right, 
-    const size_t size
+    const uint32_t* const __restrict src, 
+    const size_t size, 
+    const uint32_t& val 
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
+    //
+    const uint32x4x2_t target = {vdupq_n_u32(val), vdupq_n_u32(val)};
+
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const int32x4x2_t v0l = {vld1q_s32(left + i), vld1q_s32(left + i + 4)};
-        const int32x4x2_t v0r = {vld1q_s32(right + i), vld1q_s32(right + i + 4)};
-        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint32x4x2_t v0 = {vld1q_u32(src + i), vld1q_u32(src + i + 4)};
+        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0, target);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
@@ -625,22 +723,24 @@ bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint64_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict left, 
-    const int64_t* const __restrict right, 
-    const size_t size
+    const uint64_t* const __restrict src, 
+    const size_t size, 
+    const uint64_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
+    //
+    const uint64x2x4_t target = {vdupq_n_u64(val), vdupq_n_u64(val), vdupq_n_u64(val), vdupq_n_u64(val)};
+
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const int64x2x4_t v0l = {vld1q_s64(left + i), vld1q_s64(left + i + 2), vld1q_s64(left + i + 4), vld1q_s64(left + i + 6)};
-        const int64x2x4_t v0r = {vld1q_s64(right + i), vld1q_s64(right + i + 2), vld1q_s64(right + i + 4), vld1q_s64(right + i + 6)};
-        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint64x2x4_t v0 = {vld1q_u64(src + i), vld1q_u64(src + i + 2), vld1q_u64(src + i + 4), vld1q_u64(src + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0, target);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
@@ -650,22 +750,24 @@ bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
+bool OpCompareValImpl<float, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const float* const __restrict left, 
-    const float* const __restrict right, 
-    const size_t size
+    const float* const __restrict src, 
+    const size_t size, 
+    const float& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
+    //
+    const float32x4x2_t target = {vdupq_n_f32(val), vdupq_n_f32(val)};
+
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const float32x4x2_t v0l = {vld1q_f32(left + i), vld1q_f32(left + i + 4)};
-        const float32x4x2_t v0r = {vld1q_f32(right + i), vld1q_f32(right + i + 4)};
-        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const float32x4x2_t v0 = {vld1q_f32(src + i), vld1q_f32(src + i + 4)};
+        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0, target);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
@@ -675,22 +777,24 @@ bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
+bool OpCompareValImpl<double, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict left, 
-    const double* const __restrict right, 
-    const size_t size
+    const double* const __restrict src, 
+    const size_t size, 
+    const double& val 
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
+    //
+    const float64x2x4_t target = {vdupq_n_f64(val), vdupq_n_f64(val), vdupq_n_f64(val), vdupq_n_f64(val)};
+
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const float64x2x4_t v0l = {vld1q_f64(left + i), vld1q_f64(left + i + 2), vld1q_f64(left + i + 4), vld1q_f64(left + i + 6)};
-        const float64x2x4_t v0r = {vld1q_f64(right + i), vld1q_f64(right + i + 2), vld1q_f64(right + i + 4), vld1q_f64(right + i + 6)};
-        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const float64x2x4_t v0 = {vld1q_f64(src + i), vld1q_f64(src + i + 2), vld1q_f64(src + i + 4), vld1q_f64(src + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0, target);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
@@ -702,290 +806,367 @@ bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
 
 ///////////////////////////////////////////////////////////////////////////
 
-//
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict lower,
-    const int8_t* const __restrict upper,
-    const int8_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
+namespace {
 
-    //
-    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+// Equality comparisons for IN. The signedness of integers does not 
+//   matter, so signed types use the same helpers.
+// match() produces a bitmask for 8 elements.
+template<typename T>
+struct InValuesHelper {};
 
-    // todo: aligned reads & writes
+template<>
+struct InValuesHelper<uint8_t> {
+    using vec_type = uint8x8_t;
 
-    const size_t size32 = (size / 32) * 32;
-    for (size_t i = 0; i < size32; i += 32) {
-        const int8x16x2_t v0l = {vld1q_s8(lower + i), vld1q_s8(lower + i + 16)};
-        const int8x16x2_t v0u = {vld1q_s8(upper + i), vld1q_s8(upper + i + 16)};
-        const int8x16x2_t v0v = {vld1q_s8(values + i), vld1q_s8(values + i + 16)};
-        const uint8x16x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const uint8x16x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const uint8x16x2_t cmp = {vandq_u8(cmp0l.val[0], cmp0u.val[0]), vandq_u8(cmp0l.val[1], cmp0u.val[1])};
-        const uint32_t mmask = movemask(cmp);
+    static inline vec_type set1(const uint8_t value) {
+        return vdup_n_u8(value);
+    }
 
-        res_u32[i / 32] = mmask;
+    static inline uint8_t match(const uint8_t* const src, const vec_type* const targets, const size_t n_targets) {
+        const uint8x8_t v = vld1_u8(src);
+
+        uint8x8_t cmp = vceq_u8(v, targets[0]);
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp = vorr_u8(cmp, vceq_u8(v, targets[j]));
+        }
+
+        return movemask(cmp);
     }
+};
 
-    for (size_t i = size32; i < size; i += 8) {
-        const int8x8_t v0l = vld1_s8(lower + i);
-        const int8x8_t v0u = vld1_s8(upper + i);
-        const int8x8_t v0v = vld1_s8(values + i);
-        const uint8x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const uint8x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const uint8x8_t cmp = vand_u8(cmp0l, cmp0u);
-        const uint8_t mmask = movemask(cmp);
+template<>
+struct InValuesHelper<uint16_t> {
+    using vec_type = uint16x8_t;
 
-        res_u8[i / 8] = mmask;
+    static inline vec_type set1(const uint16_t value) {
+        return vdupq_n_u16(value);
     }
 
-    return true;
-}
+    static inline uint8_t match(const uint16_t* const src, const vec_type* const targets, const size_t n_targets) {
+        const uint16x8_t v = vld1q_u16(src);
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict lower,
-    const int16_t* const __restrict upper,
-    const int16_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
+        uint16x8_t cmp = vceqq_u16(v, targets[0]);
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp = vorrq_u16(cmp, vceqq_u16(v, targets[j]));
+        }
 
-    //
-    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+        return movemask(cmp);
+    }
+};
 
-    // todo: aligned reads & writes
+template<>
+struct InValuesHelper<uint32_t> {
+    using vec_type = uint32x4_t;
 
-    const size_t size16 = (size / 16) * 16;
-    for (size_t i = 0; i < size16; i += 16) {
-        const int16x8x2_t v0l = {vld1q_s16(lower + i), vld1q_s16(lower + i + 8)};
-        const int16x8x2_t v0u = {vld1q_s16(upper + i), vld1q_s16(upper + i + 8)};
-        const int16x8x2_t v0v = {vld1q_s16(values + i), vld1q_s16(values + i + 8)};
-        const uint16x8x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const uint16x8x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const uint16x8x2_t cmp = {vandq_u16(cmp0l.val[0], cmp0u.val[0]), vandq_u16(cmp0l.val[1], cmp0u.val[1])};
-        const uint16_t mmask = movemask(cmp);
+    static inline vec_type set1(const uint32_t value) {
+        return vdupq_n_u32(value);
+    }
 
-        res_u16[i / 16] = mmask;
+    static inline uint8_t match(const uint32_t* const src, const vec_type* const targets, const size_t n_targets) {
+        const uint32x4_t v0 = vld1q_u32(src + 0);
+        const uint32x4_t v1 = vld1q_u32(src + 4);
+
+        uint32x4x2_t cmp = {vceqq_u32(v0, targets[0]), vceqq_u32(v1, targets[0])};
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp.val[0] = vorrq_u32(cmp.val[0], vceqq_u32(v0, targets[j]));
+            cmp.val[1] = vorrq_u32(cmp.val[1], vceqq_u32(v1, targets[j]));
+        }
+
+        return movemask(cmp);
     }
+};
 
-    if (size16 != size) {
-        // 8 elements to process
-        const int16x8_t v0l = vld1q_s16(lower + size16);
-        const int16x8_t v0u = vld1q_s16(upper + size16);
-        const int16x8_t v0v = vld1q_s16(values + size16);
-        const uint16x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const uint16x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const uint16x8_t cmp = vandq_u16(cmp0l, cmp0u);
-        const uint8_t mmask = movemask(cmp);
+template<>
+struct InValuesHelper<uint64_t> {
+    using vec_type = uint64x2_t;
 
-        res_u8[size16 / 8] = mmask;
+    static inline vec_type set1(const uint64_t value) {
+        return vdupq_n_u64(value);
     }
 
-    return true;
-}
+    static inline uint8_t match(const uint64_t* const src, const vec_type* const targets, const size_t n_targets) {
+        const uint64x2_t v0 = vld1q_u64(src + 0);
+        const uint64x2_t v1 = vld1q_u64(src + 2);
+        const uint64x2_t v2 = vld1q_u64(src + 4);
+        const uint64x2_t v3 = vld1q_u64(src + 6);
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict lower,
-    const int32_t* const __restrict upper,
-    const int32_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
+        uint64x2x4_t cmp = {
+            vceqq_u64(v0, targets[0]), vceqq_u64(v1, targets[0]),
+            vceqq_u64(v2, targets[0]), vceqq_u64(v3, targets[0])
+        };
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp.val[0] = vorrq_u64(cmp.val[0], vceqq_u64(v0, targets[j]));
+            cmp.val[1] = vorrq_u64(cmp.val[1], vceqq_u64(v1, targets[j]));
+            cmp.val[2] = vorrq_u64(cmp.val[2], vceqq_u64(v2, targets[j]));
+            cmp.val[3] = vorrq_u64(cmp.val[3], vceqq_u64(v3, targets[j]));
+        }
 
-    // todo: aligned reads & writes
+        return movemask(cmp);
+    }
+};
 
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const int32x4x2_t v0l = {vld1q_s32(lower + i), vld1q_s32(lower + i + 4)};
-        const int32x4x2_t v0u = {vld1q_s32(upper + i), vld1q_s32(upper + i + 4)};
-        const int32x4x2_t v0v = {vld1q_s32(values + i), vld1q_s32(values + i + 4)};
-        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
-        const uint8_t mmask = movemask(cmp);
+template<>
+struct InValuesHelper<float> {
+    using vec_type = float32x4_t;
 
-        res_u8[i / 8] = mmask;
+    static inline vec_type set1(const float value) {
+        return vdupq_n_f32(value);
     }
 
-    return true;
-}
+    static inline uint8_t match(const float* const src, const vec_type* const targets, const size_t n_targets) {
+        const float32x4_t v0 = vld1q_f32(src + 0);
+        const float32x4_t v1 = vld1q_f32(src + 4);
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict lower,
-    const int64_t* const __restrict upper,
-    const int64_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
+        uint32x4x2_t cmp = {vceqq_f32(v0, targets[0]), vceqq_f32(v1, targets[0])};
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp.val[0] = vorrq_u32(cmp.val[0], vceqq_f32(v0, targets[j]));
+            cmp.val[1] = vorrq_u32(cmp.val[1], vceqq_f32(v1, targets[j]));
+        }
 
-    // todo: aligned reads & writes
+        return movemask(cmp);
+    }
+};
 
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const int64x2x4_t v0l = {vld1q_s64(lower + i), vld1q_s64(lower + i + 2), vld1q_s64(lower + i + 4), vld1q_s64(lower + i + 6)};
-        const int64x2x4_t v0u = {vld1q_s64(upper + i), vld1q_s64(upper + i + 2), vld1q_s64(upper + i + 4), vld1q_s64(upper + i + 6)};
-        const int64x2x4_t v0v = {vld1q_s64(values + i), vld1q_s64(values + i + 2), vld1q_s64(values + i + 4), vld1q_s64(values + i + 6)};
-        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const uint64x2x4_t cmp = {
-            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
-            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
-        };
-        const uint8_t mmask = movemask(cmp);
+template<>
+struct InValuesHelper<double> {
+    using vec_type = float64x2_t;
 
-        res_u8[i / 8] = mmask;
+    static inline vec_type set1(const double value) {
+        return vdupq_n_f64(value);
     }
 
-    return true;
-}
+    static inline uint8_t match(const double* const src, const vec_type* const targets, const size_t n_targets) {
+        const float64x2_t v0 = vld1q_f64(src + 0);
+        const float64x2_t v1 = vld1q_f64(src + 2);
+        const float64x2_t v2 = vld1q_f64(src + 4);
+        const float64x2_t v3 = vld1q_f64(src + 6);
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<float, Op>::op_within_range_column(
+        uint64x2x4_t cmp = {
+            vceqq_f64(v0, targets[0]), vceqq_f64(v1, targets[0]),
+            vceqq_f64(v2, targets[0]), vceqq_f64(v3, targets[0])
+        };
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp.val[0] = vorrq_u64(cmp.val[0], vceqq_f64(v0, targets[j]));
+            cmp.val[1] = vorrq_u64(cmp.val[1], vceqq_f64(v1, targets[j]));
+            cmp.val[2] = vorrq_u64(cmp.val[2], vceqq_f64(v2, targets[j]));
+            cmp.val[3] = vorrq_u64(cmp.val[3], vceqq_f64(v3, targets[j]));
+        }
+
+        return movemask(cmp);
+    }
+};
+
+// every value is broadcast into a register, 
+//   then compare masks are OR-ed in a single pass over the data
+template<typename T, InValuesType Op>
+bool op_in_values_impl(
     uint8_t* const __restrict res_u8,
-    const float* const __restrict lower,
-    const float* const __restrict upper,
-    const float* const __restrict values,
-    const size_t size
+    const T* const __restrict src, 
+    const size_t size, 
+    const T* const __restrict values,
+    const size_t n_values
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
+    if (n_values == 0 || n_values > IN_VALUES_MAX_BROADCAST) {
+        return false;
+    }
+
+    //
+    using U = typename InValuesLaneType<T>::unsigned_type;
+    using helper = InValuesHelper<U>;
+
+    const U* const __restrict src_u = reinterpret_cast<const U*>(src);
+
+    typename helper::vec_type targets[IN_VALUES_MAX_BROADCAST];
+    for (size_t j = 0; j < n_values; j++) {
+        targets[j] = helper::set1(U(values[j]));
+    }
+
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const float32x4x2_t v0l = {vld1q_f32(lower + i), vld1q_f32(lower + i + 4)};
-        const float32x4x2_t v0u = {vld1q_f32(upper + i), vld1q_f32(upper + i + 4)};
-        const float32x4x2_t v0v = {vld1q_f32(values + i), vld1q_f32(values + i + 4)};
-        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
-        const uint8_t mmask = movemask(cmp);
+        const uint8_t mmask = helper::match(src_u + i, targets, n_values);
 
-        res_u8[i / 8] = mmask;
+        res_u8[i / 8] = (Op == InValuesType::In) ? mmask : uint8_t(~mmask);
     }
 
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
+}
+
+#define DEFINE_OP_IN_VALUES(TTYPE) \
+    template<InValuesType Op> \
+    bool OpInValuesImpl<TTYPE, Op>::op_in_values( \
+        uint8_t* const __restrict res_u8, \
+        const TTYPE* const __restrict src, \
+        const size_t size, \
+        const TTYPE* const __restrict values, \
+        const size_t n_values \
+    ) { \
+        return op_in_values_impl<TTYPE, Op>(res_u8, src, size, values, n_values); \
+    }
+
+DEFINE_OP_IN_VALUES(int8_t)
+DEFINE_OP_IN_VALUES(int16_t)
+DEFINE_OP_IN_VALUES(int32_t)
+DEFINE_OP_IN_VALUES(int64_t)
+DEFINE_OP_IN_VALUES(uint8_t)
+DEFINE_OP_IN_VALUES(uint16_t)
+DEFINE_OP_IN_VALUES(uint32_t)
+DEFINE_OP_IN_VALUES(uint64_t)
+DEFINE_OP_IN_VALUES(float)
+DEFINE_OP_IN_VALUES(double)
+
+#undef DEFINE_OP_IN_VALUES
+
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// Strings are stored back to back, so 16 bytes starting from a string
+//   may be loaded unconditionally while they stay within the bytes
+//   of rows [0, size). The remaining rows near the end are compared
+//   using memcmp().
+template<typename OffsetT>
+bool op_prefix_match_impl(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict lower,
-    const double* const __restrict upper,
-    const double* const __restrict values,
-    const size_t size
+    const char* const __restrict data,
+    const OffsetT* const __restrict offsets,
+    const size_t size,
+    const char* const __restrict prefix,
+    const size_t prefix_size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
-    // todo: aligned reads & writes
+    // the number of bytes in a register
+    constexpr size_t N = 16;
+    if (prefix_size > N) {
+        return false;
+    }
 
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const float64x2x4_t v0l = {vld1q_f64(lower + i), vld1q_f64(lower + i + 2), vld1q_f64(lower + i + 4), vld1q_f64(lower + i + 6)};
-        const float64x2x4_t v0u = {vld1q_f64(upper + i), vld1q_f64(upper + i + 2), vld1q_f64(upper + i + 4), vld1q_f64(upper + i + 6)};
-        const float64x2x4_t v0v = {vld1q_f64(values + i), vld1q_f64(values + i + 2), vld1q_f64(values + i + 4), vld1q_f64(values + i + 6)};
-        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const uint64x2x4_t cmp = {
-            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
-            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
-        };
-        const uint8_t mmask = movemask(cmp);
+    // the prefix is padded with zeros
+    uint8_t prefix_buf[16] = { 0 };
+    std::memcpy(prefix_buf, prefix, prefix_size);
+    const uint8x16_t target = vld1q_u8(prefix_buf);
+
+    // 0xFF for bytes of the prefix
+    uint8_t prefix_mask_buf[16] = { 0 };
+    std::memset(prefix_mask_buf, 0xFF, prefix_size);
+    const uint8x16_t prefix_mask = vld1q_u8(prefix_mask_buf);
+
+    const OffsetT end = offsets[size];
+
+    for (size_t i = 0; i < size; i += 8) {
+        uint8_t result = 0;
+        for (size_t j = 0; j < 8; j++) {
+            const OffsetT begin = offsets[i + j];
+            const size_t length = static_cast<size_t>(offsets[i + j + 1] - begin);
+            const bool fits = (length >= prefix_size);
+
+            bool match = false;
+            if (begin + OffsetT(N) <= end) [[likely]] {
+                const uint8x16_t v = vld1q_u8(reinterpret_cast<const uint8_t*>(data + begin));
+                const uint8x16_t ne = vbicq_u8(prefix_mask, vceqq_u8(v, target));
+                match = fits && (vmaxvq_u8(ne) == 0);
+            } else {
+                match = fits && (std::memcmp(data + begin, prefix, prefix_size) == 0);
+            }
 
-        res_u8[i / 8] = mmask;
+            result |= uint8_t(match) << j;
+        }
+
+        res_u8[i / 8] = result;
     }
 
     return true;
 }
 
+}
+
+#define DEFINE_OP_PREFIX_MATCH(OFFSETTYPE) \
+    bool OpPrefixMatchImpl<OFFSETTYPE>::op_prefix_match( \
+        uint8_t* const __restrict res_u8, \
+        const char* const __restrict data, \
+        const OFFSETTYPE* const __restrict offsets, \
+        const size_t size, \
+        const char* const __restrict prefix, \
+        const size_t prefix_size \
+    ) { \
+        return op_prefix_match_impl<OFFSETTYPE>(res_u8, data, offsets, size, prefix, prefix_size); \
+    }
+
+DEFINE_OP_PREFIX_MATCH(int32_t)
+DEFINE_OP_PREFIX_MATCH(int64_t)
+
+#undef DEFINE_OP_PREFIX_MATCH
+
 
 ///////////////////////////////////////////////////////////////////////////
 
 //
-template<RangeType Op>
-bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int8_t& lower,
-    const int8_t& upper,
-    const int8_t* const __restrict values,
+    const int8_t* const __restrict left, 
+    const int8_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
-    const int8x16x2_t lower_v = {vdupq_n_s8(lower), vdupq_n_s8(lower)};
-    const int8x16x2_t upper_v = {vdupq_n_s8(upper), vdupq_n_s8(upper)};
     uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
 
     // todo: aligned reads & writes
 
     const size_t size32 = (size / 32) * 32;
     for (size_t i = 0; i < size32; i += 32) {
-        const int8x16x2_t v0v = {vld1q_s8(values + i), vld1q_s8(values + i + 16)};
-        const uint8x16x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const uint8x16x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const uint8x16x2_t cmp = {vandq_u8(cmp0l.val[0], cmp0u.val[0]), vandq_u8(cmp0l.val[1], cmp0u.val[1])};
+        const int8x16x2_t v0l = {vld1q_s8(left + i), vld1q_s8(left + i + 16)};
+        const int8x16x2_t v0r = {vld1q_s8(right + i), vld1q_s8(right + i + 16)};
+        const uint8x16x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
         const uint32_t mmask = movemask(cmp);
 
         res_u32[i / 32] = mmask;
     }
 
     for (size_t i = size32; i < size; i += 8) {
-        const int8x8_t lower_v1 = vdup_n_s8(lower);
-        const int8x8_t upper_v1 = vdup_n_s8(upper);
-        const int8x8_t v0v = vld1_s8(values + i);
-        const uint8x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v1, v0v);
-        const uint8x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v1);
-        const uint8x8_t cmp = vand_u8(cmp0l, cmp0u);
+        const int8x8_t v0l = vld1_s8(left + i);
+        const int8x8_t v0r = vld1_s8(right + i);
+        const uint8x8_t cmp = CmpHelper<Op>::compare(v0l, v0r);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
-    }
+    }    
 
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int16_t& lower,
-    const int16_t& upper,
-    const int16_t* const __restrict values,
+    const int16_t* const __restrict left, 
+    const int16_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
-    const int16x8x2_t lower_v = {vdupq_n_s16(lower), vdupq_n_s16(lower)};
-    const int16x8x2_t upper_v = {vdupq_n_s16(upper), vdupq_n_s16(upper)};
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
 
     // todo: aligned reads & writes
 
     const size_t size16 = (size / 16) * 16;
     for (size_t i = 0; i < size16; i += 16) {
-        const int16x8x2_t v0v = {vld1q_s16(values + i), vld1q_s16(values + i + 8)};
-        const uint16x8x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const uint16x8x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const uint16x8x2_t cmp = {vandq_u16(cmp0l.val[0], cmp0u.val[0]), vandq_u16(cmp0l.val[1], cmp0u.val[1])};
+        const int16x8x2_t v0l = {vld1q_s16(left + i), vld1q_s16(left + i + 8)};
+        const int16x8x2_t v0r = {vld1q_s16(right + i), vld1q_s16(right + i + 8)};
+        const uint16x8x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
         const uint16_t mmask = movemask(cmp);
 
         res_u16[i / 16] = mmask;
@@ -993,10 +1174,9 @@ bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
 
     if (size16 != size) {
         // 8 elements to process
-        const int16x8_t v0v = vld1q_s16(values + size16);
-        const uint16x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v.val[0], v0v);
-        const uint16x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v.val[0]);
-        const uint16x8_t cmp = vandq_u16(cmp0l, cmp0u);
+        const int16x8_t v0l = vld1q_s16(left + size16);
+        const int16x8_t v0r = vld1q_s16(right + size16);
+        const uint16x8_t cmp = CmpHelper<Op>::compare(v0l, v0r);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[size16 / 8] = mmask;
@@ -1005,29 +1185,23 @@ bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int32_t& lower,
-    const int32_t& upper,
-    const int32_t* const __restrict values,
+    const int32_t* const __restrict left, 
+    const int32_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
-    //
-    const int32x4x2_t lower_v = {vdupq_n_s32(lower), vdupq_n_s32(lower)};
-    const int32x4x2_t upper_v = {vdupq_n_s32(upper), vdupq_n_s32(upper)};
-
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const int32x4x2_t v0v = {vld1q_s32(values + i), vld1q_s32(values + i + 4)};
-        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
+        const int32x4x2_t v0l = {vld1q_s32(left + i), vld1q_s32(left + i + 4)};
+        const int32x4x2_t v0r = {vld1q_s32(right + i), vld1q_s32(right + i + 4)};
+        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
@@ -1036,32 +1210,23 @@ bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int64_t& lower,
-    const int64_t& upper,
-    const int64_t* const __restrict values,
+    const int64_t* const __restrict left, 
+    const int64_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
-    //
-    const int64x2x4_t lower_v = {vdupq_n_s64(lower), vdupq_n_s64(lower), vdupq_n_s64(lower), vdupq_n_s64(lower)};
-    const int64x2x4_t upper_v = {vdupq_n_s64(upper), vdupq_n_s64(upper), vdupq_n_s64(upper), vdupq_n_s64(upper)};
-
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const int64x2x4_t v0v = {vld1q_s64(values + i), vld1q_s64(values + i + 2), vld1q_s64(values + i + 4), vld1q_s64(values + i + 6)};
-        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const uint64x2x4_t cmp = {
-            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
-            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
-        };
+        const int64x2x4_t v0l = {vld1q_s64(left + i), vld1q_s64(left + i + 2), vld1q_s64(left + i + 4), vld1q_s64(left + i + 6)};
+        const int64x2x4_t v0r = {vld1q_s64(right + i), vld1q_s64(right + i + 2), vld1q_s64(right + i + 4), vld1q_s64(right + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
@@ -1070,63 +1235,98 @@ bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint8_t, uint8_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const float& lower,
-    const float& upper,
-    const float* const __restrict values,
+    const uint8_t* const __restrict left, 
+    const uint8_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
-    const float32x4x2_t lower_v = {vdupq_n_f32(lower), vdupq_n_f32(lower)};
-    const float32x4x2_t upper_v = {vdupq_n_f32(upper), vdupq_n_f32(upper)};
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
 
     // todo: aligned reads & writes
 
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const float32x4x2_t v0v = {vld1q_f32(values + i), vld1q_f32(values + i + 4)};
-        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const uint8x16x2_t v0l = {vld1q_u8(left + i), vld1q_u8(left + i + 16)};
+        const uint8x16x2_t v0r = {vld1q_u8(right + i), vld1q_u8(right + i + 16)};
+        const uint8x16x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint32_t mmask = movemask(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    for (size_t i = size32; i < size; i += 8) {
+        const uint8x8_t v0l = vld1_u8(left + i);
+        const uint8x8_t v0r = vld1_u8(right + i);
+        const uint8x8_t cmp = CmpHelper<Op>::compare(v0l, v0r);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
-    }
+    }    
 
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint16_t, uint16_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const double& lower,
-    const double& upper,
-    const double* const __restrict values,
+    const uint16_t* const __restrict left, 
+    const uint16_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
-    const float64x2x4_t lower_v = {vdupq_n_f64(lower), vdupq_n_f64(lower), vdupq_n_f64(lower), vdupq_n_f64(lower)};
-    const float64x2x4_t upper_v = {vdupq_n_f64(upper), vdupq_n_f64(upper), vdupq_n_f64(upper), vdupq_n_f64(upper)};
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const uint16x8x2_t v0l = {vld1q_u16(left + i), vld1q_u16(left + i + 8)};
+        const uint16x8x2_t v0r = {vld1q_u16(right + i), vld1q_u16(right + i + 8)};
+        const uint16x8x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint16_t mmask = movemask(cmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const uint16x8_t v0l = vld1q_u16(left + size16);
+        const uint16x8_t v0r = vld1q_u16(right + size16);
+        const uint16x8_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint32_t, uint32_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict left, 
+    const uint32_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
 
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const float64x2x4_t v0v = {vld1q_f64(values + i), vld1q_f64(values + i + 2), vld1q_f64(values + i + 4), vld1q_f64(values + i + 6)};
-        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const uint64x2x4_t cmp = {
-            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
-            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
-        };
+        const uint32x4x2_t v0l = {vld1q_u32(left + i), vld1q_u32(left + i + 4)};
+        const uint32x4x2_t v0r = {vld1q_u32(right + i), vld1q_u32(right + i + 4)};
+        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
         const uint8_t mmask = movemask(cmp);
 
         res_u8[i / 8] = mmask;
@@ -1135,136 +1335,1422 @@ bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
     return true;
 }
 
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint64_t, uint64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict left, 
+    const uint64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
 
-///////////////////////////////////////////////////////////////////////////
-
-namespace {
+    // todo: aligned reads & writes
 
-//
-template<ArithOpType AOp, CompareOpType CmpOp>
-struct ArithHelperI64 {};
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const uint64x2x4_t v0l = {vld1q_u64(left + i), vld1q_u64(left + i + 2), vld1q_u64(left + i + 4), vld1q_u64(left + i + 6)};
+        const uint64x2x4_t v0r = {vld1q_u64(right + i), vld1q_u64(right + i + 2), vld1q_u64(right + i + 4), vld1q_u64(right + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
 
-template<CompareOpType CmpOp>
-struct ArithHelperI64<ArithOpType::Add, CmpOp> {
-    static inline uint64x2x4_t op(const int64x2x4_t left, const int64x2x4_t right, const int64x2x4_t value) {
-        // left + right == value
-        const int64x2x4_t lr = {
-            vaddq_s64(left.val[0], right.val[0]),
-            vaddq_s64(left.val[1], right.val[1]),
-            vaddq_s64(left.val[2], right.val[2]),
-            vaddq_s64(left.val[3], right.val[3])
-        };
-        return CmpHelper<CmpOp>::compare(lr, value);
+        res_u8[i / 8] = mmask;
     }
-};
 
-template<CompareOpType CmpOp>
-struct ArithHelperI64<ArithOpType::Sub, CmpOp> {
-    static inline uint64x2x4_t op(const int64x2x4_t left, const int64x2x4_t right, const int64x2x4_t value) {
-        // left - right == value
-        const int64x2x4_t lr = {
-            vsubq_s64(left.val[0], right.val[0]),
-            vsubq_s64(left.val[1], right.val[1]),
-            vsubq_s64(left.val[2], right.val[2]),
-            vsubq_s64(left.val[3], right.val[3])
-        };
-        return CmpHelper<CmpOp>::compare(lr, value);
-    }
-};
+    return true;
+}
 
-// template<CompareOpType CmpOp>
-// struct ArithHelperI64<ArithOpType::Mul, CmpOp> {
-//     // todo draft: https://stackoverflow.com/questions/60236627/facing-problem-in-implementing-multiplication-of-64-bit-variables-using-arm-neon
-//     inline int64x2_t arm_vmulq_s64(const int64x2_t a, const int64x2_t b)
-//     {
-//         const auto ac = vmovn_s64(a);
-//         const auto pr = vmovn_s64(b);
+template<CompareOpType Op>
+bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left, 
+    const float* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
 
-//         const auto hi = vmulq_s32(b, vrev64q_s32(a));
+    // todo: aligned reads & writes
 
-//         return vmlal_u32(vshlq_n_s64(vpaddlq_u32(hi), 32), ac, pr);
-//     }
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const float32x4x2_t v0l = {vld1q_f32(left + i), vld1q_f32(left + i + 4)};
+        const float32x4x2_t v0r = {vld1q_f32(right + i), vld1q_f32(right + i + 4)};
+        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
 
-//     static inline uint64x2x4_t op(const int64x2x4_t left, const int64x2x4_t right, const int64x2x4_t value) {
-//         // left * right == value
-//         const int64x2x4_t lr = {
-//             arm_vmulq_s64(left.val[0], right.val[0]),
-//             arm_vmulq_s64(left.val[1], right.val[1]),
-//             arm_vmulq_s64(left.val[2], right.val[2]),
-//             arm_vmulq_s64(left.val[3], right.val[3])
-//         };
-//         return CmpHelper<CmpOp>::compare(lr, value);
-//     }
-// };
+        res_u8[i / 8] = mmask;
+    }
 
-//
-template<ArithOpType AOp, CompareOpType CmpOp>
-struct ArithHelperF32 {};
+    return true;
+}
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Add, CmpOp> {
-    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
-        // left + right == value
-        const float32x4x2_t lr = {
-            vaddq_f32(left.val[0], right.val[0]),
-            vaddq_f32(left.val[1], right.val[1])
-        };
-        return CmpHelper<CmpOp>::compare(lr, value);
-    }
-};
+template<CompareOpType Op>
+bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Sub, CmpOp> {
-    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
-        // left - right == value
-        const float32x4x2_t lr = {
-            vsubq_f32(left.val[0], right.val[0]),
-            vsubq_f32(left.val[1], right.val[1])
-        };
-        return CmpHelper<CmpOp>::compare(lr, value);
-    }
-};
+    // todo: aligned reads & writes
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Mul, CmpOp> {
-    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
-        // left * right == value
-        const float32x4x2_t lr = {
-            vmulq_f32(left.val[0], right.val[0]),
-            vmulq_f32(left.val[1], right.val[1])
-        };
-        return CmpHelper<CmpOp>::compare(lr, value);
-    }
-};
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const float64x2x4_t v0l = {vld1q_f64(left + i), vld1q_f64(left + i + 2), vld1q_f64(left + i + 4), vld1q_f64(left + i + 6)};
+        const float64x2x4_t v0r = {vld1q_f64(right + i), vld1q_f64(right + i + 2), vld1q_f64(right + i + 4), vld1q_f64(right + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Div, CmpOp> {
-    static inline uint32x4x2_t op_special(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
-        // this is valid for the positive denominator, == and != cases.
-        // left == right * value
-        const float32x4x2_t rv = {
-            vmulq_f32(right.val[0], value.val[0]),
-            vmulq_f32(right.val[1], value.val[1])
-        };
-        return CmpHelper<CmpOp>::compare(left, rv);
+        res_u8[i / 8] = mmask;
     }
 
-    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
-        // left / right == value
-        const float32x4x2_t rv = {
-            vdivq_f32(left.val[0], right.val[0]),
-            vdivq_f32(left.val[1], right.val[1])
-        };
-        return CmpHelper<CmpOp>::compare(rv, value);
-    }
-};
+    return true;
+}
 
-//
-template<ArithOpType AOp, CompareOpType CmpOp>
-struct ArithHelperF64 {};
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int8_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
 
-template<CompareOpType CmpOp>
-struct ArithHelperF64<ArithOpType::Add, CmpOp> {
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const int16x8_t v0l_16 = vmovl_s8(vld1_s8(left + i));
+        const int32x4_t v0l_32 = vmovl_s16(vget_low_s16(v0l_16));
+        const int32x4_t v1l_32 = vmovl_s16(vget_high_s16(v0l_16));
+        const int64x2x4_t v0l = {vmovl_s32(vget_low_s32(v0l_32)), vmovl_s32(vget_high_s32(v0l_32)), vmovl_s32(vget_low_s32(v1l_32)), vmovl_s32(vget_high_s32(v1l_32))};
+        const int64x2x4_t v0r = {vld1q_s64(right + i), vld1q_s64(right + i + 2), vld1q_s64(right + i + 4), vld1q_s64(right + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int16_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const int16x8_t v0l_16 = vld1q_s16(left + i);
+        const int32x4_t v0l_32 = vmovl_s16(vget_low_s16(v0l_16));
+        const int32x4_t v1l_32 = vmovl_s16(vget_high_s16(v0l_16));
+        const int64x2x4_t v0l = {vmovl_s32(vget_low_s32(v0l_32)), vmovl_s32(vget_high_s32(v0l_32)), vmovl_s32(vget_low_s32(v1l_32)), vmovl_s32(vget_high_s32(v1l_32))};
+        const int64x2x4_t v0r = {vld1q_s64(right + i), vld1q_s64(right + i + 2), vld1q_s64(right + i + 4), vld1q_s64(right + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const int32x4_t v0l_32 = vld1q_s32(left + i);
+        const int32x4_t v1l_32 = vld1q_s32(left + i + 4);
+        const int64x2x4_t v0l = {vmovl_s32(vget_low_s32(v0l_32)), vmovl_s32(vget_high_s32(v0l_32)), vmovl_s32(vget_low_s32(v1l_32)), vmovl_s32(vget_high_s32(v1l_32))};
+        const int64x2x4_t v0r = {vld1q_s64(right + i), vld1q_s64(right + i + 2), vld1q_s64(right + i + 4), vld1q_s64(right + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const float* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    // int32_t is rounded to float, the same way as C++ does
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const float32x4x2_t v0l = {vcvtq_f32_s32(vld1q_s32(left + i)), vcvtq_f32_s32(vld1q_s32(left + i + 4))};
+        const float32x4x2_t v0r = {vld1q_f32(right + i), vld1q_f32(right + i + 4)};
+        const uint32x4x2_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const int32x4_t v0l_32 = vld1q_s32(left + i);
+        const int32x4_t v1l_32 = vld1q_s32(left + i + 4);
+        // int32_t to double conversion is exact
+        const float64x2x4_t v0l = {
+            vcvtq_f64_s64(vmovl_s32(vget_low_s32(v0l_32))), 
+            vcvtq_f64_s64(vmovl_s32(vget_high_s32(v0l_32))), 
+            vcvtq_f64_s64(vmovl_s32(vget_low_s32(v1l_32))), 
+            vcvtq_f64_s64(vmovl_s32(vget_high_s32(v1l_32)))
+        };
+        const float64x2x4_t v0r = {vld1q_f64(right + i), vld1q_f64(right + i + 2), vld1q_f64(right + i + 4), vld1q_f64(right + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<float, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const float32x4_t v0l_32 = vld1q_f32(left + i);
+        const float32x4_t v1l_32 = vld1q_f32(left + i + 4);
+        const float64x2x4_t v0l = {
+            vcvt_f64_f32(vget_low_f32(v0l_32)), 
+            vcvt_high_f64_f32(v0l_32), 
+            vcvt_f64_f32(vget_low_f32(v1l_32)), 
+            vcvt_high_f64_f32(v1l_32)
+        };
+        const float64x2x4_t v0r = {vld1q_f64(right + i), vld1q_f64(right + i + 2), vld1q_f64(right + i + 4), vld1q_f64(right + i + 6)};
+        const uint64x2x4_t cmp = CmpHelper<Op>::compare(v0l, v0r);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+//
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict lower,
+    const int8_t* const __restrict upper,
+    const int8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const int8x16x2_t v0l = {vld1q_s8(lower + i), vld1q_s8(lower + i + 16)};
+        const int8x16x2_t v0u = {vld1q_s8(upper + i), vld1q_s8(upper + i + 16)};
+        const int8x16x2_t v0v = {vld1q_s8(values + i), vld1q_s8(values + i + 16)};
+        const uint8x16x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint8x16x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint8x16x2_t cmp = {vandq_u8(cmp0l.val[0], cmp0u.val[0]), vandq_u8(cmp0l.val[1], cmp0u.val[1])};
+        const uint32_t mmask = movemask(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    for (size_t i = size32; i < size; i += 8) {
+        const int8x8_t v0l = vld1_s8(lower + i);
+        const int8x8_t v0u = vld1_s8(upper + i);
+        const int8x8_t v0v = vld1_s8(values + i);
+        const uint8x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint8x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint8x8_t cmp = vand_u8(cmp0l, cmp0u);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict lower,
+    const int16_t* const __restrict upper,
+    const int16_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const int16x8x2_t v0l = {vld1q_s16(lower + i), vld1q_s16(lower + i + 8)};
+        const int16x8x2_t v0u = {vld1q_s16(upper + i), vld1q_s16(upper + i + 8)};
+        const int16x8x2_t v0v = {vld1q_s16(values + i), vld1q_s16(values + i + 8)};
+        const uint16x8x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint16x8x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint16x8x2_t cmp = {vandq_u16(cmp0l.val[0], cmp0u.val[0]), vandq_u16(cmp0l.val[1], cmp0u.val[1])};
+        const uint16_t mmask = movemask(cmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const int16x8_t v0l = vld1q_s16(lower + size16);
+        const int16x8_t v0u = vld1q_s16(upper + size16);
+        const int16x8_t v0v = vld1q_s16(values + size16);
+        const uint16x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint16x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint16x8_t cmp = vandq_u16(cmp0l, cmp0u);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict lower,
+    const int32_t* const __restrict upper,
+    const int32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const int32x4x2_t v0l = {vld1q_s32(lower + i), vld1q_s32(lower + i + 4)};
+        const int32x4x2_t v0u = {vld1q_s32(upper + i), vld1q_s32(upper + i + 4)};
+        const int32x4x2_t v0v = {vld1q_s32(values + i), vld1q_s32(values + i + 4)};
+        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict lower,
+    const int64_t* const __restrict upper,
+    const int64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const int64x2x4_t v0l = {vld1q_s64(lower + i), vld1q_s64(lower + i + 2), vld1q_s64(lower + i + 4), vld1q_s64(lower + i + 6)};
+        const int64x2x4_t v0u = {vld1q_s64(upper + i), vld1q_s64(upper + i + 2), vld1q_s64(upper + i + 4), vld1q_s64(upper + i + 6)};
+        const int64x2x4_t v0v = {vld1q_s64(values + i), vld1q_s64(values + i + 2), vld1q_s64(values + i + 4), vld1q_s64(values + i + 6)};
+        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint64x2x4_t cmp = {
+            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
+            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
+        };
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint8_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint8_t* const __restrict lower,
+    const uint8_t* const __restrict upper,
+    const uint8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const uint8x16x2_t v0l = {vld1q_u8(lower + i), vld1q_u8(lower + i + 16)};
+        const uint8x16x2_t v0u = {vld1q_u8(upper + i), vld1q_u8(upper + i + 16)};
+        const uint8x16x2_t v0v = {vld1q_u8(values + i), vld1q_u8(values + i + 16)};
+        const uint8x16x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint8x16x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint8x16x2_t cmp = {vandq_u8(cmp0l.val[0], cmp0u.val[0]), vandq_u8(cmp0l.val[1], cmp0u.val[1])};
+        const uint32_t mmask = movemask(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    for (size_t i = size32; i < size; i += 8) {
+        const uint8x8_t v0l = vld1_u8(lower + i);
+        const uint8x8_t v0u = vld1_u8(upper + i);
+        const uint8x8_t v0v = vld1_u8(values + i);
+        const uint8x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint8x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint8x8_t cmp = vand_u8(cmp0l, cmp0u);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint16_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint16_t* const __restrict lower,
+    const uint16_t* const __restrict upper,
+    const uint16_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const uint16x8x2_t v0l = {vld1q_u16(lower + i), vld1q_u16(lower + i + 8)};
+        const uint16x8x2_t v0u = {vld1q_u16(upper + i), vld1q_u16(upper + i + 8)};
+        const uint16x8x2_t v0v = {vld1q_u16(values + i), vld1q_u16(values + i + 8)};
+        const uint16x8x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint16x8x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint16x8x2_t cmp = {vandq_u16(cmp0l.val[0], cmp0u.val[0]), vandq_u16(cmp0l.val[1], cmp0u.val[1])};
+        const uint16_t mmask = movemask(cmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const uint16x8_t v0l = vld1q_u16(lower + size16);
+        const uint16x8_t v0u = vld1q_u16(upper + size16);
+        const uint16x8_t v0v = vld1q_u16(values + size16);
+        const uint16x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint16x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint16x8_t cmp = vandq_u16(cmp0l, cmp0u);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint32_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict lower,
+    const uint32_t* const __restrict upper,
+    const uint32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const uint32x4x2_t v0l = {vld1q_u32(lower + i), vld1q_u32(lower + i + 4)};
+        const uint32x4x2_t v0u = {vld1q_u32(upper + i), vld1q_u32(upper + i + 4)};
+        const uint32x4x2_t v0v = {vld1q_u32(values + i), vld1q_u32(values + i + 4)};
+        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint64_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict lower,
+    const uint64_t* const __restrict upper,
+    const uint64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const uint64x2x4_t v0l = {vld1q_u64(lower + i), vld1q_u64(lower + i + 2), vld1q_u64(lower + i + 4), vld1q_u64(lower + i + 6)};
+        const uint64x2x4_t v0u = {vld1q_u64(upper + i), vld1q_u64(upper + i + 2), vld1q_u64(upper + i + 4), vld1q_u64(upper + i + 6)};
+        const uint64x2x4_t v0v = {vld1q_u64(values + i), vld1q_u64(values + i + 2), vld1q_u64(values + i + 4), vld1q_u64(values + i + 6)};
+        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint64x2x4_t cmp = {
+            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
+            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
+        };
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<float, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict lower,
+    const float* const __restrict upper,
+    const float* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const float32x4x2_t v0l = {vld1q_f32(lower + i), vld1q_f32(lower + i + 4)};
+        const float32x4x2_t v0u = {vld1q_f32(upper + i), vld1q_f32(upper + i + 4)};
+        const float32x4x2_t v0v = {vld1q_f32(values + i), vld1q_f32(values + i + 4)};
+        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict lower,
+    const double* const __restrict upper,
+    const double* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const float64x2x4_t v0l = {vld1q_f64(lower + i), vld1q_f64(lower + i + 2), vld1q_f64(lower + i + 4), vld1q_f64(lower + i + 6)};
+        const float64x2x4_t v0u = {vld1q_f64(upper + i), vld1q_f64(upper + i + 2), vld1q_f64(upper + i + 4), vld1q_f64(upper + i + 6)};
+        const float64x2x4_t v0v = {vld1q_f64(values + i), vld1q_f64(values + i + 2), vld1q_f64(values + i + 4), vld1q_f64(values + i + 6)};
+        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const uint64x2x4_t cmp = {
+            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
+            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
+        };
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+//
+template<RangeType Op>
+bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int8_t& lower,
+    const int8_t& upper,
+    const int8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const int8x16x2_t lower_v = {vdupq_n_s8(lower), vdupq_n_s8(lower)};
+    const int8x16x2_t upper_v = {vdupq_n_s8(upper), vdupq_n_s8(upper)};
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const int8x16x2_t v0v = {vld1q_s8(values + i), vld1q_s8(values + i + 16)};
+        const uint8x16x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint8x16x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint8x16x2_t cmp = {vandq_u8(cmp0l.val[0], cmp0u.val[0]), vandq_u8(cmp0l.val[1], cmp0u.val[1])};
+        const uint32_t mmask = movemask(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    for (size_t i = size32; i < size; i += 8) {
+        const int8x8_t lower_v1 = vdup_n_s8(lower);
+        const int8x8_t upper_v1 = vdup_n_s8(upper);
+        const int8x8_t v0v = vld1_s8(values + i);
+        const uint8x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v1, v0v);
+        const uint8x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v1);
+        const uint8x8_t cmp = vand_u8(cmp0l, cmp0u);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int16_t& lower,
+    const int16_t& upper,
+    const int16_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const int16x8x2_t lower_v = {vdupq_n_s16(lower), vdupq_n_s16(lower)};
+    const int16x8x2_t upper_v = {vdupq_n_s16(upper), vdupq_n_s16(upper)};
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const int16x8x2_t v0v = {vld1q_s16(values + i), vld1q_s16(values + i + 8)};
+        const uint16x8x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint16x8x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint16x8x2_t cmp = {vandq_u16(cmp0l.val[0], cmp0u.val[0]), vandq_u16(cmp0l.val[1], cmp0u.val[1])};
+        const uint16_t mmask = movemask(cmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const int16x8_t v0v = vld1q_s16(values + size16);
+        const uint16x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v.val[0], v0v);
+        const uint16x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v.val[0]);
+        const uint16x8_t cmp = vandq_u16(cmp0l, cmp0u);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int32_t& lower,
+    const int32_t& upper,
+    const int32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const int32x4x2_t lower_v = {vdupq_n_s32(lower), vdupq_n_s32(lower)};
+    const int32x4x2_t upper_v = {vdupq_n_s32(upper), vdupq_n_s32(upper)};
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const int32x4x2_t v0v = {vld1q_s32(values + i), vld1q_s32(values + i + 4)};
+        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int64_t& lower,
+    const int64_t& upper,
+    const int64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const int64x2x4_t lower_v = {vdupq_n_s64(lower), vdupq_n_s64(lower), vdupq_n_s64(lower), vdupq_n_s64(lower)};
+    const int64x2x4_t upper_v = {vdupq_n_s64(upper), vdupq_n_s64(upper), vdupq_n_s64(upper), vdupq_n_s64(upper)};
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const int64x2x4_t v0v = {vld1q_s64(values + i), vld1q_s64(values + i + 2), vld1q_s64(values + i + 4), vld1q_s64(values + i + 6)};
+        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint64x2x4_t cmp = {
+            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
+            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
+        };
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint8_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint8_t& lower,
+    const uint8_t& upper,
+    const uint8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const uint8x16x2_t lower_v = {vdupq_n_u8(lower), vdupq_n_u8(lower)};
+    const uint8x16x2_t upper_v = {vdupq_n_u8(upper), vdupq_n_u8(upper)};
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const uint8x16x2_t v0v = {vld1q_u8(values + i), vld1q_u8(values + i + 16)};
+        const uint8x16x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint8x16x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint8x16x2_t cmp = {vandq_u8(cmp0l.val[0], cmp0u.val[0]), vandq_u8(cmp0l.val[1], cmp0u.val[1])};
+        const uint32_t mmask = movemask(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    for (size_t i = size32; i < size; i += 8) {
+        const uint8x8_t lower_v1 = vdup_n_u8(lower);
+        const uint8x8_t upper_v1 = vdup_n_u8(upper);
+        const uint8x8_t v0v = vld1_u8(values + i);
+        const uint8x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v1, v0v);
+        const uint8x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v1);
+        const uint8x8_t cmp = vand_u8(cmp0l, cmp0u);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint16_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint16_t& lower,
+    const uint16_t& upper,
+    const uint16_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const uint16x8x2_t lower_v = {vdupq_n_u16(lower), vdupq_n_u16(lower)};
+    const uint16x8x2_t upper_v = {vdupq_n_u16(upper), vdupq_n_u16(upper)};
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const uint16x8x2_t v0v = {vld1q_u16(values + i), vld1q_u16(values + i + 8)};
+        const uint16x8x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint16x8x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint16x8x2_t cmp = {vandq_u16(cmp0l.val[0], cmp0u.val[0]), vandq_u16(cmp0l.val[1], cmp0u.val[1])};
+        const uint16_t mmask = movemask(cmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const uint16x8_t v0v = vld1q_u16(values + size16);
+        const uint16x8_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v.val[0], v0v);
+        const uint16x8_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v.val[0]);
+        const uint16x8_t cmp = vandq_u16(cmp0l, cmp0u);
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint32_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint32_t& lower,
+    const uint32_t& upper,
+    const uint32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const uint32x4x2_t lower_v = {vdupq_n_u32(lower), vdupq_n_u32(lower)};
+    const uint32x4x2_t upper_v = {vdupq_n_u32(upper), vdupq_n_u32(upper)};
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const uint32x4x2_t v0v = {vld1q_u32(values + i), vld1q_u32(values + i + 4)};
+        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint64_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint64_t& lower,
+    const uint64_t& upper,
+    const uint64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const uint64x2x4_t lower_v = {vdupq_n_u64(lower), vdupq_n_u64(lower), vdupq_n_u64(lower), vdupq_n_u64(lower)};
+    const uint64x2x4_t upper_v = {vdupq_n_u64(upper), vdupq_n_u64(upper), vdupq_n_u64(upper), vdupq_n_u64(upper)};
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const uint64x2x4_t v0v = {vld1q_u64(values + i), vld1q_u64(values + i + 2), vld1q_u64(values + i + 4), vld1q_u64(values + i + 6)};
+        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint64x2x4_t cmp = {
+            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
+            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
+        };
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const float& lower,
+    const float& upper,
+    const float* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const float32x4x2_t lower_v = {vdupq_n_f32(lower), vdupq_n_f32(lower)};
+    const float32x4x2_t upper_v = {vdupq_n_f32(upper), vdupq_n_f32(upper)};
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const float32x4x2_t v0v = {vld1q_f32(values + i), vld1q_f32(values + i + 4)};
+        const uint32x4x2_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint32x4x2_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint32x4x2_t cmp = {vandq_u32(cmp0l.val[0], cmp0u.val[0]), vandq_u32(cmp0l.val[1], cmp0u.val[1])};
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const double& lower,
+    const double& upper,
+    const double* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const float64x2x4_t lower_v = {vdupq_n_f64(lower), vdupq_n_f64(lower), vdupq_n_f64(lower), vdupq_n_f64(lower)};
+    const float64x2x4_t upper_v = {vdupq_n_f64(upper), vdupq_n_f64(upper), vdupq_n_f64(upper), vdupq_n_f64(upper)};
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const float64x2x4_t v0v = {vld1q_f64(values + i), vld1q_f64(values + i + 2), vld1q_f64(values + i + 4), vld1q_f64(values + i + 6)};
+        const uint64x2x4_t cmp0l = CmpHelper<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const uint64x2x4_t cmp0u = CmpHelper<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const uint64x2x4_t cmp = {
+            vandq_u64(cmp0l.val[0], cmp0u.val[0]), vandq_u64(cmp0l.val[1], cmp0u.val[1]),
+            vandq_u64(cmp0l.val[2], cmp0u.val[2]), vandq_u64(cmp0l.val[3], cmp0u.val[3])
+        };
+        const uint8_t mmask = movemask(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// a broadcasted DivisorI64
+struct DivisorVecI64 {
+    DivisorI64 d;
+
+    int64x2_t divisor;
+    uint32x2_t divisor_lo;
+    uint32x2_t divisor_hi;
+    int64x2_t magic;
+    uint32x2_t magic_lo;
+    uint32x2_t magic_hi;
+    // -1 if magic is negative, 0 otherwise
+    int64x2_t magic_sign;
+    // -1 if the divisor is negative, 0 otherwise
+    int64x2_t sign;
+    // -1 if the numerator needs to be added, 0 otherwise
+    int64x2_t add;
+    // 2^shift - 1
+    int64x2_t mask;
+    // vshlq_s64() with a negative shift is an arithmetic right shift
+    int64x2_t neg_shift;
+
+    explicit DivisorVecI64(const int64_t right) : d{right} {
+        divisor = vdupq_n_s64(d.divisor);
+        divisor_lo = vdup_n_u32(uint32_t(uint64_t(d.divisor)));
+        divisor_hi = vdup_n_u32(uint32_t(uint64_t(d.divisor) >> 32));
+        magic = vdupq_n_s64(d.magic);
+        magic_lo = vdup_n_u32(uint32_t(uint64_t(d.magic)));
+        magic_hi = vdup_n_u32(uint32_t(uint64_t(d.magic) >> 32));
+        magic_sign = vdupq_n_s64((d.magic < 0) ? -1 : 0);
+        sign = vdupq_n_s64(d.negative ? -1 : 0);
+        add = vdupq_n_s64(d.add ? -1 : 0);
+        mask = vdupq_n_s64((uint64_t(1) << d.shift) - 1);
+        neg_shift = vdupq_n_s64(-int64_t(d.shift));
+    }
+
+    // signed high 64 bits of x * magic
+    inline int64x2_t mulhi(const int64x2_t x) const {
+        const uint64x2_t ux = vreinterpretq_u64_s64(x);
+        const uint32x2_t x_lo = vmovn_u64(ux);
+        const uint32x2_t x_hi = vshrn_n_u64(ux, 32);
+
+        const uint64x2_t ll = vmull_u32(x_lo, magic_lo);
+        const uint64x2_t lh = vmull_u32(x_lo, magic_hi);
+        const uint64x2_t hl = vmull_u32(x_hi, magic_lo);
+        const uint64x2_t hh = vmull_u32(x_hi, magic_hi);
+
+        const uint64x2_t t = vsraq_n_u64(hl, ll, 32);
+        const uint64x2_t u = vaddq_u64(lh, vandq_u64(t, vdupq_n_u64(0xFFFFFFFF)));
+        const uint64x2_t hi_u = vsraq_n_u64(vsraq_n_u64(hh, t, 32), u, 32);
+
+        // convert from unsigned to signed
+        const int64x2_t corr = vaddq_s64(
+            vandq_s64(vshrq_n_s64(x, 63), magic),
+            vandq_s64(magic_sign, x)
+        );
+        return vsubq_s64(vreinterpretq_s64_u64(hi_u), corr);
+    }
+
+    // lower 64 bits of q * divisor
+    inline int64x2_t mullo(const int64x2_t q) const {
+        const uint64x2_t uq = vreinterpretq_u64_s64(q);
+        const uint32x2_t q_lo = vmovn_u64(uq);
+        const uint32x2_t q_hi = vshrn_n_u64(uq, 32);
+
+        // only lower 32 bits of cross products matter
+        const uint64x2_t cross = vmlal_u32(vmull_u32(q_lo, divisor_hi), q_hi, divisor_lo);
+        return vreinterpretq_s64_u64(vmlal_u32(vshlq_n_u64(cross, 32), q_lo, divisor_lo));
+    }
+
+    // x / divisor, truncated
+    inline int64x2_t divide(const int64x2_t x) const {
+        if (d.magic == 0) {
+            // +-2^shift
+            const int64x2_t bias = vandq_s64(vshrq_n_s64(x, 63), mask);
+            const int64x2_t q = vshlq_s64(vaddq_s64(x, bias), neg_shift);
+            return vsubq_s64(veorq_s64(q, sign), sign);
+        } else {
+            const int64x2_t hi = mulhi(x);
+            const int64x2_t x_signed = vsubq_s64(veorq_s64(x, sign), sign);
+            const int64x2_t uq = vaddq_s64(hi, vandq_s64(x_signed, add));
+            const uint64x2_t q = vreinterpretq_u64_s64(vshlq_s64(uq, neg_shift));
+            return vreinterpretq_s64_u64(vsraq_n_u64(q, q, 63));
+        }
+    }
+
+    // x % divisor, the sign follows x
+    inline int64x2_t modulo(const int64x2_t x) const {
+        return vsubq_s64(x, mullo(divide(x)));
+    }
+};
+
+// Div and Mod use a precomputed divisor instead of a plain value
+template<ArithOpType AOp>
+struct ArithOperandI64 {
+    static inline int64x2x4_t make(const int64_t right) {
+        const int64x2x4_t right_v = {vdupq_n_s64(right), vdupq_n_s64(right), vdupq_n_s64(right), vdupq_n_s64(right)};
+        return right_v;
+    }
+};
+
+template<>
+struct ArithOperandI64<ArithOpType::Div> {
+    static inline DivisorVecI64 make(const int64_t right) {
+        return DivisorVecI64(right);
+    }
+};
+
+template<>
+struct ArithOperandI64<ArithOpType::Mod> {
+    static inline DivisorVecI64 make(const int64_t right) {
+        return DivisorVecI64(right);
+    }
+};
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperI64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Add, CmpOp> {
+    static inline uint64x2x4_t op(const int64x2x4_t left, const int64x2x4_t right, const int64x2x4_t value) {
+        // left + right == value
+        const int64x2x4_t lr = {
+            vaddq_s64(left.val[0], right.val[0]),
+            vaddq_s64(left.val[1], right.val[1]),
+            vaddq_s64(left.val[2], right.val[2]),
+            vaddq_s64(left.val[3], right.val[3])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Sub, CmpOp> {
+    static inline uint64x2x4_t op(const int64x2x4_t left, const int64x2x4_t right, const int64x2x4_t value) {
+        // left - right == value
+        const int64x2x4_t lr = {
+            vsubq_s64(left.val[0], right.val[0]),
+            vsubq_s64(left.val[1], right.val[1]),
+            vsubq_s64(left.val[2], right.val[2]),
+            vsubq_s64(left.val[3], right.val[3])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Div, CmpOp> {
+    static inline uint64x2x4_t op(const int64x2x4_t left, const DivisorVecI64& right, const int64x2x4_t value) {
+        // left / right == value
+        const int64x2x4_t lr = {
+            right.divide(left.val[0]),
+            right.divide(left.val[1]),
+            right.divide(left.val[2]),
+            right.divide(left.val[3])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Mod, CmpOp> {
+    static inline uint64x2x4_t op(const int64x2x4_t left, const DivisorVecI64& right, const int64x2x4_t value) {
+        // left % right == value
+        const int64x2x4_t lr = {
+            right.modulo(left.val[0]),
+            right.modulo(left.val[1]),
+            right.modulo(left.val[2]),
+            right.modulo(left.val[3])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+// uint64_t uses the modular arithmetic, so only the comparison differs
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperU64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Add, CmpOp> {
+    static inline uint64x2x4_t op(const uint64x2x4_t left, const uint64x2x4_t right, const uint64x2x4_t value) {
+        // left + right == value
+        const uint64x2x4_t lr = {
+            vaddq_u64(left.val[0], right.val[0]),
+            vaddq_u64(left.val[1], right.val[1]),
+            vaddq_u64(left.val[2], right.val[2]),
+            vaddq_u64(left.val[3], right.val[3])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Sub, CmpOp> {
+    static inline uint64x2x4_t op(const uint64x2x4_t left, const uint64x2x4_t right, const uint64x2x4_t value) {
+        // left - right == value
+        const uint64x2x4_t lr = {
+            vsubq_u64(left.val[0], right.val[0]),
+            vsubq_u64(left.val[1], right.val[1]),
+            vsubq_u64(left.val[2], right.val[2]),
+            vsubq_u64(left.val[3], right.val[3])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+// template<CompareOpType CmpOp>
+// struct ArithHelperI64<ArithOpType::Mul, CmpOp> {
+//     // todo draft: https://stackoverflow.com/questions/60236627/facing-problem-in-implementing-multiplication-of-64-bit-variables-using-arm-neon
+//     inline int64x2_t arm_vmulq_s64(const int64x2_t a, const int64x2_t b)
+//     {
+//         const auto ac = vmovn_s64(a);
+//         const auto pr = vmovn_s64(b);
+
+//         const auto hi = vmulq_s32(b, vrev64q_s32(a));
+
+//         return vmlal_u32(vshlq_n_s64(vpaddlq_u32(hi), 32), ac, pr);
+//     }
+
+//     static inline uint64x2x4_t op(const int64x2x4_t left, const int64x2x4_t right, const int64x2x4_t value) {
+//         // left * right == value
+//         const int64x2x4_t lr = {
+//             arm_vmulq_s64(left.val[0], right.val[0]),
+//             arm_vmulq_s64(left.val[1], right.val[1]),
+//             arm_vmulq_s64(left.val[2], right.val[2]),
+//             arm_vmulq_s64(left.val[3], right.val[3])
+//         };
+//         return CmpHelper<CmpOp>::compare(lr, value);
+//     }
+// };
+
+// std::fmod(x, y), bit for bit.
+// x - trunc(x / y) * y is computed exactly with fma, if trunc(x / y) is exact
+//   and is wrong by 1 at most, which is the case for |x / y| < 2^51 (2^22 for floats).
+//   Such a quotient is fixed by looking at the sign and the magnitude of the remainder.
+// |x| < |y| case returns x, this also handles y = +-inf.
+// The rest of lanes (NaN, Inf, zero divisor, huge quotients) are rare and
+//   are processed with std::fmod.
+inline float64x2_t fmod_f64(const float64x2_t x, const float64x2_t y) {
+    const uint64x2_t sign_bit = vdupq_n_u64(0x8000000000000000ULL);
+
+    const float64x2_t abs_x = vabsq_f64(x);
+    const float64x2_t abs_y = vabsq_f64(y);
+
+    const float64x2_t q = vrndq_f64(vdivq_f64(x, y));
+    const float64x2_t r0 = vfmsq_f64(x, q, y);
+
+    // +1 or -1, the sign of the quotient
+    const uint64x2_t s = vorrq_u64(
+        vandq_u64(veorq_u64(vreinterpretq_u64_f64(x), vreinterpretq_u64_f64(y)), sign_bit),
+        vreinterpretq_u64_f64(vdupq_n_f64(1.0)));
+
+    // the quotient is too small or too large by 1
+    const uint64x2_t too_small = vcgeq_f64(vabsq_f64(r0), abs_y);
+    const uint64x2_t diff_sign = vreinterpretq_u64_s64(vshrq_n_s64(
+        vreinterpretq_s64_u64(veorq_u64(vreinterpretq_u64_f64(r0), vreinterpretq_u64_f64(x))), 63));
+    const uint64x2_t too_large = vbicq_u64(diff_sign, vceqzq_f64(r0));
+    const float64x2_t q1 = vsubq_f64(
+        vaddq_f64(q, vreinterpretq_f64_u64(vandq_u64(too_small, s))),
+        vreinterpretq_f64_u64(vandq_u64(too_large, s)));
+
+    // the sign of the remainder is the sign of x, including zeros
+    const float64x2_t r1 = vfmsq_f64(x, q1, y);
+    const float64x2_t r = vbslq_f64(sign_bit, x, r1);
+
+    const uint64x2_t is_small = vcltq_f64(abs_x, abs_y);
+    const uint64x2_t is_fast = vcltq_f64(vabsq_f64(q), vdupq_n_f64(2251799813685248.0));
+    const float64x2_t result = vbslq_f64(is_small, x, r);
+
+    const uint64x2_t is_done = vorrq_u64(is_small, is_fast);
+    if (vminvq_u32(vreinterpretq_u32_u64(is_done)) == 0xFFFFFFFF) {
+        return result;
+    }
+
+    double x_s[2];
+    double y_s[2];
+    double result_s[2];
+    uint64_t is_done_s[2];
+    vst1q_f64(x_s, x);
+    vst1q_f64(y_s, y);
+    vst1q_f64(result_s, result);
+    vst1q_u64(is_done_s, is_done);
+    for (size_t i = 0; i < 2; i++) {
+        if (is_done_s[i] == 0) {
+            result_s[i] = std::fmod(x_s[i], y_s[i]);
+        }
+    }
+
+    return vld1q_f64(result_s);
+}
+
+inline float32x4_t fmod_f32(const float32x4_t x, const float32x4_t y) {
+    const uint32x4_t sign_bit = vdupq_n_u32(0x80000000);
+
+    const float32x4_t abs_x = vabsq_f32(x);
+    const float32x4_t abs_y = vabsq_f32(y);
+
+    const float32x4_t q = vrndq_f32(vdivq_f32(x, y));
+    const float32x4_t r0 = vfmsq_f32(x, q, y);
+
+    // +1 or -1, the sign of the quotient
+    const uint32x4_t s = vorrq_u32(
+        vandq_u32(veorq_u32(vreinterpretq_u32_f32(x), vreinterpretq_u32_f32(y)), sign_bit),
+        vreinterpretq_u32_f32(vdupq_n_f32(1.0f)));
+
+    // the quotient is too small or too large by 1
+    const uint32x4_t too_small = vcgeq_f32(vabsq_f32(r0), abs_y);
+    const uint32x4_t diff_sign = vreinterpretq_u32_s32(vshrq_n_s32(
+        vreinterpretq_s32_u32(veorq_u32(vreinterpretq_u32_f32(r0), vreinterpretq_u32_f32(x))), 31));
+    const uint32x4_t too_large = vbicq_u32(diff_sign, vceqzq_f32(r0));
+    const float32x4_t q1 = vsubq_f32(
+        vaddq_f32(q, vreinterpretq_f32_u32(vandq_u32(too_small, s))),
+        vreinterpretq_f32_u32(vandq_u32(too_large, s)));
+
+    // the sign of the remainder is the sign of x, including zeros
+    const float32x4_t r1 = vfmsq_f32(x, q1, y);
+    const float32x4_t r = vbslq_f32(sign_bit, x, r1);
+
+    const uint32x4_t is_small = vcltq_f32(abs_x, abs_y);
+    const uint32x4_t is_fast = vcltq_f32(vabsq_f32(q), vdupq_n_f32(4194304.0f));
+    const float32x4_t result = vbslq_f32(is_small, x, r);
+
+    const uint32x4_t is_done = vorrq_u32(is_small, is_fast);
+    if (vminvq_u32(is_done) == 0xFFFFFFFF) {
+        return result;
+    }
+
+    float x_s[4];
+    float y_s[4];
+    float result_s[4];
+    uint32_t is_done_s[4];
+    vst1q_f32(x_s, x);
+    vst1q_f32(y_s, y);
+    vst1q_f32(result_s, result);
+    vst1q_u32(is_done_s, is_done);
+    for (size_t i = 0; i < 4; i++) {
+        if (is_done_s[i] == 0) {
+            result_s[i] = std::fmod(x_s[i], y_s[i]);
+        }
+    }
+
+    return vld1q_f32(result_s);
+}
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperF32 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Add, CmpOp> {
+    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
+        // left + right == value
+        const float32x4x2_t lr = {
+            vaddq_f32(left.val[0], right.val[0]),
+            vaddq_f32(left.val[1], right.val[1])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Sub, CmpOp> {
+    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
+        // left - right == value
+        const float32x4x2_t lr = {
+            vsubq_f32(left.val[0], right.val[0]),
+            vsubq_f32(left.val[1], right.val[1])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Mul, CmpOp> {
+    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
+        // left * right == value
+        const float32x4x2_t lr = {
+            vmulq_f32(left.val[0], right.val[0]),
+            vmulq_f32(left.val[1], right.val[1])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Div, CmpOp> {
+    static inline uint32x4x2_t op_special(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
+        // this is valid for the positive denominator, == and != cases.
+        // left == right * value
+        const float32x4x2_t rv = {
+            vmulq_f32(right.val[0], value.val[0]),
+            vmulq_f32(right.val[1], value.val[1])
+        };
+        return CmpHelper<CmpOp>::compare(left, rv);
+    }
+
+    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
+        // left / right == value
+        const float32x4x2_t rv = {
+            vdivq_f32(left.val[0], right.val[0]),
+            vdivq_f32(left.val[1], right.val[1])
+        };
+        return CmpHelper<CmpOp>::compare(rv, value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Mod, CmpOp> {
+    static inline uint32x4x2_t op(const float32x4x2_t left, const float32x4x2_t right, const float32x4x2_t value) {
+        // fmod(left, right) == value
+        const float32x4x2_t lr = {
+            fmod_f32(left.val[0], right.val[0]),
+            fmod_f32(left.val[1], right.val[1])
+        };
+        return CmpHelper<CmpOp>::compare(lr, value);
+    }
+};
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperF64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Add, CmpOp> {
     static inline uint64x2x4_t op(const float64x2x4_t left, const float64x2x4_t right, const float64x2x4_t value) {
         // left + right == value
         const float64x2x4_t lr = {
@@ -1330,44 +2816,345 @@ struct ArithHelperF64<ArithOpType::Div, CmpOp> {
     }
 };
 
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Mod, CmpOp> {
+    static inline uint64x2x4_t op(const float64x2x4_t left, const float64x2x4_t right, const float64x2x4_t value) {
+        // fmod(left, right) == value
+        const float64x2x4_t rv = {
+            fmod_f64(left.val[0], right.val[0]),
+            fmod_f64(left.val[1], right.val[1]),
+            fmod_f64(left.val[2], right.val[2]),
+            fmod_f64(left.val[3], right.val[3])
+        };
+        return CmpHelper<CmpOp>::compare(rv, value);
+    }
+};
+
+}
+
+// todo: Mul
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict src,
+    const ArithHighPrecisionType<int8_t>& right_operand,
+    const ArithHighPrecisionType<int8_t>& value,
+    const size_t size
+) {
+    if constexpr(AOp == ArithOpType::Mul) {
+        return false;
+    } else {
+        if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+            // leave the division by zero to the reference implementation
+            return false;
+        }
+
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const int8x8_t v0v_i8 = vld1_s8(src + i);
+            const int16x8_t v0v_i16 = vmovl_s8(v0v_i8);
+            const int32x4x2_t v0v_i32 = {
+                vmovl_s16(vget_low_s16(v0v_i16)),
+                vmovl_s16(vget_high_s16(v0v_i16))
+            };
+            const int64x2x4_t v0v_i64 = {
+                vmovl_s32(vget_low_s32(v0v_i32.val[0])), 
+                vmovl_s32(vget_high_s32(v0v_i32.val[0])),
+                vmovl_s32(vget_low_s32(v0v_i32.val[1])), 
+                vmovl_s32(vget_high_s32(v0v_i32.val[1]))
+            };
+
+            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v_i64, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict src,
+    const ArithHighPrecisionType<int16_t>& right_operand,
+    const ArithHighPrecisionType<int16_t>& value,
+    const size_t size
+) {
+    if constexpr(AOp == ArithOpType::Mul) {
+        return false;
+    } else {
+        if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+            // leave the division by zero to the reference implementation
+            return false;
+        }
+
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const int16x8_t v0v_i16 = vld1q_s16(src + i);
+            const int32x4x2_t v0v_i32 = {
+                vmovl_s16(vget_low_s16(v0v_i16)),
+                vmovl_s16(vget_high_s16(v0v_i16))
+            };
+            const int64x2x4_t v0v_i64 = {
+                vmovl_s32(vget_low_s32(v0v_i32.val[0])), 
+                vmovl_s32(vget_high_s32(v0v_i32.val[0])),
+                vmovl_s32(vget_low_s32(v0v_i32.val[1])), 
+                vmovl_s32(vget_high_s32(v0v_i32.val[1]))
+            };
+
+            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v_i64, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict src,
+    const ArithHighPrecisionType<int32_t>& right_operand,
+    const ArithHighPrecisionType<int32_t>& value,
+    const size_t size
+) {
+    if constexpr(AOp == ArithOpType::Mul) {
+        return false;
+    } else {
+        if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+            // leave the division by zero to the reference implementation
+            return false;
+        }
+
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const int32x4x2_t v0v_i32 = {vld1q_s32(src + i), vld1q_s32(src + i + 4)};
+            const int64x2x4_t v0v_i64 = {
+                vmovl_s32(vget_low_s32(v0v_i32.val[0])), 
+                vmovl_s32(vget_high_s32(v0v_i32.val[0])),
+                vmovl_s32(vget_low_s32(v0v_i32.val[1])), 
+                vmovl_s32(vget_high_s32(v0v_i32.val[1]))
+            };
+
+            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v_i64, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict src,
+    const ArithHighPrecisionType<int64_t>& right_operand,
+    const ArithHighPrecisionType<int64_t>& value,
+    const size_t size
+) {
+    if constexpr(AOp == ArithOpType::Mul) {
+        return false;
+    } else {
+        if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+            // leave the division by zero to the reference implementation
+            return false;
+        }
+
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const int64x2x4_t v0v = {vld1q_s64(src + i), vld1q_s64(src + i + 2), vld1q_s64(src + i + 4), vld1q_s64(src + i + 6)};
+            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint8_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint8_t* const __restrict src,
+    const ArithHighPrecisionType<uint8_t>& right_operand,
+    const ArithHighPrecisionType<uint8_t>& value,
+    const size_t size
+) {
+    if constexpr(AOp == ArithOpType::Mul) {
+        return false;
+    } else {
+        if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+            // leave the division by zero to the reference implementation
+            return false;
+        }
+
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const uint8x8_t v0v_u8 = vld1_u8(src + i);
+            const uint16x8_t v0v_u16 = vmovl_u8(v0v_u8);
+            const uint32x4x2_t v0v_u32 = {
+                vmovl_u16(vget_low_u16(v0v_u16)),
+                vmovl_u16(vget_high_u16(v0v_u16))
+            };
+            const int64x2x4_t v0v_i64 = {
+                vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(v0v_u32.val[0]))), 
+                vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(v0v_u32.val[0]))),
+                vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(v0v_u32.val[1]))), 
+                vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(v0v_u32.val[1])))
+            };
+
+            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v_i64, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint16_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint16_t* const __restrict src,
+    const ArithHighPrecisionType<uint16_t>& right_operand,
+    const ArithHighPrecisionType<uint16_t>& value,
+    const size_t size
+) {
+    if constexpr(AOp == ArithOpType::Mul) {
+        return false;
+    } else {
+        if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+            // leave the division by zero to the reference implementation
+            return false;
+        }
+
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const uint16x8_t v0v_u16 = vld1q_u16(src + i);
+            const uint32x4x2_t v0v_u32 = {
+                vmovl_u16(vget_low_u16(v0v_u16)),
+                vmovl_u16(vget_high_u16(v0v_u16))
+            };
+            const int64x2x4_t v0v_i64 = {
+                vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(v0v_u32.val[0]))), 
+                vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(v0v_u32.val[0]))),
+                vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(v0v_u32.val[1]))), 
+                vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(v0v_u32.val[1])))
+            };
+
+            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v_i64, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
 }
 
-// todo: Mul, Div, Mod
-
 template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
+bool OpArithCompareImpl<uint32_t, AOp, CmpOp>::op_arith_compare(
     uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict src,
-    const ArithHighPrecisionType<int8_t>& right_operand,
-    const ArithHighPrecisionType<int8_t>& value,
+    const uint32_t* const __restrict src,
+    const ArithHighPrecisionType<uint32_t>& right_operand,
+    const ArithHighPrecisionType<uint32_t>& value,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mul || AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
+    if constexpr(AOp == ArithOpType::Mul) {
         return false;
     } else {
+        if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+            // leave the division by zero to the reference implementation
+            return false;
+        }
+
         // the restriction of the API
         assert((size % 8) == 0);
         static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
 
         //
-        const int64x2x4_t right_v = {vdupq_n_s64(right_operand), vdupq_n_s64(right_operand), vdupq_n_s64(right_operand), vdupq_n_s64(right_operand)};
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
         const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
 
         // todo: aligned reads & writes
 
         const size_t size8 = (size / 8) * 8;
         for (size_t i = 0; i < size8; i += 8) {
-            const int8x8_t v0v_i8 = vld1_s8(src + i);
-            const int16x8_t v0v_i16 = vmovl_s8(v0v_i8);
-            const int32x4x2_t v0v_i32 = {
-                vmovl_s16(vget_low_s16(v0v_i16)),
-                vmovl_s16(vget_high_s16(v0v_i16))
-            };
+            const uint32x4x2_t v0v_u32 = {vld1q_u32(src + i), vld1q_u32(src + i + 4)};
             const int64x2x4_t v0v_i64 = {
-                vmovl_s32(vget_low_s32(v0v_i32.val[0])), 
-                vmovl_s32(vget_high_s32(v0v_i32.val[0])),
-                vmovl_s32(vget_low_s32(v0v_i32.val[1])), 
-                vmovl_s32(vget_high_s32(v0v_i32.val[1]))
+                vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(v0v_u32.val[0]))), 
+                vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(v0v_u32.val[0]))),
+                vreinterpretq_s64_u64(vmovl_u32(vget_low_u32(v0v_u32.val[1]))), 
+                vreinterpretq_s64_u64(vmovl_u32(vget_high_u32(v0v_u32.val[1])))
             };
 
             const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v_i64, right_v, value_v);
@@ -1381,11 +3168,11 @@ bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
 }
 
 template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
+bool OpArithCompareImpl<uint64_t, AOp, CmpOp>::op_arith_compare(
     uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict src,
-    const ArithHighPrecisionType<int16_t>& right_operand,
-    const ArithHighPrecisionType<int16_t>& value,
+    const uint64_t* const __restrict src,
+    const ArithHighPrecisionType<uint64_t>& right_operand,
+    const ArithHighPrecisionType<uint64_t>& value,
     const size_t size
 ) {
     if constexpr(AOp == ArithOpType::Mul || AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
@@ -1393,256 +3180,930 @@ bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
     } else {
         // the restriction of the API
         assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+        static_assert(std::is_same_v<uint64_t, ArithHighPrecisionType<uint64_t>>);
+
+        //
+        const uint64x2x4_t right_v = {vdupq_n_u64(right_operand), vdupq_n_u64(right_operand), vdupq_n_u64(right_operand), vdupq_n_u64(right_operand)};
+        const uint64x2x4_t value_v = {vdupq_n_u64(value), vdupq_n_u64(value), vdupq_n_u64(value), vdupq_n_u64(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const uint64x2x4_t v0v = {vld1q_u64(src + i), vld1q_u64(src + i + 2), vld1q_u64(src + i + 4), vld1q_u64(src + i + 6)};
+            const uint64x2x4_t cmp = ArithHelperU64<AOp, CmpOp>::op(v0v, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<float, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict src,
+    const ArithHighPrecisionType<float>& right_operand,
+    const ArithHighPrecisionType<float>& value,
+    const size_t size
+) {
+    if constexpr (AOp == ArithOpType::Div) {
+        if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
+            // a special case that allows faster processing by using the multiplication
+            //   operation instead of the division one.
+
+            // the restriction of the API
+            assert((size % 8) == 0);
+
+            //
+            const float32x4x2_t right_v = {vdupq_n_f32(right_operand), vdupq_n_f32(right_operand)};
+            const float32x4x2_t value_v = {vdupq_n_f32(value), vdupq_n_f32(value)};
+
+            // todo: aligned reads & writes
+
+            const size_t size8 = (size / 8) * 8;
+            for (size_t i = 0; i < size8; i += 8) {
+                const float32x4x2_t v0v = {vld1q_f32(src + i), vld1q_f32(src + i + 4)};
+                const uint32x4x2_t cmp = ArithHelperF32<AOp, CmpOp>::op_special(v0v, right_v, value_v);
+
+                const uint8_t mmask = movemask(cmp);
+                res_u8[i / 8] = mmask;
+            }
+
+            return true;
+        } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
+            // flip signs and go for the multiplication case
+            return OpArithCompareImpl<float, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
+                res_u8, src, -right_operand, -value, size
+            );
+        }
+
+        // go with the default case
+    }
+
+    // a default case
+    {
+        // the restriction of the API
+        assert((size % 8) == 0);
+
+        //
+        const float32x4x2_t right_v = {vdupq_n_f32(right_operand), vdupq_n_f32(right_operand)};
+        const float32x4x2_t value_v = {vdupq_n_f32(value), vdupq_n_f32(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const float32x4x2_t v0v = {vld1q_f32(src + i), vld1q_f32(src + i + 4)};
+            const uint32x4x2_t cmp = ArithHelperF32<AOp, CmpOp>::op(v0v, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<double, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict src,
+    const ArithHighPrecisionType<double>& right_operand,
+    const ArithHighPrecisionType<double>& value,
+    const size_t size
+) {
+    if constexpr (AOp == ArithOpType::Div) {
+        if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
+            // a special case that allows faster processing by using the multiplication
+            //   operation instead of the division one.
+
+            // the restriction of the API
+            assert((size % 8) == 0);
+
+            //
+            const float64x2x4_t right_v = {vdupq_n_f64(right_operand), vdupq_n_f64(right_operand), vdupq_n_f64(right_operand), vdupq_n_f64(right_operand)};
+            const float64x2x4_t value_v = {vdupq_n_f64(value), vdupq_n_f64(value), vdupq_n_f64(value), vdupq_n_f64(value)};
+
+            // todo: aligned reads & writes
+
+            const size_t size8 = (size / 8) * 8;
+            for (size_t i = 0; i < size8; i += 8) {
+                const float64x2x4_t v0v = {vld1q_f64(src + i), vld1q_f64(src + i + 2), vld1q_f64(src + i + 4), vld1q_f64(src + i + 6)};
+                const uint64x2x4_t cmp = ArithHelperF64<AOp, CmpOp>::op_special(v0v, right_v, value_v);
+
+                const uint8_t mmask = movemask(cmp);
+                res_u8[i / 8] = mmask;
+            }
+
+            return true;
+        } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
+            // flip signs and go for the multiplication case
+            return OpArithCompareImpl<double, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
+                res_u8, src, -right_operand, -value, size
+            );
+        }
+
+        // go with the default case
+    }
+
+    // a default case
+    {
+        // the restriction of the API
+        assert((size % 8) == 0);
+
+        //
+        const float64x2x4_t right_v = {vdupq_n_f64(right_operand), vdupq_n_f64(right_operand), vdupq_n_f64(right_operand), vdupq_n_f64(right_operand)};
+        const float64x2x4_t value_v = {vdupq_n_f64(value), vdupq_n_f64(value), vdupq_n_f64(value), vdupq_n_f64(value)};
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const float64x2x4_t v0v = {vld1q_f64(src + i), vld1q_f64(src + i + 2), vld1q_f64(src + i + 4), vld1q_f64(src + i + 6)};
+            const uint64x2x4_t cmp = ArithHelperF64<AOp, CmpOp>::op(v0v, right_v, value_v);
+
+            const uint8_t mmask = movemask(cmp);
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+// forward ops
+
+namespace {
+
+// returns a register in which bits of interest are set
+template<bool IsSet>
+inline uint8x16_t find_prepare(const uint8x16_t v) {
+    if constexpr (IsSet) {
+        return v;
+    } else {
+        return vmvnq_u8(v);
+    }
+}
+
+// returns the index of the first set bit in a register that is known 
+//   to have at least one bit set
+inline size_t find_in_register(const uint8x16_t v) {
+    const uint64x2_t v_u64 = vreinterpretq_u64_u8(v);
+
+    const uint64_t lo = vgetq_lane_u64(v_u64, 0);
+    if (lo != 0) {
+        return CtzHelper<unsigned long long>::ctz(lo);
+    }
+
+    const uint64_t hi = vgetq_lane_u64(v_u64, 1);
+    return 64 + CtzHelper<unsigned long long>::ctz(hi);
+}
+
+// Returns the index of the first bit equal to IsSet in a given number 
+//   of bytes, or size * 8 if there is none.
+template<bool IsSet>
+size_t find(
+    const uint8_t* const __restrict src, 
+    const size_t size
+) {
+    // process blocks of 4 registers
+    const size_t size64 = (size / 64) * 64;
+    for (size_t i = 0; i < size64; i += 64) {
+        const uint8x16_t v0 = find_prepare<IsSet>(vld1q_u8(src + i + 0 * 16));
+        const uint8x16_t v1 = find_prepare<IsSet>(vld1q_u8(src + i + 1 * 16));
+        const uint8x16_t v2 = find_prepare<IsSet>(vld1q_u8(src + i + 2 * 16));
+        const uint8x16_t v3 = find_prepare<IsSet>(vld1q_u8(src + i + 3 * 16));
+
+        const uint8x16_t v0123 = vorrq_u8(vorrq_u8(v0, v1), vorrq_u8(v2, v3));
+        if (vmaxvq_u8(v0123) != 0) {
+            if (vmaxvq_u8(v0) != 0) {
+                return (i + 0 * 16) * 8 + find_in_register(v0);
+            }
+            if (vmaxvq_u8(v1) != 0) {
+                return (i + 1 * 16) * 8 + find_in_register(v1);
+            }
+            if (vmaxvq_u8(v2) != 0) {
+                return (i + 2 * 16) * 8 + find_in_register(v2);
+            }
+            return (i + 3 * 16) * 8 + find_in_register(v3);
+        }
+    }
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = size64; i < size16; i += 16) {
+        const uint8x16_t v = find_prepare<IsSet>(vld1q_u8(src + i));
+        if (vmaxvq_u8(v) != 0) {
+            return i * 8 + find_in_register(v);
+        }
+    }
+
+    // process leftovers
+    for (size_t i = size16; i < size; i++) {
+        const uint8_t v = (IsSet) ? src[i] : uint8_t(~src[i]);
+        if (v != 0) {
+            return i * 8 + CtzHelper<uint8_t>::ctz(v);
+        }
+    }
+
+    return size * 8;
+}
+
+// Searches for the first bit equal to IsSet in [start + starting_idx, start + size).
+//   Partial elements at both ends are handled by the element-wise code, 
+//   the middle goes to find().
+template<typename ElementT, bool IsSet>
+std::optional<size_t> op_find_impl(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+    constexpr size_t data_bits = policy_type::data_bits;
+
+    if (starting_idx >= size) {
+        return std::nullopt;
+    }
+
+    size_t start_element = policy_type::get_element(start + starting_idx);
+    const size_t start_shift = policy_type::get_shift(start + starting_idx);
+    const size_t end_element = policy_type::get_element(start + size);
+
+    // process the first element
+    if (start_shift != 0) {
+        const size_t size_first = 
+            (size - starting_idx < data_bits - start_shift) ? 
+                (size - starting_idx) : (data_bits - start_shift);
+        const auto result = policy_type::op_find(data, start, starting_idx + size_first, starting_idx, IsSet);
+        if (result.has_value() || starting_idx + size_first == size) {
+            return result;
+        }
+
+        start_element += 1;
+    }
+
+    // process the middle
+    if (start_element < end_element) {
+        const size_t n_bytes = (end_element - start_element) * sizeof(ElementT);
+        const size_t bit_idx = find<IsSet>(
+            reinterpret_cast<const uint8_t*>(data + start_element), 
+            n_bytes
+        );
+        if (bit_idx != n_bytes * 8) {
+            return start_element * data_bits + bit_idx - start;
+        }
+    }
+
+    // process the last element
+    if (policy_type::get_shift(start + size) != 0) {
+        return policy_type::op_find(data, start, size, end_element * data_bits - start, IsSet);
+    }
+
+    return std::nullopt;
+}
+
+}
+
+namespace {
+
+// vcnt + pairwise adds, counts bits in a given number of bytes
+inline size_t popcount(
+    const uint8_t* const __restrict src, 
+    const size_t size
+) {
+    uint64x2_t total = vdupq_n_u64(0);
+
+    // process blocks of 4 registers
+    const size_t size64 = (size / 64) * 64;
+    for (size_t i = 0; i < size64; i += 64) {
+        const uint8x16_t c0 = vcntq_u8(vld1q_u8(src + i + 0 * 16));
+        const uint8x16_t c1 = vcntq_u8(vld1q_u8(src + i + 1 * 16));
+        const uint8x16_t c2 = vcntq_u8(vld1q_u8(src + i + 2 * 16));
+        const uint8x16_t c3 = vcntq_u8(vld1q_u8(src + i + 3 * 16));
+
+        // at most 32 per lane, no overflow
+        const uint8x16_t c0123 = vaddq_u8(vaddq_u8(c0, c1), vaddq_u8(c2, c3));
+        total = vpadalq_u32(total, vpaddlq_u16(vpaddlq_u8(c0123)));
+    }
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = size64; i < size16; i += 16) {
+        const uint8x16_t c0 = vcntq_u8(vld1q_u8(src + i));
+        total = vpadalq_u32(total, vpaddlq_u16(vpaddlq_u8(c0)));
+    }
+
+    size_t count = vaddvq_u64(total);
+
+    // process leftovers
+    for (size_t i = size16; i < size; i++) {
+        count += PopCountHelper<uint8_t>::count(src[i]);
+    }
+
+    return count;
+}
+
+// Counts bits in [start, start + size). Partial elements at both ends are
+//   handled by the element-wise code, the middle goes to popcount().
+template<typename ElementT>
+size_t op_count_impl(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+    constexpr size_t data_bits = policy_type::data_bits;
+
+    if (size == 0) {
+        return 0;
+    }
+
+    size_t count = 0;
+
+    size_t start_element = policy_type::get_element(start);
+    const size_t start_shift = policy_type::get_shift(start);
+    size_t size_left = size;
+
+    // process the first element
+    if (start_shift != 0) {
+        const size_t size_first = 
+            (size < data_bits - start_shift) ? size : (data_bits - start_shift);
+        count += policy_type::op_count(data, start, size_first);
+
+        size_left -= size_first;
+        start_element += 1;
+    }
+
+    // process the middle
+    const size_t n_elements = size_left / data_bits;
+    count += popcount(
+        reinterpret_cast<const uint8_t*>(data + start_element), 
+        n_elements * sizeof(ElementT)
+    );
+
+    // process the last element
+    const size_t size_last = size_left % data_bits;
+    if (size_last != 0) {
+        count += policy_type::op_count(data + start_element + n_elements, 0, size_last);
+    }
+
+    return count;
+}
+
+}
+
+namespace {
+
+// binary operations for op_binary_impl()
+struct BinaryOpAnd {
+    static inline uint8x16_t op(const uint8x16_t left, const uint8x16_t right) {
+        return vandq_u8(left, right);
+    }
+
+    // returns true if values cannot be changed by any right operand
+    static inline bool is_saturated(
+        const uint8x16_t v0, 
+        const uint8x16_t v1, 
+        const uint8x16_t v2, 
+        const uint8x16_t v3
+    ) {
+        const uint8x16_t v = vorrq_u8(vorrq_u8(v0, v1), vorrq_u8(v2, v3));
+        return (vmaxvq_u8(v) == 0);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_and(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpOr {
+    static inline uint8x16_t op(const uint8x16_t left, const uint8x16_t right) {
+        return vorrq_u8(left, right);
+    }
+
+    // returns true if values cannot be changed by any right operand
+    static inline bool is_saturated(
+        const uint8x16_t v0, 
+        const uint8x16_t v1, 
+        const uint8x16_t v2, 
+        const uint8x16_t v3
+    ) {
+        const uint8x16_t v = vandq_u8(vandq_u8(v0, v1), vandq_u8(v2, v3));
+        return (vminvq_u8(v) == 0xFF);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_or(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpXor {
+    static inline uint8x16_t op(const uint8x16_t left, const uint8x16_t right) {
+        return veorq_u8(left, right);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_xor(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpSub {
+    static inline uint8x16_t op(const uint8x16_t left, const uint8x16_t right) {
+        return vbicq_u8(left, right);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_sub(left, right, start_left, start_right, size);
+    }
+};
+
+// Loads 16 bytes of bits that start from bit 'shift' (1..7) of src[0].
+//   Every 64-bit lane is a funnel shift of 9 consecutive bytes: 'lo' 
+//   provides bytes [0, 8) and 'hi' provides bytes [1, 9), so src[16] 
+//   is the only byte that is read past the loaded ones.
+inline uint8x16_t load_shifted(const uint8_t* const src, const size_t shift) {
+    const uint64x2_t lo = vreinterpretq_u64_u8(vld1q_u8(src));
+    const uint64x2_t hi = vreinterpretq_u64_u8(vld1q_u8(src + 1));
+    return vreinterpretq_u8_u64(
+        vorrq_u64(
+            vshlq_u64(lo, vdupq_n_s64(-(int64_t)shift)), 
+            vshlq_u64(hi, vdupq_n_s64(8 - (int64_t)shift))
+        )
+    );
+}
+
+// loads 16 bytes of bits that start from bit 'shift' (0..7) of src[0]
+inline uint8x16_t load_maybe_shifted(const uint8_t* const src, const size_t shift) {
+    if (shift == 0) {
+        return vld1q_u8(src);
+    } else {
+        return load_shifted(src, shift);
+    }
+}
+
+// Applies OpT to whole blocks of 16 bytes of left and the same number 
+//   of bits of right, which start from bit 'shift' (0..7) of right[0].
+//   If shift is not zero, then one byte past the last block of right is 
+//   read as well. Returns the number of processed bytes.
+template<typename OpT>
+size_t op_bytes(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t size,
+    const size_t shift
+) {
+    const size_t size16 = (size / 16) * 16;
 
-        //
-        const int64x2x4_t right_v = {vdupq_n_s64(right_operand), vdupq_n_s64(right_operand), vdupq_n_s64(right_operand), vdupq_n_s64(right_operand)};
-        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+    if (shift == 0) {
+        for (size_t i = 0; i < size16; i += 16) {
+            const uint8x16_t lv = vld1q_u8(left + i);
+            const uint8x16_t rv = vld1q_u8(right + i);
+            vst1q_u8(left + i, OpT::op(lv, rv));
+        }
 
-        // todo: aligned reads & writes
+        return size16;
+    }
 
-        const size_t size8 = (size / 8) * 8;
-        for (size_t i = 0; i < size8; i += 8) {
-            const int16x8_t v0v_i16 = vld1q_s16(src + i);
-            const int32x4x2_t v0v_i32 = {
-                vmovl_s16(vget_low_s16(v0v_i16)),
-                vmovl_s16(vget_high_s16(v0v_i16))
-            };
-            const int64x2x4_t v0v_i64 = {
-                vmovl_s32(vget_low_s32(v0v_i32.val[0])), 
-                vmovl_s32(vget_high_s32(v0v_i32.val[0])),
-                vmovl_s32(vget_low_s32(v0v_i32.val[1])), 
-                vmovl_s32(vget_high_s32(v0v_i32.val[1]))
-            };
+    for (size_t i = 0; i < size16; i += 16) {
+        const uint8x16_t lv = vld1q_u8(left + i);
+        const uint8x16_t rv = load_shifted(right + i, shift);
+        vst1q_u8(left + i, OpT::op(lv, rv));
+    }
 
-            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v_i64, right_v, value_v);
+    return size16;
+}
 
-            const uint8_t mmask = movemask(cmp);
-            res_u8[i / 8] = mmask;
+// Same as op_bytes(), but a given number of bytes is a multiple of 16, 
+//   and the number of set bits in the result is returned. The result 
+//   is counted with vcnt while it is still in registers.
+template<typename OpT>
+size_t op_bytes_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t size,
+    const size_t shift
+) {
+    uint64x2_t total = vdupq_n_u64(0);
+
+    // process blocks of 4 registers
+    const size_t size64 = (size / 64) * 64;
+    for (size_t i = 0; i < size64; i += 64) {
+        const uint8x16_t r0 = OpT::op(vld1q_u8(left + i + 0 * 16), load_maybe_shifted(right + i + 0 * 16, shift));
+        const uint8x16_t r1 = OpT::op(vld1q_u8(left + i + 1 * 16), load_maybe_shifted(right + i + 1 * 16, shift));
+        const uint8x16_t r2 = OpT::op(vld1q_u8(left + i + 2 * 16), load_maybe_shifted(right + i + 2 * 16, shift));
+        const uint8x16_t r3 = OpT::op(vld1q_u8(left + i + 3 * 16), load_maybe_shifted(right + i + 3 * 16, shift));
+        vst1q_u8(left + i + 0 * 16, r0);
+        vst1q_u8(left + i + 1 * 16, r1);
+        vst1q_u8(left + i + 2 * 16, r2);
+        vst1q_u8(left + i + 3 * 16, r3);
+
+        // at most 32 per lane, no overflow
+        const uint8x16_t c0123 = vaddq_u8(
+            vaddq_u8(vcntq_u8(r0), vcntq_u8(r1)), 
+            vaddq_u8(vcntq_u8(r2), vcntq_u8(r3))
+        );
+        total = vpadalq_u32(total, vpaddlq_u16(vpaddlq_u8(c0123)));
+    }
+
+    // process big blocks
+    for (size_t i = size64; i < size; i += 16) {
+        const uint8x16_t r0 = OpT::op(vld1q_u8(left + i), load_maybe_shifted(right + i, shift));
+        vst1q_u8(left + i, r0);
+
+        total = vpadalq_u32(total, vpaddlq_u16(vpaddlq_u8(vcntq_u8(r0))));
+    }
+
+    return vaddvq_u64(total);
+}
+
+// Applies OpT to whole blocks of 64 bytes of left and every right. 
+//   Bits of rights[k] start from bit shifts[k] (0..7) of rights[k][0].
+//   The remaining rights are not loaded once a block cannot be changed 
+//   by OpT anymore. Returns the number of processed bytes.
+template<typename OpT>
+size_t op_bytes_multiple(
+    uint8_t* const left,
+    const uint8_t* const* const rights,
+    const size_t* const shifts,
+    const size_t n_rights,
+    const size_t size
+) {
+    const size_t size64 = (size / 64) * 64;
+
+    for (size_t i = 0; i < size64; i += 64) {
+        uint8x16_t v0 = vld1q_u8(left + i + 0 * 16);
+        uint8x16_t v1 = vld1q_u8(left + i + 1 * 16);
+        uint8x16_t v2 = vld1q_u8(left + i + 2 * 16);
+        uint8x16_t v3 = vld1q_u8(left + i + 3 * 16);
+        for (size_t k = 0; k < n_rights && !OpT::is_saturated(v0, v1, v2, v3); k++) {
+            v0 = OpT::op(v0, load_maybe_shifted(rights[k] + i + 0 * 16, shifts[k]));
+            v1 = OpT::op(v1, load_maybe_shifted(rights[k] + i + 1 * 16, shifts[k]));
+            v2 = OpT::op(v2, load_maybe_shifted(rights[k] + i + 2 * 16, shifts[k]));
+            v3 = OpT::op(v3, load_maybe_shifted(rights[k] + i + 3 * 16, shifts[k]));
         }
 
-        return true;
+        vst1q_u8(left + i + 0 * 16, v0);
+        vst1q_u8(left + i + 1 * 16, v1);
+        vst1q_u8(left + i + 2 * 16, v2);
+        vst1q_u8(left + i + 3 * 16, v3);
     }
+
+    return size64;
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict src,
-    const ArithHighPrecisionType<int32_t>& right_operand,
-    const ArithHighPrecisionType<int32_t>& value,
+// Applies OpT to [start_left, start_left + size) of left and 
+//   [start_right, start_right + size) of right. Bits are processed by 
+//   the element-wise code until left is byte-aligned, then whole blocks
+//   of left go to op_bytes() regardless of the alignment of right.
+template<typename ElementT, typename OpT>
+void op_binary_impl(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mul || AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        // the restriction of the API
-        assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        OpT::template op_element_wise<ElementT>(left, right, start_left, start_right, size_first);
+    }
 
-        //
-        const int64x2x4_t right_v = {vdupq_n_s64(right_operand), vdupq_n_s64(right_operand), vdupq_n_s64(right_operand), vdupq_n_s64(right_operand)};
-        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_right_middle = start_right + size_first;
+    const size_t n_bytes = op_bytes<OpT>(
+        reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+        reinterpret_cast<const uint8_t*>(right) + start_right_middle / 8,
+        (size - size_first) / 8,
+        start_right_middle % 8
+    );
+
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        OpT::template op_element_wise<ElementT>(
+            left, 
+            right, 
+            start_left_middle + n_bytes * 8, 
+            start_right_middle + n_bytes * 8, 
+            size_last
+        );
+    }
+}
 
-        // todo: aligned reads & writes
+// Same as op_binary_impl(), but also returns the number of set bits 
+//   in [start_left, start_left + size) of left after the operation.
+template<typename ElementT, typename OpT>
+size_t op_binary_with_count_impl(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
 
-        const size_t size8 = (size / 8) * 8;
-        for (size_t i = 0; i < size8; i += 8) {
-            const int32x4x2_t v0v_i32 = {vld1q_s32(src + i), vld1q_s32(src + i + 4)};
-            const int64x2x4_t v0v_i64 = {
-                vmovl_s32(vget_low_s32(v0v_i32.val[0])), 
-                vmovl_s32(vget_high_s32(v0v_i32.val[0])),
-                vmovl_s32(vget_low_s32(v0v_i32.val[1])), 
-                vmovl_s32(vget_high_s32(v0v_i32.val[1]))
-            };
+    size_t count = 0;
 
-            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v_i64, right_v, value_v);
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        OpT::template op_element_wise<ElementT>(left, right, start_left, start_right, size_first);
+        count += policy_type::op_count(left, start_left, size_first);
+    }
 
-            const uint8_t mmask = movemask(cmp);
-            res_u8[i / 8] = mmask;
-        }
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_right_middle = start_right + size_first;
+    const size_t n_bytes = (((size - size_first) / 8) / 16) * 16;
+    if (n_bytes != 0) {
+        count += op_bytes_with_count<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            reinterpret_cast<const uint8_t*>(right) + start_right_middle / 8,
+            n_bytes,
+            start_right_middle % 8
+        );
+    }
 
-        return true;
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        OpT::template op_element_wise<ElementT>(
+            left, 
+            right, 
+            start_left_middle + n_bytes * 8, 
+            start_right_middle + n_bytes * 8, 
+            size_last
+        );
+        count += policy_type::op_count(left, start_left_middle + n_bytes * 8, size_last);
     }
+
+    return count;
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict src,
-    const ArithHighPrecisionType<int64_t>& right_operand,
-    const ArithHighPrecisionType<int64_t>& value,
+// Applies OpT to [start_left, start_left + size) of left and 
+//   [start_rights[k], start_rights[k] + size) of every right. Same as 
+//   op_binary_impl(), but all rights are processed in a single pass.
+template<typename ElementT, typename OpT>
+void op_multiple_impl(
+    ElementT* const left,
+    const ElementT* const * const rights,
+    const size_t start_left,
+    const size_t* const __restrict start_rights,
+    const size_t n_rights,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mul || AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        // the restriction of the API
-        assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+    if (n_rights == 0) {
+        return;
+    }
 
-        //
-        const int64x2x4_t right_v = {vdupq_n_s64(right_operand), vdupq_n_s64(right_operand), vdupq_n_s64(right_operand), vdupq_n_s64(right_operand)};
-        const int64x2x4_t value_v = {vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value), vdupq_n_s64(value)};
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        for (size_t k = 0; k < n_rights; k++) {
+            OpT::template op_element_wise<ElementT>(left, rights[k], start_left, start_rights[k], size_first);
+        }
+    }
 
-        // todo: aligned reads & writes
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    size_t n_bytes = 0;
+    if (size - size_first >= 8) {
+        MaybeVector<const uint8_t*> right_ptrs(n_rights);
+        MaybeVector<size_t> right_shifts(n_rights);
+        for (size_t k = 0; k < n_rights; k++) {
+            const size_t start_right_middle = start_rights[k] + size_first;
+            right_ptrs[k] = reinterpret_cast<const uint8_t*>(rights[k]) + start_right_middle / 8;
+            right_shifts[k] = start_right_middle % 8;
+        }
 
-        const size_t size8 = (size / 8) * 8;
-        for (size_t i = 0; i < size8; i += 8) {
-            const int64x2x4_t v0v = {vld1q_s64(src + i), vld1q_s64(src + i + 2), vld1q_s64(src + i + 4), vld1q_s64(src + i + 6)};
-            const uint64x2x4_t cmp = ArithHelperI64<AOp, CmpOp>::op(v0v, right_v, value_v);
+        n_bytes = op_bytes_multiple<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            right_ptrs.data(),
+            right_shifts.data(),
+            n_rights,
+            (size - size_first) / 8
+        );
+    }
 
-            const uint8_t mmask = movemask(cmp);
-            res_u8[i / 8] = mmask;
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        for (size_t k = 0; k < n_rights; k++) {
+            OpT::template op_element_wise<ElementT>(
+                left, 
+                rights[k], 
+                start_left_middle + n_bytes * 8, 
+                start_rights[k] + size_first + n_bytes * 8, 
+                size_last
+            );
         }
-
-        return true;
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<float, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const float* const __restrict src,
-    const ArithHighPrecisionType<float>& right_operand,
-    const ArithHighPrecisionType<float>& value,
-    const size_t size
-) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        if constexpr (AOp == ArithOpType::Div) {
-            if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
-                // a special case that allows faster processing by using the multiplication
-                //   operation instead of the division one.
-
-                // the restriction of the API
-                assert((size % 8) == 0);
-
-                //
-                const float32x4x2_t right_v = {vdupq_n_f32(right_operand), vdupq_n_f32(right_operand)};
-                const float32x4x2_t value_v = {vdupq_n_f32(value), vdupq_n_f32(value)};
-
-                // todo: aligned reads & writes
-
-                const size_t size8 = (size / 8) * 8;
-                for (size_t i = 0; i < size8; i += 8) {
-                    const float32x4x2_t v0v = {vld1q_f32(src + i), vld1q_f32(src + i + 4)};
-                    const uint32x4x2_t cmp = ArithHelperF32<AOp, CmpOp>::op_special(v0v, right_v, value_v);
-
-                    const uint8_t mmask = movemask(cmp);
-                    res_u8[i / 8] = mmask;
-                }
-
-                return true;
-            } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
-                // flip signs and go for the multiplication case
-                return OpArithCompareImpl<float, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
-                    res_u8, src, -right_operand, -value, size
-                );
-            }
+// bitwise operations for ternary_logic()
+struct LogicOps {
+    static inline uint8x16_t op_and(const uint8x16_t x, const uint8x16_t y) {
+        return vandq_u8(x, y);
+    }
 
-            // go with the default case
-        }
+    static inline uint8x16_t op_or(const uint8x16_t x, const uint8x16_t y) {
+        return vorrq_u8(x, y);
+    }
 
-        // a default case
-        {
-            // the restriction of the API
-            assert((size % 8) == 0);
+    static inline uint8x16_t op_xor(const uint8x16_t x, const uint8x16_t y) {
+        return veorq_u8(x, y);
+    }
 
-            //
-            const float32x4x2_t right_v = {vdupq_n_f32(right_operand), vdupq_n_f32(right_operand)};
-            const float32x4x2_t value_v = {vdupq_n_f32(value), vdupq_n_f32(value)};
+    // x & ~y
+    static inline uint8x16_t op_andnot(const uint8x16_t x, const uint8x16_t y) {
+        return vbicq_u8(x, y);
+    }
 
-            // todo: aligned reads & writes
+    static inline uint8x16_t op_not(const uint8x16_t x) {
+        return vmvnq_u8(x);
+    }
 
-            const size_t size8 = (size / 8) * 8;
-            for (size_t i = 0; i < size8; i += 8) {
-                const float32x4x2_t v0v = {vld1q_f32(src + i), vld1q_f32(src + i + 4)};
-                const uint32x4x2_t cmp = ArithHelperF32<AOp, CmpOp>::op(v0v, right_v, value_v);
+    // (x & m) | (y & ~m)
+    static inline uint8x16_t op_select(const uint8x16_t m, const uint8x16_t x, const uint8x16_t y) {
+        return vbslq_u8(m, x, y);
+    }
 
-                const uint8_t mmask = movemask(cmp);
-                res_u8[i / 8] = mmask;
-            }
+    static inline uint8x16_t zeros() {
+        return vdupq_n_u8(0);
+    }
 
-            return true;
-        }
+    static inline uint8x16_t ones() {
+        return vdupq_n_u8(0xFF);
     }
+};
+
+// a ^ b ^ c, which is a single eor3 if SHA3 extension is available
+inline uint8x16_t eor3(const uint8x16_t a, const uint8x16_t b, const uint8x16_t c) {
+#if defined(__ARM_FEATURE_SHA3)
+    return veor3q_u8(a, b, c);
+#else
+    return veorq_u8(a, veorq_u8(b, c));
+#endif
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<double, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const double* const __restrict src,
-    const ArithHighPrecisionType<double>& right_operand,
-    const ArithHighPrecisionType<double>& value,
-    const size_t size
-) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
+template<uint8_t TruthTable>
+inline uint8x16_t ternary_logic_neon(const uint8x16_t a, const uint8x16_t b, const uint8x16_t c) {
+    if constexpr (TruthTable == (TERNARY_A ^ TERNARY_B ^ TERNARY_C)) {
+        return eor3(a, b, c);
     } else {
-        if constexpr (AOp == ArithOpType::Div) {
-            if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
-                // a special case that allows faster processing by using the multiplication
-                //   operation instead of the division one.
-
-                // the restriction of the API
-                assert((size % 8) == 0);
-
-                //
-                const float64x2x4_t right_v = {vdupq_n_f64(right_operand), vdupq_n_f64(right_operand), vdupq_n_f64(right_operand), vdupq_n_f64(right_operand)};
-                const float64x2x4_t value_v = {vdupq_n_f64(value), vdupq_n_f64(value), vdupq_n_f64(value), vdupq_n_f64(value)};
-
-                // todo: aligned reads & writes
-
-                const size_t size8 = (size / 8) * 8;
-                for (size_t i = 0; i < size8; i += 8) {
-                    const float64x2x4_t v0v = {vld1q_f64(src + i), vld1q_f64(src + i + 2), vld1q_f64(src + i + 4), vld1q_f64(src + i + 6)};
-                    const uint64x2x4_t cmp = ArithHelperF64<AOp, CmpOp>::op_special(v0v, right_v, value_v);
-
-                    const uint8_t mmask = movemask(cmp);
-                    res_u8[i / 8] = mmask;
-                }
-
-                return true;
-            } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
-                // flip signs and go for the multiplication case
-                return OpArithCompareImpl<double, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
-                    res_u8, src, -right_operand, -value, size
-                );
-            }
+        return ternary_logic<TruthTable, LogicOps>(a, b, c);
+    }
+}
+
+// Applies a ternary op, given by a truth table, to whole blocks of 
+//   16 bytes of left and the same number of bits of b and c, which start 
+//   from bits 'shift_b' and 'shift_c' (0..7) of b[0] and c[0]. A truth 
+//   table is decomposed into bsl / bic / eor3 and others at compile 
+//   time. Returns the number of processed bytes.
+template<uint8_t TruthTable>
+size_t op_bytes_ternary(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t size,
+    const size_t shift_b,
+    const size_t shift_c
+) {
+    const size_t size16 = (size / 16) * 16;
 
-            // go with the default case
+    if (shift_b == 0 && shift_c == 0) {
+        for (size_t i = 0; i < size16; i += 16) {
+            const uint8x16_t lv = vld1q_u8(left + i);
+            const uint8x16_t bv = vld1q_u8(b + i);
+            const uint8x16_t cv = vld1q_u8(c + i);
+            vst1q_u8(left + i, ternary_logic_neon<TruthTable>(lv, bv, cv));
         }
 
-        // a default case
-        {
-            // the restriction of the API
-            assert((size % 8) == 0);
+        return size16;
+    }
 
-            //
-            const float64x2x4_t right_v = {vdupq_n_f64(right_operand), vdupq_n_f64(right_operand), vdupq_n_f64(right_operand), vdupq_n_f64(right_operand)};
-            const float64x2x4_t value_v = {vdupq_n_f64(value), vdupq_n_f64(value), vdupq_n_f64(value), vdupq_n_f64(value)};
+    for (size_t i = 0; i < size16; i += 16) {
+        const uint8x16_t lv = vld1q_u8(left + i);
+        const uint8x16_t bv = load_maybe_shifted(b + i, shift_b);
+        const uint8x16_t cv = load_maybe_shifted(c + i, shift_c);
+        vst1q_u8(left + i, ternary_logic_neon<TruthTable>(lv, bv, cv));
+    }
 
-            // todo: aligned reads & writes
+    return size16;
+}
 
-            const size_t size8 = (size / 8) * 8;
-            for (size_t i = 0; i < size8; i += 8) {
-                const float64x2x4_t v0v = {vld1q_f64(src + i), vld1q_f64(src + i + 2), vld1q_f64(src + i + 4), vld1q_f64(src + i + 6)};
-                const uint64x2x4_t cmp = ArithHelperF64<AOp, CmpOp>::op(v0v, right_v, value_v);
+using OpBytesTernaryFunc = size_t(*)(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t size,
+    const size_t shift_b,
+    const size_t shift_c
+);
+
+template<size_t... TruthTables>
+constexpr std::array<OpBytesTernaryFunc, 256> make_op_bytes_ternary_table(
+    std::index_sequence<TruthTables...>
+) {
+    return {{ &op_bytes_ternary<uint8_t(TruthTables)>... }};
+}
 
-                const uint8_t mmask = movemask(cmp);
-                res_u8[i / 8] = mmask;
-            }
+// op_bytes_ternary() for every possible truth table
+constexpr std::array<OpBytesTernaryFunc, 256> op_bytes_ternary_table =
+    make_op_bytes_ternary_table(std::make_index_sequence<256>());
+
+// Applies a ternary op, given by a truth table, to [start_left, 
+//   start_left + size) of left, [start_b, start_b + size) of b and 
+//   [start_c, start_c + size) of c. Same as op_binary_impl(), bits are 
+//   processed by the element-wise code until left is byte-aligned.
+template<typename ElementT>
+void op_ternary_impl(
+    ElementT* const left,
+    const ElementT* const b,
+    const ElementT* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
 
-            return true;
-        }
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        policy_type::op_ternary(left, b, c, start_left, start_b, start_c, size_first, truth_table);
     }
-}
 
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_b_middle = start_b + size_first;
+    const size_t start_c_middle = start_c + size_first;
+    const size_t n_bytes = op_bytes_ternary_table[truth_table](
+        reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+        reinterpret_cast<const uint8_t*>(b) + start_b_middle / 8,
+        reinterpret_cast<const uint8_t*>(c) + start_c_middle / 8,
+        (size - size_first) / 8,
+        start_b_middle % 8,
+        start_c_middle % 8
+    );
+
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        policy_type::op_ternary(
+            left, 
+            b, 
+            c, 
+            start_left_middle + n_bytes * 8, 
+            start_b_middle + n_bytes * 8, 
+            start_c_middle + n_bytes * 8, 
+            size_last,
+            truth_table
+        );
+    }
+}
 
-///////////////////////////////////////////////////////////////////////////
-// forward ops
+}
 
 //
 bool ForwardOpsImpl<uint8_t>::op_and(
@@ -1652,7 +4113,7 @@ bool ForwardOpsImpl<uint8_t>::op_and(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_and(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpAnd>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1664,7 +4125,7 @@ bool ForwardOpsImpl<uint8_t>::op_and_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_and_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint8_t, BinaryOpAnd>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1675,7 +4136,7 @@ bool ForwardOpsImpl<uint8_t>::op_or(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_or(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpOr>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1687,7 +4148,7 @@ bool ForwardOpsImpl<uint8_t>::op_or_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_or_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint8_t, BinaryOpOr>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1698,7 +4159,7 @@ bool ForwardOpsImpl<uint8_t>::op_xor(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_xor(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpXor>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1709,7 +4170,72 @@ bool ForwardOpsImpl<uint8_t>::op_sub(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_sub(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpSub>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_count(
+    const uint8_t* const data,
+    const size_t start,
+    const size_t size,
+    size_t& count
+) {
+    count = op_count_impl<uint8_t>(data, start, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_find(
+    const uint8_t* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+) {
+    if (is_set) {
+        result = op_find_impl<uint8_t, true>(data, start, size, starting_idx);
+    } else {
+        result = op_find_impl<uint8_t, false>(data, start, size, starting_idx);
+    }
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_and_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    count = op_binary_with_count_impl<uint8_t, BinaryOpAnd>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_or_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    // the number of inactive bits
+    count = size - op_binary_with_count_impl<uint8_t, BinaryOpOr>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_ternary(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    op_ternary_impl<uint8_t>(left, b, c, start_left, start_b, start_c, size, truth_table);
     return true;
 }
 
@@ -1721,7 +4247,7 @@ bool ForwardOpsImpl<uint64_t>::op_and(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_and(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpAnd>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1733,7 +4259,7 @@ bool ForwardOpsImpl<uint64_t>::op_and_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_and_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint64_t, BinaryOpAnd>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1744,7 +4270,7 @@ bool ForwardOpsImpl<uint64_t>::op_or(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_or(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpOr>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1756,7 +4282,7 @@ bool ForwardOpsImpl<uint64_t>::op_or_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_or_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint64_t, BinaryOpOr>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1767,7 +4293,7 @@ bool ForwardOpsImpl<uint64_t>::op_xor(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_xor(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpXor>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1778,7 +4304,72 @@ bool ForwardOpsImpl<uint64_t>::op_sub(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_sub(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpSub>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_count(
+    const uint64_t* const data,
+    const size_t start,
+    const size_t size,
+    size_t& count
+) {
+    count = op_count_impl<uint64_t>(data, start, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_find(
+    const uint64_t* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+) {
+    if (is_set) {
+        result = op_find_impl<uint64_t, true>(data, start, size, starting_idx);
+    } else {
+        result = op_find_impl<uint64_t, false>(data, start, size, starting_idx);
+    }
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_and_with_count(
+    uint64_t* const left,
+    const uint64_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    count = op_binary_with_count_impl<uint64_t, BinaryOpAnd>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_or_with_count(
+    uint64_t* const left,
+    const uint64_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    // the number of inactive bits
+    count = size - op_binary_with_count_impl<uint64_t, BinaryOpOr>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_ternary(
+    uint64_t* const left,
+    const uint64_t* const b,
+    const uint64_t* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    op_ternary_impl<uint64_t>(left, b, c, start_left, start_b, start_c, size, truth_table);
     return true;
 }
 
@@ -26,6 +26,11 @@ namespace neon {
     FUNC(__VA_ARGS__,LT); \
     FUNC(__VA_ARGS__,NE);
 
+// a facility to run through all possible in values operations
+#define ALL_IN_VALUES_OPS(FUNC,...) \
+    FUNC(__VA_ARGS__,In); \
+    FUNC(__VA_ARGS__,NotIn);
+
 // a facility to run through all possible range operations
 #define ALL_RANGE_OPS(FUNC,...) \
     FUNC(__VA_ARGS__,IncInc); \
@@ -82,12 +87,42 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, int8_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, int16_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, int32_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, uint8_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, uint16_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, uint32_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, uint64_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, float)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_NEON, double)
 
 #undef INSTANTIATE_COMPARE_VAL_NEON
 
 
+///////////////////////////////////////////////////////////////////////////
+
+//
+#define INSTANTIATE_IN_VALUES_NEON(TTYPE,OP) \
+    template bool OpInValuesImpl<TTYPE, InValuesType::OP>::op_in_values( \
+        uint8_t* const __restrict bitmask, \
+        const TTYPE* const __restrict src, \
+        const size_t size, \
+        const TTYPE* const __restrict values, \
+        const size_t n_values \
+    );
+
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, int8_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, int16_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, int32_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, int64_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, uint8_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, uint16_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, uint32_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, uint64_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, float)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_NEON, double)
+
+#undef INSTANTIATE_IN_VALUES_NEON
+
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
@@ -103,11 +138,33 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, int8_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, int16_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, int32_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, uint8_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, uint16_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, uint32_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, uint64_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, float)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_NEON, double)
 
 #undef INSTANTIATE_COMPARE_COLUMN_NEON
 
+//
+#define INSTANTIATE_COMPARE_COLUMN_MIXED_NEON(TTYPE,UTYPE,OP) \
+    template bool OpCompareColumnImpl<TTYPE, UTYPE, CompareOpType::OP>::op_compare_column( \
+        uint8_t* const __restrict bitmask, \
+        const TTYPE* const __restrict left, \
+        const UTYPE* const __restrict right, \
+        const size_t size \
+    );
+
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_NEON, int8_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_NEON, int16_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_NEON, int32_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_NEON, int32_t, float)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_NEON, int32_t, double)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_NEON, float, double)
+
+#undef INSTANTIATE_COMPARE_COLUMN_MIXED_NEON
+
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -125,6 +182,10 @@ ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, int8_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, int16_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, int32_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, int64_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, uint8_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, uint16_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, uint32_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, uint64_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, float)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_NEON, double)
 
@@ -147,6 +208,10 @@ ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, int8_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, int16_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, int32_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, int64_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, uint8_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, uint16_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, uint32_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, uint64_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, float)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_NEON, double)
 
@@ -169,6 +234,10 @@ ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, int8_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, int16_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, int32_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, int64_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, uint8_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, uint16_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, uint32_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, uint64_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, float)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, double)
 
@@ -179,6 +248,7 @@ ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_NEON, double)
 
 //
 #undef ALL_COMPARE_OPS
+#undef ALL_IN_VALUES_OPS
 #undef ALL_RANGE_OPS
 #undef ALL_ARITH_CMP_OPS
 
@@ -26,6 +26,12 @@ struct VectorizedNeon {
     template<typename T, CompareOpType Op>
     static constexpr inline auto op_compare_val = neon::OpCompareValImpl<T, Op>::op_compare_val;
 
+    template<typename T, InValuesType Op>
+    static constexpr inline auto op_in_values = neon::OpInValuesImpl<T, Op>::op_in_values;
+
+    template<typename OffsetT>
+    static constexpr inline auto op_prefix_match = neon::OpPrefixMatchImpl<OffsetT>::op_prefix_match;
+
     template<typename T, RangeType Op>
     static constexpr inline auto op_within_range_column = neon::OpWithinRangeColumnImpl<T, Op>::op_within_range_column;
 
@@ -52,6 +58,21 @@ struct VectorizedNeon {
 
     template<typename ElementT>
     static constexpr inline auto forward_op_sub = neon::ForwardOpsImpl<ElementT>::op_sub;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_count = neon::ForwardOpsImpl<ElementT>::op_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_find = neon::ForwardOpsImpl<ElementT>::op_find;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_and_with_count = neon::ForwardOpsImpl<ElementT>::op_and_with_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_or_with_count = neon::ForwardOpsImpl<ElementT>::op_or_with_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_ternary = neon::ForwardOpsImpl<ElementT>::op_ternary;
 };
 
 }
@@ -4,16 +4,21 @@
 
 #include <arm_sve.h>
 
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <type_traits>
+#include <utility>
 
 #include "sve-decl.h"
 
 #include "../../../common.h"
+#include "../../divide.h"
 #include "../../element_wise.h"
+#include "../../ternary_logic.h"
+#include "../../in_values.h"
 
 namespace milvus {
 namespace bitset {
@@ -111,6 +116,34 @@ struct GetPredHelper<int64_t> {
     }
 };
 
+template<>
+struct GetPredHelper<uint8_t> {
+    inline static svbool_t get_pred_op(const size_t n_elements) {
+        return get_pred_op_8(n_elements);
+    }
+};
+
+template<>
+struct GetPredHelper<uint16_t> {
+    inline static svbool_t get_pred_op(const size_t n_elements) {
+        return get_pred_op_16(n_elements);
+    }
+};
+
+template<>
+struct GetPredHelper<uint32_t> {
+    inline static svbool_t get_pred_op(const size_t n_elements) {
+        return get_pred_op_32(n_elements);
+    }
+};
+
+template<>
+struct GetPredHelper<uint64_t> {
+    inline static svbool_t get_pred_op(const size_t n_elements) {
+        return get_pred_op_64(n_elements);
+    }
+};
+
 template<>
 struct GetPredHelper<float> {
     inline static svbool_t get_pred_op(const size_t n_elements) {
@@ -155,6 +188,22 @@ struct CmpHelper<CompareOpType::EQ> {
         return svcmpeq_s64(pred, a, b);
     }
 
+    static inline svbool_t compare(const svbool_t pred, const svuint8_t a, const svuint8_t b) {
+        return svcmpeq_u8(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint16_t a, const svuint16_t b) {
+        return svcmpeq_u16(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint32_t a, const svuint32_t b) {
+        return svcmpeq_u32(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint64_t a, const svuint64_t b) {
+        return svcmpeq_u64(pred, a, b);
+    }
+
     static inline svbool_t compare(const svbool_t pred, const svfloat32_t a, const svfloat32_t b) {
         return svcmpeq_f32(pred, a, b);
     }
@@ -182,6 +231,22 @@ struct CmpHelper<CompareOpType::GE> {
         return svcmpge_s64(pred, a, b);
     }
 
+    static inline svbool_t compare(const svbool_t pred, const svuint8_t a, const svuint8_t b) {
+        return svcmpge_u8(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint16_t a, const svuint16_t b) {
+        return svcmpge_u16(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint32_t a, const svuint32_t b) {
+        return svcmpge_u32(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint64_t a, const svuint64_t b) {
+        return svcmpge_u64(pred, a, b);
+    }
+
     static inline svbool_t compare(const svbool_t pred, const svfloat32_t a, const svfloat32_t b) {
         return svcmpge_f32(pred, a, b);
     }
@@ -209,6 +274,22 @@ struct CmpHelper<CompareOpType::GT> {
         return svcmpgt_s64(pred, a, b);
     }
 
+    static inline svbool_t compare(const svbool_t pred, const svuint8_t a, const svuint8_t b) {
+        return svcmpgt_u8(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint16_t a, const svuint16_t b) {
+        return svcmpgt_u16(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint32_t a, const svuint32_t b) {
+        return svcmpgt_u32(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint64_t a, const svuint64_t b) {
+        return svcmpgt_u64(pred, a, b);
+    }
+
     static inline svbool_t compare(const svbool_t pred, const svfloat32_t a, const svfloat32_t b) {
         return svcmpgt_f32(pred, a, b);
     }
@@ -236,6 +317,22 @@ struct CmpHelper<CompareOpType::LE> {
         return svcmple_s64(pred, a, b);
     }
 
+    static inline svbool_t compare(const svbool_t pred, const svuint8_t a, const svuint8_t b) {
+        return svcmple_u8(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint16_t a, const svuint16_t b) {
+        return svcmple_u16(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint32_t a, const svuint32_t b) {
+        return svcmple_u32(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint64_t a, const svuint64_t b) {
+        return svcmple_u64(pred, a, b);
+    }
+
     static inline svbool_t compare(const svbool_t pred, const svfloat32_t a, const svfloat32_t b) {
         return svcmple_f32(pred, a, b);
     }
@@ -263,6 +360,22 @@ struct CmpHelper<CompareOpType::LT> {
         return svcmplt_s64(pred, a, b);
     }
 
+    static inline svbool_t compare(const svbool_t pred, const svuint8_t a, const svuint8_t b) {
+        return svcmplt_u8(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint16_t a, const svuint16_t b) {
+        return svcmplt_u16(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint32_t a, const svuint32_t b) {
+        return svcmplt_u32(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint64_t a, const svuint64_t b) {
+        return svcmplt_u64(pred, a, b);
+    }
+
     static inline svbool_t compare(const svbool_t pred, const svfloat32_t a, const svfloat32_t b) {
         return svcmplt_f32(pred, a, b);
     }
@@ -290,6 +403,22 @@ struct CmpHelper<CompareOpType::NE> {
         return svcmpne_s64(pred, a, b);
     }
 
+    static inline svbool_t compare(const svbool_t pred, const svuint8_t a, const svuint8_t b) {
+        return svcmpne_u8(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint16_t a, const svuint16_t b) {
+        return svcmpne_u16(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint32_t a, const svuint32_t b) {
+        return svcmpne_u32(pred, a, b);
+    }
+
+    static inline svbool_t compare(const svbool_t pred, const svuint64_t a, const svuint64_t b) {
+        return svcmpne_u64(pred, a, b);
+    }
+
     static inline svbool_t compare(const svbool_t pred, const svfloat32_t a, const svfloat32_t b) {
         return svcmpne_f32(pred, a, b);
     }
@@ -397,6 +526,98 @@ struct SVEVector<int64_t> {
     }
 };
 
+template<>
+struct SVEVector<uint8_t> {
+    using data_type = uint8_t;
+    using sve_type = svuint8_t;
+
+    // measured in the number of elements that an SVE register can hold
+    static inline uint64_t width() {
+        return svcntb();
+    }
+
+    static inline svbool_t pred_all() {
+        return svptrue_b8();
+    }
+
+    inline static sve_type set1(const data_type value) {
+        return svdup_n_u8(value);
+    }
+
+    inline static sve_type load(const svbool_t pred, const data_type* value) {
+        return svld1_u8(pred, value);
+    }
+};
+
+template<>
+struct SVEVector<uint16_t> {
+    using data_type = uint16_t;
+    using sve_type = svuint16_t;
+
+    // measured in the number of elements that an SVE register can hold
+    static inline uint64_t width() {
+        return svcnth();
+    }
+
+    static inline svbool_t pred_all() {
+        return svptrue_b16();
+    }
+
+    inline static sve_type set1(const data_type value) {
+        return svdup_n_u16(value);
+    }
+
+    inline static sve_type load(const svbool_t pred, const data_type* value) {
+        return svld1_u16(pred, value);
+    }
+};
+
+template<>
+struct SVEVector<uint32_t> {
+    using data_type = uint32_t;
+    using sve_type = svuint32_t;
+
+    // measured in the number of elements that an SVE register can hold
+    static inline uint64_t width() {
+        return svcntw();
+    }
+
+    static inline svbool_t pred_all() {
+        return svptrue_b32();
+    }
+
+    inline static sve_type set1(const data_type value) {
+        return svdup_n_u32(value);
+    }
+
+    inline static sve_type load(const svbool_t pred, const data_type* value) {
+        return svld1_u32(pred, value);
+    }
+};
+
+template<>
+struct SVEVector<uint64_t> {
+    using data_type = uint64_t;
+    using sve_type = svuint64_t;
+
+    // measured in the number of elements that an SVE register can hold
+    static inline uint64_t width() {
+        return svcntd();
+    }
+
+    static inline svbool_t pred_all() {
+        return svptrue_b64();
+    }
+
+    inline static sve_type set1(const data_type value) {
+        return svdup_n_u64(value);
+    }
+
+    inline static sve_type load(const svbool_t pred, const data_type* value) {
+        return svld1_u64(pred, value);
+    }
+};
+
 template<>
 struct SVEVector<float> {
     using data_type = float;
@@ -826,6 +1047,46 @@ bool OpCompareValImpl<int64_t, Op>::op_compare_val(
     return op_compare_val_impl<int64_t, Op>(res_u8, src, size, val);
 }
 
+template<CompareOpType Op>
+bool OpCompareValImpl<uint8_t, Op>::op_compare_val(
+    uint8_t* const __restrict res_u8,
+    const uint8_t* const __restrict src, 
+    const size_t size, 
+    const uint8_t& val
+) {
+    return op_compare_val_impl<uint8_t, Op>(res_u8, src, size, val);
+}
+
+template<CompareOpType Op>
+bool OpCompareValImpl<uint16_t, Op>::op_compare_val(
+    uint8_t* const __restrict res_u8,
+    const uint16_t* const __restrict src, 
+    const size_t size, 
+    const uint16_t& val
+) {
+    return op_compare_val_impl<uint16_t, Op>(res_u8, src, size, val);
+}
+
+template<CompareOpType Op>
+bool OpCompareValImpl<uint32_t, Op>::op_compare_val(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict src, 
+    const size_t size, 
+    const uint32_t& val 
+) {
+    return op_compare_val_impl<uint32_t, Op>(res_u8, src, size, val);
+}
+
+template<CompareOpType Op>
+bool OpCompareValImpl<uint64_t, Op>::op_compare_val(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict src, 
+    const size_t size, 
+    const uint64_t& val
+) {
+    return op_compare_val_impl<uint64_t, Op>(res_u8, src, size, val);
+}
+
 template<CompareOpType Op>
 bool OpCompareValImpl<float, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
@@ -851,19 +1112,35 @@ bool OpCompareValImpl<double, Op>::op_compare_val(
 
 namespace {
 
-template<typename T, CompareOpType CmpOp>
-bool op_compare_column_impl(
+// every value is broadcast into a register, 
+//   then compare masks are OR-ed in a single pass over the data
+template<typename T, InValuesType Op>
+bool op_in_values_impl(
     uint8_t* const __restrict res_u8,
-    const T* const __restrict left, 
-    const T* const __restrict right, 
-    const size_t size
+    const T* const __restrict src, 
+    const size_t size, 
+    const T* const __restrict values,
+    const size_t n_values
 ) {
-    auto handler = [left, right](const svbool_t pred, const size_t idx){
+    if (n_values == 0 || n_values > IN_VALUES_MAX_BROADCAST) {
+        return false;
+    }
+
+    auto handler = [src, values, n_values](const svbool_t pred, const size_t idx){
         using sve_t = SVEVector<T>;
 
-        const auto left_v = sve_t::load(pred, left + idx);
-        const auto right_v = sve_t::load(pred, right + idx);
-        const svbool_t cmp = CmpHelper<CmpOp>::compare(pred, left_v, right_v);
+        const auto v = sve_t::load(pred, src + idx);
+
+        svbool_t cmp = svpfalse_b();
+        for (size_t j = 0; j < n_values; j++) {
+            const auto target = sve_t::set1(values[j]);
+            cmp = svorr_b_z(pred, cmp, CmpHelper<CompareOpType::EQ>::compare(pred, v, target));
+        }
+
+        if constexpr (Op == InValuesType::NotIn) {
+            cmp = svnot_b_z(pred, cmp);
+        }
+
         return cmp;
     };
 
@@ -877,90 +1154,134 @@ bool op_compare_column_impl(
 }
 
 //
-template<CompareOpType Op>
-bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
+template<InValuesType Op>
+bool OpInValuesImpl<int8_t, Op>::op_in_values(
     uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict left, 
-    const int8_t* const __restrict right, 
-    const size_t size
+    const int8_t* const __restrict src, 
+    const size_t size, 
+    const int8_t* const __restrict values,
+    const size_t n_values
 ) {
-    return op_compare_column_impl<int8_t, Op>(res_u8, left, right, size);
+    return op_in_values_impl<int8_t, Op>(res_u8, src, size, values, n_values);
 }
 
-template<CompareOpType Op>
-bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
+template<InValuesType Op>
+bool OpInValuesImpl<int16_t, Op>::op_in_values(
     uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict left, 
-    const int16_t* const __restrict right, 
-    const size_t size
+    const int16_t* const __restrict src, 
+    const size_t size, 
+    const int16_t* const __restrict values,
+    const size_t n_values
 ) {
-    return op_compare_column_impl<int16_t, Op>(res_u8, left, right, size);
+    return op_in_values_impl<int16_t, Op>(res_u8, src, size, values, n_values);
 }
 
-template<CompareOpType Op>
-bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
+template<InValuesType Op>
+bool OpInValuesImpl<int32_t, Op>::op_in_values(
     uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict left, 
-    const int32_t* const __restrict right, 
-    const size_t size
+    const int32_t* const __restrict src, 
+    const size_t size, 
+    const int32_t* const __restrict values,
+    const size_t n_values
 ) {
-    return op_compare_column_impl<int32_t, Op>(res_u8, left, right, size);
+    return op_in_values_impl<int32_t, Op>(res_u8, src, size, values, n_values);
 }
 
-template<CompareOpType Op>
-bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
+template<InValuesType Op>
+bool OpInValuesImpl<int64_t, Op>::op_in_values(
     uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict left, 
-    const int64_t* const __restrict right, 
-    const size_t size
+    const int64_t* const __restrict src, 
+    const size_t size, 
+    const int64_t* const __restrict values,
+    const size_t n_values
 ) {
-    return op_compare_column_impl<int64_t, Op>(res_u8, left, right, size);
+    return op_in_values_impl<int64_t, Op>(res_u8, src, size, values, n_values);
 }
 
-template<CompareOpType Op>
-bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
+template<InValuesType Op>
+bool OpInValuesImpl<uint8_t, Op>::op_in_values(
     uint8_t* const __restrict res_u8,
-    const float* const __restrict left, 
-    const float* const __restrict right, 
-    const size_t size
+    const uint8_t* const __restrict src, 
+    const size_t size, 
+    const uint8_t* const __restrict values,
+    const size_t n_values
 ) {
-    return op_compare_column_impl<float, Op>(res_u8, left, right, size);
+    return op_in_values_impl<uint8_t, Op>(res_u8, src, size, values, n_values);
 }
 
-template<CompareOpType Op>
-bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
+template<InValuesType Op>
+bool OpInValuesImpl<uint16_t, Op>::op_in_values(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict left, 
-    const double* const __restrict right, 
-    const size_t size
+    const uint16_t* const __restrict src, 
+    const size_t size, 
+    const uint16_t* const __restrict values,
+    const size_t n_values
 ) {
-    return op_compare_column_impl<double, Op>(res_u8, left, right, size);
+    return op_in_values_impl<uint16_t, Op>(res_u8, src, size, values, n_values);
 }
 
-
-///////////////////////////////////////////////////////////////////////////
-
-namespace {
-
-template<typename T, RangeType Op>
-bool op_within_range_column_impl(
+template<InValuesType Op>
+bool OpInValuesImpl<uint32_t, Op>::op_in_values(
     uint8_t* const __restrict res_u8,
-    const T* const __restrict lower,
-    const T* const __restrict upper,
-    const T* const __restrict values,
-    const size_t size
+    const uint32_t* const __restrict src, 
+    const size_t size, 
+    const uint32_t* const __restrict values,
+    const size_t n_values
 ) {
-    auto handler = [lower, upper, values](const svbool_t pred, const size_t idx){
-        using sve_t = SVEVector<T>;
+    return op_in_values_impl<uint32_t, Op>(res_u8, src, size, values, n_values);
+}
 
-        const auto lower_v = sve_t::load(pred, lower + idx);
-        const auto upper_v = sve_t::load(pred, upper + idx);
-        const auto values_v = sve_t::load(pred, values + idx);
+template<InValuesType Op>
+bool OpInValuesImpl<uint64_t, Op>::op_in_values(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict src, 
+    const size_t size, 
+    const uint64_t* const __restrict values,
+    const size_t n_values
+) {
+    return op_in_values_impl<uint64_t, Op>(res_u8, src, size, values, n_values);
+}
 
-        const svbool_t cmpl = CmpHelper<Range2Compare<Op>::lower>::compare(pred, lower_v, values_v);
-        const svbool_t cmpu = CmpHelper<Range2Compare<Op>::upper>::compare(pred, values_v, upper_v);
-        const svbool_t cmp = svand_b_z(pred, cmpl, cmpu);
+template<InValuesType Op>
+bool OpInValuesImpl<float, Op>::op_in_values(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict src, 
+    const size_t size, 
+    const float* const __restrict values,
+    const size_t n_values
+) {
+    return op_in_values_impl<float, Op>(res_u8, src, size, values, n_values);
+}
+
+template<InValuesType Op>
+bool OpInValuesImpl<double, Op>::op_in_values(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict src, 
+    const size_t size, 
+    const double* const __restrict values,
+    const size_t n_values
+) {
+    return op_in_values_impl<double, Op>(res_u8, src, size, values, n_values);
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template<typename T, CompareOpType CmpOp>
+bool op_compare_column_impl(
+    uint8_t* const __restrict res_u8,
+    const T* const __restrict left, 
+    const T* const __restrict right, 
+    const size_t size
+) {
+    auto handler = [left, right](const svbool_t pred, const size_t idx){
+        using sve_t = SVEVector<T>;
 
+        const auto left_v = sve_t::load(pred, left + idx);
+        const auto right_v = sve_t::load(pred, right + idx);
+        const svbool_t cmp = CmpHelper<CmpOp>::compare(pred, left_v, right_v);
         return cmp;
     };
 
@@ -971,73 +1292,241 @@ bool op_within_range_column_impl(
     );
 }
 
+// loads T values into the lanes of U, so that a comparison 
+//   follows the C++ rules for the mixed types
+template<typename T, typename U>
+struct WidenHelper {};
+
+template<>
+struct WidenHelper<int8_t, int64_t> {
+    static inline svint64_t load(const svbool_t pred, const int8_t* const src) {
+        return svld1sb_s64(pred, src);
+    }
+};
+
+template<>
+struct WidenHelper<int16_t, int64_t> {
+    static inline svint64_t load(const svbool_t pred, const int16_t* const src) {
+        return svld1sh_s64(pred, src);
+    }
+};
+
+template<>
+struct WidenHelper<int32_t, int64_t> {
+    static inline svint64_t load(const svbool_t pred, const int32_t* const src) {
+        return svld1sw_s64(pred, src);
+    }
+};
+
+template<>
+struct WidenHelper<int32_t, float> {
+    static inline svfloat32_t load(const svbool_t pred, const int32_t* const src) {
+        // int32_t is rounded to float, the same way as C++ does
+        return svcvt_f32_s32_x(pred, svld1_s32(pred, src));
+    }
+};
+
+template<>
+struct WidenHelper<int32_t, double> {
+    static inline svfloat64_t load(const svbool_t pred, const int32_t* const src) {
+        return svcvt_f64_s64_x(pred, svld1sw_s64(pred, src));
+    }
+};
+
+template<>
+struct WidenHelper<float, double> {
+    static inline svfloat64_t load(const svbool_t pred, const float* const src) {
+        // 32-bit values are placed in the lower halves of 64-bit lanes
+        const svuint64_t src_u64 = svld1uw_u64(pred, reinterpret_cast<const uint32_t*>(src));
+        return svcvt_f64_f32_x(pred, svreinterpret_f32_u64(src_u64));
+    }
+};
+
+//
+template<typename T, typename U, CompareOpType CmpOp>
+bool op_compare_column_mixed_impl(
+    uint8_t* const __restrict res_u8,
+    const T* const __restrict left, 
+    const U* const __restrict right, 
+    const size_t size
+) {
+    auto handler = [left, right](const svbool_t pred, const size_t idx){
+        using sve_t = SVEVector<U>;
+
+        const auto left_v = WidenHelper<T, U>::load(pred, left + idx);
+        const auto right_v = sve_t::load(pred, right + idx);
+        const svbool_t cmp = CmpHelper<CmpOp>::compare(pred, left_v, right_v);
+        return cmp;
+    };
+
+    return op_mask_helper<U, decltype(handler)>(
+        res_u8,
+        size,
+        handler
+    );
+}
+
 }
 
 //
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict lower,
-    const int8_t* const __restrict upper,
-    const int8_t* const __restrict values,
+    const int8_t* const __restrict left, 
+    const int8_t* const __restrict right, 
     const size_t size
 ) {
-    return op_within_range_column_impl<int8_t, Op>(res_u8, lower, upper, values, size);
+    return op_compare_column_impl<int8_t, Op>(res_u8, left, right, size);
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict lower,
-    const int16_t* const __restrict upper,
-    const int16_t* const __restrict values,
+    const int16_t* const __restrict left, 
+    const int16_t* const __restrict right, 
     const size_t size
 ) {
-    return op_within_range_column_impl<int16_t, Op>(res_u8, lower, upper, values, size);
+    return op_compare_column_impl<int16_t, Op>(res_u8, left, right, size);
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict lower,
-    const int32_t* const __restrict upper,
-    const int32_t* const __restrict values,
+    const int32_t* const __restrict left, 
+    const int32_t* const __restrict right, 
     const size_t size
 ) {
-    return op_within_range_column_impl<int32_t, Op>(res_u8, lower, upper, values, size);
+    return op_compare_column_impl<int32_t, Op>(res_u8, left, right, size);
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict lower,
-    const int64_t* const __restrict upper,
-    const int64_t* const __restrict values,
+    const int64_t* const __restrict left, 
+    const int64_t* const __restrict right, 
     const size_t size
 ) {
-    return op_within_range_column_impl<int64_t, Op>(res_u8, lower, upper, values, size);
+    return op_compare_column_impl<int64_t, Op>(res_u8, left, right, size);
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<float, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint8_t, uint8_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const float* const __restrict lower,
-    const float* const __restrict upper,
-    const float* const __restrict values,
+    const uint8_t* const __restrict left, 
+    const uint8_t* const __restrict right, 
     const size_t size
 ) {
-    return op_within_range_column_impl<float, Op>(res_u8, lower, upper, values, size);
+    return op_compare_column_impl<uint8_t, Op>(res_u8, left, right, size);
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint16_t, uint16_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict lower,
-    const double* const __restrict upper,
-    const double* const __restrict values,
+    const uint16_t* const __restrict left, 
+    const uint16_t* const __restrict right, 
     const size_t size
 ) {
-    return op_within_range_column_impl<double, Op>(res_u8, lower, upper, values, size);
+    return op_compare_column_impl<uint16_t, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint32_t, uint32_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict left, 
+    const uint32_t* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_impl<uint32_t, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint64_t, uint64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict left, 
+    const uint64_t* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_impl<uint64_t, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left, 
+    const float* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_impl<float, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_impl<double, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int8_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_mixed_impl<int8_t, int64_t, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int16_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_mixed_impl<int16_t, int64_t, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_mixed_impl<int32_t, int64_t, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const float* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_mixed_impl<int32_t, float, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_mixed_impl<int32_t, double, Op>(res_u8, left, right, size);
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<float, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    return op_compare_column_mixed_impl<float, double, Op>(res_u8, left, right, size);
 }
 
 
@@ -1046,18 +1535,18 @@ bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
 namespace {
 
 template<typename T, RangeType Op>
-bool op_within_range_val_impl(
+bool op_within_range_column_impl(
     uint8_t* const __restrict res_u8,
-    const T& lower,
-    const T& upper,
+    const T* const __restrict lower,
+    const T* const __restrict upper,
     const T* const __restrict values,
     const size_t size
 ) {
     auto handler = [lower, upper, values](const svbool_t pred, const size_t idx){
         using sve_t = SVEVector<T>;
 
-        const auto lower_v = sve_t::set1(lower);
-        const auto upper_v = sve_t::set1(upper);
+        const auto lower_v = sve_t::load(pred, lower + idx);
+        const auto upper_v = sve_t::load(pred, upper + idx);
         const auto values_v = sve_t::load(pred, values + idx);
 
         const svbool_t cmpl = CmpHelper<Range2Compare<Op>::lower>::compare(pred, lower_v, values_v);
@@ -1078,40 +1567,187 @@ bool op_within_range_val_impl(
 
 //
 template<RangeType Op>
-bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
+bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
     uint8_t* const __restrict res_u8,
-    const int8_t& lower,
-    const int8_t& upper,
+    const int8_t* const __restrict lower,
+    const int8_t* const __restrict upper,
     const int8_t* const __restrict values,
     const size_t size
 ) {
-    return op_within_range_val_impl<int8_t, Op>(res_u8, lower, upper, values, size);
+    return op_within_range_column_impl<int8_t, Op>(res_u8, lower, upper, values, size);
 }
 
 template<RangeType Op>
-bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
+bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
     uint8_t* const __restrict res_u8,
-    const int16_t& lower,
-    const int16_t& upper,
+    const int16_t* const __restrict lower,
+    const int16_t* const __restrict upper,
     const int16_t* const __restrict values,
     const size_t size
 ) {
-    return op_within_range_val_impl<int16_t, Op>(res_u8, lower, upper, values, size);
+    return op_within_range_column_impl<int16_t, Op>(res_u8, lower, upper, values, size);
 }
 
 template<RangeType Op>
-bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
+bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
     uint8_t* const __restrict res_u8,
-    const int32_t& lower,
-    const int32_t& upper,
+    const int32_t* const __restrict lower,
+    const int32_t* const __restrict upper,
     const int32_t* const __restrict values,
     const size_t size
 ) {
-    return op_within_range_val_impl<int32_t, Op>(res_u8, lower, upper, values, size);
+    return op_within_range_column_impl<int32_t, Op>(res_u8, lower, upper, values, size);
 }
 
 template<RangeType Op>
-bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
+bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict lower,
+    const int64_t* const __restrict upper,
+    const int64_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_column_impl<int64_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint8_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint8_t* const __restrict lower,
+    const uint8_t* const __restrict upper,
+    const uint8_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_column_impl<uint8_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint16_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint16_t* const __restrict lower,
+    const uint16_t* const __restrict upper,
+    const uint16_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_column_impl<uint16_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint32_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict lower,
+    const uint32_t* const __restrict upper,
+    const uint32_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_column_impl<uint32_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint64_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict lower,
+    const uint64_t* const __restrict upper,
+    const uint64_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_column_impl<uint64_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<float, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict lower,
+    const float* const __restrict upper,
+    const float* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_column_impl<float, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict lower,
+    const double* const __restrict upper,
+    const double* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_column_impl<double, Op>(res_u8, lower, upper, values, size);
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+template<typename T, RangeType Op>
+bool op_within_range_val_impl(
+    uint8_t* const __restrict res_u8,
+    const T& lower,
+    const T& upper,
+    const T* const __restrict values,
+    const size_t size
+) {
+    auto handler = [lower, upper, values](const svbool_t pred, const size_t idx){
+        using sve_t = SVEVector<T>;
+
+        const auto lower_v = sve_t::set1(lower);
+        const auto upper_v = sve_t::set1(upper);
+        const auto values_v = sve_t::load(pred, values + idx);
+
+        const svbool_t cmpl = CmpHelper<Range2Compare<Op>::lower>::compare(pred, lower_v, values_v);
+        const svbool_t cmpu = CmpHelper<Range2Compare<Op>::upper>::compare(pred, values_v, upper_v);
+        const svbool_t cmp = svand_b_z(pred, cmpl, cmpu);
+
+        return cmp;
+    };
+
+    return op_mask_helper<T, decltype(handler)>(
+        res_u8,
+        size,
+        handler
+    );
+}
+
+}
+
+//
+template<RangeType Op>
+bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int8_t& lower,
+    const int8_t& upper,
+    const int8_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_val_impl<int8_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int16_t& lower,
+    const int16_t& upper,
+    const int16_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_val_impl<int16_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int32_t& lower,
+    const int32_t& upper,
+    const int32_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_val_impl<int32_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
     uint8_t* const __restrict res_u8,
     const int64_t& lower,
     const int64_t& upper,
@@ -1121,6 +1757,50 @@ bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
     return op_within_range_val_impl<int64_t, Op>(res_u8, lower, upper, values, size);
 }
 
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint8_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint8_t& lower,
+    const uint8_t& upper,
+    const uint8_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_val_impl<uint8_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint16_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint16_t& lower,
+    const uint16_t& upper,
+    const uint16_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_val_impl<uint16_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint32_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint32_t& lower,
+    const uint32_t& upper,
+    const uint32_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_val_impl<uint32_t, Op>(res_u8, lower, upper, values, size);
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint64_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint64_t& lower,
+    const uint64_t& upper,
+    const uint64_t* const __restrict values,
+    const size_t size
+) {
+    return op_within_range_val_impl<uint64_t, Op>(res_u8, lower, upper, values, size);
+}
+
 template<RangeType Op>
 bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
     uint8_t* const __restrict res_u8,
@@ -1148,6 +1828,76 @@ bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
 
 namespace {
 
+// DivisorI64 for SVE. SVE vectors are sizeless, so this one 
+//   stores scalar values and uses _n_ versions of intrinsics.
+struct DivisorVecI64 {
+    DivisorI64 d;
+
+    explicit DivisorVecI64(const int64_t right) : d{right} {}
+
+    // x / divisor, truncated
+    inline svint64_t divide(const svbool_t pred, const svint64_t x) const {
+        if (d.magic == 0) {
+            // +-2^shift
+            const int64_t mask = (uint64_t(1) << d.shift) - 1;
+            const svint64_t bias = svand_n_s64_x(pred, svasr_n_s64_x(pred, x, 63), mask);
+            const svint64_t q = svasr_n_s64_x(pred, svadd_s64_x(pred, x, bias), d.shift);
+            return d.negative ? svneg_s64_x(pred, q) : q;
+        } else {
+            svint64_t uq = svmulh_n_s64_x(pred, x, d.magic);
+            if (d.add) {
+                uq = d.negative ? svsub_s64_x(pred, uq, x) : svadd_s64_x(pred, uq, x);
+            }
+
+            const svint64_t q = svasr_n_s64_x(pred, uq, d.shift);
+            const svint64_t q_sign = svreinterpret_s64_u64(
+                svlsr_n_u64_x(pred, svreinterpret_u64_s64(q), 63));
+            return svadd_s64_x(pred, q, q_sign);
+        }
+    }
+
+    // x % divisor, the sign follows x
+    inline svint64_t modulo(const svbool_t pred, const svint64_t x) const {
+        return svmls_n_s64_x(pred, x, divide(pred, x), d.divisor);
+    }
+};
+
+// Div and Mod use a precomputed divisor instead of a plain value.
+// prepare() is called once, broadcast() is called for every vector.
+template<ArithOpType AOp>
+struct ArithOperandI64 {
+    static inline int64_t prepare(const int64_t right) {
+        return right;
+    }
+
+    static inline svint64_t broadcast(const int64_t right) {
+        return svdup_n_s64(right);
+    }
+};
+
+template<>
+struct ArithOperandI64<ArithOpType::Div> {
+    static inline DivisorVecI64 prepare(const int64_t right) {
+        return DivisorVecI64(right);
+    }
+
+    static inline const DivisorVecI64& broadcast(const DivisorVecI64& right) {
+        return right;
+    }
+};
+
+template<>
+struct ArithOperandI64<ArithOpType::Mod> {
+    static inline DivisorVecI64 prepare(const int64_t right) {
+        return DivisorVecI64(right);
+    }
+
+    static inline const DivisorVecI64& broadcast(const DivisorVecI64& right) {
+        return right;
+    }
+};
+
+//
 template<ArithOpType AOp, CompareOpType CmpOp>
 struct ArithHelperI64 {};
 
@@ -1177,12 +1927,187 @@ struct ArithHelperI64<ArithOpType::Mul, CmpOp> {
 
 template<CompareOpType CmpOp>
 struct ArithHelperI64<ArithOpType::Div, CmpOp> {
-    static inline svbool_t op(const svbool_t pred, const svint64_t left, const svint64_t right, const svint64_t value) {
+    static inline svbool_t op(const svbool_t pred, const svint64_t left, const DivisorVecI64& right, const svint64_t value) {
+        // left / right == value
+        return CmpHelper<CmpOp>::compare(pred, right.divide(pred, left), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Mod, CmpOp> {
+    static inline svbool_t op(const svbool_t pred, const svint64_t left, const DivisorVecI64& right, const svint64_t value) {
+        // left % right == value
+        return CmpHelper<CmpOp>::compare(pred, right.modulo(pred, left), value);
+    }
+};
+
+// uint64_t uses the modular arithmetic. SVE provides 
+//   a native unsigned 64-bit division.
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperU64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Add, CmpOp> {
+    static inline svbool_t op(const svbool_t pred, const svuint64_t left, const svuint64_t right, const svuint64_t value) {
+        // left + right == value
+        return CmpHelper<CmpOp>::compare(pred, svadd_u64_z(pred, left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Sub, CmpOp> {
+    static inline svbool_t op(const svbool_t pred, const svuint64_t left, const svuint64_t right, const svuint64_t value) {
+        // left - right == value
+        return CmpHelper<CmpOp>::compare(pred, svsub_u64_z(pred, left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Mul, CmpOp> {
+    static inline svbool_t op(const svbool_t pred, const svuint64_t left, const svuint64_t right, const svuint64_t value) {
+        // left * right == value
+        return CmpHelper<CmpOp>::compare(pred, svmul_u64_z(pred, left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Div, CmpOp> {
+    static inline svbool_t op(const svbool_t pred, const svuint64_t left, const svuint64_t right, const svuint64_t value) {
         // left / right == value
-        return CmpHelper<CmpOp>::compare(pred, svdiv_s64_z(pred, left, right), value);
+        return CmpHelper<CmpOp>::compare(pred, svdiv_u64_z(pred, left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Mod, CmpOp> {
+    static inline svbool_t op(const svbool_t pred, const svuint64_t left, const svuint64_t right, const svuint64_t value) {
+        // left % right == value
+        const svuint64_t q = svdiv_u64_z(pred, left, right);
+        return CmpHelper<CmpOp>::compare(pred, svmls_u64_z(pred, left, q, right), value);
     }
 };
 
+// std::fmod(x, y), bit for bit.
+// x - trunc(x / y) * y is computed exactly with fma, if trunc(x / y) is exact
+//   and is wrong by 1 at most, which is the case for |x / y| < 2^51 (2^22 for floats).
+//   Such a quotient is fixed by looking at the sign and the magnitude of the remainder.
+// |x| < |y| case returns x, this also handles y = +-inf.
+// The rest of lanes (NaN, Inf, zero divisor, huge quotients) are rare and
+//   are processed with std::fmod.
+inline svfloat64_t fmod_f64(const svbool_t pred, const svfloat64_t x, const svfloat64_t y) {
+    constexpr uint64_t sign_bit = 0x8000000000000000ULL;
+
+    const svuint64_t x_u = svreinterpret_u64_f64(x);
+    const svuint64_t y_u = svreinterpret_u64_f64(y);
+    const svfloat64_t abs_x = svabs_f64_x(pred, x);
+    const svfloat64_t abs_y = svabs_f64_x(pred, y);
+
+    const svfloat64_t q = svrintz_f64_x(pred, svdiv_f64_x(pred, x, y));
+    const svfloat64_t r0 = svmls_f64_x(pred, x, q, y);
+
+    // +1 or -1, the sign of the quotient
+    const svfloat64_t s = svreinterpret_f64_u64(svorr_n_u64_x(
+        pred, svand_n_u64_x(pred, sveor_u64_x(pred, x_u, y_u), sign_bit), 0x3FF0000000000000ULL));
+
+    // the quotient is too small or too large by 1
+    const svbool_t too_small = svcmpge_f64(pred, svabs_f64_x(pred, r0), abs_y);
+    const svbool_t too_large = svand_b_z(
+        pred,
+        svcmplt_n_s64(pred, svreinterpret_s64_u64(sveor_u64_x(pred, svreinterpret_u64_f64(r0), x_u)), 0),
+        svcmpne_n_f64(pred, r0, 0.0));
+    const svfloat64_t q1 = svsub_f64_m(too_large, svadd_f64_m(too_small, q, s), s);
+
+    // the sign of the remainder is the sign of x, including zeros
+    const svfloat64_t r1 = svmls_f64_x(pred, x, q1, y);
+    const svfloat64_t r = svreinterpret_f64_u64(svorr_u64_x(
+        pred,
+        svbic_n_u64_x(pred, svreinterpret_u64_f64(r1), sign_bit),
+        svand_n_u64_x(pred, x_u, sign_bit)));
+
+    const svbool_t is_small = svcmplt_f64(pred, abs_x, abs_y);
+    const svbool_t is_fast = svcmplt_n_f64(pred, svabs_f64_x(pred, q), 2251799813685248.0);
+    const svfloat64_t result = svsel_f64(is_small, x, r);
+
+    const svbool_t is_slow = svbic_b_z(pred, pred, svorr_b_z(pred, is_small, is_fast));
+    if (!svptest_any(pred, is_slow)) {
+        return result;
+    }
+
+    // this is a temporary buffer for the maximum possible case of 2048 bits
+    double x_s[MAX_SVE_WIDTH / 64];
+    double y_s[MAX_SVE_WIDTH / 64];
+    double result_s[MAX_SVE_WIDTH / 64];
+    uint64_t is_slow_s[MAX_SVE_WIDTH / 64];
+    svst1_f64(svptrue_b64(), x_s, x);
+    svst1_f64(svptrue_b64(), y_s, y);
+    svst1_f64(svptrue_b64(), result_s, result);
+    svst1_u64(svptrue_b64(), is_slow_s, svdup_n_u64_z(is_slow, 1));
+    for (size_t i = 0; i < svcntd(); i++) {
+        if (is_slow_s[i] != 0) {
+            result_s[i] = std::fmod(x_s[i], y_s[i]);
+        }
+    }
+
+    return svld1_f64(svptrue_b64(), result_s);
+}
+
+inline svfloat32_t fmod_f32(const svbool_t pred, const svfloat32_t x, const svfloat32_t y) {
+    constexpr uint32_t sign_bit = 0x80000000;
+
+    const svuint32_t x_u = svreinterpret_u32_f32(x);
+    const svuint32_t y_u = svreinterpret_u32_f32(y);
+    const svfloat32_t abs_x = svabs_f32_x(pred, x);
+    const svfloat32_t abs_y = svabs_f32_x(pred, y);
+
+    const svfloat32_t q = svrintz_f32_x(pred, svdiv_f32_x(pred, x, y));
+    const svfloat32_t r0 = svmls_f32_x(pred, x, q, y);
+
+    // +1 or -1, the sign of the quotient
+    const svfloat32_t s = svreinterpret_f32_u32(svorr_n_u32_x(
+        pred, svand_n_u32_x(pred, sveor_u32_x(pred, x_u, y_u), sign_bit), 0x3F800000));
+
+    // the quotient is too small or too large by 1
+    const svbool_t too_small = svcmpge_f32(pred, svabs_f32_x(pred, r0), abs_y);
+    const svbool_t too_large = svand_b_z(
+        pred,
+        svcmplt_n_s32(pred, svreinterpret_s32_u32(sveor_u32_x(pred, svreinterpret_u32_f32(r0), x_u)), 0),
+        svcmpne_n_f32(pred, r0, 0.0f));
+    const svfloat32_t q1 = svsub_f32_m(too_large, svadd_f32_m(too_small, q, s), s);
+
+    // the sign of the remainder is the sign of x, including zeros
+    const svfloat32_t r1 = svmls_f32_x(pred, x, q1, y);
+    const svfloat32_t r = svreinterpret_f32_u32(svorr_u32_x(
+        pred,
+        svbic_n_u32_x(pred, svreinterpret_u32_f32(r1), sign_bit),
+        svand_n_u32_x(pred, x_u, sign_bit)));
+
+    const svbool_t is_small = svcmplt_f32(pred, abs_x, abs_y);
+    const svbool_t is_fast = svcmplt_n_f32(pred, svabs_f32_x(pred, q), 4194304.0f);
+    const svfloat32_t result = svsel_f32(is_small, x, r);
+
+    const svbool_t is_slow = svbic_b_z(pred, pred, svorr_b_z(pred, is_small, is_fast));
+    if (!svptest_any(pred, is_slow)) {
+        return result;
+    }
+
+    // this is a temporary buffer for the maximum possible case of 2048 bits
+    float x_s[MAX_SVE_WIDTH / 32];
+    float y_s[MAX_SVE_WIDTH / 32];
+    float result_s[MAX_SVE_WIDTH / 32];
+    uint32_t is_slow_s[MAX_SVE_WIDTH / 32];
+    svst1_f32(svptrue_b32(), x_s, x);
+    svst1_f32(svptrue_b32(), y_s, y);
+    svst1_f32(svptrue_b32(), result_s, result);
+    svst1_u32(svptrue_b32(), is_slow_s, svdup_n_u32_z(is_slow, 1));
+    for (size_t i = 0; i < svcntw(); i++) {
+        if (is_slow_s[i] != 0) {
+            result_s[i] = std::fmod(x_s[i], y_s[i]);
+        }
+    }
+
+    return svld1_f32(svptrue_b32(), result_s);
+}
+
 //
 template<ArithOpType AOp, CompareOpType CmpOp>
 struct ArithHelperF32 {};
@@ -1225,6 +2150,14 @@ struct ArithHelperF32<ArithOpType::Div, CmpOp> {
     }
 };
 
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Mod, CmpOp> {
+    static inline svbool_t op(const svbool_t pred, const svfloat32_t left, const svfloat32_t right, const svfloat32_t value) {
+        // fmod(left, right) == value
+        return CmpHelper<CmpOp>::compare(pred, fmod_f32(pred, left, right), value);
+    }
+};
+
 //
 template<ArithOpType AOp, CompareOpType CmpOp>
 struct ArithHelperF64 {};
@@ -1267,10 +2200,15 @@ struct ArithHelperF64<ArithOpType::Div, CmpOp> {
     }
 };
 
-}
-
-// todo: Mod
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Mod, CmpOp> {
+    static inline svbool_t op(const svbool_t pred, const svfloat64_t left, const svfloat64_t right, const svfloat64_t value) {
+        // fmod(left, right) == value
+        return CmpHelper<CmpOp>::compare(pred, fmod_f64(pred, left, right), value);
+    }
+};
 
+}
 
 template<ArithOpType AOp, CompareOpType CmpOp>
 bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
@@ -1280,15 +2218,18 @@ bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
     const ArithHighPrecisionType<int8_t>& value,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mod) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
         return false;
     } else {
         using T = int64_t;
 
-        auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
+        const auto right_c = ArithOperandI64<AOp>::prepare(right_operand);
+
+        auto handler = [src, right_c, value](const svbool_t pred, const size_t idx){
             using sve_t = SVEVector<T>;
 
-            const auto right_v = svdup_n_s64(right_operand);
+            const auto right_v = ArithOperandI64<AOp>::broadcast(right_c);
             const auto value_v = svdup_n_s64(value);
             const svint64_t src_v = svld1sb_s64(pred, src + idx);
 
@@ -1304,241 +2245,1061 @@ bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict src,
-    const ArithHighPrecisionType<int16_t>& right_operand,
-    const ArithHighPrecisionType<int16_t>& value,
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict src,
+    const ArithHighPrecisionType<int16_t>& right_operand,
+    const ArithHighPrecisionType<int16_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        using T = int64_t;
+
+        const auto right_c = ArithOperandI64<AOp>::prepare(right_operand);
+        auto handler = [src, right_c, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const auto right_v = ArithOperandI64<AOp>::broadcast(right_c);
+            const auto value_v = svdup_n_s64(value);
+            const svint64_t src_v = svld1sh_s64(pred, src + idx);
+
+            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict src,
+    const ArithHighPrecisionType<int32_t>& right_operand,
+    const ArithHighPrecisionType<int32_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        using T = int64_t;
+
+        const auto right_c = ArithOperandI64<AOp>::prepare(right_operand);
+        auto handler = [src, right_c, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const auto right_v = ArithOperandI64<AOp>::broadcast(right_c);
+            const auto value_v = svdup_n_s64(value);
+            const svint64_t src_v = svld1sw_s64(pred, src + idx);
+
+            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict src,
+    const ArithHighPrecisionType<int64_t>& right_operand,
+    const ArithHighPrecisionType<int64_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        using T = int64_t;
+
+        const auto right_c = ArithOperandI64<AOp>::prepare(right_operand);
+        auto handler = [src, right_c, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const auto right_v = ArithOperandI64<AOp>::broadcast(right_c);
+            const auto value_v = svdup_n_s64(value);
+            const svint64_t src_v = svld1_s64(pred, src + idx);
+
+            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint8_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint8_t* const __restrict src,
+    const ArithHighPrecisionType<uint8_t>& right_operand,
+    const ArithHighPrecisionType<uint8_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        using T = int64_t;
+
+        const auto right_c = ArithOperandI64<AOp>::prepare(right_operand);
+
+        auto handler = [src, right_c, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const auto right_v = ArithOperandI64<AOp>::broadcast(right_c);
+            const auto value_v = svdup_n_s64(value);
+            const svint64_t src_v = svreinterpret_s64_u64(svld1ub_u64(pred, src + idx));
+
+            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint16_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint16_t* const __restrict src,
+    const ArithHighPrecisionType<uint16_t>& right_operand,
+    const ArithHighPrecisionType<uint16_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        using T = int64_t;
+
+        const auto right_c = ArithOperandI64<AOp>::prepare(right_operand);
+        auto handler = [src, right_c, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const auto right_v = ArithOperandI64<AOp>::broadcast(right_c);
+            const auto value_v = svdup_n_s64(value);
+            const svint64_t src_v = svreinterpret_s64_u64(svld1uh_u64(pred, src + idx));
+
+            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint32_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict src,
+    const ArithHighPrecisionType<uint32_t>& right_operand,
+    const ArithHighPrecisionType<uint32_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        using T = int64_t;
+
+        const auto right_c = ArithOperandI64<AOp>::prepare(right_operand);
+        auto handler = [src, right_c, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const auto right_v = ArithOperandI64<AOp>::broadcast(right_c);
+            const auto value_v = svdup_n_s64(value);
+            const svint64_t src_v = svreinterpret_s64_u64(svld1uw_u64(pred, src + idx));
+
+            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint64_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict src,
+    const ArithHighPrecisionType<uint64_t>& right_operand,
+    const ArithHighPrecisionType<uint64_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        using T = uint64_t;
+
+        auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const svuint64_t right_v = svdup_n_u64(right_operand);
+            const svuint64_t value_v = svdup_n_u64(value);
+            const svuint64_t src_v = svld1_u64(pred, src + idx);
+
+            const svbool_t cmp = ArithHelperU64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<float, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict src,
+    const ArithHighPrecisionType<float>& right_operand,
+    const ArithHighPrecisionType<float>& value,
+    const size_t size
+) {
+    if constexpr (AOp == ArithOpType::Div) {
+        if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
+            // a special case that allows faster processing by using the multiplication
+            //   operation instead of the division one.
+
+            using T = float;
+    
+            auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
+                using sve_t = SVEVector<T>;
+
+                const auto right_v = svdup_n_f32(right_operand);
+                const auto value_v = svdup_n_f32(value);
+                const svfloat32_t src_v = svld1_f32(pred, src + idx);
+
+                const svbool_t cmp = ArithHelperF32<AOp, CmpOp>::op_special(pred, src_v, right_v, value_v);
+                return cmp;
+            };
+
+            return op_mask_helper<T, decltype(handler)>(
+                res_u8,
+                size,
+                handler
+            );
+        } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
+            // flip signs and go for the multiplication case
+            return OpArithCompareImpl<float, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
+                res_u8, src, -right_operand, -value, size
+            );
+        }
+
+        // go with the default case
+    }
+
+    // a default case
+    {
+        using T = float;
+        
+        auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const auto right_v = svdup_n_f32(right_operand);
+            const auto value_v = svdup_n_f32(value);
+            const svfloat32_t src_v = svld1_f32(pred, src + idx);
+
+            const svbool_t cmp = ArithHelperF32<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<double, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict src,
+    const ArithHighPrecisionType<double>& right_operand,
+    const ArithHighPrecisionType<double>& value,
+    const size_t size
+) {
+    if constexpr (AOp == ArithOpType::Div) {
+        if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
+            // a special case that allows faster processing by using the multiplication
+            //   operation instead of the division one.
+
+            using T = double;
+            
+            auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
+                using sve_t = SVEVector<T>;
+
+                const auto right_v = svdup_n_f64(right_operand);
+                const auto value_v = svdup_n_f64(value);
+                const svfloat64_t src_v = svld1_f64(pred, src + idx);
+
+                const svbool_t cmp = ArithHelperF64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+                return cmp;
+            };
+
+            return op_mask_helper<T, decltype(handler)>(
+                res_u8,
+                size,
+                handler
+            );
+        } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
+            // flip signs and go for the multiplication case
+            return OpArithCompareImpl<double, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
+                res_u8, src, -right_operand, -value, size
+            );
+        }
+
+        // go with the default case
+    }
+
+    // a default case
+    {
+        using T = double;
+    
+        auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
+            using sve_t = SVEVector<T>;
+
+            const auto right_v = svdup_n_f64(right_operand);
+            const auto value_v = svdup_n_f64(value);
+            const svfloat64_t src_v = svld1_f64(pred, src + idx);
+
+            const svbool_t cmp = ArithHelperF64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
+            return cmp;
+        };
+
+        return op_mask_helper<T, decltype(handler)>(
+            res_u8,
+            size,
+            handler
+        );
+    }
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+// forward ops
+
+namespace {
+
+// Returns the index of the first bit equal to IsSet in a given number 
+//   of bytes, or size * 8 if there is none.
+template<bool IsSet>
+size_t find(
+    const uint8_t* const __restrict src, 
+    const size_t size
+) {
+    const size_t sve_width = svcntb();
+    const uint8_t skip_value = (IsSet) ? 0 : 0xFF;
+
+    for (size_t i = 0; i < size; i += sve_width) {
+        const svbool_t pred = svwhilelt_b8(uint64_t(i), uint64_t(size));
+        const svuint8_t v = svld1_u8(pred, src + i);
+        const svbool_t cmp = svcmpne_n_u8(pred, v, skip_value);
+
+        if (svptest_any(pred, cmp)) {
+            // the number of lanes before the first match
+            const svbool_t before = svbrkb_b_z(pred, cmp);
+            const size_t byte_idx = i + svcntp_b8(pred, before);
+
+            const uint8_t value = (IsSet) ? src[byte_idx] : uint8_t(~src[byte_idx]);
+            return byte_idx * 8 + CtzHelper<uint8_t>::ctz(value);
+        }
+    }
+
+    return size * 8;
+}
+
+// Searches for the first bit equal to IsSet in [start + starting_idx, start + size).
+//   Partial elements at both ends are handled by the element-wise code, 
+//   the middle goes to find().
+template<typename ElementT, bool IsSet>
+std::optional<size_t> op_find_impl(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+    constexpr size_t data_bits = policy_type::data_bits;
+
+    if (starting_idx >= size) {
+        return std::nullopt;
+    }
+
+    size_t start_element = policy_type::get_element(start + starting_idx);
+    const size_t start_shift = policy_type::get_shift(start + starting_idx);
+    const size_t end_element = policy_type::get_element(start + size);
+
+    // process the first element
+    if (start_shift != 0) {
+        const size_t size_first = 
+            (size - starting_idx < data_bits - start_shift) ? 
+                (size - starting_idx) : (data_bits - start_shift);
+        const auto result = policy_type::op_find(data, start, starting_idx + size_first, starting_idx, IsSet);
+        if (result.has_value() || starting_idx + size_first == size) {
+            return result;
+        }
+
+        start_element += 1;
+    }
+
+    // process the middle
+    if (start_element < end_element) {
+        const size_t n_bytes = (end_element - start_element) * sizeof(ElementT);
+        const size_t bit_idx = find<IsSet>(
+            reinterpret_cast<const uint8_t*>(data + start_element), 
+            n_bytes
+        );
+        if (bit_idx != n_bytes * 8) {
+            return start_element * data_bits + bit_idx - start;
+        }
+    }
+
+    // process the last element
+    if (policy_type::get_shift(start + size) != 0) {
+        return policy_type::op_find(data, start, size, end_element * data_bits - start, IsSet);
+    }
+
+    return std::nullopt;
+}
+
+}
+
+namespace {
+
+// svcnt, counts bits in a given number of bytes
+inline size_t popcount(
+    const uint8_t* const __restrict src, 
+    const size_t size
+) {
+    const uint64_t* const __restrict src_u64 = reinterpret_cast<const uint64_t*>(src);
+
+    // process 64-bit words
+    const size_t size_u64 = size / 8;
+    const size_t sve_width = svcntd();
+
+    svuint64_t total = svdup_n_u64(0);
+    for (size_t i = 0; i < size_u64; i += sve_width) {
+        const svbool_t pred = svwhilelt_b64(uint64_t(i), uint64_t(size_u64));
+        const svuint64_t v = svld1_u64(pred, src_u64 + i);
+        total = svadd_u64_m(pred, total, svcnt_u64_x(pred, v));
+    }
+
+    size_t count = svaddv_u64(svptrue_b64(), total);
+
+    // process leftovers
+    const size_t size_leftovers = size - size_u64 * 8;
+    if (size_leftovers != 0) {
+        const svbool_t pred = get_pred_op_8(size_leftovers);
+        const svuint8_t v = svld1_u8(pred, src + size_u64 * 8);
+        count += svaddv_u8(pred, svcnt_u8_z(pred, v));
+    }
+
+    return count;
+}
+
+// Counts bits in [start, start + size). Partial elements at both ends are
+//   handled by the element-wise code, the middle goes to popcount().
+template<typename ElementT>
+size_t op_count_impl(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+    constexpr size_t data_bits = policy_type::data_bits;
+
+    if (size == 0) {
+        return 0;
+    }
+
+    size_t count = 0;
+
+    size_t start_element = policy_type::get_element(start);
+    const size_t start_shift = policy_type::get_shift(start);
+    size_t size_left = size;
+
+    // process the first element
+    if (start_shift != 0) {
+        const size_t size_first = 
+            (size < data_bits - start_shift) ? size : (data_bits - start_shift);
+        count += policy_type::op_count(data, start, size_first);
+
+        size_left -= size_first;
+        start_element += 1;
+    }
+
+    // process the middle
+    const size_t n_elements = size_left / data_bits;
+    count += popcount(
+        reinterpret_cast<const uint8_t*>(data + start_element), 
+        n_elements * sizeof(ElementT)
+    );
+
+    // process the last element
+    const size_t size_last = size_left % data_bits;
+    if (size_last != 0) {
+        count += policy_type::op_count(data + start_element + n_elements, 0, size_last);
+    }
+
+    return count;
+}
+
+}
+
+namespace {
+
+// binary operations for op_binary_impl()
+struct BinaryOpAnd {
+    static inline svuint8_t op(const svbool_t pred, const svuint8_t left, const svuint8_t right) {
+        return svand_u8_x(pred, left, right);
+    }
+
+    // returns true if a value cannot be changed by any right operand
+    static inline bool is_saturated(const svbool_t pred, const svuint8_t v) {
+        return !svptest_any(pred, svcmpne_n_u8(pred, v, 0));
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_and(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpOr {
+    static inline svuint8_t op(const svbool_t pred, const svuint8_t left, const svuint8_t right) {
+        return svorr_u8_x(pred, left, right);
+    }
+
+    // returns true if a value cannot be changed by any right operand
+    static inline bool is_saturated(const svbool_t pred, const svuint8_t v) {
+        return !svptest_any(pred, svcmpne_n_u8(pred, v, 0xFF));
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_or(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpXor {
+    static inline svuint8_t op(const svbool_t pred, const svuint8_t left, const svuint8_t right) {
+        return sveor_u8_x(pred, left, right);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_xor(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpSub {
+    static inline svuint8_t op(const svbool_t pred, const svuint8_t left, const svuint8_t right) {
+        return svbic_u8_x(pred, left, right);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_sub(left, right, start_left, start_right, size);
+    }
+};
+
+// Loads bytes of bits that start from bit 'shift' (1..7) of src[0], 
+//   only bytes that are set in pred are loaded. Every 64-bit lane is 
+//   a funnel shift of 9 consecutive bytes: 'lo' provides bytes [0, 8) 
+//   and 'hi' provides bytes [1, 9), so one byte past the last active 
+//   one is read as well.
+inline svuint8_t load_shifted(
+    const svbool_t pred, 
+    const uint8_t* const src, 
+    const size_t shift
+) {
+    const svbool_t pred_all = svptrue_b64();
+
+    const svuint64_t lo = svreinterpret_u64_u8(svld1_u8(pred, src));
+    const svuint64_t hi = svreinterpret_u64_u8(svld1_u8(pred, src + 1));
+    return svreinterpret_u8_u64(
+        svorr_u64_x(
+            pred_all,
+            svlsr_n_u64_x(pred_all, lo, shift), 
+            svlsl_n_u64_x(pred_all, hi, 8 - shift)
+        )
+    );
+}
+
+// Applies OpT to a given number of bytes of left and the same number 
+//   of bits of right, which start from bit 'shift' (0..7) of right[0].
+//   If shift is not zero, then right[size] is read as well.
+template<typename OpT>
+void op_bytes(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t size,
+    const size_t shift
+) {
+    const size_t sve_width = svcntb();
+
+    if (shift == 0) {
+        for (size_t i = 0; i < size; i += sve_width) {
+            const svbool_t pred = svwhilelt_b8(uint64_t(i), uint64_t(size));
+            const svuint8_t lv = svld1_u8(pred, left + i);
+            const svuint8_t rv = svld1_u8(pred, right + i);
+            svst1_u8(pred, left + i, OpT::op(pred, lv, rv));
+        }
+
+        return;
+    }
+
+    for (size_t i = 0; i < size; i += sve_width) {
+        const svbool_t pred = svwhilelt_b8(uint64_t(i), uint64_t(size));
+        const svuint8_t lv = svld1_u8(pred, left + i);
+        const svuint8_t rv = load_shifted(pred, right + i, shift);
+        svst1_u8(pred, left + i, OpT::op(pred, lv, rv));
+    }
+}
+
+// Same as op_bytes(), but also returns the number of set bits in 
+//   the result, which is counted while it is still in registers.
+template<typename OpT>
+size_t op_bytes_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t size,
+    const size_t shift
+) {
+    const size_t sve_width = svcntb();
+    const svbool_t pred_all = svptrue_b64();
+
+    svuint64_t total = svdup_n_u64(0);
+    for (size_t i = 0; i < size; i += sve_width) {
+        const svbool_t pred = svwhilelt_b8(uint64_t(i), uint64_t(size));
+        const svuint8_t lv = svld1_u8(pred, left + i);
+        const svuint8_t rv = (shift == 0) ? 
+            svld1_u8(pred, right + i) : 
+            load_shifted(pred, right + i, shift);
+        const svuint8_t result = OpT::op(pred, lv, rv);
+        svst1_u8(pred, left + i, result);
+
+        // inactive lanes are not counted
+        const svuint8_t result_z = svsel_u8(pred, result, svdup_n_u8(0));
+        total = svadd_u64_x(
+            pred_all, 
+            total, 
+            svcnt_u64_x(pred_all, svreinterpret_u64_u8(result_z))
+        );
+    }
+
+    return svaddv_u64(pred_all, total);
+}
+
+// Applies OpT to a given number of bytes of left and every right. 
+//   Bits of rights[k] start from bit shifts[k] (0..7) of rights[k][0].
+//   Bytes are processed in blocks of the size of a register, and 
+//   the remaining rights are not loaded once a block cannot be changed 
+//   by OpT anymore.
+template<typename OpT>
+void op_bytes_multiple(
+    uint8_t* const left,
+    const uint8_t* const* const rights,
+    const size_t* const shifts,
+    const size_t n_rights,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        using T = int64_t;
-        
-        auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
-            using sve_t = SVEVector<T>;
-
-            const auto right_v = svdup_n_s64(right_operand);
-            const auto value_v = svdup_n_s64(value);
-            const svint64_t src_v = svld1sh_s64(pred, src + idx);
+    const size_t sve_width = svcntb();
 
-            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
-            return cmp;
-        };
+    for (size_t i = 0; i < size; i += sve_width) {
+        const svbool_t pred = svwhilelt_b8(uint64_t(i), uint64_t(size));
+        svuint8_t v = svld1_u8(pred, left + i);
+        for (size_t k = 0; k < n_rights && !OpT::is_saturated(pred, v); k++) {
+            const svuint8_t rv = (shifts[k] == 0) ? 
+                svld1_u8(pred, rights[k] + i) : 
+                load_shifted(pred, rights[k] + i, shifts[k]);
+            v = OpT::op(pred, v, rv);
+        }
 
-        return op_mask_helper<T, decltype(handler)>(
-            res_u8,
-            size,
-            handler
-        );
+        svst1_u8(pred, left + i, v);
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict src,
-    const ArithHighPrecisionType<int32_t>& right_operand,
-    const ArithHighPrecisionType<int32_t>& value,
+// Applies OpT to [start_left, start_left + size) of left and 
+//   [start_right, start_right + size) of right. Bits are processed by 
+//   the element-wise code until left is byte-aligned, then whole bytes
+//   of left go to op_bytes() regardless of the alignment of right.
+template<typename ElementT, typename OpT>
+void op_binary_impl(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        using T = int64_t;
-        
-        auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
-            using sve_t = SVEVector<T>;
-
-            const auto right_v = svdup_n_s64(right_operand);
-            const auto value_v = svdup_n_s64(value);
-            const svint64_t src_v = svld1sw_s64(pred, src + idx);
-
-            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
-            return cmp;
-        };
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        OpT::template op_element_wise<ElementT>(left, right, start_left, start_right, size_first);
+    }
+
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_right_middle = start_right + size_first;
+    const size_t n_bytes = (size - size_first) / 8;
+    if (n_bytes != 0) {
+        op_bytes<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            reinterpret_cast<const uint8_t*>(right) + start_right_middle / 8,
+            n_bytes,
+            start_right_middle % 8
+        );
+    }
 
-        return op_mask_helper<T, decltype(handler)>(
-            res_u8,
-            size,
-            handler
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        OpT::template op_element_wise<ElementT>(
+            left, 
+            right, 
+            start_left_middle + n_bytes * 8, 
+            start_right_middle + n_bytes * 8, 
+            size_last
         );
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict src,
-    const ArithHighPrecisionType<int64_t>& right_operand,
-    const ArithHighPrecisionType<int64_t>& value,
+// Same as op_binary_impl(), but also returns the number of set bits 
+//   in [start_left, start_left + size) of left after the operation.
+template<typename ElementT, typename OpT>
+size_t op_binary_with_count_impl(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        using T = int64_t;
-        
-        auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
-            using sve_t = SVEVector<T>;
-
-            const auto right_v = svdup_n_s64(right_operand);
-            const auto value_v = svdup_n_s64(value);
-            const svint64_t src_v = svld1_s64(pred, src + idx);
-
-            const svbool_t cmp = ArithHelperI64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
-            return cmp;
-        };
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+
+    size_t count = 0;
+
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        OpT::template op_element_wise<ElementT>(left, right, start_left, start_right, size_first);
+        count += policy_type::op_count(left, start_left, size_first);
+    }
+
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_right_middle = start_right + size_first;
+    const size_t n_bytes = (size - size_first) / 8;
+    if (n_bytes != 0) {
+        count += op_bytes_with_count<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            reinterpret_cast<const uint8_t*>(right) + start_right_middle / 8,
+            n_bytes,
+            start_right_middle % 8
+        );
+    }
 
-        return op_mask_helper<T, decltype(handler)>(
-            res_u8,
-            size,
-            handler
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        OpT::template op_element_wise<ElementT>(
+            left, 
+            right, 
+            start_left_middle + n_bytes * 8, 
+            start_right_middle + n_bytes * 8, 
+            size_last
         );
+        count += policy_type::op_count(left, start_left_middle + n_bytes * 8, size_last);
     }
+
+    return count;
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<float, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const float* const __restrict src,
-    const ArithHighPrecisionType<float>& right_operand,
-    const ArithHighPrecisionType<float>& value,
+// Applies OpT to [start_left, start_left + size) of left and 
+//   [start_rights[k], start_rights[k] + size) of every right. Same as 
+//   op_binary_impl(), but all rights are processed in a single pass.
+template<typename ElementT, typename OpT>
+void op_multiple_impl(
+    ElementT* const left,
+    const ElementT* const * const rights,
+    const size_t start_left,
+    const size_t* const __restrict start_rights,
+    const size_t n_rights,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        if constexpr (AOp == ArithOpType::Div) {
-            if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
-                // a special case that allows faster processing by using the multiplication
-                //   operation instead of the division one.
-
-                using T = float;
-        
-                auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
-                    using sve_t = SVEVector<T>;
-
-                    const auto right_v = svdup_n_f32(right_operand);
-                    const auto value_v = svdup_n_f32(value);
-                    const svfloat32_t src_v = svld1_f32(pred, src + idx);
-
-                    const svbool_t cmp = ArithHelperF32<AOp, CmpOp>::op_special(pred, src_v, right_v, value_v);
-                    return cmp;
-                };
-
-                return op_mask_helper<T, decltype(handler)>(
-                    res_u8,
-                    size,
-                    handler
-                );
-            } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
-                // flip signs and go for the multiplication case
-                return OpArithCompareImpl<float, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
-                    res_u8, src, -right_operand, -value, size
-                );
-            }
+    if (n_rights == 0) {
+        return;
+    }
 
-            // go with the default case
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        for (size_t k = 0; k < n_rights; k++) {
+            OpT::template op_element_wise<ElementT>(left, rights[k], start_left, start_rights[k], size_first);
         }
+    }
 
-        // a default case
-        {
-            using T = float;
-            
-            auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
-                using sve_t = SVEVector<T>;
-
-                const auto right_v = svdup_n_f32(right_operand);
-                const auto value_v = svdup_n_f32(value);
-                const svfloat32_t src_v = svld1_f32(pred, src + idx);
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t n_bytes = (size - size_first) / 8;
+    if (n_bytes != 0) {
+        MaybeVector<const uint8_t*> right_ptrs(n_rights);
+        MaybeVector<size_t> right_shifts(n_rights);
+        for (size_t k = 0; k < n_rights; k++) {
+            const size_t start_right_middle = start_rights[k] + size_first;
+            right_ptrs[k] = reinterpret_cast<const uint8_t*>(rights[k]) + start_right_middle / 8;
+            right_shifts[k] = start_right_middle % 8;
+        }
 
-                const svbool_t cmp = ArithHelperF32<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
-                return cmp;
-            };
+        op_bytes_multiple<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            right_ptrs.data(),
+            right_shifts.data(),
+            n_rights,
+            n_bytes
+        );
+    }
 
-            return op_mask_helper<T, decltype(handler)>(
-                res_u8,
-                size,
-                handler
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        for (size_t k = 0; k < n_rights; k++) {
+            OpT::template op_element_wise<ElementT>(
+                left, 
+                rights[k], 
+                start_left_middle + n_bytes * 8, 
+                start_rights[k] + size_first + n_bytes * 8, 
+                size_last
             );
         }
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<double, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const double* const __restrict src,
-    const ArithHighPrecisionType<double>& right_operand,
-    const ArithHighPrecisionType<double>& value,
-    const size_t size
-) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        if constexpr (AOp == ArithOpType::Div) {
-            if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
-                // a special case that allows faster processing by using the multiplication
-                //   operation instead of the division one.
-
-                using T = double;
-                
-                auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
-                    using sve_t = SVEVector<T>;
-
-                    const auto right_v = svdup_n_f64(right_operand);
-                    const auto value_v = svdup_n_f64(value);
-                    const svfloat64_t src_v = svld1_f64(pred, src + idx);
-
-                    const svbool_t cmp = ArithHelperF64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
-                    return cmp;
-                };
-
-                return op_mask_helper<T, decltype(handler)>(
-                    res_u8,
-                    size,
-                    handler
-                );
-            } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
-                // flip signs and go for the multiplication case
-                return OpArithCompareImpl<double, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
-                    res_u8, src, -right_operand, -value, size
-                );
-            }
+// bitwise operations for ternary_logic(). Inactive lanes are never 
+//   stored, so all-true predicates are used.
+struct LogicOps {
+    static inline svuint8_t op_and(const svuint8_t x, const svuint8_t y) {
+        return svand_u8_x(svptrue_b8(), x, y);
+    }
 
-            // go with the default case
-        }
+    static inline svuint8_t op_or(const svuint8_t x, const svuint8_t y) {
+        return svorr_u8_x(svptrue_b8(), x, y);
+    }
 
-        // a default case
-        {
-            using T = double;
-        
-            auto handler = [src, right_operand, value](const svbool_t pred, const size_t idx){
-                using sve_t = SVEVector<T>;
+    static inline svuint8_t op_xor(const svuint8_t x, const svuint8_t y) {
+        return sveor_u8_x(svptrue_b8(), x, y);
+    }
 
-                const auto right_v = svdup_n_f64(right_operand);
-                const auto value_v = svdup_n_f64(value);
-                const svfloat64_t src_v = svld1_f64(pred, src + idx);
+    // x & ~y
+    static inline svuint8_t op_andnot(const svuint8_t x, const svuint8_t y) {
+        return svbic_u8_x(svptrue_b8(), x, y);
+    }
 
-                const svbool_t cmp = ArithHelperF64<AOp, CmpOp>::op(pred, src_v, right_v, value_v);
-                return cmp;
-            };
+    static inline svuint8_t op_not(const svuint8_t x) {
+        return svnot_u8_x(svptrue_b8(), x);
+    }
 
-            return op_mask_helper<T, decltype(handler)>(
-                res_u8,
-                size,
-                handler
-            );
-        }
+    // (x & m) | (y & ~m)
+    static inline svuint8_t op_select(const svuint8_t m, const svuint8_t x, const svuint8_t y) {
+#if defined(__ARM_FEATURE_SVE2)
+        return svbsl_u8(x, y, m);
+#else
+        return svorr_u8_x(
+            svptrue_b8(),
+            svand_u8_x(svptrue_b8(), m, x),
+            svbic_u8_x(svptrue_b8(), y, m)
+        );
+#endif
+    }
+
+    static inline svuint8_t zeros() {
+        return svdup_n_u8(0);
+    }
+
+    static inline svuint8_t ones() {
+        return svdup_n_u8(0xFF);
+    }
+};
+
+template<uint8_t TruthTable>
+inline svuint8_t ternary_logic_sve(const svuint8_t a, const svuint8_t b, const svuint8_t c) {
+#if defined(__ARM_FEATURE_SVE2)
+    if constexpr (TruthTable == (TERNARY_A ^ TERNARY_B ^ TERNARY_C)) {
+        return sveor3_u8(a, b, c);
+    }
+#endif
+
+    return ternary_logic<TruthTable, LogicOps>(a, b, c);
+}
+
+// Applies a ternary op, given by a truth table, to a given number of 
+//   bytes of left and the same number of bits of b and c, which start 
+//   from bits 'shift_b' and 'shift_c' (0..7) of b[0] and c[0]. SVE2 
+//   bsl and eor3 are used if available.
+template<uint8_t TruthTable>
+void op_bytes_ternary(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t size,
+    const size_t shift_b,
+    const size_t shift_c
+) {
+    const size_t sve_width = svcntb();
+
+    for (size_t i = 0; i < size; i += sve_width) {
+        const svbool_t pred = svwhilelt_b8(uint64_t(i), uint64_t(size));
+        const svuint8_t lv = svld1_u8(pred, left + i);
+        const svuint8_t bv = (shift_b == 0) ? 
+            svld1_u8(pred, b + i) : 
+            load_shifted(pred, b + i, shift_b);
+        const svuint8_t cv = (shift_c == 0) ? 
+            svld1_u8(pred, c + i) : 
+            load_shifted(pred, c + i, shift_c);
+        svst1_u8(pred, left + i, ternary_logic_sve<TruthTable>(lv, bv, cv));
     }
 }
 
+using OpBytesTernaryFunc = void(*)(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t size,
+    const size_t shift_b,
+    const size_t shift_c
+);
 
-///////////////////////////////////////////////////////////////////////////
-// forward ops
+template<size_t... TruthTables>
+constexpr std::array<OpBytesTernaryFunc, 256> make_op_bytes_ternary_table(
+    std::index_sequence<TruthTables...>
+) {
+    return {{ &op_bytes_ternary<uint8_t(TruthTables)>... }};
+}
+
+// op_bytes_ternary() for every possible truth table
+constexpr std::array<OpBytesTernaryFunc, 256> op_bytes_ternary_table =
+    make_op_bytes_ternary_table(std::make_index_sequence<256>());
+
+// Applies a ternary op, given by a truth table, to [start_left, 
+//   start_left + size) of left, [start_b, start_b + size) of b and 
+//   [start_c, start_c + size) of c. Same as op_binary_impl(), bits are 
+//   processed by the element-wise code until left is byte-aligned.
+template<typename ElementT>
+void op_ternary_impl(
+    ElementT* const left,
+    const ElementT* const b,
+    const ElementT* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        policy_type::op_ternary(left, b, c, start_left, start_b, start_c, size_first, truth_table);
+    }
+
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_b_middle = start_b + size_first;
+    const size_t start_c_middle = start_c + size_first;
+    const size_t n_bytes = (size - size_first) / 8;
+    if (n_bytes != 0) {
+        op_bytes_ternary_table[truth_table](
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            reinterpret_cast<const uint8_t*>(b) + start_b_middle / 8,
+            reinterpret_cast<const uint8_t*>(c) + start_c_middle / 8,
+            n_bytes,
+            start_b_middle % 8,
+            start_c_middle % 8
+        );
+    }
+
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        policy_type::op_ternary(
+            left, 
+            b, 
+            c, 
+            start_left_middle + n_bytes * 8, 
+            start_b_middle + n_bytes * 8, 
+            start_c_middle + n_bytes * 8, 
+            size_last,
+            truth_table
+        );
+    }
+}
+
+}
 
 //
 bool ForwardOpsImpl<uint8_t>::op_and(
@@ -1548,7 +3309,7 @@ bool ForwardOpsImpl<uint8_t>::op_and(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_and(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpAnd>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1560,7 +3321,7 @@ bool ForwardOpsImpl<uint8_t>::op_and_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_and_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint8_t, BinaryOpAnd>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1571,7 +3332,7 @@ bool ForwardOpsImpl<uint8_t>::op_or(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_or(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpOr>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1583,7 +3344,7 @@ bool ForwardOpsImpl<uint8_t>::op_or_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_or_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint8_t, BinaryOpOr>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1594,7 +3355,7 @@ bool ForwardOpsImpl<uint8_t>::op_xor(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_xor(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpXor>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1605,7 +3366,72 @@ bool ForwardOpsImpl<uint8_t>::op_sub(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_sub(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpSub>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_count(
+    const uint8_t* const data,
+    const size_t start,
+    const size_t size,
+    size_t& count
+) {
+    count = op_count_impl<uint8_t>(data, start, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_find(
+    const uint8_t* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+) {
+    if (is_set) {
+        result = op_find_impl<uint8_t, true>(data, start, size, starting_idx);
+    } else {
+        result = op_find_impl<uint8_t, false>(data, start, size, starting_idx);
+    }
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_and_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    count = op_binary_with_count_impl<uint8_t, BinaryOpAnd>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_or_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    // the number of inactive bits
+    count = size - op_binary_with_count_impl<uint8_t, BinaryOpOr>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_ternary(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    op_ternary_impl<uint8_t>(left, b, c, start_left, start_b, start_c, size, truth_table);
     return true;
 }
 
@@ -1617,7 +3443,7 @@ bool ForwardOpsImpl<uint64_t>::op_and(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_and(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpAnd>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1629,7 +3455,7 @@ bool ForwardOpsImpl<uint64_t>::op_and_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_and_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint64_t, BinaryOpAnd>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1640,7 +3466,7 @@ bool ForwardOpsImpl<uint64_t>::op_or(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_or(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpOr>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1652,7 +3478,7 @@ bool ForwardOpsImpl<uint64_t>::op_or_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_or_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint64_t, BinaryOpOr>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1663,7 +3489,7 @@ bool ForwardOpsImpl<uint64_t>::op_xor(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_xor(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpXor>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1674,7 +3500,72 @@ bool ForwardOpsImpl<uint64_t>::op_sub(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_sub(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpSub>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_count(
+    const uint64_t* const data,
+    const size_t start,
+    const size_t size,
+    size_t& count
+) {
+    count = op_count_impl<uint64_t>(data, start, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_find(
+    const uint64_t* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+) {
+    if (is_set) {
+        result = op_find_impl<uint64_t, true>(data, start, size, starting_idx);
+    } else {
+        result = op_find_impl<uint64_t, false>(data, start, size, starting_idx);
+    }
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_and_with_count(
+    uint64_t* const left,
+    const uint64_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    count = op_binary_with_count_impl<uint64_t, BinaryOpAnd>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_or_with_count(
+    uint64_t* const left,
+    const uint64_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    // the number of inactive bits
+    count = size - op_binary_with_count_impl<uint64_t, BinaryOpOr>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_ternary(
+    uint64_t* const left,
+    const uint64_t* const b,
+    const uint64_t* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    op_ternary_impl<uint64_t>(left, b, c, start_left, start_b, start_c, size, truth_table);
     return true;
 }
 
@@ -26,6 +26,11 @@ namespace sve {
     FUNC(__VA_ARGS__,LT); \
     FUNC(__VA_ARGS__,NE);
 
+// a facility to run through all possible in values operations
+#define ALL_IN_VALUES_OPS(FUNC,...) \
+    FUNC(__VA_ARGS__,In); \
+    FUNC(__VA_ARGS__,NotIn);
+
 // a facility to run through all possible range operations
 #define ALL_RANGE_OPS(FUNC,...) \
     FUNC(__VA_ARGS__,IncInc); \
@@ -82,12 +87,42 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, int8_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, int16_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, int32_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, uint8_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, uint16_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, uint32_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, uint64_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, float)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_SVE, double)
 
 #undef INSTANTIATE_COMPARE_VAL_SVE
 
 
+///////////////////////////////////////////////////////////////////////////
+
+//
+#define INSTANTIATE_IN_VALUES_SVE(TTYPE,OP) \
+    template bool OpInValuesImpl<TTYPE, InValuesType::OP>::op_in_values( \
+        uint8_t* const __restrict bitmask, \
+        const TTYPE* const __restrict src, \
+        const size_t size, \
+        const TTYPE* const __restrict values, \
+        const size_t n_values \
+    );
+
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, int8_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, int16_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, int32_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, int64_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, uint8_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, uint16_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, uint32_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, uint64_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, float)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_SVE, double)
+
+#undef INSTANTIATE_IN_VALUES_SVE
+
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
@@ -103,11 +138,33 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, int8_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, int16_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, int32_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, uint8_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, uint16_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, uint32_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, uint64_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, float)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_SVE, double)
 
 #undef INSTANTIATE_COMPARE_COLUMN_SVE
 
+//
+#define INSTANTIATE_COMPARE_COLUMN_MIXED_SVE(TTYPE,UTYPE,OP) \
+    template bool OpCompareColumnImpl<TTYPE, UTYPE, CompareOpType::OP>::op_compare_column( \
+        uint8_t* const __restrict bitmask, \
+        const TTYPE* const __restrict left, \
+        const UTYPE* const __restrict right, \
+        const size_t size \
+    );
+
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_SVE, int8_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_SVE, int16_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_SVE, int32_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_SVE, int32_t, float)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_SVE, int32_t, double)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_SVE, float, double)
+
+#undef INSTANTIATE_COMPARE_COLUMN_MIXED_SVE
+
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -125,6 +182,10 @@ ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, int8_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, int16_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, int32_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, int64_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, uint8_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, uint16_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, uint32_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, uint64_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, float)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_SVE, double)
 
@@ -147,6 +208,10 @@ ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, int8_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, int16_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, int32_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, int64_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, uint8_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, uint16_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, uint32_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, uint64_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, float)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_SVE, double)
 
@@ -169,6 +234,10 @@ ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, int8_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, int16_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, int32_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, int64_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, uint8_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, uint16_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, uint32_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, uint64_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, float)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, double)
 
@@ -179,6 +248,7 @@ ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_SVE, double)
 
 //
 #undef ALL_COMPARE_OPS
+#undef ALL_IN_VALUES_OPS
 #undef ALL_RANGE_OPS
 #undef ALL_ARITH_CMP_OPS
 
@@ -26,6 +26,12 @@ struct VectorizedSve {
     template<typename T, CompareOpType Op>
     static constexpr inline auto op_compare_val = sve::OpCompareValImpl<T, Op>::op_compare_val;
 
+    template<typename T, InValuesType Op>
+    static constexpr inline auto op_in_values = sve::OpInValuesImpl<T, Op>::op_in_values;
+
+    template<typename OffsetT>
+    static constexpr inline auto op_prefix_match = sve::OpPrefixMatchImpl<OffsetT>::op_prefix_match;
+
     template<typename T, RangeType Op>
     static constexpr inline auto op_within_range_column = sve::OpWithinRangeColumnImpl<T, Op>::op_within_range_column;
 
@@ -52,6 +58,21 @@ struct VectorizedSve {
 
     template<typename ElementT>
     static constexpr inline auto forward_op_sub = sve::ForwardOpsImpl<ElementT>::op_sub;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_count = sve::ForwardOpsImpl<ElementT>::op_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_find = sve::ForwardOpsImpl<ElementT>::op_find;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_and_with_count = sve::ForwardOpsImpl<ElementT>::op_and_with_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_or_with_count = sve::ForwardOpsImpl<ElementT>::op_or_with_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_ternary = sve::ForwardOpsImpl<ElementT>::op_ternary;
 };
 
 }
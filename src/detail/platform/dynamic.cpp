@@ -40,6 +40,11 @@ using namespace milvus::bitset::detail::arm;
     FUNC(__VA_ARGS__,ExcInc); \
     FUNC(__VA_ARGS__,ExcExc);
 
+// a facility to run through all possible in values operations
+#define ALL_IN_VALUES_OPS(FUNC,...) \
+    FUNC(__VA_ARGS__,In); \
+    FUNC(__VA_ARGS__,NotIn);
+
 // a facility to run through all possible arithmetic compare operations
 #define ALL_ARITH_CMP_OPS(FUNC,...) \
     FUNC(__VA_ARGS__,Add,EQ); \
@@ -78,6 +83,11 @@ using namespace milvus::bitset::detail::arm;
     FUNC(uint8_t); \
     FUNC(uint64_t);
 
+// a facility to run through all possible types of string offsets
+#define ALL_PREFIX_MATCH_OPS(FUNC) \
+    FUNC(int32_t); \
+    FUNC(int64_t);
+
 
 //
 namespace milvus {
@@ -103,8 +113,18 @@ ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int8_t, int8_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int16_t, int16_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int32_t, int32_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int64_t, int64_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, uint8_t, uint8_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, uint16_t, uint16_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, uint32_t, uint32_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, uint64_t, uint64_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, float, float)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, double, double)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int8_t, int64_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int16_t, int64_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int32_t, int64_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int32_t, float)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, int32_t, double)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_COLUMN, float, double)
 
 #undef DECLARE_OP_COMPARE_COLUMN
 
@@ -126,11 +146,35 @@ ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, int8_t)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, int16_t)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, int32_t)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, int64_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, uint8_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, uint16_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, uint32_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, uint64_t)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, float)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_IMPL, double)
 
 #undef DISPATCH_OP_COMPARE_COLUMN_IMPL
 
+#define DISPATCH_OP_COMPARE_COLUMN_MIXED_IMPL(TTYPE, UTYPE, OP) \
+    template<> \
+    bool OpCompareColumnImpl<TTYPE, UTYPE, CompareOpType::OP>::op_compare_column( \
+        uint8_t* const __restrict bitmask,  \
+        const TTYPE* const __restrict t, \
+        const UTYPE* const __restrict u, \
+        const size_t size \
+    ) { \
+        return op_compare_column_##TTYPE##_##UTYPE##_##OP(bitmask, t, u, size); \
+    }
+
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_MIXED_IMPL, int8_t, int64_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_MIXED_IMPL, int16_t, int64_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_MIXED_IMPL, int32_t, int64_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_MIXED_IMPL, int32_t, float)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_MIXED_IMPL, int32_t, double)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_COLUMN_MIXED_IMPL, float, double)
+
+#undef DISPATCH_OP_COMPARE_COLUMN_MIXED_IMPL
+
 }
 
 
@@ -151,6 +195,10 @@ ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, int8_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, int16_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, int32_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, int64_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, uint8_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, uint16_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, uint32_t)
+ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, uint64_t)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, float)
 ALL_COMPARE_OPS(DECLARE_OP_COMPARE_VAL, double)
 
@@ -173,6 +221,10 @@ ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, int8_t)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, int16_t)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, int32_t)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, int64_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, uint8_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, uint16_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, uint32_t)
+ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, uint64_t)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, float)
 ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, double)
 
@@ -181,6 +233,103 @@ ALL_COMPARE_OPS(DISPATCH_OP_COMPARE_VAL_IMPL, double)
 }
 
 
+/////////////////////////////////////////////////////////////////////////////
+// op_in_values
+template<typename T, InValuesType Op>
+using OpInValuesPtr = bool(*)(
+    uint8_t* const __restrict output, 
+    const T* const __restrict t, 
+    const size_t size, 
+    const T* const __restrict values, 
+    const size_t n_values
+);
+
+#define DECLARE_OP_IN_VALUES(TTYPE, OP) \
+    OpInValuesPtr<TTYPE, InValuesType::OP> op_in_values_##TTYPE##_##OP = VectorizedRef::template op_in_values<TTYPE, InValuesType::OP>;
+
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, int8_t)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, int16_t)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, int32_t)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, int64_t)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, uint8_t)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, uint16_t)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, uint32_t)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, uint64_t)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, float)
+ALL_IN_VALUES_OPS(DECLARE_OP_IN_VALUES, double)
+
+#undef DECLARE_OP_IN_VALUES
+
+namespace dynamic {
+
+#define DISPATCH_OP_IN_VALUES_IMPL(TTYPE, OP) \
+    template<> \
+    bool OpInValuesImpl<TTYPE, InValuesType::OP>::op_in_values( \
+        uint8_t* const __restrict bitmask,  \
+        const TTYPE* const __restrict t, \
+        const size_t size, \
+        const TTYPE* const __restrict values, \
+        const size_t n_values \
+    ) { \
+        return op_in_values_##TTYPE##_##OP(bitmask, t, size, values, n_values); \
+    }
+
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, int8_t)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, int16_t)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, int32_t)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, int64_t)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, uint8_t)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, uint16_t)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, uint32_t)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, uint64_t)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, float)
+ALL_IN_VALUES_OPS(DISPATCH_OP_IN_VALUES_IMPL, double)
+
+#undef DISPATCH_OP_IN_VALUES_IMPL
+
+}
+
+
+/////////////////////////////////////////////////////////////////////////////
+// op_prefix_match
+template<typename OffsetT>
+using OpPrefixMatchPtr = bool(*)(
+    uint8_t* const __restrict output, 
+    const char* const __restrict data, 
+    const OffsetT* const __restrict offsets, 
+    const size_t size, 
+    const char* const __restrict prefix, 
+    const size_t prefix_size
+);
+
+#define DECLARE_OP_PREFIX_MATCH(OFFSETTYPE) \
+    OpPrefixMatchPtr<OFFSETTYPE> op_prefix_match_##OFFSETTYPE = VectorizedRef::template op_prefix_match<OFFSETTYPE>;
+
+ALL_PREFIX_MATCH_OPS(DECLARE_OP_PREFIX_MATCH)
+
+#undef DECLARE_OP_PREFIX_MATCH
+
+namespace dynamic {
+
+#define DISPATCH_OP_PREFIX_MATCH_IMPL(OFFSETTYPE) \
+    bool OpPrefixMatchImpl<OFFSETTYPE>::op_prefix_match( \
+        uint8_t* const __restrict bitmask,  \
+        const char* const __restrict data, \
+        const OFFSETTYPE* const __restrict offsets, \
+        const size_t size, \
+        const char* const __restrict prefix, \
+        const size_t prefix_size \
+    ) { \
+        return op_prefix_match_##OFFSETTYPE(bitmask, data, offsets, size, prefix, prefix_size); \
+    }
+
+ALL_PREFIX_MATCH_OPS(DISPATCH_OP_PREFIX_MATCH_IMPL)
+
+#undef DISPATCH_OP_PREFIX_MATCH_IMPL
+
+}
+
+
 /////////////////////////////////////////////////////////////////////////////
 // op_within_range column
 template<typename T, RangeType Op>
@@ -199,6 +348,10 @@ ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, int8_t)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, int16_t)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, int32_t)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, int64_t)
+ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, uint8_t)
+ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, uint16_t)
+ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, uint32_t)
+ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, uint64_t)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, float)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_COLUMN, double)
 
@@ -223,6 +376,10 @@ ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, int8_t)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, int16_t)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, int32_t)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, int64_t)
+ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, uint8_t)
+ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, uint16_t)
+ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, uint32_t)
+ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, uint64_t)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, float)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_COLUMN_IMPL, double)
 
@@ -249,6 +406,10 @@ ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, int8_t)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, int16_t)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, int32_t)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, int64_t)
+ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, uint8_t)
+ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, uint16_t)
+ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, uint32_t)
+ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, uint64_t)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, float)
 ALL_RANGE_OPS(DECLARE_OP_WITHIN_RANGE_VAL, double)
 
@@ -273,6 +434,10 @@ ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, int8_t)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, int16_t)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, int32_t)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, int64_t)
+ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, uint8_t)
+ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, uint16_t)
+ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, uint32_t)
+ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, uint64_t)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, float)
 ALL_RANGE_OPS(DISPATCH_OP_WITHIN_RANGE_VAL_IMPL, double)
 
@@ -299,6 +464,10 @@ ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, int8_t)
 ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, int16_t)
 ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, int32_t)
 ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, int64_t)
+ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, uint8_t)
+ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, uint16_t)
+ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, uint32_t)
+ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, uint64_t)
 ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, float)
 ALL_ARITH_CMP_OPS(DECLARE_OP_ARITH_COMPARE, double)
 
@@ -323,6 +492,10 @@ ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, int8_t)
 ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, int16_t)
 ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, int32_t)
 ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, int64_t)
+ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, uint8_t)
+ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, uint16_t)
+ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, uint32_t)
+ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, uint64_t)
 ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, float)
 ALL_ARITH_CMP_OPS(DISPATCH_OP_ARITH_COMPARE, double)
 
@@ -353,13 +526,58 @@ using ForwardOpsOpMultiple2 = bool(*)(
     const size_t size
 );
 
+template<typename ElementT>
+using ForwardOpsCount = bool(*)(
+    const ElementT* const data, 
+    const size_t start,
+    const size_t size,
+    size_t& count
+);
+
+template<typename ElementT>
+using ForwardOpsFind = bool(*)(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+);
+
+template<typename ElementT>
+using ForwardOpsOp2WithCount = bool(*)(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+);
+
+template<typename ElementT>
+using ForwardOpsTernary = bool(*)(
+    ElementT* const left,
+    const ElementT* const b,
+    const ElementT* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+);
+
 #define DECLARE_FORWARD_OPS_OP2(ELEMENTTYPE) \
     ForwardOpsOp2<ELEMENTTYPE> forward_op_and_##ELEMENTTYPE = VectorizedRef::template forward_op_and<ELEMENTTYPE>; \
     ForwardOpsOpMultiple2<ELEMENTTYPE> forward_op_and_multiple_##ELEMENTTYPE = VectorizedRef::template forward_op_and_multiple<ELEMENTTYPE>; \
     ForwardOpsOp2<ELEMENTTYPE> forward_op_or_##ELEMENTTYPE = VectorizedRef::template forward_op_or<ELEMENTTYPE>; \
     ForwardOpsOpMultiple2<ELEMENTTYPE> forward_op_or_multiple_##ELEMENTTYPE = VectorizedRef::template forward_op_or_multiple<ELEMENTTYPE>; \
     ForwardOpsOp2<ELEMENTTYPE> forward_op_xor_##ELEMENTTYPE = VectorizedRef::template forward_op_xor<ELEMENTTYPE>; \
-    ForwardOpsOp2<ELEMENTTYPE> forward_op_sub_##ELEMENTTYPE = VectorizedRef::template forward_op_sub<ELEMENTTYPE>;
+    ForwardOpsOp2<ELEMENTTYPE> forward_op_sub_##ELEMENTTYPE = VectorizedRef::template forward_op_sub<ELEMENTTYPE>; \
+    ForwardOpsCount<ELEMENTTYPE> forward_op_count_##ELEMENTTYPE = VectorizedRef::template forward_op_count<ELEMENTTYPE>; \
+    ForwardOpsFind<ELEMENTTYPE> forward_op_find_##ELEMENTTYPE = VectorizedRef::template forward_op_find<ELEMENTTYPE>; \
+    ForwardOpsOp2WithCount<ELEMENTTYPE> forward_op_and_with_count_##ELEMENTTYPE = VectorizedRef::template forward_op_and_with_count<ELEMENTTYPE>; \
+    ForwardOpsOp2WithCount<ELEMENTTYPE> forward_op_or_with_count_##ELEMENTTYPE = VectorizedRef::template forward_op_or_with_count<ELEMENTTYPE>; \
+    ForwardOpsTernary<ELEMENTTYPE> forward_op_ternary_##ELEMENTTYPE = VectorizedRef::template forward_op_ternary<ELEMENTTYPE>;
 
 ALL_FORWARD_OPS(DECLARE_FORWARD_OPS_OP2)
 
@@ -424,6 +642,56 @@ namespace dynamic {
         const size_t size \
     ) { \
         return forward_op_sub_##ELEMENTTYPE(left, right, start_left, start_right, size); \
+    } \
+    bool ForwardOpsImpl<ELEMENTTYPE>::op_count( \
+        const ELEMENTTYPE* const data, \
+        const size_t start, \
+        const size_t size, \
+        size_t& count \
+    ) { \
+        return forward_op_count_##ELEMENTTYPE(data, start, size, count); \
+    } \
+    bool ForwardOpsImpl<ELEMENTTYPE>::op_find( \
+        const ELEMENTTYPE* const data, \
+        const size_t start, \
+        const size_t size, \
+        const size_t starting_idx, \
+        const bool is_set, \
+        std::optional<size_t>& result \
+    ) { \
+        return forward_op_find_##ELEMENTTYPE(data, start, size, starting_idx, is_set, result); \
+    } \
+    bool ForwardOpsImpl<ELEMENTTYPE>::op_and_with_count( \
+        ELEMENTTYPE* const left, \
+        const ELEMENTTYPE* const right, \
+        const size_t start_left, \
+        const size_t start_right, \
+        const size_t size, \
+        size_t& count \
+    ) { \
+        return forward_op_and_with_count_##ELEMENTTYPE(left, right, start_left, start_right, size, count); \
+    } \
+    bool ForwardOpsImpl<ELEMENTTYPE>::op_or_with_count( \
+        ELEMENTTYPE* const left, \
+        const ELEMENTTYPE* const right, \
+        const size_t start_left, \
+        const size_t start_right, \
+        const size_t size, \
+        size_t& count \
+    ) { \
+        return forward_op_or_with_count_##ELEMENTTYPE(left, right, start_left, start_right, size, count); \
+    } \
+    bool ForwardOpsImpl<ELEMENTTYPE>::op_ternary( \
+        ELEMENTTYPE* const left, \
+        const ELEMENTTYPE* const b, \
+        const ELEMENTTYPE* const c, \
+        const size_t start_left, \
+        const size_t start_b, \
+        const size_t start_c, \
+        const size_t size, \
+        const uint8_t truth_table \
+    ) { \
+        return forward_op_ternary_##ELEMENTTYPE(left, b, c, start_left, start_b, start_c, size, truth_table); \
     }
 
 ALL_FORWARD_OPS(DISPATCH_FORWARD_OPS_OP_AND)
@@ -448,6 +716,10 @@ static void init_dynamic_hook() {
     op_compare_column_##TTYPE##_##UTYPE##_##OP = VectorizedAvx512::template op_compare_column<TTYPE, UTYPE, CompareOpType::OP>;
 #define SET_OP_COMPARE_VAL_AVX512(TTYPE, OP) \
     op_compare_val_##TTYPE##_##OP = VectorizedAvx512::template op_compare_val<TTYPE, CompareOpType::OP>;
+#define SET_OP_IN_VALUES_AVX512(TTYPE, OP) \
+    op_in_values_##TTYPE##_##OP = VectorizedAvx512::template op_in_values<TTYPE, InValuesType::OP>;
+#define SET_OP_PREFIX_MATCH_AVX512(OFFSETTYPE) \
+    op_prefix_match_##OFFSETTYPE = VectorizedAvx512::template op_prefix_match<OFFSETTYPE>;
 #define SET_OP_WITHIN_RANGE_COLUMN_AVX512(TTYPE, OP) \
     op_within_range_column_##TTYPE##_##OP = VectorizedAvx512::template op_within_range_column<TTYPE, RangeType::OP>;
 #define SET_OP_WITHIN_RANGE_VAL_AVX512(TTYPE, OP) \
@@ -460,20 +732,51 @@ static void init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int16_t, int16_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int32_t, int32_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int64_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, uint8_t, uint8_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, uint16_t, uint16_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, uint32_t, uint32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, uint64_t, uint64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, float, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, double, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int8_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int16_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int32_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int32_t, float)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, int32_t, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX512, float, double)
 
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, int8_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, int16_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, int32_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, uint8_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, uint16_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, uint32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, uint64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX512, double)
 
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, int8_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, int16_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, int32_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, int64_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, uint8_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, uint16_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, uint32_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, uint64_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, float)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX512, double)
+
+        ALL_PREFIX_MATCH_OPS(SET_OP_PREFIX_MATCH_AVX512)
+
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, int8_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, int32_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, int64_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, uint8_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, uint16_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, uint32_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, uint64_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, float)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX512, double)
 
@@ -481,6 +784,10 @@ static void init_dynamic_hook() {
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, int32_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, int64_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, uint8_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, uint16_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, uint32_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, uint64_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, float)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX512, double)
 
@@ -488,6 +795,10 @@ static void init_dynamic_hook() {
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, int16_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, int32_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, int64_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, uint8_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, uint16_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, uint32_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, uint64_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, float)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX512, double)
 
@@ -497,13 +808,20 @@ static void init_dynamic_hook() {
     forward_op_or_##ELEMENTTYPE = VectorizedAvx512::template forward_op_or<ELEMENTTYPE>; \
     forward_op_or_multiple_##ELEMENTTYPE = VectorizedAvx512::template forward_op_or_multiple<ELEMENTTYPE>; \
     forward_op_xor_##ELEMENTTYPE = VectorizedAvx512::template forward_op_xor<ELEMENTTYPE>; \
-    forward_op_sub_##ELEMENTTYPE = VectorizedAvx512::template forward_op_sub<ELEMENTTYPE>;
+    forward_op_sub_##ELEMENTTYPE = VectorizedAvx512::template forward_op_sub<ELEMENTTYPE>; \
+    forward_op_count_##ELEMENTTYPE = VectorizedAvx512::template forward_op_count<ELEMENTTYPE>; \
+    forward_op_find_##ELEMENTTYPE = VectorizedAvx512::template forward_op_find<ELEMENTTYPE>; \
+    forward_op_and_with_count_##ELEMENTTYPE = VectorizedAvx512::template forward_op_and_with_count<ELEMENTTYPE>; \
+    forward_op_or_with_count_##ELEMENTTYPE = VectorizedAvx512::template forward_op_or_with_count<ELEMENTTYPE>; \
+    forward_op_ternary_##ELEMENTTYPE = VectorizedAvx512::template forward_op_ternary<ELEMENTTYPE>;
 
         ALL_FORWARD_OPS(SET_FORWARD_OPS_AVX512)
 
 
 #undef SET_OP_COMPARE_COLUMN_AVX512
 #undef SET_OP_COMPARE_VAL_AVX512
+#undef SET_OP_IN_VALUES_AVX512
+#undef SET_OP_PREFIX_MATCH_AVX512
 #undef SET_OP_WITHIN_RANGE_COLUMN_AVX512
 #undef SET_OP_WITHIN_RANGE_VAL_AVX512
 #undef SET_ARITH_COMPARE_AVX512
@@ -518,6 +836,10 @@ static void init_dynamic_hook() {
     op_compare_column_##TTYPE##_##UTYPE##_##OP = VectorizedAvx2::template op_compare_column<TTYPE, UTYPE, CompareOpType::OP>;
 #define SET_OP_COMPARE_VAL_AVX2(TTYPE, OP) \
     op_compare_val_##TTYPE##_##OP = VectorizedAvx2::template op_compare_val<TTYPE, CompareOpType::OP>;
+#define SET_OP_IN_VALUES_AVX2(TTYPE, OP) \
+    op_in_values_##TTYPE##_##OP = VectorizedAvx2::template op_in_values<TTYPE, InValuesType::OP>;
+#define SET_OP_PREFIX_MATCH_AVX2(OFFSETTYPE) \
+    op_prefix_match_##OFFSETTYPE = VectorizedAvx2::template op_prefix_match<OFFSETTYPE>;
 #define SET_OP_WITHIN_RANGE_COLUMN_AVX2(TTYPE, OP) \
     op_within_range_column_##TTYPE##_##OP = VectorizedAvx2::template op_within_range_column<TTYPE, RangeType::OP>;
 #define SET_OP_WITHIN_RANGE_VAL_AVX2(TTYPE, OP) \
@@ -530,20 +852,51 @@ static void init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int16_t, int16_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int32_t, int32_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int64_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, uint8_t, uint8_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, uint16_t, uint16_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, uint32_t, uint32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, uint64_t, uint64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, float, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, double, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int8_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int16_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int32_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int32_t, float)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, int32_t, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_AVX2, float, double)
 
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, int8_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, int16_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, int32_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, uint8_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, uint16_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, uint32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, uint64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_AVX2, double)
 
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, int8_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, int16_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, int32_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, int64_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, uint8_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, uint16_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, uint32_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, uint64_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, float)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_AVX2, double)
+
+        ALL_PREFIX_MATCH_OPS(SET_OP_PREFIX_MATCH_AVX2)
+
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, int8_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, int32_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, int64_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, uint8_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, uint16_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, uint32_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, uint64_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, float)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_AVX2, double)
 
@@ -551,6 +904,10 @@ static void init_dynamic_hook() {
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, int32_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, int64_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, uint8_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, uint16_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, uint32_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, uint64_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, float)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_AVX2, double)
 
@@ -558,6 +915,10 @@ static void init_dynamic_hook() {
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, int16_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, int32_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, int64_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, uint8_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, uint16_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, uint32_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, uint64_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, float)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_AVX2, double)
 
@@ -567,13 +928,20 @@ static void init_dynamic_hook() {
     forward_op_or_##ELEMENTTYPE = VectorizedAvx2::template forward_op_or<ELEMENTTYPE>; \
     forward_op_or_multiple_##ELEMENTTYPE = VectorizedAvx2::template forward_op_or_multiple<ELEMENTTYPE>; \
     forward_op_xor_##ELEMENTTYPE = VectorizedAvx2::template forward_op_xor<ELEMENTTYPE>; \
-    forward_op_sub_##ELEMENTTYPE = VectorizedAvx2::template forward_op_sub<ELEMENTTYPE>;
+    forward_op_sub_##ELEMENTTYPE = VectorizedAvx2::template forward_op_sub<ELEMENTTYPE>; \
+    forward_op_count_##ELEMENTTYPE = VectorizedAvx2::template forward_op_count<ELEMENTTYPE>; \
+    forward_op_find_##ELEMENTTYPE = VectorizedAvx2::template forward_op_find<ELEMENTTYPE>; \
+    forward_op_and_with_count_##ELEMENTTYPE = VectorizedAvx2::template forward_op_and_with_count<ELEMENTTYPE>; \
+    forward_op_or_with_count_##ELEMENTTYPE = VectorizedAvx2::template forward_op_or_with_count<ELEMENTTYPE>; \
+    forward_op_ternary_##ELEMENTTYPE = VectorizedAvx2::template forward_op_ternary<ELEMENTTYPE>;
 
         ALL_FORWARD_OPS(SET_FORWARD_OPS_AVX2)
 
 
 #undef SET_OP_COMPARE_COLUMN_AVX2
 #undef SET_OP_COMPARE_VAL_AVX2
+#undef SET_OP_IN_VALUES_AVX2
+#undef SET_OP_PREFIX_MATCH_AVX2
 #undef SET_OP_WITHIN_RANGE_COLUMN_AVX2
 #undef SET_OP_WITHIN_RANGE_VAL_AVX2
 #undef SET_ARITH_COMPARE_AVX2
@@ -591,6 +959,8 @@ static void init_dynamic_hook() {
     op_compare_column_##TTYPE##_##UTYPE##_##OP = VectorizedSve::template op_compare_column<TTYPE, UTYPE, CompareOpType::OP>;
 #define SET_OP_COMPARE_VAL_SVE(TTYPE, OP) \
     op_compare_val_##TTYPE##_##OP = VectorizedSve::template op_compare_val<TTYPE, CompareOpType::OP>;
+#define SET_OP_IN_VALUES_SVE(TTYPE, OP) \
+    op_in_values_##TTYPE##_##OP = VectorizedSve::template op_in_values<TTYPE, InValuesType::OP>;
 #define SET_OP_WITHIN_RANGE_COLUMN_SVE(TTYPE, OP) \
     op_within_range_column_##TTYPE##_##OP = VectorizedSve::template op_within_range_column<TTYPE, RangeType::OP>;
 #define SET_OP_WITHIN_RANGE_VAL_SVE(TTYPE, OP) \
@@ -603,20 +973,49 @@ static void init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int16_t, int16_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int32_t, int32_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int64_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, uint8_t, uint8_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, uint16_t, uint16_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, uint32_t, uint32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, uint64_t, uint64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, float, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, double, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int8_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int16_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int32_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int32_t, float)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, int32_t, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_SVE, float, double)
 
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, int8_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, int16_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, int32_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, uint8_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, uint16_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, uint32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, uint64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_SVE, double)
 
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, int8_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, int16_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, int32_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, int64_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, uint8_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, uint16_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, uint32_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, uint64_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, float)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_SVE, double)
+
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, int8_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, int32_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, int64_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, uint8_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, uint16_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, uint32_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, uint64_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, float)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_SVE, double)
 
@@ -624,6 +1023,10 @@ static void init_dynamic_hook() {
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, int32_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, int64_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, uint8_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, uint16_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, uint32_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, uint64_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, float)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_SVE, double)
 
@@ -631,6 +1034,10 @@ static void init_dynamic_hook() {
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, int16_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, int32_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, int64_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, uint8_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, uint16_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, uint32_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, uint64_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, float)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_SVE, double)
 
@@ -640,13 +1047,19 @@ static void init_dynamic_hook() {
     forward_op_or_##ELEMENTTYPE = VectorizedSve::template forward_op_or<ELEMENTTYPE>; \
     forward_op_or_multiple_##ELEMENTTYPE = VectorizedSve::template forward_op_or_multiple<ELEMENTTYPE>; \
     forward_op_xor_##ELEMENTTYPE = VectorizedSve::template forward_op_xor<ELEMENTTYPE>; \
-    forward_op_sub_##ELEMENTTYPE = VectorizedSve::template forward_op_sub<ELEMENTTYPE>;
+    forward_op_sub_##ELEMENTTYPE = VectorizedSve::template forward_op_sub<ELEMENTTYPE>; \
+    forward_op_count_##ELEMENTTYPE = VectorizedSve::template forward_op_count<ELEMENTTYPE>; \
+    forward_op_find_##ELEMENTTYPE = VectorizedSve::template forward_op_find<ELEMENTTYPE>; \
+    forward_op_and_with_count_##ELEMENTTYPE = VectorizedSve::template forward_op_and_with_count<ELEMENTTYPE>; \
+    forward_op_or_with_count_##ELEMENTTYPE = VectorizedSve::template forward_op_or_with_count<ELEMENTTYPE>; \
+    forward_op_ternary_##ELEMENTTYPE = VectorizedSve::template forward_op_ternary<ELEMENTTYPE>;
 
         ALL_FORWARD_OPS(SET_FORWARD_OPS_SVE)
 
 
 #undef SET_OP_COMPARE_COLUMN_SVE
 #undef SET_OP_COMPARE_VAL_SVE
+#undef SET_OP_IN_VALUES_SVE
 #undef SET_OP_WITHIN_RANGE_COLUMN_SVE
 #undef SET_OP_WITHIN_RANGE_VAL_SVE
 #undef SET_ARITH_COMPARE_SVE
@@ -662,6 +1075,10 @@ static void init_dynamic_hook() {
     op_compare_column_##TTYPE##_##UTYPE##_##OP = VectorizedNeon::template op_compare_column<TTYPE, UTYPE, CompareOpType::OP>;
 #define SET_OP_COMPARE_VAL_NEON(TTYPE, OP) \
     op_compare_val_##TTYPE##_##OP = VectorizedNeon::template op_compare_val<TTYPE, CompareOpType::OP>;
+#define SET_OP_IN_VALUES_NEON(TTYPE, OP) \
+    op_in_values_##TTYPE##_##OP = VectorizedNeon::template op_in_values<TTYPE, InValuesType::OP>;
+#define SET_OP_PREFIX_MATCH_NEON(OFFSETTYPE) \
+    op_prefix_match_##OFFSETTYPE = VectorizedNeon::template op_prefix_match<OFFSETTYPE>;
 #define SET_OP_WITHIN_RANGE_COLUMN_NEON(TTYPE, OP) \
     op_within_range_column_##TTYPE##_##OP = VectorizedNeon::template op_within_range_column<TTYPE, RangeType::OP>;
 #define SET_OP_WITHIN_RANGE_VAL_NEON(TTYPE, OP) \
@@ -674,20 +1091,51 @@ static void init_dynamic_hook() {
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int16_t, int16_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int32_t, int32_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int64_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, uint8_t, uint8_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, uint16_t, uint16_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, uint32_t, uint32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, uint64_t, uint64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, float, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, double, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int8_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int16_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int32_t, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int32_t, float)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, int32_t, double)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_COLUMN_NEON, float, double)
 
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, int8_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, int16_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, int32_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, int64_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, uint8_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, uint16_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, uint32_t)
+        ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, uint64_t)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, float)
         ALL_COMPARE_OPS(SET_OP_COMPARE_VAL_NEON, double)
 
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, int8_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, int16_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, int32_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, int64_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, uint8_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, uint16_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, uint32_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, uint64_t)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, float)
+        ALL_IN_VALUES_OPS(SET_OP_IN_VALUES_NEON, double)
+
+        ALL_PREFIX_MATCH_OPS(SET_OP_PREFIX_MATCH_NEON)
+
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, int8_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, int32_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, int64_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, uint8_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, uint16_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, uint32_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, uint64_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, float)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_COLUMN_NEON, double)
 
@@ -695,6 +1143,10 @@ static void init_dynamic_hook() {
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, int16_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, int32_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, int64_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, uint8_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, uint16_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, uint32_t)
+        ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, uint64_t)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, float)
         ALL_RANGE_OPS(SET_OP_WITHIN_RANGE_VAL_NEON, double)
 
@@ -702,6 +1154,10 @@ static void init_dynamic_hook() {
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, int16_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, int32_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, int64_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, uint8_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, uint16_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, uint32_t)
+        ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, uint64_t)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, float)
         ALL_ARITH_CMP_OPS(SET_ARITH_COMPARE_NEON, double)
 
@@ -711,13 +1167,20 @@ static void init_dynamic_hook() {
     forward_op_or_##ELEMENTTYPE = VectorizedNeon::template forward_op_or<ELEMENTTYPE>; \
     forward_op_or_multiple_##ELEMENTTYPE = VectorizedNeon::template forward_op_or_multiple<ELEMENTTYPE>; \
     forward_op_xor_##ELEMENTTYPE = VectorizedNeon::template forward_op_xor<ELEMENTTYPE>; \
-    forward_op_sub_##ELEMENTTYPE = VectorizedNeon::template forward_op_sub<ELEMENTTYPE>;
+    forward_op_sub_##ELEMENTTYPE = VectorizedNeon::template forward_op_sub<ELEMENTTYPE>; \
+    forward_op_count_##ELEMENTTYPE = VectorizedNeon::template forward_op_count<ELEMENTTYPE>; \
+    forward_op_find_##ELEMENTTYPE = VectorizedNeon::template forward_op_find<ELEMENTTYPE>; \
+    forward_op_and_with_count_##ELEMENTTYPE = VectorizedNeon::template forward_op_and_with_count<ELEMENTTYPE>; \
+    forward_op_or_with_count_##ELEMENTTYPE = VectorizedNeon::template forward_op_or_with_count<ELEMENTTYPE>; \
+    forward_op_ternary_##ELEMENTTYPE = VectorizedNeon::template forward_op_ternary<ELEMENTTYPE>;
 
         ALL_FORWARD_OPS(SET_FORWARD_OPS_NEON)
 
 
 #undef SET_OP_COMPARE_COLUMN_NEON
 #undef SET_OP_COMPARE_VAL_NEON
+#undef SET_OP_IN_VALUES_NEON
+#undef SET_OP_PREFIX_MATCH_NEON
 #undef SET_OP_WITHIN_RANGE_COLUMN_NEON
 #undef SET_OP_WITHIN_RANGE_VAL_NEON
 #undef SET_ARITH_COMPARE_NEON
@@ -732,6 +1195,8 @@ static void init_dynamic_hook() {
 
 // no longer needed
 #undef ALL_COMPARE_OPS
+#undef ALL_IN_VALUES_OPS
+#undef ALL_PREFIX_MATCH_OPS
 #undef ALL_RANGE_OPS
 #undef ALL_ARITH_CMP_OPS
 #undef ALL_FORWARD_OPS
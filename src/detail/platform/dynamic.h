@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 
 #include "../../common.h"
 
@@ -18,14 +19,33 @@ namespace dynamic {
     FUNC(int16_t); \
     FUNC(int32_t); \
     FUNC(int64_t); \
+    FUNC(uint8_t); \
+    FUNC(uint16_t); \
+    FUNC(uint32_t); \
+    FUNC(uint64_t); \
     FUNC(float); \
     FUNC(double);
 
+// a facility to run through all acceptable pairs of different data types,
+//   the first one is widened to the second one
+#define ALL_DATATYPES_2_MIXED(FUNC) \
+    FUNC(int8_t, int64_t); \
+    FUNC(int16_t, int64_t); \
+    FUNC(int32_t, int64_t); \
+    FUNC(int32_t, float); \
+    FUNC(int32_t, double); \
+    FUNC(float, double);
+
 // a facility to run through all acceptable forward types
 #define ALL_FORWARD_TYPES_1(FUNC) \
     FUNC(uint8_t); \
     FUNC(uint64_t);
 
+// a facility to run through all acceptable types of string offsets
+#define ALL_OFFSET_TYPES(FUNC) \
+    FUNC(int32_t); \
+    FUNC(int64_t);
+
 
 ///////////////////////////////////////////////////////////////////////////
 // the default implementation
@@ -56,6 +76,21 @@ ALL_DATATYPES_1(DECLARE_PARTIAL_OP_COMPARE_COLUMN)
 
 #undef DECLARE_PARTIAL_OP_COMPARE_COLUMN
 
+#define DECLARE_PARTIAL_OP_COMPARE_COLUMN_MIXED(TTYPE, UTYPE) \
+    template<CompareOpType Op> \
+    struct OpCompareColumnImpl<TTYPE, UTYPE, Op> { \
+        static bool op_compare_column( \
+            uint8_t* const __restrict bitmask, \
+            const TTYPE* const __restrict t, \
+            const UTYPE* const __restrict u, \
+            const size_t size \
+        ); \
+    };
+
+ALL_DATATYPES_2_MIXED(DECLARE_PARTIAL_OP_COMPARE_COLUMN_MIXED)
+
+#undef DECLARE_PARTIAL_OP_COMPARE_COLUMN_MIXED
+
 
 ///////////////////////////////////////////////////////////////////////////
 // the default implementation
@@ -87,6 +122,72 @@ ALL_DATATYPES_1(DECLARE_PARTIAL_OP_COMPARE_VAL)
 #undef DECLARE_PARTIAL_OP_COMPARE_VAL
 
 
+///////////////////////////////////////////////////////////////////////////
+// the default implementation
+template<typename T, InValuesType Op>
+struct OpInValuesImpl {
+    static inline bool op_in_values(
+        uint8_t* const __restrict bitmask,
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        return false;
+    }
+};
+
+#define DECLARE_PARTIAL_OP_IN_VALUES(TTYPE) \
+    template<InValuesType Op> \
+    struct OpInValuesImpl<TTYPE, Op> { \
+        static bool op_in_values( \
+            uint8_t* const __restrict bitmask, \
+            const TTYPE* const __restrict t, \
+            const size_t size, \
+            const TTYPE* const __restrict values, \
+            const size_t n_values \
+        ); \
+    };
+
+ALL_DATATYPES_1(DECLARE_PARTIAL_OP_IN_VALUES)
+
+#undef DECLARE_PARTIAL_OP_IN_VALUES
+
+
+///////////////////////////////////////////////////////////////////////////
+// the default implementation
+template<typename OffsetT>
+struct OpPrefixMatchImpl {
+    static inline bool op_prefix_match(
+        uint8_t* const __restrict bitmask,
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const char* const __restrict prefix,
+        const size_t prefix_size
+    ) {
+        return false;
+    }
+};
+
+#define DECLARE_PARTIAL_OP_PREFIX_MATCH(OFFSETTYPE) \
+    template<> \
+    struct OpPrefixMatchImpl<OFFSETTYPE> { \
+        static bool op_prefix_match( \
+            uint8_t* const __restrict bitmask, \
+            const char* const __restrict data, \
+            const OFFSETTYPE* const __restrict offsets, \
+            const size_t size, \
+            const char* const __restrict prefix, \
+            const size_t prefix_size \
+        ); \
+    };
+
+ALL_OFFSET_TYPES(DECLARE_PARTIAL_OP_PREFIX_MATCH)
+
+#undef DECLARE_PARTIAL_OP_PREFIX_MATCH
+
+
 ///////////////////////////////////////////////////////////////////////////
 // the default implementation
 template<typename T, RangeType Op>
@@ -248,6 +349,59 @@ struct ForwardOpsImpl {
     ) {
         return false;
     }
+
+    static inline bool op_count(
+        const ElementT* const data,
+        const size_t start,
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+
+    static inline bool op_find(
+        const ElementT* const data,
+        const size_t start,
+        const size_t size,
+        const size_t starting_idx,
+        const bool is_set,
+        std::optional<size_t>& result
+    ) {
+        return false;
+    }
+    static inline bool op_and_with_count(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+    static inline bool op_or_with_count(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+
+    static inline bool op_ternary(
+        ElementT* const left,
+        const ElementT* const b,
+        const ElementT* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size,
+        const uint8_t truth_table
+    ) {
+        return false;
+    }
 };
 
 #define DECLARE_PARTIAL_FORWARD_OPS(ELEMENTTYPE) \
@@ -302,6 +456,51 @@ struct ForwardOpsImpl {
             const size_t start_right, \
             const size_t size \
         ); \
+\
+        static bool op_count( \
+            const ELEMENTTYPE* const data, \
+            const size_t start, \
+            const size_t size, \
+            size_t& count \
+        ); \
+\
+        static bool op_find( \
+            const ELEMENTTYPE* const data, \
+            const size_t start, \
+            const size_t size, \
+            const size_t starting_idx, \
+            const bool is_set, \
+            std::optional<size_t>& result \
+        ); \
+\
+        static bool op_and_with_count( \
+            ELEMENTTYPE* const left, \
+            const ELEMENTTYPE* const right, \
+            const size_t start_left, \
+            const size_t start_right, \
+            const size_t size, \
+            size_t& count \
+        ); \
+\
+        static bool op_or_with_count( \
+            ELEMENTTYPE* const left, \
+            const ELEMENTTYPE* const right, \
+            const size_t start_left, \
+            const size_t start_right, \
+            const size_t size, \
+            size_t& count \
+        ); \
+\
+        static bool op_ternary( \
+            ELEMENTTYPE* const left, \
+            const ELEMENTTYPE* const b, \
+            const ELEMENTTYPE* const c, \
+            const size_t start_left, \
+            const size_t start_b, \
+            const size_t start_c, \
+            const size_t size, \
+            const uint8_t truth_table \
+        ); \
     };
 
 ALL_FORWARD_TYPES_1(DECLARE_PARTIAL_FORWARD_OPS)
@@ -312,7 +511,9 @@ ALL_FORWARD_TYPES_1(DECLARE_PARTIAL_FORWARD_OPS)
 ///////////////////////////////////////////////////////////////////////////
 
 #undef ALL_DATATYPES_1
+#undef ALL_DATATYPES_2_MIXED
 #undef ALL_FORWARD_TYPES_1
+#undef ALL_OFFSET_TYPES
 
 }
 
@@ -345,6 +546,35 @@ struct VectorizedDynamic {
         return dynamic::OpCompareValImpl<T, Op>::op_compare_val(bitmask, t, size, value);
     }
 
+    // Fills a bitmask by checking whether elements of a given array
+    //   are present in a given set of values.
+    // API requirement: size % 8 == 0
+    template<typename T, InValuesType Op>
+    static bool op_in_values(
+        uint8_t* const __restrict bitmask,
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        return dynamic::OpInValuesImpl<T, Op>::op_in_values(bitmask, t, size, values, n_values);
+    }
+
+    // Fills a bitmask by checking whether strings of a given column
+    //   start with a given prefix.
+    // API requirement: size % 8 == 0
+    template<typename OffsetT>
+    static bool op_prefix_match(
+        uint8_t* const __restrict bitmask,
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const char* const __restrict prefix,
+        const size_t prefix_size
+    ) {
+        return dynamic::OpPrefixMatchImpl<OffsetT>::op_prefix_match(bitmask, data, offsets, size, prefix, prefix_size);
+    }
+
     // API requirement: size % 8 == 0
     template<typename T, RangeType Op>
     static bool op_within_range_column(
@@ -451,6 +681,66 @@ struct VectorizedDynamic {
     ) {
         return dynamic::ForwardOpsImpl<ElementT>::op_sub(left, right, start_left, start_right, size);
     }
+
+    template<typename ElementT>
+    static inline bool forward_op_count(
+        const ElementT* const data, 
+        const size_t start, 
+        const size_t size,
+        size_t& count
+    ) {
+        return dynamic::ForwardOpsImpl<ElementT>::op_count(data, start, size, count);
+    }
+
+    template<typename ElementT>
+    static inline bool forward_op_find(
+        const ElementT* const data,
+        const size_t start,
+        const size_t size,
+        const size_t starting_idx,
+        const bool is_set,
+        std::optional<size_t>& result
+    ) {
+        return dynamic::ForwardOpsImpl<ElementT>::op_find(data, start, size, starting_idx, is_set, result);
+    }
+
+    template<typename ElementT>
+    static inline bool forward_op_and_with_count(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size,
+        size_t& count
+    ) {
+        return dynamic::ForwardOpsImpl<ElementT>::op_and_with_count(left, right, start_left, start_right, size, count);
+    }
+
+    template<typename ElementT>
+    static inline bool forward_op_or_with_count(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size,
+        size_t& count
+    ) {
+        return dynamic::ForwardOpsImpl<ElementT>::op_or_with_count(left, right, start_left, start_right, size, count);
+    }
+
+    template<typename ElementT>
+    static inline bool forward_op_ternary(
+        ElementT* const left,
+        const ElementT* const b,
+        const ElementT* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size,
+        const uint8_t truth_table
+    ) {
+        return dynamic::ForwardOpsImpl<ElementT>::op_ternary(left, b, c, start_left, start_b, start_c, size, truth_table);
+    }
 };
 
 }
@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 #include <type_traits>
 
 #include "../../common.h"
@@ -46,6 +47,35 @@ struct VectorizedRef {
         return false;
     }
 
+    // Fills a bitmask by checking whether elements of a given array
+    //   are present in a given set of values.
+    // API requirement: size % 8 == 0
+    template<typename T, InValuesType Op>
+    static inline bool op_in_values(
+        uint8_t* const __restrict output,
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        return false;
+    }
+
+    // Fills a bitmask by checking whether strings of a given column
+    //   start with a given prefix.
+    // API requirement: size % 8 == 0
+    template<typename OffsetT>
+    static inline bool op_prefix_match(
+        uint8_t* const __restrict output,
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const char* const __restrict prefix,
+        const size_t prefix_size
+    ) {
+        return false;
+    }
+
     // API requirement: size % 8 == 0
     template<typename T, RangeType Op>
     static inline bool op_within_range_column(
@@ -153,6 +183,66 @@ struct VectorizedRef {
     ) {
         return false;
     }
+
+    template<typename ElementT>
+    static inline bool forward_op_count(
+        const ElementT* const data, 
+        const size_t start, 
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+
+    template<typename ElementT>
+    static inline bool forward_op_find(
+        const ElementT* const data,
+        const size_t start,
+        const size_t size,
+        const size_t starting_idx,
+        const bool is_set,
+        std::optional<size_t>& result
+    ) {
+        return false;
+    }
+
+    template<typename ElementT>
+    static inline bool forward_op_and_with_count(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+
+    template<typename ElementT>
+    static inline bool forward_op_or_with_count(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+
+    template<typename ElementT>
+    static inline bool forward_op_ternary(
+        ElementT* const left,
+        const ElementT* const b,
+        const ElementT* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size,
+        const uint8_t truth_table
+    ) {
+        return false;
+    }
 };
 
 }
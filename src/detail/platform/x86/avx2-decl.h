@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <optional>
 
 #include "../../../common.h"
 
@@ -20,14 +21,33 @@ namespace avx2 {
     FUNC(int16_t); \
     FUNC(int32_t); \
     FUNC(int64_t); \
+    FUNC(uint8_t); \
+    FUNC(uint16_t); \
+    FUNC(uint32_t); \
+    FUNC(uint64_t); \
     FUNC(float); \
     FUNC(double);
 
+// a facility to run through all acceptable pairs of different data types,
+//   the first one is widened to the second one
+#define ALL_DATATYPES_2_MIXED(FUNC) \
+    FUNC(int8_t, int64_t); \
+    FUNC(int16_t, int64_t); \
+    FUNC(int32_t, int64_t); \
+    FUNC(int32_t, float); \
+    FUNC(int32_t, double); \
+    FUNC(float, double);
+
 // a facility to run through all acceptable forward types
 #define ALL_FORWARD_TYPES_1(FUNC) \
     FUNC(uint8_t); \
     FUNC(uint64_t);
 
+// a facility to run through all acceptable types of string offsets
+#define ALL_OFFSET_TYPES(FUNC) \
+    FUNC(int32_t); \
+    FUNC(int64_t);
+
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +80,21 @@ ALL_DATATYPES_1(DECLARE_PARTIAL_OP_COMPARE_COLUMN)
 
 #undef DECLARE_PARTIAL_OP_COMPARE_COLUMN
 
+#define DECLARE_PARTIAL_OP_COMPARE_COLUMN_MIXED(TTYPE, UTYPE) \
+    template<CompareOpType Op> \
+    struct OpCompareColumnImpl<TTYPE, UTYPE, Op> { \
+        static bool op_compare_column( \
+            uint8_t* const __restrict bitmask, \
+            const TTYPE* const __restrict t, \
+            const UTYPE* const __restrict u, \
+            const size_t size \
+        ); \
+    };
+
+ALL_DATATYPES_2_MIXED(DECLARE_PARTIAL_OP_COMPARE_COLUMN_MIXED)
+
+#undef DECLARE_PARTIAL_OP_COMPARE_COLUMN_MIXED
+
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -93,6 +128,76 @@ ALL_DATATYPES_1(DECLARE_PARTIAL_OP_COMPARE_VAL)
 #undef DECLARE_PARTIAL_OP_COMPARE_VAL
 
 
+///////////////////////////////////////////////////////////////////////////
+
+// the default implementation does nothing
+template<typename T, InValuesType Op>
+struct OpInValuesImpl {
+    static inline bool op_in_values(
+        uint8_t* const __restrict bitmask,
+        const T* const __restrict t,
+        const size_t size,
+        const T* const __restrict values,
+        const size_t n_values
+    ) {
+        return false;
+    }
+};
+
+// the following use cases are handled
+#define DECLARE_PARTIAL_OP_IN_VALUES(TTYPE) \
+    template<InValuesType Op> \
+    struct OpInValuesImpl<TTYPE, Op> { \
+        static bool op_in_values( \
+            uint8_t* const __restrict bitmask, \
+            const TTYPE* const __restrict t, \
+            const size_t size, \
+            const TTYPE* const __restrict values, \
+            const size_t n_values \
+        ); \
+    };
+
+ALL_DATATYPES_1(DECLARE_PARTIAL_OP_IN_VALUES)
+
+#undef DECLARE_PARTIAL_OP_IN_VALUES
+
+
+///////////////////////////////////////////////////////////////////////////
+
+// the default implementation does nothing
+template<typename OffsetT>
+struct OpPrefixMatchImpl {
+    static inline bool op_prefix_match(
+        uint8_t* const __restrict bitmask,
+        const char* const __restrict data,
+        const OffsetT* const __restrict offsets,
+        const size_t size,
+        const char* const __restrict prefix,
+        const size_t prefix_size
+    ) {
+        return false;
+    }
+};
+
+// the following use cases are handled
+#define DECLARE_PARTIAL_OP_PREFIX_MATCH(OFFSETTYPE) \
+    template<> \
+    struct OpPrefixMatchImpl<OFFSETTYPE> { \
+        static bool op_prefix_match( \
+            uint8_t* const __restrict bitmask, \
+            const char* const __restrict data, \
+            const OFFSETTYPE* const __restrict offsets, \
+            const size_t size, \
+            const char* const __restrict prefix, \
+            const size_t prefix_size \
+        ); \
+    };
+
+ALL_OFFSET_TYPES(DECLARE_PARTIAL_OP_PREFIX_MATCH)
+
+#undef DECLARE_PARTIAL_OP_PREFIX_MATCH
+
+
 ///////////////////////////////////////////////////////////////////////////
 
 // the default implementation does nothing
@@ -261,6 +366,59 @@ struct ForwardOpsImpl {
     ) {
         return false;
     }
+
+    static inline bool op_count(
+        const ElementT* const data,
+        const size_t start,
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+
+    static inline bool op_find(
+        const ElementT* const data,
+        const size_t start,
+        const size_t size,
+        const size_t starting_idx,
+        const bool is_set,
+        std::optional<size_t>& result
+    ) {
+        return false;
+    }
+    static inline bool op_and_with_count(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+    static inline bool op_or_with_count(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size,
+        size_t& count
+    ) {
+        return false;
+    }
+
+    static inline bool op_ternary(
+        ElementT* const left,
+        const ElementT* const b,
+        const ElementT* const c,
+        const size_t start_left,
+        const size_t start_b,
+        const size_t start_c,
+        const size_t size,
+        const uint8_t truth_table
+    ) {
+        return false;
+    }
 };
 
 #define DECLARE_PARTIAL_FORWARD_OPS(ELEMENTTYPE) \
@@ -315,6 +473,51 @@ struct ForwardOpsImpl {
             const size_t start_right, \
             const size_t size \
         ); \
+\
+        static bool op_count( \
+            const ELEMENTTYPE* const data, \
+            const size_t start, \
+            const size_t size, \
+            size_t& count \
+        ); \
+\
+        static bool op_find( \
+            const ELEMENTTYPE* const data, \
+            const size_t start, \
+            const size_t size, \
+            const size_t starting_idx, \
+            const bool is_set, \
+            std::optional<size_t>& result \
+        ); \
+\
+        static bool op_and_with_count( \
+            ELEMENTTYPE* const left, \
+            const ELEMENTTYPE* const right, \
+            const size_t start_left, \
+            const size_t start_right, \
+            const size_t size, \
+            size_t& count \
+        ); \
+\
+        static bool op_or_with_count( \
+            ELEMENTTYPE* const left, \
+            const ELEMENTTYPE* const right, \
+            const size_t start_left, \
+            const size_t start_right, \
+            const size_t size, \
+            size_t& count \
+        ); \
+\
+        static bool op_ternary( \
+            ELEMENTTYPE* const left, \
+            const ELEMENTTYPE* const b, \
+            const ELEMENTTYPE* const c, \
+            const size_t start_left, \
+            const size_t start_b, \
+            const size_t start_c, \
+            const size_t size, \
+            const uint8_t truth_table \
+        ); \
     };
 
 ALL_FORWARD_TYPES_1(DECLARE_PARTIAL_FORWARD_OPS)
@@ -325,7 +528,9 @@ ALL_FORWARD_TYPES_1(DECLARE_PARTIAL_FORWARD_OPS)
 ///////////////////////////////////////////////////////////////////////////
 
 #undef ALL_DATATYPES_1
+#undef ALL_DATATYPES_2_MIXED
 #undef ALL_FORWARD_TYPES_1
+#undef ALL_OFFSET_TYPES
 
 }
 }
@@ -4,16 +4,22 @@
 
 #include <immintrin.h>
 
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
+#include <utility>
 
 #include "avx2-decl.h"
 
 #include "../../../common.h"
+#include "../../divide.h"
 #include "../../element_wise.h"
+#include "../../ternary_logic.h"
+#include "../../in_values.h"
 #include "common.h"
 
 namespace milvus {
@@ -238,6 +244,67 @@ struct CmpHelperI64<CompareOpType::NE> {
     }
 };
 
+// unsigned values are compared as signed ones with flipped sign bits
+template<CompareOpType Op>
+struct CmpHelperU8 {
+    static inline __m256i compare(const __m256i a, const __m256i b) {
+        if constexpr (Op == CompareOpType::EQ || Op == CompareOpType::NE) {
+            return CmpHelperI8<Op>::compare(a, b);
+        } else {
+            const __m256i sign = _mm256_set1_epi8(char(0x80));
+            return CmpHelperI8<Op>::compare(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+        }
+    }
+};
+
+//
+template<CompareOpType Op>
+struct CmpHelperU16 {
+    static inline __m256i compare(const __m256i a, const __m256i b) {
+        if constexpr (Op == CompareOpType::EQ || Op == CompareOpType::NE) {
+            return CmpHelperI16<Op>::compare(a, b);
+        } else {
+            const __m256i sign = _mm256_set1_epi16(short(0x8000));
+            return CmpHelperI16<Op>::compare(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+        }
+    }
+
+    static inline __m128i compare(const __m128i a, const __m128i b) {
+        if constexpr (Op == CompareOpType::EQ || Op == CompareOpType::NE) {
+            return CmpHelperI16<Op>::compare(a, b);
+        } else {
+            const __m128i sign = _mm_set1_epi16(short(0x8000));
+            return CmpHelperI16<Op>::compare(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+        }
+    }
+};
+
+//
+template<CompareOpType Op>
+struct CmpHelperU32 {
+    static inline __m256i compare(const __m256i a, const __m256i b) {
+        if constexpr (Op == CompareOpType::EQ || Op == CompareOpType::NE) {
+            return CmpHelperI32<Op>::compare(a, b);
+        } else {
+            const __m256i sign = _mm256_set1_epi32(int(0x80000000));
+            return CmpHelperI32<Op>::compare(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+        }
+    }
+};
+
+//
+template<CompareOpType Op>
+struct CmpHelperU64 {
+    static inline __m256i compare(const __m256i a, const __m256i b) {
+        if constexpr (Op == CompareOpType::EQ || Op == CompareOpType::NE) {
+            return CmpHelperI64<Op>::compare(a, b);
+        } else {
+            const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+            return CmpHelperI64<Op>::compare(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+        }
+    }
+};
+
 }
 
 ///////////////////////////////////////////////////////////////////////////
@@ -394,90 +461,25 @@ bool OpCompareValImpl<int64_t, Op>::op_compare_val(
 }
 
 template<CompareOpType Op>
-bool OpCompareValImpl<float, Op>::op_compare_val(
-    uint8_t* const __restrict res_u8,
-    const float* const __restrict src, 
-    const size_t size, 
-    const float& val
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-
-    //
-    constexpr auto pred = ComparePredicate<float, Op>::value;
-
-    const __m256 target = _mm256_set1_ps(val);
-
-    // todo: aligned reads & writes
-
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m256 v0 = _mm256_loadu_ps(src + i);
-        const __m256 cmp = _mm256_cmp_ps(v0, target, pred);
-        const uint8_t mmask = _mm256_movemask_ps(cmp);
-
-        res_u8[i / 8] = mmask;
-    }
-
-    return true;
-}
-
-template<CompareOpType Op>
-bool OpCompareValImpl<double, Op>::op_compare_val(
+bool OpCompareValImpl<uint8_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict src, 
+    const uint8_t* const __restrict src, 
     const size_t size, 
-    const double& val
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-
-    //
-    constexpr auto pred = ComparePredicate<float, Op>::value;
-
-    const __m256d target = _mm256_set1_pd(val);
-
-    // todo: aligned reads & writes
-
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m256d v0 = _mm256_loadu_pd(src + i);
-        const __m256d v1 = _mm256_loadu_pd(src + i + 4);
-        const __m256d cmp0 = _mm256_cmp_pd(v0, target, pred);
-        const __m256d cmp1 = _mm256_cmp_pd(v1, target, pred);
-        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
-        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
-
-        res_u8[i / 8] = mmask0 + mmask1 * 16;
-    }
-
-    return true;
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-
-//
-template<CompareOpType Op>
-bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
-    uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict left, 
-    const int8_t* const __restrict right, 
-    const size_t size
+    const uint8_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
     uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+    const __m256i target = _mm256_set1_epi8(val);
 
     // todo: aligned reads & writes
 
     const size_t size32 = (size / 32) * 32;
     for (size_t i = 0; i < size32; i += 32) {
-        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
-        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
-        const __m256i cmp = CmpHelperI8<Op>::compare(v0l, v0r);
+        const __m256i v0 = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i cmp = CmpHelperU8<Op>::compare(v0, target);
         const uint32_t mmask = _mm256_movemask_epi8(cmp);
 
         res_u32[i / 32] = mmask;
@@ -492,9 +494,8 @@ bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
             0
         );
 
-        const __m256i v0l = _mm256_maskload_epi64((const long long*)(left + size32), mask);
-        const __m256i v0r = _mm256_maskload_epi64((const long long*)(right + size32), mask);
-        const __m256i cmp = CmpHelperI8<Op>::compare(v0l, v0r);
+        const __m256i v0 = _mm256_maskload_epi64((const long long*)(src + size32), mask);
+        const __m256i cmp = CmpHelperU8<Op>::compare(v0, target);
         const uint32_t mmask = _mm256_movemask_epi8(cmp);
 
         if (size - size32 >= 8) {
@@ -512,25 +513,25 @@ bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint16_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict left, 
-    const int16_t* const __restrict right, 
-    const size_t size
+    const uint16_t* const __restrict src, 
+    const size_t size, 
+    const uint16_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+    const __m256i target = _mm256_set1_epi16(val);
 
     // todo: aligned reads & writes
 
     const size_t size16 = (size / 16) * 16;
     for (size_t i = 0; i < size16; i += 16) {
-        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
-        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
-        const __m256i cmp = CmpHelperI16<Op>::compare(v0l, v0r);
+        const __m256i v0 = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i cmp = CmpHelperU16<Op>::compare(v0, target);
         const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
         const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
         const uint16_t mmask = _mm256_movemask_epi8(qcmp);
@@ -540,9 +541,9 @@ bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
 
     if (size16 != size) {
         // 8 elements to process
-        const __m128i v0l = _mm_loadu_si128((const __m128i*)(left + size16));
-        const __m128i v0r = _mm_loadu_si128((const __m128i*)(right + size16));
-        const __m128i cmp = CmpHelperI16<Op>::compare(v0l, v0r);
+        const __m128i v0 = _mm_loadu_si128((const __m128i*)(src + size16));
+        const __m128i target0 = _mm_set1_epi16(val);
+        const __m128i cmp = CmpHelperU16<Op>::compare(v0, target0);
         const __m128i pcmp = _mm_packs_epi16(cmp, cmp);
         const uint32_t mmask = _mm_movemask_epi8(pcmp) & 0xFF;
 
@@ -553,22 +554,24 @@ bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint32_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict left, 
-    const int32_t* const __restrict right, 
-    const size_t size
+    const uint32_t* const __restrict src, 
+    const size_t size, 
+    const uint32_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
+    //
+    const __m256i target = _mm256_set1_epi32(val);
+
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
-        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
-        const __m256i cmp = CmpHelperI32<Op>::compare(v0l, v0r);
+        const __m256i v0 = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i cmp = CmpHelperU32<Op>::compare(v0, target);
         const uint8_t mmask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
 
         res_u8[i / 8] = mmask;
@@ -578,25 +581,26 @@ bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint64_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict left, 
-    const int64_t* const __restrict right, 
-    const size_t size
+    const uint64_t* const __restrict src, 
+    const size_t size, 
+    const uint64_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
+    //
+    const __m256i target = _mm256_set1_epi64x(val);
+
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
-        const __m256i v1l = _mm256_loadu_si256((const __m256i*)(left + i + 4));
-        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
-        const __m256i v1r = _mm256_loadu_si256((const __m256i*)(right + i + 4));
-        const __m256i cmp0 = CmpHelperI64<Op>::compare(v0l, v0r);
-        const __m256i cmp1 = CmpHelperI64<Op>::compare(v1l, v1r);
+        const __m256i v0 = _mm256_loadu_si256((const __m256i*)(src + i));
+        const __m256i v1 = _mm256_loadu_si256((const __m256i*)(src + i + 4));
+        const __m256i cmp0 = CmpHelperU64<Op>::compare(v0, target);
+        const __m256i cmp1 = CmpHelperU64<Op>::compare(v1, target);
         const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
         const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
 
@@ -607,11 +611,11 @@ bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
+bool OpCompareValImpl<float, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const float* const __restrict left, 
-    const float* const __restrict right, 
-    const size_t size
+    const float* const __restrict src, 
+    const size_t size, 
+    const float& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
@@ -619,13 +623,14 @@ bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
     //
     constexpr auto pred = ComparePredicate<float, Op>::value;
 
+    const __m256 target = _mm256_set1_ps(val);
+
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const __m256 v0l = _mm256_loadu_ps(left + i);
-        const __m256 v0r = _mm256_loadu_ps(right + i);
-        const __m256 cmp = _mm256_cmp_ps(v0l, v0r, pred);
+        const __m256 v0 = _mm256_loadu_ps(src + i);
+        const __m256 cmp = _mm256_cmp_ps(v0, target, pred);
         const uint8_t mmask = _mm256_movemask_ps(cmp);
 
         res_u8[i / 8] = mmask;
@@ -635,27 +640,28 @@ bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
+bool OpCompareValImpl<double, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict left, 
-    const double* const __restrict right, 
-    const size_t size
+    const double* const __restrict src, 
+    const size_t size, 
+    const double& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
-    constexpr auto pred = ComparePredicate<double, Op>::value;
+    constexpr auto pred = ComparePredicate<float, Op>::value;
+
+    const __m256d target = _mm256_set1_pd(val);
 
     // todo: aligned reads & writes
+
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const __m256d v0l = _mm256_loadu_pd(left + i);
-        const __m256d v1l = _mm256_loadu_pd(left + i + 4);
-        const __m256d v0r = _mm256_loadu_pd(right + i);
-        const __m256d v1r = _mm256_loadu_pd(right + i + 4);
-        const __m256d cmp0 = _mm256_cmp_pd(v0l, v0r, pred);
-        const __m256d cmp1 = _mm256_cmp_pd(v1l, v1r, pred);
+        const __m256d v0 = _mm256_loadu_pd(src + i);
+        const __m256d v1 = _mm256_loadu_pd(src + i + 4);
+        const __m256d cmp0 = _mm256_cmp_pd(v0, target, pred);
+        const __m256d cmp1 = _mm256_cmp_pd(v1, target, pred);
         const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
         const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
 
@@ -668,260 +674,321 @@ bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
 
 ///////////////////////////////////////////////////////////////////////////
 
-//
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict lower,
-    const int8_t* const __restrict upper,
-    const int8_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
+namespace {
 
-    //
-    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+// Equality comparisons for IN. The signedness of integers does not 
+//   matter, so unsigned types use the same helpers.
+// match() produces a bitmask for N elements.
+template<typename T>
+struct InValuesHelper {};
 
-    // todo: aligned reads & writes
+template<>
+struct InValuesHelper<int8_t> {
+    using vec_type = __m256i;
+    static constexpr size_t N = 32;
 
-    const size_t size32 = (size / 32) * 32;
-    for (size_t i = 0; i < size32; i += 32) {
-        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
-        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
-        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
-        const __m256i cmpl = CmpHelperI8<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const __m256i cmpu = CmpHelperI8<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
-        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+    static inline vec_type set1(const int8_t value) {
+        return _mm256_set1_epi8(value);
+    }
 
-        res_u32[i / 32] = mmask;
+    static inline uint32_t match(const int8_t* const src, const vec_type* const targets, const size_t n_targets) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)src);
+
+        __m256i cmp = _mm256_cmpeq_epi8(v, targets[0]);
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp = _mm256_or_si256(cmp, _mm256_cmpeq_epi8(v, targets[j]));
+        }
+
+        return _mm256_movemask_epi8(cmp);
     }
+};
 
-    if (size32 != size) {
-        // 8, 16 or 24 elements to process
-        const __m256i mask = _mm256_setr_epi64x(
-            (size - size32 >= 8) ? (-1) : 0,
-            (size - size32 >= 16) ? (-1) : 0,
-            (size - size32 >= 24) ? (-1) : 0,
-            0
-        );
+template<>
+struct InValuesHelper<int16_t> {
+    using vec_type = __m256i;
+    static constexpr size_t N = 16;
 
-        const __m256i v0l = _mm256_maskload_epi64((const long long*)(lower + size32), mask);
-        const __m256i v0u = _mm256_maskload_epi64((const long long*)(upper + size32), mask);
-        const __m256i v0v = _mm256_maskload_epi64((const long long*)(values + size32), mask);
-        const __m256i cmpl = CmpHelperI8<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const __m256i cmpu = CmpHelperI8<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
-        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+    static inline vec_type set1(const int16_t value) {
+        return _mm256_set1_epi16(value);
+    }
 
-        if (size - size32 >= 8) {
-            res_u8[size32 / 8 + 0] = (mmask & 0xFF);
-        }
-        if (size - size32 >= 16) {
-            res_u8[size32 / 8 + 1] = ((mmask >> 8) & 0xFF);
-        }
-        if (size - size32 >= 24) {
-            res_u8[size32 / 8 + 2] = ((mmask >> 16) & 0xFF);
+    static inline uint32_t match(const int16_t* const src, const vec_type* const targets, const size_t n_targets) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)src);
+
+        __m256i cmp = _mm256_cmpeq_epi16(v, targets[0]);
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp = _mm256_or_si256(cmp, _mm256_cmpeq_epi16(v, targets[j]));
         }
+
+        const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
+        const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
+        return uint16_t(_mm256_movemask_epi8(qcmp));
     }
+};
 
-    return true;
-}
+template<>
+struct InValuesHelper<int32_t> {
+    using vec_type = __m256i;
+    static constexpr size_t N = 8;
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict lower,
-    const int16_t* const __restrict upper,
-    const int16_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-
-    //
-    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+    static inline vec_type set1(const int32_t value) {
+        return _mm256_set1_epi32(value);
+    }
 
-    // todo: aligned reads & writes
+    static inline uint32_t match(const int32_t* const src, const vec_type* const targets, const size_t n_targets) {
+        const __m256i v = _mm256_loadu_si256((const __m256i*)src);
 
-    const size_t size16 = (size / 16) * 16;
-    for (size_t i = 0; i < size16; i += 16) {
-        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
-        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
-        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
-        const __m256i cmpl = CmpHelperI16<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const __m256i cmpu = CmpHelperI16<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
-        const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
-        const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
-        const uint16_t mmask = _mm256_movemask_epi8(qcmp);
+        __m256i cmp = _mm256_cmpeq_epi32(v, targets[0]);
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp = _mm256_or_si256(cmp, _mm256_cmpeq_epi32(v, targets[j]));
+        }
 
-        res_u16[i / 16] = mmask;
+        return _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
     }
+};
 
-    if (size16 != size) {
-        // 8 elements to process
-        const __m128i v0l = _mm_loadu_si128((const __m128i*)(lower + size16));
-        const __m128i v0u = _mm_loadu_si128((const __m128i*)(upper + size16));
-        const __m128i v0v = _mm_loadu_si128((const __m128i*)(values + size16));
-        const __m128i cmpl = CmpHelperI16<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const __m128i cmpu = CmpHelperI16<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const __m128i cmp = _mm_and_si128(cmpl, cmpu);
-        const __m128i pcmp = _mm_packs_epi16(cmp, cmp);
-        const uint32_t mmask = _mm_movemask_epi8(pcmp) & 0xFF;
+template<>
+struct InValuesHelper<int64_t> {
+    using vec_type = __m256i;
+    static constexpr size_t N = 8;
 
-        res_u8[size16 / 8] = mmask;
+    static inline vec_type set1(const int64_t value) {
+        return _mm256_set1_epi64x(value);
     }
 
-    return true;
-}
+    static inline uint32_t match(const int64_t* const src, const vec_type* const targets, const size_t n_targets) {
+        const __m256i v0 = _mm256_loadu_si256((const __m256i*)(src + 0));
+        const __m256i v1 = _mm256_loadu_si256((const __m256i*)(src + 4));
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict lower,
-    const int32_t* const __restrict upper,
-    const int32_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
+        __m256i cmp0 = _mm256_cmpeq_epi64(v0, targets[0]);
+        __m256i cmp1 = _mm256_cmpeq_epi64(v1, targets[0]);
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp0 = _mm256_or_si256(cmp0, _mm256_cmpeq_epi64(v0, targets[j]));
+            cmp1 = _mm256_or_si256(cmp1, _mm256_cmpeq_epi64(v1, targets[j]));
+        }
 
-    // todo: aligned reads & writes
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+        return mmask0 + mmask1 * 16;
+    }
+};
 
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
-        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
-        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
-        const __m256i cmpl = CmpHelperI32<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const __m256i cmpu = CmpHelperI32<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
-        const uint8_t mmask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+template<>
+struct InValuesHelper<float> {
+    using vec_type = __m256;
+    static constexpr size_t N = 8;
 
-        res_u8[i / 8] = mmask;
+    static inline vec_type set1(const float value) {
+        return _mm256_set1_ps(value);
     }
 
-    return true;
-}
+    static inline uint32_t match(const float* const src, const vec_type* const targets, const size_t n_targets) {
+        const __m256 v = _mm256_loadu_ps(src);
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict lower,
-    const int64_t* const __restrict upper,
-    const int64_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
+        __m256 cmp = _mm256_cmp_ps(v, targets[0], _CMP_EQ_OQ);
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp = _mm256_or_ps(cmp, _mm256_cmp_ps(v, targets[j], _CMP_EQ_OQ));
+        }
 
-    // todo: aligned reads & writes
+        return _mm256_movemask_ps(cmp);
+    }
+};
 
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
-        const __m256i v1l = _mm256_loadu_si256((const __m256i*)(lower + i + 4));
-        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
-        const __m256i v1u = _mm256_loadu_si256((const __m256i*)(upper + i + 4));
-        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
-        const __m256i v1v = _mm256_loadu_si256((const __m256i*)(values + i + 4));
-        const __m256i cmp0l = CmpHelperI64<Range2Compare<Op>::lower>::compare(v0l, v0v);
-        const __m256i cmp0u = CmpHelperI64<Range2Compare<Op>::upper>::compare(v0v, v0u);
-        const __m256i cmp1l = CmpHelperI64<Range2Compare<Op>::lower>::compare(v1l, v1v);
-        const __m256i cmp1u = CmpHelperI64<Range2Compare<Op>::upper>::compare(v1v, v1u);
-        const __m256i cmp0 = _mm256_and_si256(cmp0l, cmp0u);
-        const __m256i cmp1 = _mm256_and_si256(cmp1l, cmp1u);
-        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
-        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+template<>
+struct InValuesHelper<double> {
+    using vec_type = __m256d;
+    static constexpr size_t N = 8;
 
-        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    static inline vec_type set1(const double value) {
+        return _mm256_set1_pd(value);
     }
 
-    return true;
-}
+    static inline uint32_t match(const double* const src, const vec_type* const targets, const size_t n_targets) {
+        const __m256d v0 = _mm256_loadu_pd(src + 0);
+        const __m256d v1 = _mm256_loadu_pd(src + 4);
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<float, Op>::op_within_range_column(
+        __m256d cmp0 = _mm256_cmp_pd(v0, targets[0], _CMP_EQ_OQ);
+        __m256d cmp1 = _mm256_cmp_pd(v1, targets[0], _CMP_EQ_OQ);
+        for (size_t j = 1; j < n_targets; j++) {
+            cmp0 = _mm256_or_pd(cmp0, _mm256_cmp_pd(v0, targets[j], _CMP_EQ_OQ));
+            cmp1 = _mm256_or_pd(cmp1, _mm256_cmp_pd(v1, targets[j], _CMP_EQ_OQ));
+        }
+
+        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+        return mmask0 + mmask1 * 16;
+    }
+};
+
+// every value is broadcast into a register, 
+//   then compare masks are OR-ed in a single pass over the data
+template<typename T, InValuesType Op>
+bool op_in_values_impl(
     uint8_t* const __restrict res_u8,
-    const float* const __restrict lower,
-    const float* const __restrict upper,
-    const float* const __restrict values,
-    const size_t size) {
+    const T* const __restrict src, 
+    const size_t size, 
+    const T* const __restrict values,
+    const size_t n_values
+) {
     // the restriction of the API
     assert((size % 8) == 0);
 
+    if (n_values == 0 || n_values > IN_VALUES_MAX_BROADCAST) {
+        return false;
+    }
+
     //
-    constexpr auto pred_lower = ComparePredicate<float, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<float, Range2Compare<Op>::upper>::value;
+    using S = typename InValuesLaneType<T>::signed_type;
+    using helper = InValuesHelper<S>;
+
+    const S* const __restrict src_s = reinterpret_cast<const S*>(src);
+
+    typename helper::vec_type targets[IN_VALUES_MAX_BROADCAST];
+    for (size_t j = 0; j < n_values; j++) {
+        targets[j] = helper::set1(S(values[j]));
+    }
+
+    // the number of elements per a single match()
+    constexpr size_t N = helper::N;
 
     // todo: aligned reads & writes
 
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m256 v0l = _mm256_loadu_ps(lower + i);
-        const __m256 v0u = _mm256_loadu_ps(upper + i);
-        const __m256 v0v = _mm256_loadu_ps(values + i);
-        const __m256 cmpl = _mm256_cmp_ps(v0l, v0v, pred_lower);
-        const __m256 cmpu = _mm256_cmp_ps(v0v, v0u, pred_upper);
-        const __m256 cmp = _mm256_and_ps(cmpl, cmpu);
-        const uint8_t mmask = _mm256_movemask_ps(cmp);
+    // process big blocks
+    const size_t sizeN = (size / N) * N;
+    for (size_t i = 0; i < sizeN; i += N) {
+        const uint32_t mmask = helper::match(src_s + i, targets, n_values);
+        const uint32_t result = (Op == InValuesType::In) ? mmask : ~mmask;
+        memcpy(res_u8 + i / 8, &result, N / 8);
+    }
 
-        res_u8[i / 8] = mmask;
+    // process leftovers, which are possible for 8-bit and 16-bit types only
+    for (size_t i = sizeN; i < size; i += 8) {
+        uint8_t mmask = 0;
+        for (size_t k = 0; k < 8; k++) {
+            mmask |= uint8_t(in_values_linear(src[i + k], values, n_values)) << k;
+        }
+
+        res_u8[i / 8] = (Op == InValuesType::In) ? mmask : uint8_t(~mmask);
     }
 
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
+}
+
+#define DEFINE_OP_IN_VALUES(TTYPE) \
+    template<InValuesType Op> \
+    bool OpInValuesImpl<TTYPE, Op>::op_in_values( \
+        uint8_t* const __restrict res_u8, \
+        const TTYPE* const __restrict src, \
+        const size_t size, \
+        const TTYPE* const __restrict values, \
+        const size_t n_values \
+    ) { \
+        return op_in_values_impl<TTYPE, Op>(res_u8, src, size, values, n_values); \
+    }
+
+DEFINE_OP_IN_VALUES(int8_t)
+DEFINE_OP_IN_VALUES(int16_t)
+DEFINE_OP_IN_VALUES(int32_t)
+DEFINE_OP_IN_VALUES(int64_t)
+DEFINE_OP_IN_VALUES(uint8_t)
+DEFINE_OP_IN_VALUES(uint16_t)
+DEFINE_OP_IN_VALUES(uint32_t)
+DEFINE_OP_IN_VALUES(uint64_t)
+DEFINE_OP_IN_VALUES(float)
+DEFINE_OP_IN_VALUES(double)
+
+#undef DEFINE_OP_IN_VALUES
+
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// AVX2 has no byte-granular masked loads. Strings are stored back to back,
+//   so 32 bytes starting from a string may be loaded unconditionally while
+//   they stay within the bytes of rows [0, size). The remaining rows near
+//   the end are compared using memcmp().
+template<typename OffsetT>
+bool op_prefix_match_impl(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict lower,
-    const double* const __restrict upper,
-    const double* const __restrict values,
-    const size_t size
+    const char* const __restrict data,
+    const OffsetT* const __restrict offsets,
+    const size_t size,
+    const char* const __restrict prefix,
+    const size_t prefix_size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
-    //
-    constexpr auto pred_lower = ComparePredicate<double, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<double, Range2Compare<Op>::upper>::value;
+    // the number of bytes in a register
+    constexpr size_t N = 32;
+    if (prefix_size > N) {
+        return false;
+    }
 
-    // todo: aligned reads & writes
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m256d v0l = _mm256_loadu_pd(lower + i);
-        const __m256d v1l = _mm256_loadu_pd(lower + i + 4);
-        const __m256d v0u = _mm256_loadu_pd(upper + i);
-        const __m256d v1u = _mm256_loadu_pd(upper + i + 4);
-        const __m256d v0v = _mm256_loadu_pd(values + i);
-        const __m256d v1v = _mm256_loadu_pd(values + i + 4);
-        const __m256d cmp0l = _mm256_cmp_pd(v0l, v0v, pred_lower);
-        const __m256d cmp0u = _mm256_cmp_pd(v0v, v0u, pred_upper);
-        const __m256d cmp1l = _mm256_cmp_pd(v1l, v1v, pred_lower);
-        const __m256d cmp1u = _mm256_cmp_pd(v1v, v1u, pred_upper);
-        const __m256d cmp0 = _mm256_and_pd(cmp0l, cmp0u);
-        const __m256d cmp1 = _mm256_and_pd(cmp1l, cmp1u);
-        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
-        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+    // the prefix is padded with zeros
+    char prefix_buf[32] = { 0 };
+    std::memcpy(prefix_buf, prefix, prefix_size);
+    const __m256i target = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prefix_buf));
+    const uint32_t prefix_mask = (prefix_size == 32) ? uint32_t(-1) : ((uint32_t(1) << prefix_size) - 1);
+
+    const OffsetT end = offsets[size];
+
+    for (size_t i = 0; i < size; i += 8) {
+        uint8_t result = 0;
+        for (size_t j = 0; j < 8; j++) {
+            const OffsetT begin = offsets[i + j];
+            const size_t length = static_cast<size_t>(offsets[i + j + 1] - begin);
+            const bool fits = (length >= prefix_size);
+
+            bool match = false;
+            if (begin + OffsetT(N) <= end) [[likely]] {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + begin));
+                const uint32_t eq_mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, target));
+                match = fits && ((~eq_mask & prefix_mask) == 0);
+            } else {
+                match = fits && (std::memcmp(data + begin, prefix, prefix_size) == 0);
+            }
 
-        res_u8[i / 8] = mmask0 + mmask1 * 16;
+            result |= uint8_t(match) << j;
+        }
+
+        res_u8[i / 8] = result;
     }
 
     return true;
 }
 
+}
+
+#define DEFINE_OP_PREFIX_MATCH(OFFSETTYPE) \
+    bool OpPrefixMatchImpl<OFFSETTYPE>::op_prefix_match( \
+        uint8_t* const __restrict res_u8, \
+        const char* const __restrict data, \
+        const OFFSETTYPE* const __restrict offsets, \
+        const size_t size, \
+        const char* const __restrict prefix, \
+        const size_t prefix_size \
+    ) { \
+        return op_prefix_match_impl<OFFSETTYPE>(res_u8, data, offsets, size, prefix, prefix_size); \
+    }
+
+DEFINE_OP_PREFIX_MATCH(int32_t)
+DEFINE_OP_PREFIX_MATCH(int64_t)
+
+#undef DEFINE_OP_PREFIX_MATCH
+
 
 ///////////////////////////////////////////////////////////////////////////
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
+//
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int8_t& lower,
-    const int8_t& upper,
-    const int8_t* const __restrict values,
+    const int8_t* const __restrict left, 
+    const int8_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
@@ -929,17 +996,14 @@ bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
 
     //
     uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
-    const __m256i lower_v = _mm256_set1_epi8(lower);
-    const __m256i upper_v = _mm256_set1_epi8(upper);
 
     // todo: aligned reads & writes
 
     const size_t size32 = (size / 32) * 32;
     for (size_t i = 0; i < size32; i += 32) {
-        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
-        const __m256i cmpl = CmpHelperI8<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const __m256i cmpu = CmpHelperI8<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i cmp = CmpHelperI8<Op>::compare(v0l, v0r);
         const uint32_t mmask = _mm256_movemask_epi8(cmp);
 
         res_u32[i / 32] = mmask;
@@ -954,10 +1018,9 @@ bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
             0
         );
 
-        const __m256i v0v = _mm256_maskload_epi64((const long long*)(values + size32), mask);
-        const __m256i cmpl = CmpHelperI8<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const __m256i cmpu = CmpHelperI8<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const __m256i v0l = _mm256_maskload_epi64((const long long*)(left + size32), mask);
+        const __m256i v0r = _mm256_maskload_epi64((const long long*)(right + size32), mask);
+        const __m256i cmp = CmpHelperI8<Op>::compare(v0l, v0r);
         const uint32_t mmask = _mm256_movemask_epi8(cmp);
 
         if (size - size32 >= 8) {
@@ -974,12 +1037,11 @@ bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int16_t& lower,
-    const int16_t& upper,
-    const int16_t* const __restrict values,
+    const int16_t* const __restrict left, 
+    const int16_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
@@ -987,17 +1049,14 @@ bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
 
     //
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
-    const __m256i lower_v = _mm256_set1_epi16(lower);
-    const __m256i upper_v = _mm256_set1_epi16(upper);
 
     // todo: aligned reads & writes
 
     const size_t size16 = (size / 16) * 16;
     for (size_t i = 0; i < size16; i += 16) {
-        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
-        const __m256i cmpl = CmpHelperI16<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const __m256i cmpu = CmpHelperI16<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i cmp = CmpHelperI16<Op>::compare(v0l, v0r);
         const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
         const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
         const uint16_t mmask = _mm256_movemask_epi8(qcmp);
@@ -1007,12 +1066,9 @@ bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
 
     if (size16 != size) {
         // 8 elements to process
-        const __m128i lower_v1 = _mm_set1_epi16(lower);
-        const __m128i upper_v1 = _mm_set1_epi16(upper);
-        const __m128i v0v = _mm_loadu_si128((const __m128i*)(values + size16));
-        const __m128i cmpl = CmpHelperI16<Range2Compare<Op>::lower>::compare(lower_v1, v0v);
-        const __m128i cmpu = CmpHelperI16<Range2Compare<Op>::upper>::compare(v0v, upper_v1);
-        const __m128i cmp = _mm_and_si128(cmpl, cmpu);
+        const __m128i v0l = _mm_loadu_si128((const __m128i*)(left + size16));
+        const __m128i v0r = _mm_loadu_si128((const __m128i*)(right + size16));
+        const __m128i cmp = CmpHelperI16<Op>::compare(v0l, v0r);
         const __m128i pcmp = _mm_packs_epi16(cmp, cmp);
         const uint32_t mmask = _mm_movemask_epi8(pcmp) & 0xFF;
 
@@ -1022,29 +1078,23 @@ bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int32_t& lower,
-    const int32_t& upper,
-    const int32_t* const __restrict values,
+    const int32_t* const __restrict left, 
+    const int32_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
-    //
-    const __m256i lower_v = _mm256_set1_epi32(lower);
-    const __m256i upper_v = _mm256_set1_epi32(upper);
-
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
-        const __m256i cmpl = CmpHelperI32<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const __m256i cmpu = CmpHelperI32<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i cmp = CmpHelperI32<Op>::compare(v0l, v0r);
         const uint8_t mmask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
 
         res_u8[i / 8] = mmask;
@@ -1053,33 +1103,26 @@ bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int64_t& lower,
-    const int64_t& upper,
-    const int64_t* const __restrict values,
+    const int64_t* const __restrict left, 
+    const int64_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
-    //
-    const __m256i lower_v = _mm256_set1_epi64x(lower);
-    const __m256i upper_v = _mm256_set1_epi64x(upper);
-
     // todo: aligned reads & writes
 
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
-        const __m256i v1v = _mm256_loadu_si256((const __m256i*)(values + i + 4));
-        const __m256i cmp0l = CmpHelperI64<Range2Compare<Op>::lower>::compare(lower_v, v0v);
-        const __m256i cmp0u = CmpHelperI64<Range2Compare<Op>::upper>::compare(v0v, upper_v);
-        const __m256i cmp1l = CmpHelperI64<Range2Compare<Op>::lower>::compare(lower_v, v1v);
-        const __m256i cmp1u = CmpHelperI64<Range2Compare<Op>::upper>::compare(v1v, upper_v);
-        const __m256i cmp0 = _mm256_and_si256(cmp0l, cmp0u);
-        const __m256i cmp1 = _mm256_and_si256(cmp1l, cmp1u);
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i v1l = _mm256_loadu_si256((const __m256i*)(left + i + 4));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i v1r = _mm256_loadu_si256((const __m256i*)(right + i + 4));
+        const __m256i cmp0 = CmpHelperI64<Op>::compare(v0l, v0r);
+        const __m256i cmp1 = CmpHelperI64<Op>::compare(v1l, v1r);
         const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
         const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
 
@@ -1089,187 +1132,1615 @@ bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint8_t, uint8_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const float& lower,
-    const float& upper,
-    const float* const __restrict values,
+    const uint8_t* const __restrict left, 
+    const uint8_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
-    const __m256 lower_v = _mm256_set1_ps(lower);
-    const __m256 upper_v = _mm256_set1_ps(upper);
-    constexpr auto pred_lower = ComparePredicate<float, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<float, Range2Compare<Op>::upper>::value;
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
 
     // todo: aligned reads & writes
 
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m256 v0v = _mm256_loadu_ps(values + i);
-        const __m256 cmpl = _mm256_cmp_ps(lower_v, v0v, pred_lower);
-        const __m256 cmpu = _mm256_cmp_ps(v0v, upper_v, pred_upper);
-        const __m256 cmp = _mm256_and_ps(cmpl, cmpu);
-        const uint8_t mmask = _mm256_movemask_ps(cmp);
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i cmp = CmpHelperU8<Op>::compare(v0l, v0r);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
 
-        res_u8[i / 8] = mmask;
+        res_u32[i / 32] = mmask;
+    }
+
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const __m256i mask = _mm256_setr_epi64x(
+            (size - size32 >= 8) ? (-1) : 0,
+            (size - size32 >= 16) ? (-1) : 0,
+            (size - size32 >= 24) ? (-1) : 0,
+            0
+        );
+
+        const __m256i v0l = _mm256_maskload_epi64((const long long*)(left + size32), mask);
+        const __m256i v0r = _mm256_maskload_epi64((const long long*)(right + size32), mask);
+        const __m256i cmp = CmpHelperU8<Op>::compare(v0l, v0r);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        if (size - size32 >= 8) {
+            res_u8[size32 / 8 + 0] = (mmask & 0xFF);
+        }
+        if (size - size32 >= 16) {
+            res_u8[size32 / 8 + 1] = ((mmask >> 8) & 0xFF);
+        }
+        if (size - size32 >= 24) {
+            res_u8[size32 / 8 + 2] = ((mmask >> 16) & 0xFF);
+        }
     }
 
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint16_t, uint16_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const double& lower,
-    const double& upper,
-    const double* const __restrict values,
+    const uint16_t* const __restrict left, 
+    const uint16_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
 
     //
-    const __m256d lower_v = _mm256_set1_pd(lower);
-    const __m256d upper_v = _mm256_set1_pd(upper);
-    constexpr auto pred_lower = ComparePredicate<double, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<double, Range2Compare<Op>::upper>::value;
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
 
     // todo: aligned reads & writes
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m256d v0v = _mm256_loadu_pd(values + i);
-        const __m256d v1v = _mm256_loadu_pd(values + i + 4);
-        const __m256d cmp0l = _mm256_cmp_pd(lower_v, v0v, pred_lower);
-        const __m256d cmp0u = _mm256_cmp_pd(v0v, upper_v, pred_upper);
-        const __m256d cmp1l = _mm256_cmp_pd(lower_v, v1v, pred_lower);
-        const __m256d cmp1u = _mm256_cmp_pd(v1v, upper_v, pred_upper);
-        const __m256d cmp0 = _mm256_and_pd(cmp0l, cmp0u);
-        const __m256d cmp1 = _mm256_and_pd(cmp1l, cmp1u);
-        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
-        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
 
-        res_u8[i / 8] = mmask0 + mmask1 * 16;
-    }
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i cmp = CmpHelperU16<Op>::compare(v0l, v0r);
+        const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
+        const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
+        const uint16_t mmask = _mm256_movemask_epi8(qcmp);
 
-    return true;
-}
+        res_u16[i / 16] = mmask;
+    }
 
+    if (size16 != size) {
+        // 8 elements to process
+        const __m128i v0l = _mm_loadu_si128((const __m128i*)(left + size16));
+        const __m128i v0r = _mm_loadu_si128((const __m128i*)(right + size16));
+        const __m128i cmp = CmpHelperU16<Op>::compare(v0l, v0r);
+        const __m128i pcmp = _mm_packs_epi16(cmp, cmp);
+        const uint32_t mmask = _mm_movemask_epi8(pcmp) & 0xFF;
 
-///////////////////////////////////////////////////////////////////////////
+        res_u8[size16 / 8] = mmask;
+    }
 
-namespace {
+    return true;
+}
 
-//
-template<ArithOpType Op, CompareOpType CmpOp>
-struct ArithHelperI64 {};
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint32_t, uint32_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict left, 
+    const uint32_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
 
-template<CompareOpType CmpOp>
-struct ArithHelperI64<ArithOpType::Add, CmpOp> {
-    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
-        // left + right ?? value
-        return CmpHelperI64<CmpOp>::compare(_mm256_add_epi64(left, right), value);
-    }
-};
+    // todo: aligned reads & writes
 
-template<CompareOpType CmpOp>
-struct ArithHelperI64<ArithOpType::Sub, CmpOp> {
-    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
-        // left - right ?? value
-        return CmpHelperI64<CmpOp>::compare(_mm256_sub_epi64(left, right), value);
-    }
-};
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i cmp = CmpHelperU32<Op>::compare(v0l, v0r);
+        const uint8_t mmask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
 
-template<CompareOpType CmpOp>
-struct ArithHelperI64<ArithOpType::Mul, CmpOp> {
-    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
-        // left * right ?? value
-        
-        // draft: the code from Agner Fog's vectorclass library
-        const __m256i a = left;
-        const __m256i b = right;
-        const __m256i bswap   = _mm256_shuffle_epi32(b,0xB1);        // swap H<->L
-        const __m256i prodlh  = _mm256_mullo_epi32(a,bswap);         // 32 bit L*H products
-        const __m256i zero    = _mm256_setzero_si256();              // 0
-        const __m256i prodlh2 = _mm256_hadd_epi32(prodlh,zero);      // a0Lb0H+a0Hb0L,a1Lb1H+a1Hb1L,0,0
-        const __m256i prodlh3 = _mm256_shuffle_epi32(prodlh2,0x73);  // 0, a0Lb0H+a0Hb0L, 0, a1Lb1H+a1Hb1L
-        const __m256i prodll  = _mm256_mul_epu32(a,b);               // a0Lb0L,a1Lb1L, 64 bit unsigned products
-        const __m256i prod    = _mm256_add_epi64(prodll,prodlh3);    // a0Lb0L+(a0Lb0H+a0Hb0L)<<32, a1Lb1L+(a1Lb1H+a1Hb1L)<<32
-            
-        return CmpHelperI64<CmpOp>::compare(prod, value);
+        res_u8[i / 8] = mmask;
     }
-};
 
+    return true;
+}
 
-// todo: Mul, Div, Mod
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint64_t, uint64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict left, 
+    const uint64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
 
-//
-template<ArithOpType AOp, CompareOpType CmpOp>
-struct ArithHelperF32 {};
+    // todo: aligned reads & writes
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Add, CmpOp> {
-    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
-        // left + right == value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm256_cmp_ps(_mm256_add_ps(left, right), value, pred);
-    }
-};
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i v1l = _mm256_loadu_si256((const __m256i*)(left + i + 4));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i v1r = _mm256_loadu_si256((const __m256i*)(right + i + 4));
+        const __m256i cmp0 = CmpHelperU64<Op>::compare(v0l, v0r);
+        const __m256i cmp1 = CmpHelperU64<Op>::compare(v1l, v1r);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Sub, CmpOp> {
-    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
-        // left - right == value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm256_cmp_ps(_mm256_sub_ps(left, right), value, pred);
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
     }
-};
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Mul, CmpOp> {
-    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
-        // left * right == value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm256_cmp_ps(_mm256_mul_ps(left, right), value, pred);
-    }
-};
+    return true;
+}
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Div, CmpOp> {
-    static inline __m256 op_special(const __m256 left, const __m256 right, const __m256 value) {
-        // this is valid for the positive denominator, == and != cases.
-        // left == right * value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm256_cmp_ps(left, _mm256_mul_ps(right, value), pred);
-    }
+template<CompareOpType Op>
+bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left, 
+    const float* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
 
-    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
-        // left / right == value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm256_cmp_ps(_mm256_div_ps(left, right), value, pred);
-    }
-};
+    //
+    constexpr auto pred = ComparePredicate<float, Op>::value;
 
-// todo: Mod
+    // todo: aligned reads & writes
 
-//
-template<ArithOpType AOp, CompareOpType CmpOp>
-struct ArithHelperF64 {};
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256 v0l = _mm256_loadu_ps(left + i);
+        const __m256 v0r = _mm256_loadu_ps(right + i);
+        const __m256 cmp = _mm256_cmp_ps(v0l, v0r, pred);
+        const uint8_t mmask = _mm256_movemask_ps(cmp);
 
-template<CompareOpType CmpOp>
-struct ArithHelperF64<ArithOpType::Add, CmpOp> {
-    static inline __m256d op(const __m256d left, const __m256d right, const __m256d value) {
-        // left + right == value
-        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
-        return _mm256_cmp_pd(_mm256_add_pd(left, right), value, pred);
+        res_u8[i / 8] = mmask;
     }
-};
 
-template<CompareOpType CmpOp>
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred = ComparePredicate<double, Op>::value;
+
+    // todo: aligned reads & writes
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256d v0l = _mm256_loadu_pd(left + i);
+        const __m256d v1l = _mm256_loadu_pd(left + i + 4);
+        const __m256d v0r = _mm256_loadu_pd(right + i);
+        const __m256d v1r = _mm256_loadu_pd(right + i + 4);
+        const __m256d cmp0 = _mm256_cmp_pd(v0l, v0r, pred);
+        const __m256d cmp1 = _mm256_cmp_pd(v1l, v1r, pred);
+        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int8_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m128i vl = _mm_loadl_epi64((const __m128i*)(left + i));
+        const __m256i v0l = _mm256_cvtepi8_epi64(vl);
+        const __m256i v1l = _mm256_cvtepi8_epi64(_mm_srli_si128(vl, 4));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i v1r = _mm256_loadu_si256((const __m256i*)(right + i + 4));
+        const __m256i cmp0 = CmpHelperI64<Op>::compare(v0l, v0r);
+        const __m256i cmp1 = CmpHelperI64<Op>::compare(v1l, v1r);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int16_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m128i vl = _mm_loadu_si128((const __m128i*)(left + i));
+        const __m256i v0l = _mm256_cvtepi16_epi64(vl);
+        const __m256i v1l = _mm256_cvtepi16_epi64(_mm_srli_si128(vl, 8));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i v1r = _mm256_loadu_si256((const __m256i*)(right + i + 4));
+        const __m256i cmp0 = CmpHelperI64<Op>::compare(v0l, v0r);
+        const __m256i cmp1 = CmpHelperI64<Op>::compare(v1l, v1r);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0l = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(left + i)));
+        const __m256i v1l = _mm256_cvtepi32_epi64(_mm_loadu_si128((const __m128i*)(left + i + 4)));
+        const __m256i v0r = _mm256_loadu_si256((const __m256i*)(right + i));
+        const __m256i v1r = _mm256_loadu_si256((const __m256i*)(right + i + 4));
+        const __m256i cmp0 = CmpHelperI64<Op>::compare(v0l, v0r);
+        const __m256i cmp1 = CmpHelperI64<Op>::compare(v1l, v1r);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const float* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred = ComparePredicate<float, Op>::value;
+
+    // todo: aligned reads & writes
+
+    // int32_t is rounded to float, the same way as C++ does
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256 v0l = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(left + i)));
+        const __m256 v0r = _mm256_loadu_ps(right + i);
+        const __m256 cmp = _mm256_cmp_ps(v0l, v0r, pred);
+        const uint8_t mmask = _mm256_movemask_ps(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred = ComparePredicate<double, Op>::value;
+
+    // todo: aligned reads & writes
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256d v0l = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*)(left + i)));
+        const __m256d v1l = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*)(left + i + 4)));
+        const __m256d v0r = _mm256_loadu_pd(right + i);
+        const __m256d v1r = _mm256_loadu_pd(right + i + 4);
+        const __m256d cmp0 = _mm256_cmp_pd(v0l, v0r, pred);
+        const __m256d cmp1 = _mm256_cmp_pd(v1l, v1r, pred);
+        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<float, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred = ComparePredicate<double, Op>::value;
+
+    // todo: aligned reads & writes
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256d v0l = _mm256_cvtps_pd(_mm_loadu_ps(left + i));
+        const __m256d v1l = _mm256_cvtps_pd(_mm_loadu_ps(left + i + 4));
+        const __m256d v0r = _mm256_loadu_pd(right + i);
+        const __m256d v1r = _mm256_loadu_pd(right + i + 4);
+        const __m256d cmp0 = _mm256_cmp_pd(v0l, v0r, pred);
+        const __m256d cmp1 = _mm256_cmp_pd(v1l, v1r, pred);
+        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+//
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict lower,
+    const int8_t* const __restrict upper,
+    const int8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
+        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperI8<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmpu = CmpHelperI8<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const __m256i mask = _mm256_setr_epi64x(
+            (size - size32 >= 8) ? (-1) : 0,
+            (size - size32 >= 16) ? (-1) : 0,
+            (size - size32 >= 24) ? (-1) : 0,
+            0
+        );
+
+        const __m256i v0l = _mm256_maskload_epi64((const long long*)(lower + size32), mask);
+        const __m256i v0u = _mm256_maskload_epi64((const long long*)(upper + size32), mask);
+        const __m256i v0v = _mm256_maskload_epi64((const long long*)(values + size32), mask);
+        const __m256i cmpl = CmpHelperI8<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmpu = CmpHelperI8<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        if (size - size32 >= 8) {
+            res_u8[size32 / 8 + 0] = (mmask & 0xFF);
+        }
+        if (size - size32 >= 16) {
+            res_u8[size32 / 8 + 1] = ((mmask >> 8) & 0xFF);
+        }
+        if (size - size32 >= 24) {
+            res_u8[size32 / 8 + 2] = ((mmask >> 16) & 0xFF);
+        }
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict lower,
+    const int16_t* const __restrict upper,
+    const int16_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
+        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperI16<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmpu = CmpHelperI16<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
+        const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
+        const uint16_t mmask = _mm256_movemask_epi8(qcmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const __m128i v0l = _mm_loadu_si128((const __m128i*)(lower + size16));
+        const __m128i v0u = _mm_loadu_si128((const __m128i*)(upper + size16));
+        const __m128i v0v = _mm_loadu_si128((const __m128i*)(values + size16));
+        const __m128i cmpl = CmpHelperI16<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m128i cmpu = CmpHelperI16<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m128i cmp = _mm_and_si128(cmpl, cmpu);
+        const __m128i pcmp = _mm_packs_epi16(cmp, cmp);
+        const uint32_t mmask = _mm_movemask_epi8(pcmp) & 0xFF;
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict lower,
+    const int32_t* const __restrict upper,
+    const int32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
+        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperI32<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmpu = CmpHelperI32<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint8_t mmask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict lower,
+    const int64_t* const __restrict upper,
+    const int64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
+        const __m256i v1l = _mm256_loadu_si256((const __m256i*)(lower + i + 4));
+        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
+        const __m256i v1u = _mm256_loadu_si256((const __m256i*)(upper + i + 4));
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i v1v = _mm256_loadu_si256((const __m256i*)(values + i + 4));
+        const __m256i cmp0l = CmpHelperI64<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmp0u = CmpHelperI64<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp1l = CmpHelperI64<Range2Compare<Op>::lower>::compare(v1l, v1v);
+        const __m256i cmp1u = CmpHelperI64<Range2Compare<Op>::upper>::compare(v1v, v1u);
+        const __m256i cmp0 = _mm256_and_si256(cmp0l, cmp0u);
+        const __m256i cmp1 = _mm256_and_si256(cmp1l, cmp1u);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint8_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint8_t* const __restrict lower,
+    const uint8_t* const __restrict upper,
+    const uint8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
+        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperU8<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmpu = CmpHelperU8<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const __m256i mask = _mm256_setr_epi64x(
+            (size - size32 >= 8) ? (-1) : 0,
+            (size - size32 >= 16) ? (-1) : 0,
+            (size - size32 >= 24) ? (-1) : 0,
+            0
+        );
+
+        const __m256i v0l = _mm256_maskload_epi64((const long long*)(lower + size32), mask);
+        const __m256i v0u = _mm256_maskload_epi64((const long long*)(upper + size32), mask);
+        const __m256i v0v = _mm256_maskload_epi64((const long long*)(values + size32), mask);
+        const __m256i cmpl = CmpHelperU8<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmpu = CmpHelperU8<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        if (size - size32 >= 8) {
+            res_u8[size32 / 8 + 0] = (mmask & 0xFF);
+        }
+        if (size - size32 >= 16) {
+            res_u8[size32 / 8 + 1] = ((mmask >> 8) & 0xFF);
+        }
+        if (size - size32 >= 24) {
+            res_u8[size32 / 8 + 2] = ((mmask >> 16) & 0xFF);
+        }
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint16_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint16_t* const __restrict lower,
+    const uint16_t* const __restrict upper,
+    const uint16_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
+        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperU16<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmpu = CmpHelperU16<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
+        const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
+        const uint16_t mmask = _mm256_movemask_epi8(qcmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const __m128i v0l = _mm_loadu_si128((const __m128i*)(lower + size16));
+        const __m128i v0u = _mm_loadu_si128((const __m128i*)(upper + size16));
+        const __m128i v0v = _mm_loadu_si128((const __m128i*)(values + size16));
+        const __m128i cmpl = CmpHelperU16<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m128i cmpu = CmpHelperU16<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m128i cmp = _mm_and_si128(cmpl, cmpu);
+        const __m128i pcmp = _mm_packs_epi16(cmp, cmp);
+        const uint32_t mmask = _mm_movemask_epi8(pcmp) & 0xFF;
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint32_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict lower,
+    const uint32_t* const __restrict upper,
+    const uint32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
+        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperU32<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmpu = CmpHelperU32<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint8_t mmask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint64_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict lower,
+    const uint64_t* const __restrict upper,
+    const uint64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0l = _mm256_loadu_si256((const __m256i*)(lower + i));
+        const __m256i v1l = _mm256_loadu_si256((const __m256i*)(lower + i + 4));
+        const __m256i v0u = _mm256_loadu_si256((const __m256i*)(upper + i));
+        const __m256i v1u = _mm256_loadu_si256((const __m256i*)(upper + i + 4));
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i v1v = _mm256_loadu_si256((const __m256i*)(values + i + 4));
+        const __m256i cmp0l = CmpHelperU64<Range2Compare<Op>::lower>::compare(v0l, v0v);
+        const __m256i cmp0u = CmpHelperU64<Range2Compare<Op>::upper>::compare(v0v, v0u);
+        const __m256i cmp1l = CmpHelperU64<Range2Compare<Op>::lower>::compare(v1l, v1v);
+        const __m256i cmp1u = CmpHelperU64<Range2Compare<Op>::upper>::compare(v1v, v1u);
+        const __m256i cmp0 = _mm256_and_si256(cmp0l, cmp0u);
+        const __m256i cmp1 = _mm256_and_si256(cmp1l, cmp1u);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<float, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict lower,
+    const float* const __restrict upper,
+    const float* const __restrict values,
+    const size_t size) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred_lower = ComparePredicate<float, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<float, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256 v0l = _mm256_loadu_ps(lower + i);
+        const __m256 v0u = _mm256_loadu_ps(upper + i);
+        const __m256 v0v = _mm256_loadu_ps(values + i);
+        const __m256 cmpl = _mm256_cmp_ps(v0l, v0v, pred_lower);
+        const __m256 cmpu = _mm256_cmp_ps(v0v, v0u, pred_upper);
+        const __m256 cmp = _mm256_and_ps(cmpl, cmpu);
+        const uint8_t mmask = _mm256_movemask_ps(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict lower,
+    const double* const __restrict upper,
+    const double* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    constexpr auto pred_lower = ComparePredicate<double, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<double, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256d v0l = _mm256_loadu_pd(lower + i);
+        const __m256d v1l = _mm256_loadu_pd(lower + i + 4);
+        const __m256d v0u = _mm256_loadu_pd(upper + i);
+        const __m256d v1u = _mm256_loadu_pd(upper + i + 4);
+        const __m256d v0v = _mm256_loadu_pd(values + i);
+        const __m256d v1v = _mm256_loadu_pd(values + i + 4);
+        const __m256d cmp0l = _mm256_cmp_pd(v0l, v0v, pred_lower);
+        const __m256d cmp0u = _mm256_cmp_pd(v0v, v0u, pred_upper);
+        const __m256d cmp1l = _mm256_cmp_pd(v1l, v1v, pred_lower);
+        const __m256d cmp1u = _mm256_cmp_pd(v1v, v1u, pred_upper);
+        const __m256d cmp0 = _mm256_and_pd(cmp0l, cmp0u);
+        const __m256d cmp1 = _mm256_and_pd(cmp1l, cmp1u);
+        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int8_t& lower,
+    const int8_t& upper,
+    const int8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+    const __m256i lower_v = _mm256_set1_epi8(lower);
+    const __m256i upper_v = _mm256_set1_epi8(upper);
+
+    // todo: aligned reads & writes
+
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperI8<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmpu = CmpHelperI8<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const __m256i mask = _mm256_setr_epi64x(
+            (size - size32 >= 8) ? (-1) : 0,
+            (size - size32 >= 16) ? (-1) : 0,
+            (size - size32 >= 24) ? (-1) : 0,
+            0
+        );
+
+        const __m256i v0v = _mm256_maskload_epi64((const long long*)(values + size32), mask);
+        const __m256i cmpl = CmpHelperI8<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmpu = CmpHelperI8<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        if (size - size32 >= 8) {
+            res_u8[size32 / 8 + 0] = (mmask & 0xFF);
+        }
+        if (size - size32 >= 16) {
+            res_u8[size32 / 8 + 1] = ((mmask >> 8) & 0xFF);
+        }
+        if (size - size32 >= 24) {
+            res_u8[size32 / 8 + 2] = ((mmask >> 16) & 0xFF);
+        }
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int16_t& lower,
+    const int16_t& upper,
+    const int16_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+    const __m256i lower_v = _mm256_set1_epi16(lower);
+    const __m256i upper_v = _mm256_set1_epi16(upper);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperI16<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmpu = CmpHelperI16<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
+        const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
+        const uint16_t mmask = _mm256_movemask_epi8(qcmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const __m128i lower_v1 = _mm_set1_epi16(lower);
+        const __m128i upper_v1 = _mm_set1_epi16(upper);
+        const __m128i v0v = _mm_loadu_si128((const __m128i*)(values + size16));
+        const __m128i cmpl = CmpHelperI16<Range2Compare<Op>::lower>::compare(lower_v1, v0v);
+        const __m128i cmpu = CmpHelperI16<Range2Compare<Op>::upper>::compare(v0v, upper_v1);
+        const __m128i cmp = _mm_and_si128(cmpl, cmpu);
+        const __m128i pcmp = _mm_packs_epi16(cmp, cmp);
+        const uint32_t mmask = _mm_movemask_epi8(pcmp) & 0xFF;
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int32_t& lower,
+    const int32_t& upper,
+    const int32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const __m256i lower_v = _mm256_set1_epi32(lower);
+    const __m256i upper_v = _mm256_set1_epi32(upper);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperI32<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmpu = CmpHelperI32<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint8_t mmask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int64_t& lower,
+    const int64_t& upper,
+    const int64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const __m256i lower_v = _mm256_set1_epi64x(lower);
+    const __m256i upper_v = _mm256_set1_epi64x(upper);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i v1v = _mm256_loadu_si256((const __m256i*)(values + i + 4));
+        const __m256i cmp0l = CmpHelperI64<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmp0u = CmpHelperI64<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp1l = CmpHelperI64<Range2Compare<Op>::lower>::compare(lower_v, v1v);
+        const __m256i cmp1u = CmpHelperI64<Range2Compare<Op>::upper>::compare(v1v, upper_v);
+        const __m256i cmp0 = _mm256_and_si256(cmp0l, cmp0u);
+        const __m256i cmp1 = _mm256_and_si256(cmp1l, cmp1u);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint8_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint8_t& lower,
+    const uint8_t& upper,
+    const uint8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8);
+    const __m256i lower_v = _mm256_set1_epi8(lower);
+    const __m256i upper_v = _mm256_set1_epi8(upper);
+
+    // todo: aligned reads & writes
+
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperU8<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmpu = CmpHelperU8<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        res_u32[i / 32] = mmask;
+    }
+
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const __m256i mask = _mm256_setr_epi64x(
+            (size - size32 >= 8) ? (-1) : 0,
+            (size - size32 >= 16) ? (-1) : 0,
+            (size - size32 >= 24) ? (-1) : 0,
+            0
+        );
+
+        const __m256i v0v = _mm256_maskload_epi64((const long long*)(values + size32), mask);
+        const __m256i cmpl = CmpHelperU8<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmpu = CmpHelperU8<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint32_t mmask = _mm256_movemask_epi8(cmp);
+
+        if (size - size32 >= 8) {
+            res_u8[size32 / 8 + 0] = (mmask & 0xFF);
+        }
+        if (size - size32 >= 16) {
+            res_u8[size32 / 8 + 1] = ((mmask >> 8) & 0xFF);
+        }
+        if (size - size32 >= 24) {
+            res_u8[size32 / 8 + 2] = ((mmask >> 16) & 0xFF);
+        }
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint16_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint16_t& lower,
+    const uint16_t& upper,
+    const uint16_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+    const __m256i lower_v = _mm256_set1_epi16(lower);
+    const __m256i upper_v = _mm256_set1_epi16(upper);
+
+    // todo: aligned reads & writes
+
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperU16<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmpu = CmpHelperU16<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const __m256i pcmp = _mm256_packs_epi16(cmp, cmp);
+        const __m256i qcmp = _mm256_permute4x64_epi64(pcmp, _MM_SHUFFLE(3, 1, 2, 0));
+        const uint16_t mmask = _mm256_movemask_epi8(qcmp);
+
+        res_u16[i / 16] = mmask;
+    }
+
+    if (size16 != size) {
+        // 8 elements to process
+        const __m128i lower_v1 = _mm_set1_epi16(lower);
+        const __m128i upper_v1 = _mm_set1_epi16(upper);
+        const __m128i v0v = _mm_loadu_si128((const __m128i*)(values + size16));
+        const __m128i cmpl = CmpHelperU16<Range2Compare<Op>::lower>::compare(lower_v1, v0v);
+        const __m128i cmpu = CmpHelperU16<Range2Compare<Op>::upper>::compare(v0v, upper_v1);
+        const __m128i cmp = _mm_and_si128(cmpl, cmpu);
+        const __m128i pcmp = _mm_packs_epi16(cmp, cmp);
+        const uint32_t mmask = _mm_movemask_epi8(pcmp) & 0xFF;
+
+        res_u8[size16 / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint32_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint32_t& lower,
+    const uint32_t& upper,
+    const uint32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const __m256i lower_v = _mm256_set1_epi32(lower);
+    const __m256i upper_v = _mm256_set1_epi32(upper);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i cmpl = CmpHelperU32<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmpu = CmpHelperU32<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp = _mm256_and_si256(cmpl, cmpu);
+        const uint8_t mmask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint64_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint64_t& lower,
+    const uint64_t& upper,
+    const uint64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const __m256i lower_v = _mm256_set1_epi64x(lower);
+    const __m256i upper_v = _mm256_set1_epi64x(upper);
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256i v0v = _mm256_loadu_si256((const __m256i*)(values + i));
+        const __m256i v1v = _mm256_loadu_si256((const __m256i*)(values + i + 4));
+        const __m256i cmp0l = CmpHelperU64<Range2Compare<Op>::lower>::compare(lower_v, v0v);
+        const __m256i cmp0u = CmpHelperU64<Range2Compare<Op>::upper>::compare(v0v, upper_v);
+        const __m256i cmp1l = CmpHelperU64<Range2Compare<Op>::lower>::compare(lower_v, v1v);
+        const __m256i cmp1u = CmpHelperU64<Range2Compare<Op>::upper>::compare(v1v, upper_v);
+        const __m256i cmp0 = _mm256_and_si256(cmp0l, cmp0u);
+        const __m256i cmp1 = _mm256_and_si256(cmp1l, cmp1u);
+        const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+        const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const float& lower,
+    const float& upper,
+    const float* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const __m256 lower_v = _mm256_set1_ps(lower);
+    const __m256 upper_v = _mm256_set1_ps(upper);
+    constexpr auto pred_lower = ComparePredicate<float, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<float, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256 v0v = _mm256_loadu_ps(values + i);
+        const __m256 cmpl = _mm256_cmp_ps(lower_v, v0v, pred_lower);
+        const __m256 cmpu = _mm256_cmp_ps(v0v, upper_v, pred_upper);
+        const __m256 cmp = _mm256_and_ps(cmpl, cmpu);
+        const uint8_t mmask = _mm256_movemask_ps(cmp);
+
+        res_u8[i / 8] = mmask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const double& lower,
+    const double& upper,
+    const double* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    const __m256d lower_v = _mm256_set1_pd(lower);
+    const __m256d upper_v = _mm256_set1_pd(upper);
+    constexpr auto pred_lower = ComparePredicate<double, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<double, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m256d v0v = _mm256_loadu_pd(values + i);
+        const __m256d v1v = _mm256_loadu_pd(values + i + 4);
+        const __m256d cmp0l = _mm256_cmp_pd(lower_v, v0v, pred_lower);
+        const __m256d cmp0u = _mm256_cmp_pd(v0v, upper_v, pred_upper);
+        const __m256d cmp1l = _mm256_cmp_pd(lower_v, v1v, pred_lower);
+        const __m256d cmp1u = _mm256_cmp_pd(v1v, upper_v, pred_upper);
+        const __m256d cmp0 = _mm256_and_pd(cmp0l, cmp0u);
+        const __m256d cmp1 = _mm256_and_pd(cmp1l, cmp1u);
+        const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+        const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+
+        res_u8[i / 8] = mmask0 + mmask1 * 16;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// the code from Agner Fog's vectorclass library
+inline __m256i mullo_epi64(const __m256i a, const __m256i b) {
+    const __m256i bswap   = _mm256_shuffle_epi32(b,0xB1);        // swap H<->L
+    const __m256i prodlh  = _mm256_mullo_epi32(a,bswap);         // 32 bit L*H products
+    const __m256i zero    = _mm256_setzero_si256();              // 0
+    const __m256i prodlh2 = _mm256_hadd_epi32(prodlh,zero);      // a0Lb0H+a0Hb0L,a1Lb1H+a1Hb1L,0,0
+    const __m256i prodlh3 = _mm256_shuffle_epi32(prodlh2,0x73);  // 0, a0Lb0H+a0Hb0L, 0, a1Lb1H+a1Hb1L
+    const __m256i prodll  = _mm256_mul_epu32(a,b);               // a0Lb0L,a1Lb1L, 64 bit unsigned products
+    const __m256i prod    = _mm256_add_epi64(prodll,prodlh3);    // a0Lb0L+(a0Lb0H+a0Hb0L)<<32, a1Lb1L+(a1Lb1H+a1Hb1L)<<32
+    return prod;
+}
+
+// a broadcasted DivisorI64
+struct DivisorVecI64 {
+    DivisorI64 d;
+
+    __m256i divisor;
+    __m256i magic;
+    __m256i magic_hi;
+    // -1 if magic is negative, 0 otherwise
+    __m256i magic_sign;
+    // -1 if the divisor is negative, 0 otherwise
+    __m256i sign;
+    // -1 if the numerator needs to be added, 0 otherwise
+    __m256i add;
+    // 2^shift - 1
+    __m256i mask;
+    // 2^63 >> shift, used for the arithmetic shift emulation
+    __m256i shifted_sign_bit;
+    __m128i shift;
+
+    explicit DivisorVecI64(const int64_t right) : d{right} {
+        divisor = _mm256_set1_epi64x(d.divisor);
+        magic = _mm256_set1_epi64x(d.magic);
+        magic_hi = _mm256_srli_epi64(magic, 32);
+        magic_sign = _mm256_set1_epi64x((d.magic < 0) ? -1 : 0);
+        sign = _mm256_set1_epi64x(d.negative ? -1 : 0);
+        add = _mm256_set1_epi64x(d.add ? -1 : 0);
+        mask = _mm256_set1_epi64x((uint64_t(1) << d.shift) - 1);
+        shifted_sign_bit = _mm256_set1_epi64x((uint64_t(1) << 63) >> d.shift);
+        shift = _mm_set_epi64x(0, d.shift);
+    }
+
+    // AVX2 has no 64-bit arithmetic shift
+    inline __m256i sra(const __m256i x) const {
+        const __m256i t = _mm256_srl_epi64(x, shift);
+        return _mm256_sub_epi64(_mm256_xor_si256(t, shifted_sign_bit), shifted_sign_bit);
+    }
+
+    // signed high 64 bits of x * magic
+    inline __m256i mulhi(const __m256i x) const {
+        const __m256i x_hi = _mm256_srli_epi64(x, 32);
+
+        const __m256i ll = _mm256_mul_epu32(x, magic);
+        const __m256i lh = _mm256_mul_epu32(x, magic_hi);
+        const __m256i hl = _mm256_mul_epu32(x_hi, magic);
+        const __m256i hh = _mm256_mul_epu32(x_hi, magic_hi);
+
+        const __m256i t = _mm256_add_epi64(hl, _mm256_srli_epi64(ll, 32));
+        const __m256i u = _mm256_add_epi64(lh, _mm256_and_si256(t, _mm256_set1_epi64x(0xFFFFFFFF)));
+        const __m256i hi_u = _mm256_add_epi64(
+            _mm256_add_epi64(hh, _mm256_srli_epi64(t, 32)), 
+            _mm256_srli_epi64(u, 32)
+        );
+
+        // convert from unsigned to signed
+        const __m256i x_sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+        const __m256i corr = _mm256_add_epi64(
+            _mm256_and_si256(x_sign, magic),
+            _mm256_and_si256(magic_sign, x)
+        );
+        return _mm256_sub_epi64(hi_u, corr);
+    }
+
+    // x / divisor, truncated
+    inline __m256i divide(const __m256i x) const {
+        if (d.magic == 0) {
+            // +-2^shift
+            const __m256i x_sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), x);
+            const __m256i bias = _mm256_and_si256(x_sign, mask);
+            const __m256i q = sra(_mm256_add_epi64(x, bias));
+            return _mm256_sub_epi64(_mm256_xor_si256(q, sign), sign);
+        } else {
+            const __m256i hi = mulhi(x);
+            const __m256i x_signed = _mm256_sub_epi64(_mm256_xor_si256(x, sign), sign);
+            const __m256i uq = _mm256_add_epi64(hi, _mm256_and_si256(x_signed, add));
+            const __m256i q = sra(uq);
+            return _mm256_add_epi64(q, _mm256_srli_epi64(q, 63));
+        }
+    }
+
+    // x % divisor, the sign follows x
+    inline __m256i modulo(const __m256i x) const {
+        return _mm256_sub_epi64(x, mullo_epi64(divide(x), divisor));
+    }
+};
+
+// Div and Mod use a precomputed divisor instead of a plain value
+template<ArithOpType AOp>
+struct ArithOperandI64 {
+    static inline __m256i make(const int64_t right) {
+        return _mm256_set1_epi64x(right);
+    }
+};
+
+template<>
+struct ArithOperandI64<ArithOpType::Div> {
+    static inline DivisorVecI64 make(const int64_t right) {
+        return DivisorVecI64(right);
+    }
+};
+
+template<>
+struct ArithOperandI64<ArithOpType::Mod> {
+    static inline DivisorVecI64 make(const int64_t right) {
+        return DivisorVecI64(right);
+    }
+};
+
+//
+template<ArithOpType Op, CompareOpType CmpOp>
+struct ArithHelperI64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Add, CmpOp> {
+    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
+        // left + right ?? value
+        return CmpHelperI64<CmpOp>::compare(_mm256_add_epi64(left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Sub, CmpOp> {
+    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
+        // left - right ?? value
+        return CmpHelperI64<CmpOp>::compare(_mm256_sub_epi64(left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Mul, CmpOp> {
+    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
+        // left * right ?? value
+        return CmpHelperI64<CmpOp>::compare(mullo_epi64(left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Div, CmpOp> {
+    static inline __m256i op(const __m256i left, const DivisorVecI64& right, const __m256i value) {
+        // left / right ?? value
+        return CmpHelperI64<CmpOp>::compare(right.divide(left), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Mod, CmpOp> {
+    static inline __m256i op(const __m256i left, const DivisorVecI64& right, const __m256i value) {
+        // left % right ?? value
+        return CmpHelperI64<CmpOp>::compare(right.modulo(left), value);
+    }
+};
+
+// uint64_t uses the modular arithmetic, so only the comparison differs
+template<ArithOpType Op, CompareOpType CmpOp>
+struct ArithHelperU64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Add, CmpOp> {
+    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
+        // left + right ?? value
+        return CmpHelperU64<CmpOp>::compare(_mm256_add_epi64(left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Sub, CmpOp> {
+    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
+        // left - right ?? value
+        return CmpHelperU64<CmpOp>::compare(_mm256_sub_epi64(left, right), value);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Mul, CmpOp> {
+    static inline __m256i op(const __m256i left, const __m256i right, const __m256i value) {
+        // left * right ?? value
+        return CmpHelperU64<CmpOp>::compare(mullo_epi64(left, right), value);
+    }
+};
+
+// std::fmod(x, y), bit for bit.
+// x - trunc(x / y) * y is computed exactly with fma, if trunc(x / y) is exact
+//   and is wrong by 1 at most, which is the case for |x / y| < 2^51 (2^22 for floats).
+//   Such a quotient is fixed by looking at the sign and the magnitude of the remainder.
+// |x| < |y| case returns x, this also handles y = +-inf.
+// The rest of lanes (NaN, Inf, zero divisor, huge quotients) are rare and
+//   are processed with std::fmod.
+inline __m256d fmod_pd(const __m256d x, const __m256d y) {
+    const __m256d sign_bit = _mm256_set1_pd(-0.0);
+    const __m256d zero = _mm256_setzero_pd();
+
+    const __m256d abs_x = _mm256_andnot_pd(sign_bit, x);
+    const __m256d abs_y = _mm256_andnot_pd(sign_bit, y);
+
+    const __m256d q = _mm256_round_pd(
+        _mm256_div_pd(x, y), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m256d r0 = _mm256_fnmadd_pd(q, y, x);
+
+    // +1 or -1, the sign of the quotient
+    const __m256d s = _mm256_or_pd(
+        _mm256_and_pd(_mm256_xor_pd(x, y), sign_bit), _mm256_set1_pd(1.0));
+
+    // the quotient is too small or too large by 1
+    const __m256d too_small = _mm256_cmp_pd(_mm256_andnot_pd(sign_bit, r0), abs_y, _CMP_GE_OQ);
+    const __m256i diff_sign = _mm256_shuffle_epi32(
+        _mm256_srai_epi32(_mm256_castpd_si256(_mm256_xor_pd(r0, x)), 31), 0xF5);
+    const __m256d too_large = _mm256_and_pd(
+        _mm256_castsi256_pd(diff_sign), _mm256_cmp_pd(r0, zero, _CMP_NEQ_OQ));
+    const __m256d q1 = _mm256_sub_pd(
+        _mm256_add_pd(q, _mm256_and_pd(too_small, s)), _mm256_and_pd(too_large, s));
+
+    // the sign of the remainder is the sign of x, including zeros
+    const __m256d r1 = _mm256_fnmadd_pd(q1, y, x);
+    const __m256d r = _mm256_or_pd(
+        _mm256_andnot_pd(sign_bit, r1), _mm256_and_pd(sign_bit, x));
+
+    const __m256d is_small = _mm256_cmp_pd(abs_x, abs_y, _CMP_LT_OQ);
+    const __m256d is_fast = _mm256_cmp_pd(
+        _mm256_andnot_pd(sign_bit, q), _mm256_set1_pd(2251799813685248.0), _CMP_LT_OQ);
+    const __m256d result = _mm256_blendv_pd(r, x, is_small);
+
+    const int is_slow = (~_mm256_movemask_pd(_mm256_or_pd(is_small, is_fast))) & 0xF;
+    if (is_slow == 0) {
+        return result;
+    }
+
+    double x_s[4];
+    double y_s[4];
+    double result_s[4];
+    _mm256_storeu_pd(x_s, x);
+    _mm256_storeu_pd(y_s, y);
+    _mm256_storeu_pd(result_s, result);
+    for (size_t i = 0; i < 4; i++) {
+        if (is_slow & (1 << i)) {
+            result_s[i] = std::fmod(x_s[i], y_s[i]);
+        }
+    }
+
+    return _mm256_loadu_pd(result_s);
+}
+
+inline __m256 fmod_ps(const __m256 x, const __m256 y) {
+    const __m256 sign_bit = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+
+    const __m256 abs_x = _mm256_andnot_ps(sign_bit, x);
+    const __m256 abs_y = _mm256_andnot_ps(sign_bit, y);
+
+    const __m256 q = _mm256_round_ps(
+        _mm256_div_ps(x, y), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m256 r0 = _mm256_fnmadd_ps(q, y, x);
+
+    // +1 or -1, the sign of the quotient
+    const __m256 s = _mm256_or_ps(
+        _mm256_and_ps(_mm256_xor_ps(x, y), sign_bit), _mm256_set1_ps(1.0f));
+
+    // the quotient is too small or too large by 1
+    const __m256 too_small = _mm256_cmp_ps(_mm256_andnot_ps(sign_bit, r0), abs_y, _CMP_GE_OQ);
+    const __m256i diff_sign = _mm256_srai_epi32(_mm256_castps_si256(_mm256_xor_ps(r0, x)), 31);
+    const __m256 too_large = _mm256_and_ps(
+        _mm256_castsi256_ps(diff_sign), _mm256_cmp_ps(r0, zero, _CMP_NEQ_OQ));
+    const __m256 q1 = _mm256_sub_ps(
+        _mm256_add_ps(q, _mm256_and_ps(too_small, s)), _mm256_and_ps(too_large, s));
+
+    // the sign of the remainder is the sign of x, including zeros
+    const __m256 r1 = _mm256_fnmadd_ps(q1, y, x);
+    const __m256 r = _mm256_or_ps(
+        _mm256_andnot_ps(sign_bit, r1), _mm256_and_ps(sign_bit, x));
+
+    const __m256 is_small = _mm256_cmp_ps(abs_x, abs_y, _CMP_LT_OQ);
+    const __m256 is_fast = _mm256_cmp_ps(
+        _mm256_andnot_ps(sign_bit, q), _mm256_set1_ps(4194304.0f), _CMP_LT_OQ);
+    const __m256 result = _mm256_blendv_ps(r, x, is_small);
+
+    const int is_slow = (~_mm256_movemask_ps(_mm256_or_ps(is_small, is_fast))) & 0xFF;
+    if (is_slow == 0) {
+        return result;
+    }
+
+    float x_s[8];
+    float y_s[8];
+    float result_s[8];
+    _mm256_storeu_ps(x_s, x);
+    _mm256_storeu_ps(y_s, y);
+    _mm256_storeu_ps(result_s, result);
+    for (size_t i = 0; i < 8; i++) {
+        if (is_slow & (1 << i)) {
+            result_s[i] = std::fmod(x_s[i], y_s[i]);
+        }
+    }
+
+    return _mm256_loadu_ps(result_s);
+}
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperF32 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Add, CmpOp> {
+    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
+        // left + right == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm256_cmp_ps(_mm256_add_ps(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Sub, CmpOp> {
+    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
+        // left - right == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm256_cmp_ps(_mm256_sub_ps(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Mul, CmpOp> {
+    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
+        // left * right == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm256_cmp_ps(_mm256_mul_ps(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Div, CmpOp> {
+    static inline __m256 op_special(const __m256 left, const __m256 right, const __m256 value) {
+        // this is valid for the positive denominator, == and != cases.
+        // left == right * value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm256_cmp_ps(left, _mm256_mul_ps(right, value), pred);
+    }
+
+    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
+        // left / right == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm256_cmp_ps(_mm256_div_ps(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Mod, CmpOp> {
+    static inline __m256 op(const __m256 left, const __m256 right, const __m256 value) {
+        // fmod(left, right) == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm256_cmp_ps(fmod_ps(left, right), value, pred);
+    }
+};
+
+// todo: Mod
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperF64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Add, CmpOp> {
+    static inline __m256d op(const __m256d left, const __m256d right, const __m256d value) {
+        // left + right == value
+        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
+        return _mm256_cmp_pd(_mm256_add_pd(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
 struct ArithHelperF64<ArithOpType::Sub, CmpOp> {
     static inline __m256d op(const __m256d left, const __m256d right, const __m256d value) {
         // left - right == value
@@ -1303,39 +2774,322 @@ struct ArithHelperF64<ArithOpType::Div, CmpOp> {
     }
 };
 
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Mod, CmpOp> {
+    static inline __m256d op(const __m256d left, const __m256d right, const __m256d value) {
+        // fmod(left, right) == value
+        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
+        return _mm256_cmp_pd(fmod_pd(left, right), value, pred);
+    }
+};
+
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict src,
+    const ArithHighPrecisionType<int8_t>& right_operand,
+    const ArithHighPrecisionType<int8_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m256i value_v = _mm256_set1_epi64x(value);
+        const uint64_t* const __restrict src_u64 = reinterpret_cast<const uint64_t*>(src);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const uint64_t v = src_u64[i / 8];
+            const __m256i v0s = _mm256_cvtepi8_epi64(_mm_set_epi64x(0, v));
+            const __m256i v1s = _mm256_cvtepi8_epi64(_mm_set_epi64x(0, v >> 32));
+            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+            res_u8[i / 8] = mmask0 + mmask1 * 16;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict src,
+    const ArithHighPrecisionType<int16_t>& right_operand,
+    const ArithHighPrecisionType<int16_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m256i value_v = _mm256_set1_epi64x(value);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const __m128i vs = _mm_loadu_si128((const __m128i*)(src + i));
+            const __m256i v0s = _mm256_cvtepi16_epi64(vs);
+            const __m128i v1sr = _mm_set_epi64x(0, _mm_extract_epi64(vs, 1));
+            const __m256i v1s = _mm256_cvtepi16_epi64(v1sr);
+            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+            res_u8[i / 8] = mmask0 + mmask1 * 16;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict src,
+    const ArithHighPrecisionType<int32_t>& right_operand,
+    const ArithHighPrecisionType<int32_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m256i value_v = _mm256_set1_epi64x(value);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i));
+            const __m256i v0s = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(vs, 0));
+            const __m256i v1s = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(vs, 1));
+            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+            res_u8[i / 8] = mmask0 + mmask1 * 16;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict src,
+    const ArithHighPrecisionType<int64_t>& right_operand,
+    const ArithHighPrecisionType<int64_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m256i value_v = _mm256_set1_epi64x(value);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const __m256i v0s = _mm256_loadu_si256((const __m256i*)(src + i));
+            const __m256i v1s = _mm256_loadu_si256((const __m256i*)(src + i + 4));
+            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+            res_u8[i / 8] = mmask0 + mmask1 * 16;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint8_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint8_t* const __restrict src,
+    const ArithHighPrecisionType<uint8_t>& right_operand,
+    const ArithHighPrecisionType<uint8_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m256i value_v = _mm256_set1_epi64x(value);
+        const uint64_t* const __restrict src_u64 = reinterpret_cast<const uint64_t*>(src);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const uint64_t v = src_u64[i / 8];
+            const __m256i v0s = _mm256_cvtepu8_epi64(_mm_set_epi64x(0, v));
+            const __m256i v1s = _mm256_cvtepu8_epi64(_mm_set_epi64x(0, v >> 32));
+            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+            res_u8[i / 8] = mmask0 + mmask1 * 16;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint16_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint16_t* const __restrict src,
+    const ArithHighPrecisionType<uint16_t>& right_operand,
+    const ArithHighPrecisionType<uint16_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m256i value_v = _mm256_set1_epi64x(value);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const __m128i vs = _mm_loadu_si128((const __m128i*)(src + i));
+            const __m256i v0s = _mm256_cvtepu16_epi64(vs);
+            const __m128i v1sr = _mm_set_epi64x(0, _mm_extract_epi64(vs, 1));
+            const __m256i v1s = _mm256_cvtepu16_epi64(v1sr);
+            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+            res_u8[i / 8] = mmask0 + mmask1 * 16;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint32_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict src,
+    const ArithHighPrecisionType<uint32_t>& right_operand,
+    const ArithHighPrecisionType<uint32_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m256i value_v = _mm256_set1_epi64x(value);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i));
+            const __m256i v0s = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(vs, 0));
+            const __m256i v1s = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(vs, 1));
+            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
+            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+
+            res_u8[i / 8] = mmask0 + mmask1 * 16;
+        }
+
+        return true;
+    }
 }
 
-// todo: Mul, Div, Mod
-
 template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
+bool OpArithCompareImpl<uint64_t, AOp, CmpOp>::op_arith_compare(
     uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict src,
-    const ArithHighPrecisionType<int8_t>& right_operand,
-    const ArithHighPrecisionType<int8_t>& value,
+    const uint64_t* const __restrict src,
+    const ArithHighPrecisionType<uint64_t>& right_operand,
+    const ArithHighPrecisionType<uint64_t>& value,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
+    if constexpr (AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
+        // there is no fast unsigned 64-bit division, 
+        //   so leave it to the reference implementation
         return false;
     } else {
         // the restriction of the API
         assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+        static_assert(std::is_same_v<uint64_t, ArithHighPrecisionType<uint64_t>>);
 
         //
         const __m256i right_v = _mm256_set1_epi64x(right_operand);
         const __m256i value_v = _mm256_set1_epi64x(value);
-        const uint64_t* const __restrict src_u64 = reinterpret_cast<const uint64_t*>(src);
 
         // todo: aligned reads & writes
 
         const size_t size8 = (size / 8) * 8;
         for (size_t i = 0; i < size8; i += 8) {
-            const uint64_t v = src_u64[i / 8];
-            const __m256i v0s = _mm256_cvtepi8_epi64(_mm_set_epi64x(0, v));
-            const __m256i v1s = _mm256_cvtepi8_epi64(_mm_set_epi64x(0, v >> 32));
-            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
-            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const __m256i v0s = _mm256_loadu_si256((const __m256i*)(src + i));
+            const __m256i v1s = _mm256_loadu_si256((const __m256i*)(src + i + 4));
+            const __m256i cmp0 = ArithHelperU64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256i cmp1 = ArithHelperU64<AOp, CmpOp>::op(v1s, right_v, value_v);
             const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
             const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
 
@@ -1346,269 +3100,951 @@ bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict src,
-    const ArithHighPrecisionType<int16_t>& right_operand,
-    const ArithHighPrecisionType<int16_t>& value,
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<float, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict src,
+    const ArithHighPrecisionType<float>& right_operand,
+    const ArithHighPrecisionType<float>& value,
+    const size_t size
+) {
+    if constexpr (AOp == ArithOpType::Div) {
+        if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
+            // a special case that allows faster processing by using the multiplication
+            //   operation instead of the division one.
+
+            // the restriction of the API
+            assert((size % 8) == 0);
+
+            //
+            const __m256 right_v = _mm256_set1_ps(right_operand);
+            const __m256 value_v = _mm256_set1_ps(value);
+
+            // todo: aligned reads & writes
+
+            const size_t size8 = (size / 8) * 8;
+            for (size_t i = 0; i < size8; i += 8) {
+                const __m256 v0s = _mm256_loadu_ps(src + i);
+                const __m256 cmp = ArithHelperF32<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+                const uint8_t mmask = _mm256_movemask_ps(cmp);
+
+                res_u8[i / 8] = mmask;
+            }
+
+            return true;
+        } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
+            // flip signs and go for the multiplication case
+            return OpArithCompareImpl<float, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
+                res_u8, src, -right_operand, -value, size
+            );
+        }
+
+        // go with the default case
+    }
+
+    // a default case
+    {
+        // the restriction of the API
+        assert((size % 8) == 0);
+
+        //
+        const __m256 right_v = _mm256_set1_ps(right_operand);
+        const __m256 value_v = _mm256_set1_ps(value);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const __m256 v0s = _mm256_loadu_ps(src + i);
+            const __m256 cmp = ArithHelperF32<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const uint8_t mmask = _mm256_movemask_ps(cmp);
+
+            res_u8[i / 8] = mmask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<double, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict src,
+    const ArithHighPrecisionType<double>& right_operand,
+    const ArithHighPrecisionType<double>& value,
+    const size_t size
+) {
+    if constexpr (AOp == ArithOpType::Div) {
+        if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
+            // a special case that allows faster processing by using the multiplication
+            //   operation instead of the division one.
+
+            // the restriction of the API
+            assert((size % 8) == 0);
+
+            //
+            const __m256d right_v = _mm256_set1_pd(right_operand);
+            const __m256d value_v = _mm256_set1_pd(value);
+
+            // todo: aligned reads & writes
+
+            const size_t size8 = (size / 8) * 8;
+            for (size_t i = 0; i < size8; i += 8) {
+                const __m256d v0s = _mm256_loadu_pd(src + i);
+                const __m256d v1s = _mm256_loadu_pd(src + i + 4);
+                const __m256d cmp0 = ArithHelperF64<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+                const __m256d cmp1 = ArithHelperF64<AOp, CmpOp>::op_special(v1s, right_v, value_v);
+                const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+                const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+
+                res_u8[i / 8] = mmask0 + mmask1 * 16;
+            }
+
+            return true;
+        } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
+            // flip signs and go for the multiplication case
+            return OpArithCompareImpl<double, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
+                res_u8, src, -right_operand, -value, size
+            );
+        }
+
+        // go with the default case
+    }
+
+    // a default case
+    {
+        // the restriction of the API
+        assert((size % 8) == 0);
+
+        //
+        const __m256d right_v = _mm256_set1_pd(right_operand);
+        const __m256d value_v = _mm256_set1_pd(value);
+
+        // todo: aligned reads & writes
+
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = 0; i < size8; i += 8) {
+            const __m256d v0s = _mm256_loadu_pd(src + i);
+            const __m256d v1s = _mm256_loadu_pd(src + i + 4);
+            const __m256d cmp0 = ArithHelperF64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m256d cmp1 = ArithHelperF64<AOp, CmpOp>::op(v1s, right_v, value_v);
+            const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
+            const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+
+            res_u8[i / 8] = mmask0 + mmask1 * 16;
+        }
+
+        return true;
+    }
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+// forward ops
+
+namespace {
+
+// returns a register in which bits of interest are set
+template<bool IsSet>
+inline __m256i find_prepare(const __m256i v) {
+    if constexpr (IsSet) {
+        return v;
+    } else {
+        return _mm256_xor_si256(v, _mm256_set1_epi32(-1));
+    }
+}
+
+// returns the index of the first set bit in a register that is known 
+//   to have at least one bit set
+inline size_t find_in_register(const __m256i v) {
+    const uint32_t zero_bytes = _mm256_movemask_epi8(
+        _mm256_cmpeq_epi8(v, _mm256_setzero_si256())
+    );
+    const size_t byte_idx = CtzHelper<unsigned int>::ctz(~zero_bytes);
+
+    uint8_t values[32];
+    _mm256_storeu_si256((__m256i*)values, v);
+
+    return byte_idx * 8 + CtzHelper<uint8_t>::ctz(values[byte_idx]);
+}
+
+// Returns the index of the first bit equal to IsSet in a given number 
+//   of bytes, or size * 8 if there is none.
+template<bool IsSet>
+size_t find(
+    const uint8_t* const __restrict src, 
+    const size_t size
+) {
+    auto load = [src](const size_t offset) {
+        return find_prepare<IsSet>(_mm256_loadu_si256((const __m256i*)(src + offset)));
+    };
+
+    // process blocks of 4 registers
+    const size_t size128 = (size / 128) * 128;
+    for (size_t i = 0; i < size128; i += 128) {
+        const __m256i v0 = load(i + 0 * 32);
+        const __m256i v1 = load(i + 1 * 32);
+        const __m256i v2 = load(i + 2 * 32);
+        const __m256i v3 = load(i + 3 * 32);
+
+        const __m256i v0123 = _mm256_or_si256(_mm256_or_si256(v0, v1), _mm256_or_si256(v2, v3));
+        if (!_mm256_testz_si256(v0123, v0123)) {
+            if (!_mm256_testz_si256(v0, v0)) {
+                return (i + 0 * 32) * 8 + find_in_register(v0);
+            }
+            if (!_mm256_testz_si256(v1, v1)) {
+                return (i + 1 * 32) * 8 + find_in_register(v1);
+            }
+            if (!_mm256_testz_si256(v2, v2)) {
+                return (i + 2 * 32) * 8 + find_in_register(v2);
+            }
+            return (i + 3 * 32) * 8 + find_in_register(v3);
+        }
+    }
+
+    // process big blocks
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = size128; i < size32; i += 32) {
+        const __m256i v = load(i);
+        if (!_mm256_testz_si256(v, v)) {
+            return i * 8 + find_in_register(v);
+        }
+    }
+
+    // process leftovers
+    for (size_t i = size32; i < size; i++) {
+        const uint8_t v = (IsSet) ? src[i] : uint8_t(~src[i]);
+        if (v != 0) {
+            return i * 8 + CtzHelper<uint8_t>::ctz(v);
+        }
+    }
+
+    return size * 8;
+}
+
+// Searches for the first bit equal to IsSet in [start + starting_idx, start + size).
+//   Partial elements at both ends are handled by the element-wise code, 
+//   the middle goes to find().
+template<typename ElementT, bool IsSet>
+std::optional<size_t> op_find_impl(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+    constexpr size_t data_bits = policy_type::data_bits;
+
+    if (starting_idx >= size) {
+        return std::nullopt;
+    }
+
+    size_t start_element = policy_type::get_element(start + starting_idx);
+    const size_t start_shift = policy_type::get_shift(start + starting_idx);
+    const size_t end_element = policy_type::get_element(start + size);
+
+    // process the first element
+    if (start_shift != 0) {
+        const size_t size_first = 
+            (size - starting_idx < data_bits - start_shift) ? 
+                (size - starting_idx) : (data_bits - start_shift);
+        const auto result = policy_type::op_find(data, start, starting_idx + size_first, starting_idx, IsSet);
+        if (result.has_value() || starting_idx + size_first == size) {
+            return result;
+        }
+
+        start_element += 1;
+    }
+
+    // process the middle
+    if (start_element < end_element) {
+        const size_t n_bytes = (end_element - start_element) * sizeof(ElementT);
+        const size_t bit_idx = find<IsSet>(
+            reinterpret_cast<const uint8_t*>(data + start_element), 
+            n_bytes
+        );
+        if (bit_idx != n_bytes * 8) {
+            return start_element * data_bits + bit_idx - start;
+        }
+    }
+
+    // process the last element
+    if (policy_type::get_shift(start + size) != 0) {
+        return policy_type::op_find(data, start, size, end_element * data_bits - start, IsSet);
+    }
+
+    return std::nullopt;
+}
+
+}
+
+namespace {
+
+// per-64-bit-lane popcount, a nibble lookup table + vpsadbw
+inline __m256i popcount_lookup_epi64(const __m256i v) {
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4
+    );
+    const __m256i low_mask = _mm256_set1_epi8(0x0F);
+
+    const __m256i lo = _mm256_and_si256(v, low_mask);
+    const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+    const __m256i cnt = _mm256_add_epi8(
+        _mm256_shuffle_epi8(lookup, lo), 
+        _mm256_shuffle_epi8(lookup, hi)
+    );
+
+    return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
+}
+
+// carry-save adder: h:l = a + b + c
+inline void csa(
+    __m256i& h, 
+    __m256i& l, 
+    const __m256i a, 
+    const __m256i b, 
+    const __m256i c
+) {
+    const __m256i u = _mm256_xor_si256(a, b);
+    h = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+    l = _mm256_xor_si256(u, c);
+}
+
+// Harley-Seal popcount, counts bits in a given number of bytes, which 
+//   is a multiple of 32. Every block of 32 bytes is provided by load(offset).
+template<typename LoadT>
+inline size_t popcount_blocks(const size_t size, LoadT load) {
+    __m256i total = _mm256_setzero_si256();
+    __m256i ones = _mm256_setzero_si256();
+    __m256i twos = _mm256_setzero_si256();
+    __m256i fours = _mm256_setzero_si256();
+    __m256i eights = _mm256_setzero_si256();
+
+    // process blocks of 16 registers
+    const size_t size_hs = (size / (16 * 32)) * (16 * 32);
+    for (size_t i = 0; i < size_hs; i += 16 * 32) {
+        __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+
+        csa(twos_a, ones, ones, load(i + 0 * 32), load(i + 1 * 32));
+        csa(twos_b, ones, ones, load(i + 2 * 32), load(i + 3 * 32));
+        csa(fours_a, twos, twos, twos_a, twos_b);
+        csa(twos_a, ones, ones, load(i + 4 * 32), load(i + 5 * 32));
+        csa(twos_b, ones, ones, load(i + 6 * 32), load(i + 7 * 32));
+        csa(fours_b, twos, twos, twos_a, twos_b);
+        csa(eights_a, fours, fours, fours_a, fours_b);
+        csa(twos_a, ones, ones, load(i + 8 * 32), load(i + 9 * 32));
+        csa(twos_b, ones, ones, load(i + 10 * 32), load(i + 11 * 32));
+        csa(fours_a, twos, twos, twos_a, twos_b);
+        csa(twos_a, ones, ones, load(i + 12 * 32), load(i + 13 * 32));
+        csa(twos_b, ones, ones, load(i + 14 * 32), load(i + 15 * 32));
+        csa(fours_b, twos, twos, twos_a, twos_b);
+        csa(eights_b, fours, fours, fours_a, fours_b);
+        csa(sixteens, eights, eights, eights_a, eights_b);
+
+        total = _mm256_add_epi64(total, popcount_lookup_epi64(sixteens));
+    }
+
+    total = _mm256_slli_epi64(total, 4);
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount_lookup_epi64(eights), 3));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount_lookup_epi64(fours), 2));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount_lookup_epi64(twos), 1));
+    total = _mm256_add_epi64(total, popcount_lookup_epi64(ones));
+
+    // process big blocks
+    for (size_t i = size_hs; i < size; i += 32) {
+        total = _mm256_add_epi64(total, popcount_lookup_epi64(load(i)));
+    }
+
+    const __m128i total_128 = _mm_add_epi64(
+        _mm256_castsi256_si128(total), 
+        _mm256_extracti128_si256(total, 1)
+    );
+    return _mm_cvtsi128_si64(total_128) + _mm_extract_epi64(total_128, 1);
+}
+
+// counts bits in a given number of bytes
+inline size_t popcount(
+    const uint8_t* const __restrict src, 
+    const size_t size
+) {
+    // process big blocks
+    const size_t size32 = (size / 32) * 32;
+    size_t count = popcount_blocks(
+        size32,
+        [src](const size_t offset) {
+            return _mm256_loadu_si256((const __m256i*)(src + offset));
+        }
+    );
+
+    // process leftovers
+    for (size_t i = size32; i < size; i++) {
+        count += PopCountHelper<uint8_t>::count(src[i]);
+    }
+
+    return count;
+}
+
+// Counts bits in [start, start + size). Partial elements at both ends are
+//   handled by the element-wise code, the middle goes to popcount().
+template<typename ElementT>
+size_t op_count_impl(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+    constexpr size_t data_bits = policy_type::data_bits;
+
+    if (size == 0) {
+        return 0;
+    }
+
+    size_t count = 0;
+
+    size_t start_element = policy_type::get_element(start);
+    const size_t start_shift = policy_type::get_shift(start);
+    size_t size_left = size;
+
+    // process the first element
+    if (start_shift != 0) {
+        const size_t size_first = 
+            (size < data_bits - start_shift) ? size : (data_bits - start_shift);
+        count += policy_type::op_count(data, start, size_first);
+
+        size_left -= size_first;
+        start_element += 1;
+    }
+
+    // process the middle
+    const size_t n_elements = size_left / data_bits;
+    count += popcount(
+        reinterpret_cast<const uint8_t*>(data + start_element), 
+        n_elements * sizeof(ElementT)
+    );
+
+    // process the last element
+    const size_t size_last = size_left % data_bits;
+    if (size_last != 0) {
+        count += policy_type::op_count(data + start_element + n_elements, 0, size_last);
+    }
+
+    return count;
+}
+
+}
+
+namespace {
+
+// binary operations for op_binary_impl()
+struct BinaryOpAnd {
+    static inline __m256i op(const __m256i left, const __m256i right) {
+        return _mm256_and_si256(left, right);
+    }
+
+    // returns true if a pair of values cannot be changed by any right operand
+    static inline bool is_saturated(const __m256i v0, const __m256i v1) {
+        const __m256i v = _mm256_or_si256(v0, v1);
+        return (_mm256_testz_si256(v, v) != 0);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_and(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpOr {
+    static inline __m256i op(const __m256i left, const __m256i right) {
+        return _mm256_or_si256(left, right);
+    }
+
+    // returns true if a pair of values cannot be changed by any right operand
+    static inline bool is_saturated(const __m256i v0, const __m256i v1) {
+        const __m256i v = _mm256_and_si256(v0, v1);
+        return (_mm256_testc_si256(v, _mm256_set1_epi64x(-1)) != 0);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_or(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpXor {
+    static inline __m256i op(const __m256i left, const __m256i right) {
+        return _mm256_xor_si256(left, right);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_xor(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpSub {
+    static inline __m256i op(const __m256i left, const __m256i right) {
+        return _mm256_andnot_si256(right, left);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_sub(left, right, start_left, start_right, size);
+    }
+};
+
+// Loads 32 bytes of bits that start from bit 'shift' (1..7) of src[0].
+//   Every 64-bit lane is a funnel shift of 9 consecutive bytes: 'lo' 
+//   provides bytes [0, 8) and 'hi' provides bytes [1, 9), so src[32] 
+//   is the only byte that is read past the loaded ones.
+inline __m256i load_shifted(const uint8_t* const src, const size_t shift) {
+    const __m256i lo = _mm256_loadu_si256((const __m256i*)(src));
+    const __m256i hi = _mm256_loadu_si256((const __m256i*)(src + 1));
+    return _mm256_or_si256(
+        _mm256_srl_epi64(lo, _mm_cvtsi64_si128(shift)), 
+        _mm256_sll_epi64(hi, _mm_cvtsi64_si128(8 - shift))
+    );
+}
+
+// loads 32 bytes of bits that start from bit 'shift' (0..7) of src[0]
+inline __m256i load_maybe_shifted(const uint8_t* const src, const size_t shift) {
+    if (shift == 0) {
+        return _mm256_loadu_si256((const __m256i*)(src));
+    } else {
+        return load_shifted(src, shift);
+    }
+}
+
+// Applies OpT to whole blocks of 32 bytes of left and the same number 
+//   of bits of right, which start from bit 'shift' (0..7) of right[0].
+//   If shift is not zero, then one byte past the last block of right is 
+//   read as well. Returns the number of processed bytes.
+template<typename OpT>
+size_t op_bytes(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t size,
+    const size_t shift
+) {
+    const size_t size32 = (size / 32) * 32;
+
+    if (shift == 0) {
+        for (size_t i = 0; i < size32; i += 32) {
+            const __m256i lv = _mm256_loadu_si256((const __m256i*)(left + i));
+            const __m256i rv = _mm256_loadu_si256((const __m256i*)(right + i));
+            _mm256_storeu_si256((__m256i*)(left + i), OpT::op(lv, rv));
+        }
+
+        return size32;
+    }
+
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m256i lv = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i rv = load_shifted(right + i, shift);
+        _mm256_storeu_si256((__m256i*)(left + i), OpT::op(lv, rv));
+    }
+
+    return size32;
+}
+
+// Same as op_bytes(), but a given number of bytes is a multiple of 32, 
+//   and the number of set bits in the result is returned. The result 
+//   is counted while it is still in registers.
+template<typename OpT>
+size_t op_bytes_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t size,
+    const size_t shift
+) {
+    if (shift == 0) {
+        return popcount_blocks(
+            size,
+            [left, right](const size_t offset) {
+                const __m256i lv = _mm256_loadu_si256((const __m256i*)(left + offset));
+                const __m256i rv = _mm256_loadu_si256((const __m256i*)(right + offset));
+                const __m256i result = OpT::op(lv, rv);
+                _mm256_storeu_si256((__m256i*)(left + offset), result);
+                return result;
+            }
+        );
+    } else {
+        return popcount_blocks(
+            size,
+            [left, right, shift](const size_t offset) {
+                const __m256i lv = _mm256_loadu_si256((const __m256i*)(left + offset));
+                const __m256i rv = load_shifted(right + offset, shift);
+                const __m256i result = OpT::op(lv, rv);
+                _mm256_storeu_si256((__m256i*)(left + offset), result);
+                return result;
+            }
+        );
+    }
+}
+
+// Applies OpT to whole blocks of 64 bytes of left and every right. 
+//   Bits of rights[k] start from bit shifts[k] (0..7) of rights[k][0].
+//   The remaining rights are not loaded once a block cannot be changed 
+//   by OpT anymore. Returns the number of processed bytes.
+template<typename OpT>
+size_t op_bytes_multiple(
+    uint8_t* const left,
+    const uint8_t* const* const rights,
+    const size_t* const shifts,
+    const size_t n_rights,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        // the restriction of the API
-        assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
-
-        //
-        const __m256i right_v = _mm256_set1_epi64x(right_operand);
-        const __m256i value_v = _mm256_set1_epi64x(value);
+    const size_t size64 = (size / 64) * 64;
+
+    for (size_t i = 0; i < size64; i += 64) {
+        __m256i v0 = _mm256_loadu_si256((const __m256i*)(left + i));
+        __m256i v1 = _mm256_loadu_si256((const __m256i*)(left + i + 32));
+        for (size_t k = 0; k < n_rights && !OpT::is_saturated(v0, v1); k++) {
+            v0 = OpT::op(v0, load_maybe_shifted(rights[k] + i, shifts[k]));
+            v1 = OpT::op(v1, load_maybe_shifted(rights[k] + i + 32, shifts[k]));
+        }
 
-        // todo: aligned reads & writes
+        _mm256_storeu_si256((__m256i*)(left + i), v0);
+        _mm256_storeu_si256((__m256i*)(left + i + 32), v1);
+    }
 
-        const size_t size8 = (size / 8) * 8;
-        for (size_t i = 0; i < size8; i += 8) {
-            const __m128i vs = _mm_loadu_si128((const __m128i*)(src + i));
-            const __m256i v0s = _mm256_cvtepi16_epi64(vs);
-            const __m128i v1sr = _mm_set_epi64x(0, _mm_extract_epi64(vs, 1));
-            const __m256i v1s = _mm256_cvtepi16_epi64(v1sr);
-            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
-            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
-            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
-            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+    return size64;
+}
 
-            res_u8[i / 8] = mmask0 + mmask1 * 16;
-        }
+// Applies OpT to [start_left, start_left + size) of left and 
+//   [start_right, start_right + size) of right. Bits are processed by 
+//   the element-wise code until left is byte-aligned, then whole blocks
+//   of left go to op_bytes() regardless of the alignment of right.
+template<typename ElementT, typename OpT>
+void op_binary_impl(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size
+) {
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        OpT::template op_element_wise<ElementT>(left, right, start_left, start_right, size_first);
+    }
 
-        return true;
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_right_middle = start_right + size_first;
+    const size_t n_bytes = op_bytes<OpT>(
+        reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+        reinterpret_cast<const uint8_t*>(right) + start_right_middle / 8,
+        (size - size_first) / 8,
+        start_right_middle % 8
+    );
+
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        OpT::template op_element_wise<ElementT>(
+            left, 
+            right, 
+            start_left_middle + n_bytes * 8, 
+            start_right_middle + n_bytes * 8, 
+            size_last
+        );
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict src,
-    const ArithHighPrecisionType<int32_t>& right_operand,
-    const ArithHighPrecisionType<int32_t>& value,
+// Same as op_binary_impl(), but also returns the number of set bits 
+//   in [start_left, start_left + size) of left after the operation.
+template<typename ElementT, typename OpT>
+size_t op_binary_with_count_impl(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        // the restriction of the API
-        assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
-
-        //
-        const __m256i right_v = _mm256_set1_epi64x(right_operand);
-        const __m256i value_v = _mm256_set1_epi64x(value);
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
 
-        // todo: aligned reads & writes
+    size_t count = 0;
 
-        const size_t size8 = (size / 8) * 8;
-        for (size_t i = 0; i < size8; i += 8) {
-            const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i));
-            const __m256i v0s = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(vs, 0));
-            const __m256i v1s = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(vs, 1));
-            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
-            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
-            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
-            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        OpT::template op_element_wise<ElementT>(left, right, start_left, start_right, size_first);
+        count += policy_type::op_count(left, start_left, size_first);
+    }
 
-            res_u8[i / 8] = mmask0 + mmask1 * 16;
-        }
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_right_middle = start_right + size_first;
+    const size_t n_bytes = (((size - size_first) / 8) / 32) * 32;
+    if (n_bytes != 0) {
+        count += op_bytes_with_count<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            reinterpret_cast<const uint8_t*>(right) + start_right_middle / 8,
+            n_bytes,
+            start_right_middle % 8
+        );
+    }
 
-        return true;
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        OpT::template op_element_wise<ElementT>(
+            left, 
+            right, 
+            start_left_middle + n_bytes * 8, 
+            start_right_middle + n_bytes * 8, 
+            size_last
+        );
+        count += policy_type::op_count(left, start_left_middle + n_bytes * 8, size_last);
     }
+
+    return count;
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict src,
-    const ArithHighPrecisionType<int64_t>& right_operand,
-    const ArithHighPrecisionType<int64_t>& value,
+// Applies OpT to [start_left, start_left + size) of left and 
+//   [start_rights[k], start_rights[k] + size) of every right. Same as 
+//   op_binary_impl(), but all rights are processed in a single pass.
+template<typename ElementT, typename OpT>
+void op_multiple_impl(
+    ElementT* const left,
+    const ElementT* const * const rights,
+    const size_t start_left,
+    const size_t* const __restrict start_rights,
+    const size_t n_rights,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        // the restriction of the API
-        assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+    if (n_rights == 0) {
+        return;
+    }
 
-        //
-        const __m256i right_v = _mm256_set1_epi64x(right_operand);
-        const __m256i value_v = _mm256_set1_epi64x(value);
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        for (size_t k = 0; k < n_rights; k++) {
+            OpT::template op_element_wise<ElementT>(left, rights[k], start_left, start_rights[k], size_first);
+        }
+    }
 
-        // todo: aligned reads & writes
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    size_t n_bytes = 0;
+    if (size - size_first >= 8) {
+        MaybeVector<const uint8_t*> right_ptrs(n_rights);
+        MaybeVector<size_t> right_shifts(n_rights);
+        for (size_t k = 0; k < n_rights; k++) {
+            const size_t start_right_middle = start_rights[k] + size_first;
+            right_ptrs[k] = reinterpret_cast<const uint8_t*>(rights[k]) + start_right_middle / 8;
+            right_shifts[k] = start_right_middle % 8;
+        }
 
-        const size_t size8 = (size / 8) * 8;
-        for (size_t i = 0; i < size8; i += 8) {
-            const __m256i v0s = _mm256_loadu_si256((const __m256i*)(src + i));
-            const __m256i v1s = _mm256_loadu_si256((const __m256i*)(src + i + 4));
-            const __m256i cmp0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
-            const __m256i cmp1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
-            const uint8_t mmask0 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp0));
-            const uint8_t mmask1 = _mm256_movemask_pd(_mm256_castsi256_pd(cmp1));
+        n_bytes = op_bytes_multiple<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            right_ptrs.data(),
+            right_shifts.data(),
+            n_rights,
+            (size - size_first) / 8
+        );
+    }
 
-            res_u8[i / 8] = mmask0 + mmask1 * 16;
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        for (size_t k = 0; k < n_rights; k++) {
+            OpT::template op_element_wise<ElementT>(
+                left, 
+                rights[k], 
+                start_left_middle + n_bytes * 8, 
+                start_rights[k] + size_first + n_bytes * 8, 
+                size_last
+            );
         }
-
-        return true;
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<float, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const float* const __restrict src,
-    const ArithHighPrecisionType<float>& right_operand,
-    const ArithHighPrecisionType<float>& value,
-    const size_t size
-) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        if constexpr (AOp == ArithOpType::Div) {
-            if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
-                // a special case that allows faster processing by using the multiplication
-                //   operation instead of the division one.
-
-                // the restriction of the API
-                assert((size % 8) == 0);
-
-                //
-                const __m256 right_v = _mm256_set1_ps(right_operand);
-                const __m256 value_v = _mm256_set1_ps(value);
-
-                // todo: aligned reads & writes
-
-                const size_t size8 = (size / 8) * 8;
-                for (size_t i = 0; i < size8; i += 8) {
-                    const __m256 v0s = _mm256_loadu_ps(src + i);
-                    const __m256 cmp = ArithHelperF32<AOp, CmpOp>::op_special(v0s, right_v, value_v);
-                    const uint8_t mmask = _mm256_movemask_ps(cmp);
-
-                    res_u8[i / 8] = mmask;
-                }
-
-                return true;
-            } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
-                // flip signs and go for the multiplication case
-                return OpArithCompareImpl<float, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
-                    res_u8, src, -right_operand, -value, size
-                );
-            }
 
-            // go with the default case
-        }
+// bitwise operations for ternary_logic()
+struct LogicOps {
+    static inline __m256i op_and(const __m256i x, const __m256i y) {
+        return _mm256_and_si256(x, y);
+    }
 
-        // a default case
-        {
-            // the restriction of the API
-            assert((size % 8) == 0);
+    static inline __m256i op_or(const __m256i x, const __m256i y) {
+        return _mm256_or_si256(x, y);
+    }
 
-            //
-            const __m256 right_v = _mm256_set1_ps(right_operand);
-            const __m256 value_v = _mm256_set1_ps(value);
+    static inline __m256i op_xor(const __m256i x, const __m256i y) {
+        return _mm256_xor_si256(x, y);
+    }
 
-            // todo: aligned reads & writes
+    // x & ~y
+    static inline __m256i op_andnot(const __m256i x, const __m256i y) {
+        return _mm256_andnot_si256(y, x);
+    }
 
-            const size_t size8 = (size / 8) * 8;
-            for (size_t i = 0; i < size8; i += 8) {
-                const __m256 v0s = _mm256_loadu_ps(src + i);
-                const __m256 cmp = ArithHelperF32<AOp, CmpOp>::op(v0s, right_v, value_v);
-                const uint8_t mmask = _mm256_movemask_ps(cmp);
+    static inline __m256i op_not(const __m256i x) {
+        return _mm256_xor_si256(x, _mm256_set1_epi32(-1));
+    }
 
-                res_u8[i / 8] = mmask;
-            }
+    // (x & m) | (y & ~m)
+    static inline __m256i op_select(const __m256i m, const __m256i x, const __m256i y) {
+        return _mm256_or_si256(_mm256_and_si256(m, x), _mm256_andnot_si256(m, y));
+    }
 
-            return true;
-        }
+    static inline __m256i zeros() {
+        return _mm256_setzero_si256();
     }
-}
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<double, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const double* const __restrict src,
-    const ArithHighPrecisionType<double>& right_operand,
-    const ArithHighPrecisionType<double>& value,
-    const size_t size
+    static inline __m256i ones() {
+        return _mm256_set1_epi32(-1);
+    }
+};
+
+// Applies a ternary op, given by a truth table, to whole blocks of 
+//   32 bytes of left and the same number of bits of b and c, which start 
+//   from bits 'shift_b' and 'shift_c' (0..7) of b[0] and c[0]. There is 
+//   no vpternlog in AVX2, so a truth table is decomposed into a short 
+//   sequence of and / or / xor / andnot at compile time. Returns 
+//   the number of processed bytes.
+template<uint8_t TruthTable>
+size_t op_bytes_ternary(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t size,
+    const size_t shift_b,
+    const size_t shift_c
 ) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        if constexpr (AOp == ArithOpType::Div) {
-            if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
-                // a special case that allows faster processing by using the multiplication
-                //   operation instead of the division one.
-
-                // the restriction of the API
-                assert((size % 8) == 0);
-
-                //
-                const __m256d right_v = _mm256_set1_pd(right_operand);
-                const __m256d value_v = _mm256_set1_pd(value);
-
-                // todo: aligned reads & writes
-
-                const size_t size8 = (size / 8) * 8;
-                for (size_t i = 0; i < size8; i += 8) {
-                    const __m256d v0s = _mm256_loadu_pd(src + i);
-                    const __m256d v1s = _mm256_loadu_pd(src + i + 4);
-                    const __m256d cmp0 = ArithHelperF64<AOp, CmpOp>::op_special(v0s, right_v, value_v);
-                    const __m256d cmp1 = ArithHelperF64<AOp, CmpOp>::op_special(v1s, right_v, value_v);
-                    const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
-                    const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
-
-                    res_u8[i / 8] = mmask0 + mmask1 * 16;
-                }
-
-                return true;
-            } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
-                // flip signs and go for the multiplication case
-                return OpArithCompareImpl<double, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
-                    res_u8, src, -right_operand, -value, size
-                );
-            }
+    const size_t size32 = (size / 32) * 32;
 
-            // go with the default case
+    if (shift_b == 0 && shift_c == 0) {
+        for (size_t i = 0; i < size32; i += 32) {
+            const __m256i lv = _mm256_loadu_si256((const __m256i*)(left + i));
+            const __m256i bv = _mm256_loadu_si256((const __m256i*)(b + i));
+            const __m256i cv = _mm256_loadu_si256((const __m256i*)(c + i));
+            _mm256_storeu_si256(
+                (__m256i*)(left + i), 
+                ternary_logic<TruthTable, LogicOps>(lv, bv, cv)
+            );
         }
 
-        // a default case
-        {
-            // the restriction of the API
-            assert((size % 8) == 0);
+        return size32;
+    }
 
-            //
-            const __m256d right_v = _mm256_set1_pd(right_operand);
-            const __m256d value_v = _mm256_set1_pd(value);
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m256i lv = _mm256_loadu_si256((const __m256i*)(left + i));
+        const __m256i bv = load_maybe_shifted(b + i, shift_b);
+        const __m256i cv = load_maybe_shifted(c + i, shift_c);
+        _mm256_storeu_si256(
+            (__m256i*)(left + i), 
+            ternary_logic<TruthTable, LogicOps>(lv, bv, cv)
+        );
+    }
 
-            // todo: aligned reads & writes
+    return size32;
+}
 
-            const size_t size8 = (size / 8) * 8;
-            for (size_t i = 0; i < size8; i += 8) {
-                const __m256d v0s = _mm256_loadu_pd(src + i);
-                const __m256d v1s = _mm256_loadu_pd(src + i + 4);
-                const __m256d cmp0 = ArithHelperF64<AOp, CmpOp>::op(v0s, right_v, value_v);
-                const __m256d cmp1 = ArithHelperF64<AOp, CmpOp>::op(v1s, right_v, value_v);
-                const uint8_t mmask0 = _mm256_movemask_pd(cmp0);
-                const uint8_t mmask1 = _mm256_movemask_pd(cmp1);
+using OpBytesTernaryFunc = size_t(*)(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t size,
+    const size_t shift_b,
+    const size_t shift_c
+);
+
+template<size_t... TruthTables>
+constexpr std::array<OpBytesTernaryFunc, 256> make_op_bytes_ternary_table(
+    std::index_sequence<TruthTables...>
+) {
+    return {{ &op_bytes_ternary<uint8_t(TruthTables)>... }};
+}
 
-                res_u8[i / 8] = mmask0 + mmask1 * 16;
-            }
+// op_bytes_ternary() for every possible truth table
+constexpr std::array<OpBytesTernaryFunc, 256> op_bytes_ternary_table =
+    make_op_bytes_ternary_table(std::make_index_sequence<256>());
+
+// Applies a ternary op, given by a truth table, to [start_left, 
+//   start_left + size) of left, [start_b, start_b + size) of b and 
+//   [start_c, start_c + size) of c. Same as op_binary_impl(), bits are 
+//   processed by the element-wise code until left is byte-aligned.
+template<typename ElementT>
+void op_ternary_impl(
+    ElementT* const left,
+    const ElementT* const b,
+    const ElementT* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
 
-            return true;
-        }
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        policy_type::op_ternary(left, b, c, start_left, start_b, start_c, size_first, truth_table);
     }
-}
 
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_b_middle = start_b + size_first;
+    const size_t start_c_middle = start_c + size_first;
+    const size_t n_bytes = op_bytes_ternary_table[truth_table](
+        reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+        reinterpret_cast<const uint8_t*>(b) + start_b_middle / 8,
+        reinterpret_cast<const uint8_t*>(c) + start_c_middle / 8,
+        (size - size_first) / 8,
+        start_b_middle % 8,
+        start_c_middle % 8
+    );
+
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        policy_type::op_ternary(
+            left, 
+            b, 
+            c, 
+            start_left_middle + n_bytes * 8, 
+            start_b_middle + n_bytes * 8, 
+            start_c_middle + n_bytes * 8, 
+            size_last,
+            truth_table
+        );
+    }
+}
 
-///////////////////////////////////////////////////////////////////////////
-// forward ops
+}
 
 //
 bool ForwardOpsImpl<uint8_t>::op_and(
@@ -1618,7 +4054,7 @@ bool ForwardOpsImpl<uint8_t>::op_and(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_and(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpAnd>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1630,7 +4066,7 @@ bool ForwardOpsImpl<uint8_t>::op_and_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_and_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint8_t, BinaryOpAnd>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1641,7 +4077,7 @@ bool ForwardOpsImpl<uint8_t>::op_or(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_or(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpOr>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1653,7 +4089,7 @@ bool ForwardOpsImpl<uint8_t>::op_or_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_or_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint8_t, BinaryOpOr>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1664,7 +4100,7 @@ bool ForwardOpsImpl<uint8_t>::op_xor(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_xor(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpXor>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1675,7 +4111,72 @@ bool ForwardOpsImpl<uint8_t>::op_sub(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_sub(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpSub>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_count(
+    const uint8_t* const data,
+    const size_t start,
+    const size_t size,
+    size_t& count
+) {
+    count = op_count_impl<uint8_t>(data, start, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_find(
+    const uint8_t* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+) {
+    if (is_set) {
+        result = op_find_impl<uint8_t, true>(data, start, size, starting_idx);
+    } else {
+        result = op_find_impl<uint8_t, false>(data, start, size, starting_idx);
+    }
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_and_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    count = op_binary_with_count_impl<uint8_t, BinaryOpAnd>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_or_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    // the number of inactive bits
+    count = size - op_binary_with_count_impl<uint8_t, BinaryOpOr>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_ternary(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    op_ternary_impl<uint8_t>(left, b, c, start_left, start_b, start_c, size, truth_table);
     return true;
 }
 
@@ -1687,7 +4188,7 @@ bool ForwardOpsImpl<uint64_t>::op_and(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_and(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpAnd>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1699,7 +4200,7 @@ bool ForwardOpsImpl<uint64_t>::op_and_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_and_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint64_t, BinaryOpAnd>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1710,7 +4211,7 @@ bool ForwardOpsImpl<uint64_t>::op_or(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_or(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpOr>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1722,7 +4223,7 @@ bool ForwardOpsImpl<uint64_t>::op_or_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_or_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint64_t, BinaryOpOr>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1733,7 +4234,7 @@ bool ForwardOpsImpl<uint64_t>::op_xor(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_xor(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpXor>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1744,7 +4245,72 @@ bool ForwardOpsImpl<uint64_t>::op_sub(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_sub(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpSub>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_count(
+    const uint64_t* const data,
+    const size_t start,
+    const size_t size,
+    size_t& count
+) {
+    count = op_count_impl<uint64_t>(data, start, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_find(
+    const uint64_t* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+) {
+    if (is_set) {
+        result = op_find_impl<uint64_t, true>(data, start, size, starting_idx);
+    } else {
+        result = op_find_impl<uint64_t, false>(data, start, size, starting_idx);
+    }
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_and_with_count(
+    uint64_t* const left,
+    const uint64_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    count = op_binary_with_count_impl<uint64_t, BinaryOpAnd>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_or_with_count(
+    uint64_t* const left,
+    const uint64_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    // the number of inactive bits
+    count = size - op_binary_with_count_impl<uint64_t, BinaryOpOr>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_ternary(
+    uint64_t* const left,
+    const uint64_t* const b,
+    const uint64_t* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    op_ternary_impl<uint64_t>(left, b, c, start_left, start_b, start_c, size, truth_table);
     return true;
 }
 
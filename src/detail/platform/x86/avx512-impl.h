@@ -4,17 +4,23 @@
 
 #include <immintrin.h>
 
+#include <array>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <type_traits>
+#include <utility>
 
 #include "avx512-decl.h"
 
 #include "../../../common.h"
+#include "../../divide.h"
 #include "../../element_wise.h"
+#include "../../in_values.h"
 #include "common.h"
+#include "instruction_set.h"
 
 namespace milvus {
 namespace bitset {
@@ -259,132 +265,43 @@ bool OpCompareValImpl<int64_t, Op>::op_compare_val(
 }
 
 template<CompareOpType Op>
-bool OpCompareValImpl<float, Op>::op_compare_val(
-    uint8_t* const __restrict res_u8,
-    const float* const __restrict src, 
-    const size_t size, 
-    const float& val
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-    
-    //
-    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
-    constexpr auto pred = ComparePredicate<float, Op>::value;
-
-    const __m512 target = _mm512_set1_ps(val);
-
-    // todo: aligned reads & writes
-
-    // interleaved pages
-    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(float);
-    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-        for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
-            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                const __m512 v = _mm512_loadu_ps(src + i + p + ip * BLOCK_COUNT);
-                const __mmask16 cmp_mask = _mm512_cmp_ps_mask(v, target, pred);
-
-                res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
-
-                _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-            }
-        }
-    }
-
-    // process big blocks
-    const size_t size16 = (size / 16) * 16;
-    for (size_t i = size_8p; i < size16; i += 16) {
-        const __m512 v = _mm512_loadu_ps(src + i);
-        const __mmask16 cmp_mask = _mm512_cmp_ps_mask(v, target, pred);
-
-        res_u16[i / 16] = cmp_mask;
-    }
-
-    // process leftovers
-    if (size16 != size) {
-        // 8 elements to process
-        const __m256 v = _mm256_loadu_ps(src + size16);
-        const __mmask8 cmp_mask = 
-            _mm256_cmp_ps_mask(v, _mm512_castps512_ps256(target), pred);
-
-        res_u8[size16 / 8] = cmp_mask;
-    }
-
-    return true;
-}
-
-template<CompareOpType Op>
-bool OpCompareValImpl<double, Op>::op_compare_val(
+bool OpCompareValImpl<uint8_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict src, 
+    const uint8_t* const __restrict src, 
     const size_t size, 
-    const double& val
+    const uint8_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    constexpr auto pred = ComparePredicate<double, Op>::value;
-
-    const __m512d target = _mm512_set1_pd(val);
+    const __m512i target = _mm512_set1_epi8(val);
+    uint64_t* const __restrict res_u64 = reinterpret_cast<uint64_t*>(res_u8); 
+    constexpr auto pred = ComparePredicate<uint8_t, Op>::value;
 
     // todo: aligned reads & writes
 
     // interleaved pages
-    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(double);
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(uint8_t);
     const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
     for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-        for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 64) {
             for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                const __m512d v = _mm512_loadu_pd(src + i + p + ip * BLOCK_COUNT);
-                const __mmask8 cmp_mask = _mm512_cmp_pd_mask(v, target, pred);
+                const __m512i v = _mm512_loadu_si512(src + i + p + ip * BLOCK_COUNT);
+                const __mmask64 cmp_mask = _mm512_cmp_epu8_mask(v, target, pred);
 
-                res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+                res_u64[(i + p + ip * BLOCK_COUNT) / 64] = cmp_mask;
 
                 _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
             }
         }
     }
 
-    // process big blocks
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = size_8p; i < size8; i += 8) {
-        const __m512d v = _mm512_loadu_pd(src + i);
-        const __mmask8 cmp_mask = _mm512_cmp_pd_mask(v, target, pred);
-
-        res_u8[i / 8] = cmp_mask;
-    }
-
-    return true;
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-
-//
-template<CompareOpType Op>
-bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
-    uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict left, 
-    const int8_t* const __restrict right, 
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-    
-    //
-    uint64_t* const __restrict res_u64 = reinterpret_cast<uint64_t*>(res_u8); 
-    constexpr auto pred = ComparePredicate<int8_t, Op>::value;
-
-    // todo: aligned reads & writes
-
     // process big blocks
     const size_t size64 = (size / 64) * 64;
-    for (size_t i = 0; i < size64; i += 64) {
-        const __m512i vl = _mm512_loadu_si512(left + i);
-        const __m512i vr = _mm512_loadu_si512(right + i);
-        const __mmask64 cmp_mask = _mm512_cmp_epi8_mask(vl, vr, pred);
+    for (size_t i = size_8p; i < size64; i += 64) {
+        const __m512i v = _mm512_loadu_si512(src + i);
+        const __mmask64 cmp_mask = _mm512_cmp_epu8_mask(v, target, pred);
 
         res_u64[i / 64] = cmp_mask;
     }
@@ -393,9 +310,8 @@ bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
     if (size64 != size) {
         // 8, 16, 24, 32, 40, 48 or 56 elements to process
         const uint64_t mask = get_mask(size - size64);
-        const __m512i vl = _mm512_maskz_loadu_epi8(mask, left + size64);
-        const __m512i vr = _mm512_maskz_loadu_epi8(mask, right + size64);
-        const __mmask64 cmp_mask = _mm512_cmp_epi8_mask(vl, vr, pred);
+        const __m512i v = _mm512_maskz_loadu_epi8(mask, src + size64);
+        const __mmask64 cmp_mask = _mm512_cmp_epu8_mask(v, target, pred);
 
         const uint16_t store_mask = get_mask((size - size64) / 8);
         _mm_mask_storeu_epi8(
@@ -409,27 +325,43 @@ bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint16_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict left, 
-    const int16_t* const __restrict right, 
-    const size_t size
+    const uint16_t* const __restrict src, 
+    const size_t size, 
+    const uint16_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
+    const __m512i target = _mm512_set1_epi16(val);
     uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8); 
-    constexpr auto pred = ComparePredicate<int16_t, Op>::value;
+    constexpr auto pred = ComparePredicate<uint16_t, Op>::value;
 
     // todo: aligned reads & writes
 
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(uint16_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 32) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i v = _mm512_loadu_si512(src + i + p + ip * BLOCK_COUNT);
+                const __mmask32 cmp_mask = _mm512_cmp_epu16_mask(v, target, pred);
+
+                res_u32[(i + p + ip * BLOCK_COUNT) / 32] = cmp_mask;
+
+                _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
     // process big blocks
     const size_t size32 = (size / 32) * 32;
-    for (size_t i = 0; i < size32; i += 32) {
-        const __m512i vl = _mm512_loadu_si512(left + i);
-        const __m512i vr = _mm512_loadu_si512(right + i);
-        const __mmask32 cmp_mask = _mm512_cmp_epi16_mask(vl, vr, pred);
+    for (size_t i = size_8p; i < size32; i += 32) {
+        const __m512i v = _mm512_loadu_si512(src + i);
+        const __mmask32 cmp_mask = _mm512_cmp_epu16_mask(v, target, pred);
 
         res_u32[i / 32] = cmp_mask;
     }
@@ -438,9 +370,8 @@ bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
     if (size32 != size) {
         // 8, 16 or 24 elements to process
         const uint32_t mask = get_mask(size - size32);
-        const __m512i vl = _mm512_maskz_loadu_epi16(mask, left + size32);
-        const __m512i vr = _mm512_maskz_loadu_epi16(mask, right + size32);
-        const __mmask32 cmp_mask = _mm512_cmp_epi16_mask(vl, vr, pred);
+        const __m512i v = _mm512_maskz_loadu_epi16(mask, src + size32);
+        const __mmask32 cmp_mask = _mm512_cmp_epu16_mask(v, target, pred);
 
         const uint16_t store_mask = get_mask((size - size32) / 8);
         _mm_mask_storeu_epi8(
@@ -454,27 +385,43 @@ bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint32_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict left, 
-    const int32_t* const __restrict right, 
-    const size_t size
+    const uint32_t* const __restrict src, 
+    const size_t size, 
+    const uint32_t& val 
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
+    const __m512i target = _mm512_set1_epi32(val);
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
-    constexpr auto pred = ComparePredicate<int32_t, Op>::value;
+    constexpr auto pred = ComparePredicate<uint32_t, Op>::value;
 
     // todo: aligned reads & writes
 
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(uint32_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i v = _mm512_loadu_si512(src + i + p + ip * BLOCK_COUNT);
+                const __mmask16 cmp_mask = _mm512_cmp_epu32_mask(v, target, pred);
+
+                res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
+
+                _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
     // process big blocks
     const size_t size16 = (size / 16) * 16;
-    for (size_t i = 0; i < size16; i += 16) {
-        const __m512i vl = _mm512_loadu_si512(left + i);
-        const __m512i vr = _mm512_loadu_si512(right + i);
-        const __mmask16 cmp_mask = _mm512_cmp_epi32_mask(vl, vr, pred);
+    for (size_t i = size_8p; i < size16; i += 16) {
+        const __m512i v = _mm512_loadu_si512(src + i);
+        const __mmask16 cmp_mask = _mm512_cmp_epu32_mask(v, target, pred);
 
         res_u16[i / 16] = cmp_mask;
     }
@@ -482,9 +429,9 @@ bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
     // process leftovers
     if (size16 != size) {
         // 8 elements to process
-        const __m256i vl = _mm256_loadu_si256((const __m256i*)(left + size16));
-        const __m256i vr = _mm256_loadu_si256((const __m256i*)(right + size16));
-        const __mmask8 cmp_mask = _mm256_cmp_epi32_mask(vl, vr, pred);
+        const __m256i v = _mm256_loadu_si256((const __m256i*)(src + size16));
+        const __mmask8 cmp_mask = 
+            _mm256_cmp_epu32_mask(v, _mm512_castsi512_si256(target), pred);
 
         res_u8[size16 / 8] = cmp_mask;
     }
@@ -493,26 +440,42 @@ bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
+bool OpCompareValImpl<uint64_t, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict left, 
-    const int64_t* const __restrict right, 
-    const size_t size
+    const uint64_t* const __restrict src, 
+    const size_t size, 
+    const uint64_t& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    constexpr auto pred = ComparePredicate<int64_t, Op>::value;
+    const __m512i target = _mm512_set1_epi64(val);
+    constexpr auto pred = ComparePredicate<uint64_t, Op>::value;
 
     // todo: aligned reads & writes
 
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(uint64_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i v = _mm512_loadu_si512(src + i + p + ip * BLOCK_COUNT);
+                const __mmask8 cmp_mask = _mm512_cmp_epu64_mask(v, target, pred);
+
+                res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+
+                _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
     // process big blocks
     const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m512i vl = _mm512_loadu_si512(left + i);
-        const __m512i vr = _mm512_loadu_si512(right + i);
-        const __mmask8 cmp_mask = _mm512_cmp_epi64_mask(vl, vr, pred);
+    for (size_t i = size_8p; i < size8; i += 8) {
+        const __m512i v = _mm512_loadu_si512(src + i);
+        const __mmask8 cmp_mask = _mm512_cmp_epu64_mask(v, target, pred);
 
         res_u8[i / 8] = cmp_mask;
     }
@@ -521,11 +484,11 @@ bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
+bool OpCompareValImpl<float, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const float* const __restrict left, 
-    const float* const __restrict right, 
-    const size_t size
+    const float* const __restrict src, 
+    const size_t size, 
+    const float& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
@@ -534,24 +497,41 @@ bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
     constexpr auto pred = ComparePredicate<float, Op>::value;
 
+    const __m512 target = _mm512_set1_ps(val);
+
     // todo: aligned reads & writes
 
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(float);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512 v = _mm512_loadu_ps(src + i + p + ip * BLOCK_COUNT);
+                const __mmask16 cmp_mask = _mm512_cmp_ps_mask(v, target, pred);
+
+                res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
+
+                _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
     // process big blocks
     const size_t size16 = (size / 16) * 16;
-    for (size_t i = 0; i < size16; i += 16) {
-        const __m512 vl = _mm512_loadu_ps(left + i);
-        const __m512 vr = _mm512_loadu_ps(right + i);
-        const __mmask16 cmp_mask = _mm512_cmp_ps_mask(vl, vr, pred);
+    for (size_t i = size_8p; i < size16; i += 16) {
+        const __m512 v = _mm512_loadu_ps(src + i);
+        const __mmask16 cmp_mask = _mm512_cmp_ps_mask(v, target, pred);
 
         res_u16[i / 16] = cmp_mask;
     }
 
     // process leftovers
     if (size16 != size) {
-        // process 8 elements
-        const __m256 vl = _mm256_loadu_ps(left + size16);
-        const __m256 vr = _mm256_loadu_ps(right + size16);
-        const __mmask8 cmp_mask = _mm256_cmp_ps_mask(vl, vr, pred);
+        // 8 elements to process
+        const __m256 v = _mm256_loadu_ps(src + size16);
+        const __mmask8 cmp_mask = 
+            _mm256_cmp_ps_mask(v, _mm512_castps512_ps256(target), pred);
 
         res_u8[size16 / 8] = cmp_mask;
     }
@@ -560,11 +540,11 @@ bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
 }
 
 template<CompareOpType Op>
-bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
+bool OpCompareValImpl<double, Op>::op_compare_val(
     uint8_t* const __restrict res_u8,
-    const double* const __restrict left, 
-    const double* const __restrict right, 
-    const size_t size
+    const double* const __restrict src, 
+    const size_t size, 
+    const double& val
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
@@ -572,14 +552,31 @@ bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
     //
     constexpr auto pred = ComparePredicate<double, Op>::value;
 
+    const __m512d target = _mm512_set1_pd(val);
+
     // todo: aligned reads & writes
 
-    // process big blocks
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(double);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512d v = _mm512_loadu_pd(src + i + p + ip * BLOCK_COUNT);
+                const __mmask8 cmp_mask = _mm512_cmp_pd_mask(v, target, pred);
+
+                res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+
+                _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
     const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m512d vl = _mm512_loadu_pd(left + i);
-        const __m512d vr = _mm512_loadu_pd(right + i);
-        const __mmask8 cmp_mask = _mm512_cmp_pd_mask(vl, vr, pred);
+    for (size_t i = size_8p; i < size8; i += 8) {
+        const __m512d v = _mm512_loadu_pd(src + i);
+        const __mmask8 cmp_mask = _mm512_cmp_pd_mask(v, target, pred);
 
         res_u8[i / 8] = cmp_mask;
     }
@@ -588,15 +585,281 @@ bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
 }
 
 
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// Equality comparisons for IN. The signedness of integers does not 
+//   matter, so unsigned types use the same helpers.
+template<typename T>
+struct InValuesHelper {};
+
+template<>
+struct InValuesHelper<int8_t> {
+    using vec_type = __m512i;
+
+    static inline vec_type set1(const int8_t value) {
+        return _mm512_set1_epi8(value);
+    }
+
+    static inline vec_type load(const uint64_t mask, const int8_t* const src) {
+        return _mm512_maskz_loadu_epi8(mask, src);
+    }
+
+    static inline uint64_t compare(const vec_type a, const vec_type b) {
+        return _mm512_cmpeq_epi8_mask(a, b);
+    }
+};
+
+template<>
+struct InValuesHelper<int16_t> {
+    using vec_type = __m512i;
+
+    static inline vec_type set1(const int16_t value) {
+        return _mm512_set1_epi16(value);
+    }
+
+    static inline vec_type load(const uint64_t mask, const int16_t* const src) {
+        return _mm512_maskz_loadu_epi16(mask, src);
+    }
+
+    static inline uint64_t compare(const vec_type a, const vec_type b) {
+        return _mm512_cmpeq_epi16_mask(a, b);
+    }
+};
+
+template<>
+struct InValuesHelper<int32_t> {
+    using vec_type = __m512i;
+
+    static inline vec_type set1(const int32_t value) {
+        return _mm512_set1_epi32(value);
+    }
+
+    static inline vec_type load(const uint64_t mask, const int32_t* const src) {
+        return _mm512_maskz_loadu_epi32(mask, src);
+    }
+
+    static inline uint64_t compare(const vec_type a, const vec_type b) {
+        return _mm512_cmpeq_epi32_mask(a, b);
+    }
+};
+
+template<>
+struct InValuesHelper<int64_t> {
+    using vec_type = __m512i;
+
+    static inline vec_type set1(const int64_t value) {
+        return _mm512_set1_epi64(value);
+    }
+
+    static inline vec_type load(const uint64_t mask, const int64_t* const src) {
+        return _mm512_maskz_loadu_epi64(mask, src);
+    }
+
+    static inline uint64_t compare(const vec_type a, const vec_type b) {
+        return _mm512_cmpeq_epi64_mask(a, b);
+    }
+};
+
+template<>
+struct InValuesHelper<float> {
+    using vec_type = __m512;
+
+    static inline vec_type set1(const float value) {
+        return _mm512_set1_ps(value);
+    }
+
+    static inline vec_type load(const uint64_t mask, const float* const src) {
+        return _mm512_maskz_loadu_ps(mask, src);
+    }
+
+    static inline uint64_t compare(const vec_type a, const vec_type b) {
+        return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ);
+    }
+};
+
+template<>
+struct InValuesHelper<double> {
+    using vec_type = __m512d;
+
+    static inline vec_type set1(const double value) {
+        return _mm512_set1_pd(value);
+    }
+
+    static inline vec_type load(const uint64_t mask, const double* const src) {
+        return _mm512_maskz_loadu_pd(mask, src);
+    }
+
+    static inline uint64_t compare(const vec_type a, const vec_type b) {
+        return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ);
+    }
+};
+
+// every value is broadcast into a register, 
+//   then compare masks are OR-ed in a single pass over the data
+template<typename T, InValuesType Op>
+bool op_in_values_impl(
+    uint8_t* const __restrict res_u8,
+    const T* const __restrict src, 
+    const size_t size, 
+    const T* const __restrict values,
+    const size_t n_values
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    if (n_values == 0 || n_values > IN_VALUES_MAX_BROADCAST) {
+        return false;
+    }
+
+    //
+    using S = typename InValuesLaneType<T>::signed_type;
+    using helper = InValuesHelper<S>;
+
+    const S* const __restrict src_s = reinterpret_cast<const S*>(src);
+
+    typename helper::vec_type targets[IN_VALUES_MAX_BROADCAST];
+    for (size_t j = 0; j < n_values; j++) {
+        targets[j] = helper::set1(S(values[j]));
+    }
+
+    auto match = [&targets, n_values](const uint64_t load_mask, const S* const p) {
+        const auto v = helper::load(load_mask, p);
+
+        uint64_t cmp_mask = 0;
+        for (size_t j = 0; j < n_values; j++) {
+            cmp_mask |= helper::compare(v, targets[j]);
+        }
+
+        return (Op == InValuesType::In) ? cmp_mask : ~cmp_mask;
+    };
+
+    // the number of elements in a register
+    constexpr size_t N = 64 / sizeof(T);
+    constexpr uint64_t full_mask = (N == 64) ? uint64_t(-1) : ((uint64_t(1) << N) - 1);
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t sizeN = (size / N) * N;
+    for (size_t i = 0; i < sizeN; i += N) {
+        const uint64_t cmp_mask = match(full_mask, src_s + i);
+        memcpy(res_u8 + i / 8, &cmp_mask, N / 8);
+    }
+
+    // process leftovers
+    if (sizeN != size) {
+        const uint64_t cmp_mask = match(get_mask(size - sizeN), src_s + sizeN);
+        memcpy(res_u8 + sizeN / 8, &cmp_mask, (size - sizeN) / 8);
+    }
+
+    return true;
+}
+
+}
+
+#define DEFINE_OP_IN_VALUES(TTYPE) \
+    template<InValuesType Op> \
+    bool OpInValuesImpl<TTYPE, Op>::op_in_values( \
+        uint8_t* const __restrict res_u8, \
+        const TTYPE* const __restrict src, \
+        const size_t size, \
+        const TTYPE* const __restrict values, \
+        const size_t n_values \
+    ) { \
+        return op_in_values_impl<TTYPE, Op>(res_u8, src, size, values, n_values); \
+    }
+
+DEFINE_OP_IN_VALUES(int8_t)
+DEFINE_OP_IN_VALUES(int16_t)
+DEFINE_OP_IN_VALUES(int32_t)
+DEFINE_OP_IN_VALUES(int64_t)
+DEFINE_OP_IN_VALUES(uint8_t)
+DEFINE_OP_IN_VALUES(uint16_t)
+DEFINE_OP_IN_VALUES(uint32_t)
+DEFINE_OP_IN_VALUES(uint64_t)
+DEFINE_OP_IN_VALUES(float)
+DEFINE_OP_IN_VALUES(double)
+
+#undef DEFINE_OP_IN_VALUES
+
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// Every string is compared against the prefix using a single masked load
+//   of min(length, prefix_size) bytes, so nothing past the end of a string
+//   is touched.
+template<typename OffsetT>
+bool op_prefix_match_impl(
+    uint8_t* const __restrict res_u8,
+    const char* const __restrict data,
+    const OffsetT* const __restrict offsets,
+    const size_t size,
+    const char* const __restrict prefix,
+    const size_t prefix_size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    // the number of bytes in a register
+    if (prefix_size > 64) {
+        return false;
+    }
+
+    const uint64_t prefix_mask = (prefix_size == 64) ? uint64_t(-1) : get_mask(prefix_size);
+    const __m512i target = _mm512_maskz_loadu_epi8(prefix_mask, prefix);
+
+    for (size_t i = 0; i < size; i += 8) {
+        uint8_t result = 0;
+        for (size_t j = 0; j < 8; j++) {
+            const OffsetT begin = offsets[i + j];
+            const size_t length = static_cast<size_t>(offsets[i + j + 1] - begin);
+            const bool fits = (length >= prefix_size);
+
+            const uint64_t load_mask = fits ? prefix_mask : get_mask(length);
+            const __m512i v = _mm512_maskz_loadu_epi8(load_mask, data + begin);
+            const uint64_t ne_mask = _mm512_mask_cmpneq_epi8_mask(prefix_mask, v, target);
+
+            result |= uint8_t(fits && (ne_mask == 0)) << j;
+        }
+
+        res_u8[i / 8] = result;
+    }
+
+    return true;
+}
+
+}
+
+#define DEFINE_OP_PREFIX_MATCH(OFFSETTYPE) \
+    bool OpPrefixMatchImpl<OFFSETTYPE>::op_prefix_match( \
+        uint8_t* const __restrict res_u8, \
+        const char* const __restrict data, \
+        const OFFSETTYPE* const __restrict offsets, \
+        const size_t size, \
+        const char* const __restrict prefix, \
+        const size_t prefix_size \
+    ) { \
+        return op_prefix_match_impl<OFFSETTYPE>(res_u8, data, offsets, size, prefix, prefix_size); \
+    }
+
+DEFINE_OP_PREFIX_MATCH(int32_t)
+DEFINE_OP_PREFIX_MATCH(int64_t)
+
+#undef DEFINE_OP_PREFIX_MATCH
+
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int8_t, int8_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict lower,
-    const int8_t* const __restrict upper,
-    const int8_t* const __restrict values,
+    const int8_t* const __restrict left, 
+    const int8_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
@@ -604,19 +867,16 @@ bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
     
     //
     uint64_t* const __restrict res_u64 = reinterpret_cast<uint64_t*>(res_u8); 
-    constexpr auto pred_lower = ComparePredicate<int8_t, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<int8_t, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<int8_t, Op>::value;
 
     // todo: aligned reads & writes
 
     // process big blocks
     const size_t size64 = (size / 64) * 64;
     for (size_t i = 0; i < size64; i += 64) {
-        const __m512i vl = _mm512_loadu_si512(lower + i);
-        const __m512i vu = _mm512_loadu_si512(upper + i);
-        const __m512i vv = _mm512_loadu_si512(values + i);
-        const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(vl, vv, pred_lower);
-        const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, vu, pred_upper);
+        const __m512i vl = _mm512_loadu_si512(left + i);
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask64 cmp_mask = _mm512_cmp_epi8_mask(vl, vr, pred);
 
         res_u64[i / 64] = cmp_mask;
     }
@@ -625,11 +885,9 @@ bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
     if (size64 != size) {
         // 8, 16, 24, 32, 40, 48 or 56 elements to process
         const uint64_t mask = get_mask(size - size64);
-        const __m512i vl = _mm512_maskz_loadu_epi8(mask, lower + size64);
-        const __m512i vu = _mm512_maskz_loadu_epi8(mask, upper + size64);
-        const __m512i vv = _mm512_maskz_loadu_epi8(mask, values + size64);
-        const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(vl, vv, pred_lower);
-        const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, vu, pred_upper);
+        const __m512i vl = _mm512_maskz_loadu_epi8(mask, left + size64);
+        const __m512i vr = _mm512_maskz_loadu_epi8(mask, right + size64);
+        const __mmask64 cmp_mask = _mm512_cmp_epi8_mask(vl, vr, pred);
 
         const uint16_t store_mask = get_mask((size - size64) / 8);
         _mm_mask_storeu_epi8(
@@ -642,33 +900,28 @@ bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int16_t, int16_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict lower,
-    const int16_t* const __restrict upper,
-    const int16_t* const __restrict values,
+    const int16_t* const __restrict left, 
+    const int16_t* const __restrict right, 
     const size_t size
 ) {
-
     // the restriction of the API
     assert((size % 8) == 0);
-
+    
     //
     uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8); 
-    constexpr auto pred_lower = ComparePredicate<int16_t, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<int16_t, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<int16_t, Op>::value;
 
     // todo: aligned reads & writes
 
     // process big blocks
     const size_t size32 = (size / 32) * 32;
     for (size_t i = 0; i < size32; i += 32) {
-        const __m512i vl = _mm512_loadu_si512(lower + i);
-        const __m512i vu = _mm512_loadu_si512(upper + i);
-        const __m512i vv = _mm512_loadu_si512(values + i);
-        const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(vl, vv, pred_lower);
-        const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, vu, pred_upper);
+        const __m512i vl = _mm512_loadu_si512(left + i);
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask32 cmp_mask = _mm512_cmp_epi16_mask(vl, vr, pred);
 
         res_u32[i / 32] = cmp_mask;
     }
@@ -677,11 +930,9 @@ bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
     if (size32 != size) {
         // 8, 16 or 24 elements to process
         const uint32_t mask = get_mask(size - size32);
-        const __m512i vl = _mm512_maskz_loadu_epi16(mask, lower + size32);
-        const __m512i vu = _mm512_maskz_loadu_epi16(mask, upper + size32);
-        const __m512i vv = _mm512_maskz_loadu_epi16(mask, values + size32);
-        const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(vl, vv, pred_lower);
-        const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, vu, pred_upper);
+        const __m512i vl = _mm512_maskz_loadu_epi16(mask, left + size32);
+        const __m512i vr = _mm512_maskz_loadu_epi16(mask, right + size32);
+        const __mmask32 cmp_mask = _mm512_cmp_epi16_mask(vl, vr, pred);
 
         const uint16_t store_mask = get_mask((size - size32) / 8);
         _mm_mask_storeu_epi8(
@@ -694,12 +945,11 @@ bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, int32_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict lower,
-    const int32_t* const __restrict upper,
-    const int32_t* const __restrict values,
+    const int32_t* const __restrict left, 
+    const int32_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
@@ -707,19 +957,16 @@ bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
     
     //
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
-    constexpr auto pred_lower = ComparePredicate<int32_t, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<int32_t, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<int32_t, Op>::value;
 
     // todo: aligned reads & writes
 
     // process big blocks
     const size_t size16 = (size / 16) * 16;
     for (size_t i = 0; i < size16; i += 16) {
-        const __m512i vl = _mm512_loadu_si512(lower + i);
-        const __m512i vu = _mm512_loadu_si512(upper + i);
-        const __m512i vv = _mm512_loadu_si512(values + i);
-        const __mmask16 cmpl_mask = _mm512_cmp_epi32_mask(vl, vv, pred_lower);
-        const __mmask16 cmp_mask = _mm512_mask_cmp_epi32_mask(cmpl_mask, vv, vu, pred_upper);
+        const __m512i vl = _mm512_loadu_si512(left + i);
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask16 cmp_mask = _mm512_cmp_epi32_mask(vl, vr, pred);
 
         res_u16[i / 16] = cmp_mask;
     }
@@ -727,11 +974,9 @@ bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
     // process leftovers
     if (size16 != size) {
         // 8 elements to process
-        const __m256i vl = _mm256_loadu_si256((const __m256i*)(lower + size16));
-        const __m256i vu = _mm256_loadu_si256((const __m256i*)(upper + size16));
-        const __m256i vv = _mm256_loadu_si256((const __m256i*)(values + size16));
-        const __mmask8 cmpl_mask = _mm256_cmp_epi32_mask(vl, vv, pred_lower);
-        const __mmask8 cmp_mask = _mm256_mask_cmp_epi32_mask(cmpl_mask, vv, vu, pred_upper);
+        const __m256i vl = _mm256_loadu_si256((const __m256i*)(left + size16));
+        const __m256i vr = _mm256_loadu_si256((const __m256i*)(right + size16));
+        const __mmask8 cmp_mask = _mm256_cmp_epi32_mask(vl, vr, pred);
 
         res_u8[size16 / 8] = cmp_mask;
     }
@@ -739,31 +984,27 @@ bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int64_t, int64_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict lower,
-    const int64_t* const __restrict upper,
-    const int64_t* const __restrict values,
+    const int64_t* const __restrict left, 
+    const int64_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    constexpr auto pred_lower = ComparePredicate<int64_t, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<int64_t, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<int64_t, Op>::value;
 
     // todo: aligned reads & writes
 
     // process big blocks
     const size_t size8 = (size / 8) * 8;
     for (size_t i = 0; i < size8; i += 8) {
-        const __m512i vl = _mm512_loadu_si512(lower + i);
-        const __m512i vu = _mm512_loadu_si512(upper + i);
-        const __m512i vv = _mm512_loadu_si512(values + i);
-        const __mmask8 cmpl_mask = _mm512_cmp_epi64_mask(vl, vv, pred_lower);
-        const __mmask8 cmp_mask = _mm512_mask_cmp_epi64_mask(cmpl_mask, vv, vu, pred_upper);
+        const __m512i vl = _mm512_loadu_si512(left + i);
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_epi64_mask(vl, vr, pred);
 
         res_u8[i / 8] = cmp_mask;
     }
@@ -771,130 +1012,28 @@ bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<float, Op>::op_within_range_column(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint8_t, uint8_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const float* const __restrict lower,
-    const float* const __restrict upper,
-    const float* const __restrict values,
+    const uint8_t* const __restrict left, 
+    const uint8_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
-    constexpr auto pred_lower = ComparePredicate<float, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<float, Range2Compare<Op>::upper>::value;
-
-    // todo: aligned reads & writes
-
-    // process big blocks
-    const size_t size16 = (size / 16) * 16;
-    for (size_t i = 0; i < size16; i += 16) {
-        const __m512 vl = _mm512_loadu_ps(lower + i);
-        const __m512 vu = _mm512_loadu_ps(upper + i);
-        const __m512 vv = _mm512_loadu_ps(values + i);
-        const __mmask16 cmpl_mask = _mm512_cmp_ps_mask(vl, vv, pred_lower);
-        const __mmask16 cmp_mask = _mm512_mask_cmp_ps_mask(cmpl_mask, vv, vu, pred_upper);
-
-        res_u16[i / 16] = cmp_mask;
-    }
-
-    // process leftovers
-    if (size16 != size) {
-        // process 8 elements
-        const __m256 vl = _mm256_loadu_ps(lower + size16);
-        const __m256 vu = _mm256_loadu_ps(upper + size16);
-        const __m256 vv = _mm256_loadu_ps(values + size16);
-        const __mmask8 cmpl_mask = _mm256_cmp_ps_mask(vl, vv, pred_lower);
-        const __mmask8 cmp_mask = _mm256_mask_cmp_ps_mask(cmpl_mask, vv, vu, pred_upper);
-
-        res_u8[size16 / 8] = cmp_mask;
-    }
-
-    return true;
-}
-
-template<RangeType Op>
-bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
-    uint8_t* const __restrict res_u8,
-    const double* const __restrict lower,
-    const double* const __restrict upper,
-    const double* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-    
-    //
-    constexpr auto pred_lower = ComparePredicate<double, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<double, Range2Compare<Op>::upper>::value;
-
-    // todo: aligned reads & writes
-
-    // process big blocks
-    const size_t size8 = (size / 8) * 8;
-    for (size_t i = 0; i < size8; i += 8) {
-        const __m512d vl = _mm512_loadu_pd(lower + i);
-        const __m512d vu = _mm512_loadu_pd(upper + i);
-        const __m512d vv = _mm512_loadu_pd(values + i);
-        const __mmask8 cmpl_mask = _mm512_cmp_pd_mask(vl, vv, pred_lower);
-        const __mmask8 cmp_mask = _mm512_mask_cmp_pd_mask(cmpl_mask, vv, vu, pred_upper);
-
-        res_u8[i / 8] = cmp_mask;
-    }
-
-    return true;
-}
-
-
-///////////////////////////////////////////////////////////////////////////
-
-//
-template<RangeType Op>
-bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
-    uint8_t* const __restrict res_u8,
-    const int8_t& lower,
-    const int8_t& upper,
-    const int8_t* const __restrict values,
-    const size_t size
-) {
-    // the restriction of the API
-    assert((size % 8) == 0);
-    
-    //
-    const __m512i lower_v = _mm512_set1_epi8(lower);
-    const __m512i upper_v = _mm512_set1_epi8(upper);
     uint64_t* const __restrict res_u64 = reinterpret_cast<uint64_t*>(res_u8); 
-    constexpr auto pred_lower = ComparePredicate<int8_t, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<int8_t, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<uint8_t, Op>::value;
 
     // todo: aligned reads & writes
 
-    // interleaved pages
-    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(int8_t);
-    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-        for (size_t p = 0; p < BLOCK_COUNT; p += 64) {
-            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
-                const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(lower_v, vv, pred_lower);
-                const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, upper_v, pred_upper);
-
-                res_u64[(i + p + ip * BLOCK_COUNT) / 64] = cmp_mask;
-
-                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-            }
-        }
-    }
-
     // process big blocks
     const size_t size64 = (size / 64) * 64;
-    for (size_t i = size_8p; i < size64; i += 64) {
-        const __m512i vv = _mm512_loadu_si512(values + i);
-        const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(lower_v, vv, pred_lower);
-        const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, upper_v, pred_upper);
+    for (size_t i = 0; i < size64; i += 64) {
+        const __m512i vl = _mm512_loadu_si512(left + i);
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask64 cmp_mask = _mm512_cmp_epu8_mask(vl, vr, pred);
 
         res_u64[i / 64] = cmp_mask;
     }
@@ -903,9 +1042,9 @@ bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
     if (size64 != size) {
         // 8, 16, 24, 32, 40, 48 or 56 elements to process
         const uint64_t mask = get_mask(size - size64);
-        const __m512i vv = _mm512_maskz_loadu_epi8(mask, values + size64);
-        const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(lower_v, vv, pred_lower);
-        const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, upper_v, pred_upper);
+        const __m512i vl = _mm512_maskz_loadu_epi8(mask, left + size64);
+        const __m512i vr = _mm512_maskz_loadu_epi8(mask, right + size64);
+        const __mmask64 cmp_mask = _mm512_cmp_epu8_mask(vl, vr, pred);
 
         const uint16_t store_mask = get_mask((size - size64) / 8);
         _mm_mask_storeu_epi8(
@@ -918,50 +1057,28 @@ bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint16_t, uint16_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int16_t& lower,
-    const int16_t& upper,
-    const int16_t* const __restrict values,
+    const uint16_t* const __restrict left, 
+    const uint16_t* const __restrict right, 
     const size_t size
 ) {
-
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    const __m512i lower_v = _mm512_set1_epi16(lower);
-    const __m512i upper_v = _mm512_set1_epi16(upper);
     uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8); 
-    constexpr auto pred_lower = ComparePredicate<int16_t, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<int16_t, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<uint16_t, Op>::value;
 
     // todo: aligned reads & writes
 
-    // interleaved pages
-    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(int16_t);
-    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-        for (size_t p = 0; p < BLOCK_COUNT; p += 32) {
-            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
-                const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(lower_v, vv, pred_lower);
-                const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, upper_v, pred_upper);
-
-                res_u32[(i + p + ip * BLOCK_COUNT) / 32] = cmp_mask;
-
-                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-            }
-        }
-    }
-
     // process big blocks
     const size_t size32 = (size / 32) * 32;
-    for (size_t i = size_8p; i < size32; i += 32) {
-        const __m512i vv = _mm512_loadu_si512(values + i);
-        const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(lower_v, vv, pred_lower);
-        const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, upper_v, pred_upper);
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m512i vl = _mm512_loadu_si512(left + i);
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask32 cmp_mask = _mm512_cmp_epu16_mask(vl, vr, pred);
 
         res_u32[i / 32] = cmp_mask;
     }
@@ -970,9 +1087,9 @@ bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
     if (size32 != size) {
         // 8, 16 or 24 elements to process
         const uint32_t mask = get_mask(size - size32);
-        const __m512i vv = _mm512_maskz_loadu_epi16(mask, values + size32);
-        const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(lower_v, vv, pred_lower);
-        const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, upper_v, pred_upper);
+        const __m512i vl = _mm512_maskz_loadu_epi16(mask, left + size32);
+        const __m512i vr = _mm512_maskz_loadu_epi16(mask, right + size32);
+        const __mmask32 cmp_mask = _mm512_cmp_epu16_mask(vl, vr, pred);
 
         const uint16_t store_mask = get_mask((size - size32) / 8);
         _mm_mask_storeu_epi8(
@@ -985,49 +1102,28 @@ bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint32_t, uint32_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int32_t& lower,
-    const int32_t& upper,
-    const int32_t* const __restrict values,
+    const uint32_t* const __restrict left, 
+    const uint32_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    const __m512i lower_v = _mm512_set1_epi32(lower);
-    const __m512i upper_v = _mm512_set1_epi32(upper);
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
-    constexpr auto pred_lower = ComparePredicate<int32_t, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<int32_t, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<uint32_t, Op>::value;
 
     // todo: aligned reads & writes
 
-    // interleaved pages
-    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(int32_t);
-    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-        for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
-            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
-                const __mmask16 cmpl_mask = _mm512_cmp_epi32_mask(lower_v, vv, pred_lower);
-                const __mmask16 cmp_mask = _mm512_mask_cmp_epi32_mask(cmpl_mask, vv, upper_v, pred_upper);
-
-                res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
-
-                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-            }
-        }
-    }
-
     // process big blocks
     const size_t size16 = (size / 16) * 16;
-    for (size_t i = size_8p; i < size16; i += 16) {
-        const __m512i vv = _mm512_loadu_si512(values + i);
-        const __mmask16 cmpl_mask = _mm512_cmp_epi32_mask(lower_v, vv, pred_lower);
-        const __mmask16 cmp_mask = _mm512_mask_cmp_epi32_mask(cmpl_mask, vv, upper_v, pred_upper);
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m512i vl = _mm512_loadu_si512(left + i);
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask16 cmp_mask = _mm512_cmp_epu32_mask(vl, vr, pred);
 
         res_u16[i / 16] = cmp_mask;
     }
@@ -1035,9 +1131,9 @@ bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
     // process leftovers
     if (size16 != size) {
         // 8 elements to process
-        const __m256i vv = _mm256_loadu_si256((const __m256i*)(values + size16));
-        const __mmask8 cmpl_mask = _mm256_cmp_epi32_mask(_mm512_castsi512_si256(lower_v), vv, pred_lower);
-        const __mmask8 cmp_mask = _mm256_mask_cmp_epi32_mask(cmpl_mask, vv, _mm512_castsi512_si256(upper_v), pred_upper);
+        const __m256i vl = _mm256_loadu_si256((const __m256i*)(left + size16));
+        const __m256i vr = _mm256_loadu_si256((const __m256i*)(right + size16));
+        const __mmask8 cmp_mask = _mm256_cmp_epu32_mask(vl, vr, pred);
 
         res_u8[size16 / 8] = cmp_mask;
     }
@@ -1045,48 +1141,27 @@ bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<uint64_t, uint64_t, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const int64_t& lower,
-    const int64_t& upper,
-    const int64_t* const __restrict values,
+    const uint64_t* const __restrict left, 
+    const uint64_t* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    const __m512i lower_v = _mm512_set1_epi64(lower);
-    const __m512i upper_v = _mm512_set1_epi64(upper);
-    constexpr auto pred_lower = ComparePredicate<int64_t, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<int64_t, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<uint64_t, Op>::value;
 
     // todo: aligned reads & writes
 
-    // interleaved pages
-    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(int64_t);
-    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-        for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
-            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
-                const __mmask8 cmpl_mask = _mm512_cmp_epi64_mask(lower_v, vv, pred_lower);
-                const __mmask8 cmp_mask = _mm512_mask_cmp_epi64_mask(cmpl_mask, vv, upper_v, pred_upper);
-
-                res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
-
-                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-            }
-        }
-    }
-
     // process big blocks
     const size_t size8 = (size / 8) * 8;
-    for (size_t i = size_8p; i < size8; i += 8) {
-        const __m512i vv = _mm512_loadu_si512(values + i);
-        const __mmask8 cmpl_mask = _mm512_cmp_epi64_mask(lower_v, vv, pred_lower);
-        const __mmask8 cmp_mask = _mm512_mask_cmp_epi64_mask(cmpl_mask, vv, upper_v, pred_upper);
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512i vl = _mm512_loadu_si512(left + i);
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_epu64_mask(vl, vr, pred);
 
         res_u8[i / 8] = cmp_mask;
     }
@@ -1094,49 +1169,28 @@ bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<float, float, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const float& lower,
-    const float& upper,
-    const float* const __restrict values,
+    const float* const __restrict left, 
+    const float* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    const __m512 lower_v = _mm512_set1_ps(lower);
-    const __m512 upper_v = _mm512_set1_ps(upper);
     uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
-    constexpr auto pred_lower = ComparePredicate<float, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<float, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<float, Op>::value;
 
     // todo: aligned reads & writes
 
-    // interleaved pages
-    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(float);
-    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-        for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
-            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                const __m512 vv = _mm512_loadu_ps(values + i + p + ip * BLOCK_COUNT);
-                const __mmask16 cmpl_mask = _mm512_cmp_ps_mask(lower_v, vv, pred_lower);
-                const __mmask16 cmp_mask = _mm512_mask_cmp_ps_mask(cmpl_mask, vv, upper_v, pred_upper);
-
-                res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
-
-                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-            }
-        }
-    }
-
-    // process big blocks
-    const size_t size16 = (size / 16) * 16;
-    for (size_t i = size_8p; i < size16; i += 16) {
-        const __m512 vv = _mm512_loadu_ps(values + i);
-        const __mmask16 cmpl_mask = _mm512_cmp_ps_mask(lower_v, vv, pred_lower);
-        const __mmask16 cmp_mask = _mm512_mask_cmp_ps_mask(cmpl_mask, vv, upper_v, pred_upper);
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m512 vl = _mm512_loadu_ps(left + i);
+        const __m512 vr = _mm512_loadu_ps(right + i);
+        const __mmask16 cmp_mask = _mm512_cmp_ps_mask(vl, vr, pred);
 
         res_u16[i / 16] = cmp_mask;
     }
@@ -1144,9 +1198,9 @@ bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
     // process leftovers
     if (size16 != size) {
         // process 8 elements
-        const __m256 vv = _mm256_loadu_ps(values + size16);
-        const __mmask8 cmpl_mask = _mm256_cmp_ps_mask(_mm512_castps512_ps256(lower_v), vv, pred_lower);
-        const __mmask8 cmp_mask = _mm256_mask_cmp_ps_mask(cmpl_mask, vv, _mm512_castps512_ps256(upper_v), pred_upper);
+        const __m256 vl = _mm256_loadu_ps(left + size16);
+        const __m256 vr = _mm256_loadu_ps(right + size16);
+        const __mmask8 cmp_mask = _mm256_cmp_ps_mask(vl, vr, pred);
 
         res_u8[size16 / 8] = cmp_mask;
     }
@@ -1154,48 +1208,55 @@ bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
     return true;
 }
 
-template<RangeType Op>
-bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
+template<CompareOpType Op>
+bool OpCompareColumnImpl<double, double, Op>::op_compare_column(
     uint8_t* const __restrict res_u8,
-    const double& lower,
-    const double& upper,
-    const double* const __restrict values,
+    const double* const __restrict left, 
+    const double* const __restrict right, 
     const size_t size
 ) {
     // the restriction of the API
     assert((size % 8) == 0);
     
     //
-    const __m512d lower_v = _mm512_set1_pd(lower);
-    const __m512d upper_v = _mm512_set1_pd(upper);
-    constexpr auto pred_lower = ComparePredicate<double, Range2Compare<Op>::lower>::value;
-    constexpr auto pred_upper = ComparePredicate<double, Range2Compare<Op>::upper>::value;
+    constexpr auto pred = ComparePredicate<double, Op>::value;
 
     // todo: aligned reads & writes
 
-    // interleaved pages
-    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(double);
-    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-        for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
-            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                const __m512d vv = _mm512_loadu_pd(values + i + p + ip * BLOCK_COUNT);
-                const __mmask8 cmpl_mask = _mm512_cmp_pd_mask(lower_v, vv, pred_lower);
-                const __mmask8 cmp_mask = _mm512_mask_cmp_pd_mask(cmpl_mask, vv, upper_v, pred_upper);
-
-                res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512d vl = _mm512_loadu_pd(left + i);
+        const __m512d vr = _mm512_loadu_pd(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_pd_mask(vl, vr, pred);
 
-                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-            }
-        }
+        res_u8[i / 8] = cmp_mask;
     }
 
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int8_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    constexpr auto pred = ComparePredicate<int64_t, Op>::value;
+
+    // todo: aligned reads & writes
+
     // process big blocks
     const size_t size8 = (size / 8) * 8;
-    for (size_t i = size_8p; i < size8; i += 8) {
-        const __m512d vv = _mm512_loadu_pd(values + i);
-        const __mmask8 cmpl_mask = _mm512_cmp_pd_mask(lower_v, vv, pred_lower);
-        const __mmask8 cmp_mask = _mm512_mask_cmp_pd_mask(cmpl_mask, vv, upper_v, pred_upper);
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512i vl = _mm512_cvtepi8_epi64(_mm_loadl_epi64((const __m128i*)(left + i)));
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_epi64_mask(vl, vr, pred);
 
         res_u8[i / 8] = cmp_mask;
     }
@@ -1203,167 +1264,2179 @@ bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
     return true;
 }
 
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int16_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    constexpr auto pred = ComparePredicate<int64_t, Op>::value;
 
-///////////////////////////////////////////////////////////////////////////
-
-namespace {
+    // todo: aligned reads & writes
 
-//
-template<ArithOpType AOp, CompareOpType CmpOp>
-struct ArithHelperI64 {};
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512i vl = _mm512_cvtepi16_epi64(_mm_loadu_si128((const __m128i*)(left + i)));
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_epi64_mask(vl, vr, pred);
 
-template<CompareOpType CmpOp>
-struct ArithHelperI64<ArithOpType::Add, CmpOp> {
-    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
-        // left + right == value
-        constexpr auto pred = ComparePredicate<int64_t, CmpOp>::value;
-        return _mm512_cmp_epi64_mask(_mm512_add_epi64(left, right), value, pred);
+        res_u8[i / 8] = cmp_mask;
     }
-};
 
-template<CompareOpType CmpOp>
-struct ArithHelperI64<ArithOpType::Sub, CmpOp> {
-    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
-        // left - right == value
-        constexpr auto pred = ComparePredicate<int64_t, CmpOp>::value;
-        return _mm512_cmp_epi64_mask(_mm512_sub_epi64(left, right), value, pred);
-    }
-};
+    return true;
+}
 
-template<CompareOpType CmpOp>
-struct ArithHelperI64<ArithOpType::Mul, CmpOp> {
-    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
-        // left * right == value
-        constexpr auto pred = ComparePredicate<int64_t, CmpOp>::value;
-        return _mm512_cmp_epi64_mask(_mm512_mullo_epi64(left, right), value, pred);
-    }
-};
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, int64_t, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const int64_t* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    constexpr auto pred = ComparePredicate<int64_t, Op>::value;
 
-//
-template<ArithOpType AOp, CompareOpType CmpOp>
-struct ArithHelperF32 {};
+    // todo: aligned reads & writes
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Add, CmpOp> {
-    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
-        // left + right == value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm512_cmp_ps_mask(_mm512_add_ps(left, right), value, pred);
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512i vl = _mm512_cvtepi32_epi64(_mm256_loadu_si256((const __m256i*)(left + i)));
+        const __m512i vr = _mm512_loadu_si512(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_epi64_mask(vl, vr, pred);
+
+        res_u8[i / 8] = cmp_mask;
     }
-};
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Sub, CmpOp> {
-    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
-        // left - right == value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm512_cmp_ps_mask(_mm512_sub_ps(left, right), value, pred);
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, float, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const float* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
+    constexpr auto pred = ComparePredicate<float, Op>::value;
+
+    // todo: aligned reads & writes
+
+    // int32_t is rounded to float, the same way as C++ does
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m512 vl = _mm512_cvtepi32_ps(_mm512_loadu_si512(left + i));
+        const __m512 vr = _mm512_loadu_ps(right + i);
+        const __mmask16 cmp_mask = _mm512_cmp_ps_mask(vl, vr, pred);
+
+        res_u16[i / 16] = cmp_mask;
     }
-};
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Mul, CmpOp> {
-    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
-        // left * right == value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm512_cmp_ps_mask(_mm512_mul_ps(left, right), value, pred);
+    // process leftovers
+    if (size16 != size) {
+        // 8 elements to process
+        const __m256 vl = _mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i*)(left + size16)));
+        const __m256 vr = _mm256_loadu_ps(right + size16);
+        const __mmask8 cmp_mask = _mm256_cmp_ps_mask(vl, vr, pred);
+
+        res_u8[size16 / 8] = cmp_mask;
     }
-};
 
-template<CompareOpType CmpOp>
-struct ArithHelperF32<ArithOpType::Div, CmpOp> {
-    static inline __mmask16 op_special(const __m512 left, const __m512 right, const __m512 value) {
-        // this is valid for the positive denominator, == and != cases.
-        // left == right * value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm512_cmp_ps_mask(left, _mm512_mul_ps(right, value), pred);
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<int32_t, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    constexpr auto pred = ComparePredicate<double, Op>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512d vl = _mm512_cvtepi32_pd(_mm256_loadu_si256((const __m256i*)(left + i)));
+        const __m512d vr = _mm512_loadu_pd(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_pd_mask(vl, vr, pred);
+
+        res_u8[i / 8] = cmp_mask;
     }
 
-    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
-        // left / right == value
-        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
-        return _mm512_cmp_ps_mask(_mm512_div_ps(left, right), value, pred);
+    return true;
+}
+
+template<CompareOpType Op>
+bool OpCompareColumnImpl<float, double, Op>::op_compare_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict left, 
+    const double* const __restrict right, 
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    constexpr auto pred = ComparePredicate<double, Op>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512d vl = _mm512_cvtps_pd(_mm256_loadu_ps(left + i));
+        const __m512d vr = _mm512_loadu_pd(right + i);
+        const __mmask8 cmp_mask = _mm512_cmp_pd_mask(vl, vr, pred);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+//
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int8_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict lower,
+    const int8_t* const __restrict upper,
+    const int8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    uint64_t* const __restrict res_u64 = reinterpret_cast<uint64_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<int8_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<int8_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size64 = (size / 64) * 64;
+    for (size_t i = 0; i < size64; i += 64) {
+        const __m512i vl = _mm512_loadu_si512(lower + i);
+        const __m512i vu = _mm512_loadu_si512(upper + i);
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(vl, vv, pred_lower);
+        const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u64[i / 64] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size64 != size) {
+        // 8, 16, 24, 32, 40, 48 or 56 elements to process
+        const uint64_t mask = get_mask(size - size64);
+        const __m512i vl = _mm512_maskz_loadu_epi8(mask, lower + size64);
+        const __m512i vu = _mm512_maskz_loadu_epi8(mask, upper + size64);
+        const __m512i vv = _mm512_maskz_loadu_epi8(mask, values + size64);
+        const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(vl, vv, pred_lower);
+        const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, vu, pred_upper);
+
+        const uint16_t store_mask = get_mask((size - size64) / 8);
+        _mm_mask_storeu_epi8(
+            res_u64 + size64 / 64, 
+            store_mask, 
+            _mm_setr_epi64(__m64(cmp_mask), __m64(0ULL))
+        );
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int16_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict lower,
+    const int16_t* const __restrict upper,
+    const int16_t* const __restrict values,
+    const size_t size
+) {
+
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<int16_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<int16_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m512i vl = _mm512_loadu_si512(lower + i);
+        const __m512i vu = _mm512_loadu_si512(upper + i);
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(vl, vv, pred_lower);
+        const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u32[i / 32] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const uint32_t mask = get_mask(size - size32);
+        const __m512i vl = _mm512_maskz_loadu_epi16(mask, lower + size32);
+        const __m512i vu = _mm512_maskz_loadu_epi16(mask, upper + size32);
+        const __m512i vv = _mm512_maskz_loadu_epi16(mask, values + size32);
+        const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(vl, vv, pred_lower);
+        const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, vu, pred_upper);
+
+        const uint16_t store_mask = get_mask((size - size32) / 8);
+        _mm_mask_storeu_epi8(
+            res_u32 + size32 / 32, 
+            store_mask, 
+            _mm_setr_epi32(cmp_mask, 0, 0, 0)
+        );
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int32_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict lower,
+    const int32_t* const __restrict upper,
+    const int32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<int32_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<int32_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m512i vl = _mm512_loadu_si512(lower + i);
+        const __m512i vu = _mm512_loadu_si512(upper + i);
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask16 cmpl_mask = _mm512_cmp_epi32_mask(vl, vv, pred_lower);
+        const __mmask16 cmp_mask = _mm512_mask_cmp_epi32_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u16[i / 16] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size16 != size) {
+        // 8 elements to process
+        const __m256i vl = _mm256_loadu_si256((const __m256i*)(lower + size16));
+        const __m256i vu = _mm256_loadu_si256((const __m256i*)(upper + size16));
+        const __m256i vv = _mm256_loadu_si256((const __m256i*)(values + size16));
+        const __mmask8 cmpl_mask = _mm256_cmp_epi32_mask(vl, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm256_mask_cmp_epi32_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u8[size16 / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<int64_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict lower,
+    const int64_t* const __restrict upper,
+    const int64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    constexpr auto pred_lower = ComparePredicate<int64_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<int64_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512i vl = _mm512_loadu_si512(lower + i);
+        const __m512i vu = _mm512_loadu_si512(upper + i);
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask8 cmpl_mask = _mm512_cmp_epi64_mask(vl, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm512_mask_cmp_epi64_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint8_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint8_t* const __restrict lower,
+    const uint8_t* const __restrict upper,
+    const uint8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    uint64_t* const __restrict res_u64 = reinterpret_cast<uint64_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<uint8_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<uint8_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size64 = (size / 64) * 64;
+    for (size_t i = 0; i < size64; i += 64) {
+        const __m512i vl = _mm512_loadu_si512(lower + i);
+        const __m512i vu = _mm512_loadu_si512(upper + i);
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask64 cmpl_mask = _mm512_cmp_epu8_mask(vl, vv, pred_lower);
+        const __mmask64 cmp_mask = _mm512_mask_cmp_epu8_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u64[i / 64] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size64 != size) {
+        // 8, 16, 24, 32, 40, 48 or 56 elements to process
+        const uint64_t mask = get_mask(size - size64);
+        const __m512i vl = _mm512_maskz_loadu_epi8(mask, lower + size64);
+        const __m512i vu = _mm512_maskz_loadu_epi8(mask, upper + size64);
+        const __m512i vv = _mm512_maskz_loadu_epi8(mask, values + size64);
+        const __mmask64 cmpl_mask = _mm512_cmp_epu8_mask(vl, vv, pred_lower);
+        const __mmask64 cmp_mask = _mm512_mask_cmp_epu8_mask(cmpl_mask, vv, vu, pred_upper);
+
+        const uint16_t store_mask = get_mask((size - size64) / 8);
+        _mm_mask_storeu_epi8(
+            res_u64 + size64 / 64, 
+            store_mask, 
+            _mm_setr_epi64(__m64(cmp_mask), __m64(0ULL))
+        );
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint16_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint16_t* const __restrict lower,
+    const uint16_t* const __restrict upper,
+    const uint16_t* const __restrict values,
+    const size_t size
+) {
+
+    // the restriction of the API
+    assert((size % 8) == 0);
+
+    //
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<uint16_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<uint16_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = 0; i < size32; i += 32) {
+        const __m512i vl = _mm512_loadu_si512(lower + i);
+        const __m512i vu = _mm512_loadu_si512(upper + i);
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask32 cmpl_mask = _mm512_cmp_epu16_mask(vl, vv, pred_lower);
+        const __mmask32 cmp_mask = _mm512_mask_cmp_epu16_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u32[i / 32] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const uint32_t mask = get_mask(size - size32);
+        const __m512i vl = _mm512_maskz_loadu_epi16(mask, lower + size32);
+        const __m512i vu = _mm512_maskz_loadu_epi16(mask, upper + size32);
+        const __m512i vv = _mm512_maskz_loadu_epi16(mask, values + size32);
+        const __mmask32 cmpl_mask = _mm512_cmp_epu16_mask(vl, vv, pred_lower);
+        const __mmask32 cmp_mask = _mm512_mask_cmp_epu16_mask(cmpl_mask, vv, vu, pred_upper);
+
+        const uint16_t store_mask = get_mask((size - size32) / 8);
+        _mm_mask_storeu_epi8(
+            res_u32 + size32 / 32, 
+            store_mask, 
+            _mm_setr_epi32(cmp_mask, 0, 0, 0)
+        );
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint32_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict lower,
+    const uint32_t* const __restrict upper,
+    const uint32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<uint32_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<uint32_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m512i vl = _mm512_loadu_si512(lower + i);
+        const __m512i vu = _mm512_loadu_si512(upper + i);
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask16 cmpl_mask = _mm512_cmp_epu32_mask(vl, vv, pred_lower);
+        const __mmask16 cmp_mask = _mm512_mask_cmp_epu32_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u16[i / 16] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size16 != size) {
+        // 8 elements to process
+        const __m256i vl = _mm256_loadu_si256((const __m256i*)(lower + size16));
+        const __m256i vu = _mm256_loadu_si256((const __m256i*)(upper + size16));
+        const __m256i vv = _mm256_loadu_si256((const __m256i*)(values + size16));
+        const __mmask8 cmpl_mask = _mm256_cmp_epu32_mask(vl, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm256_mask_cmp_epu32_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u8[size16 / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<uint64_t, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict lower,
+    const uint64_t* const __restrict upper,
+    const uint64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    constexpr auto pred_lower = ComparePredicate<uint64_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<uint64_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512i vl = _mm512_loadu_si512(lower + i);
+        const __m512i vu = _mm512_loadu_si512(upper + i);
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask8 cmpl_mask = _mm512_cmp_epu64_mask(vl, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm512_mask_cmp_epu64_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<float, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict lower,
+    const float* const __restrict upper,
+    const float* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<float, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<float, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = 0; i < size16; i += 16) {
+        const __m512 vl = _mm512_loadu_ps(lower + i);
+        const __m512 vu = _mm512_loadu_ps(upper + i);
+        const __m512 vv = _mm512_loadu_ps(values + i);
+        const __mmask16 cmpl_mask = _mm512_cmp_ps_mask(vl, vv, pred_lower);
+        const __mmask16 cmp_mask = _mm512_mask_cmp_ps_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u16[i / 16] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size16 != size) {
+        // process 8 elements
+        const __m256 vl = _mm256_loadu_ps(lower + size16);
+        const __m256 vu = _mm256_loadu_ps(upper + size16);
+        const __m256 vv = _mm256_loadu_ps(values + size16);
+        const __mmask8 cmpl_mask = _mm256_cmp_ps_mask(vl, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm256_mask_cmp_ps_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u8[size16 / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeColumnImpl<double, Op>::op_within_range_column(
+    uint8_t* const __restrict res_u8,
+    const double* const __restrict lower,
+    const double* const __restrict upper,
+    const double* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    constexpr auto pred_lower = ComparePredicate<double, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<double, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = 0; i < size8; i += 8) {
+        const __m512d vl = _mm512_loadu_pd(lower + i);
+        const __m512d vu = _mm512_loadu_pd(upper + i);
+        const __m512d vv = _mm512_loadu_pd(values + i);
+        const __mmask8 cmpl_mask = _mm512_cmp_pd_mask(vl, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm512_mask_cmp_pd_mask(cmpl_mask, vv, vu, pred_upper);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+//
+template<RangeType Op>
+bool OpWithinRangeValImpl<int8_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int8_t& lower,
+    const int8_t& upper,
+    const int8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512i lower_v = _mm512_set1_epi8(lower);
+    const __m512i upper_v = _mm512_set1_epi8(upper);
+    uint64_t* const __restrict res_u64 = reinterpret_cast<uint64_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<int8_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<int8_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(int8_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 64) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
+                const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(lower_v, vv, pred_lower);
+                const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u64[(i + p + ip * BLOCK_COUNT) / 64] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size64 = (size / 64) * 64;
+    for (size_t i = size_8p; i < size64; i += 64) {
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(lower_v, vv, pred_lower);
+        const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u64[i / 64] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size64 != size) {
+        // 8, 16, 24, 32, 40, 48 or 56 elements to process
+        const uint64_t mask = get_mask(size - size64);
+        const __m512i vv = _mm512_maskz_loadu_epi8(mask, values + size64);
+        const __mmask64 cmpl_mask = _mm512_cmp_epi8_mask(lower_v, vv, pred_lower);
+        const __mmask64 cmp_mask = _mm512_mask_cmp_epi8_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        const uint16_t store_mask = get_mask((size - size64) / 8);
+        _mm_mask_storeu_epi8(
+            res_u64 + size64 / 64, 
+            store_mask, 
+            _mm_setr_epi64(__m64(cmp_mask), __m64(0ULL))
+        );
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int16_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int16_t& lower,
+    const int16_t& upper,
+    const int16_t* const __restrict values,
+    const size_t size
+) {
+
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512i lower_v = _mm512_set1_epi16(lower);
+    const __m512i upper_v = _mm512_set1_epi16(upper);
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<int16_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<int16_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(int16_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 32) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
+                const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(lower_v, vv, pred_lower);
+                const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u32[(i + p + ip * BLOCK_COUNT) / 32] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = size_8p; i < size32; i += 32) {
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(lower_v, vv, pred_lower);
+        const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u32[i / 32] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const uint32_t mask = get_mask(size - size32);
+        const __m512i vv = _mm512_maskz_loadu_epi16(mask, values + size32);
+        const __mmask32 cmpl_mask = _mm512_cmp_epi16_mask(lower_v, vv, pred_lower);
+        const __mmask32 cmp_mask = _mm512_mask_cmp_epi16_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        const uint16_t store_mask = get_mask((size - size32) / 8);
+        _mm_mask_storeu_epi8(
+            res_u32 + size32 / 32, 
+            store_mask, 
+            _mm_setr_epi32(cmp_mask, 0, 0, 0)
+        );
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int32_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int32_t& lower,
+    const int32_t& upper,
+    const int32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512i lower_v = _mm512_set1_epi32(lower);
+    const __m512i upper_v = _mm512_set1_epi32(upper);
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<int32_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<int32_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(int32_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
+                const __mmask16 cmpl_mask = _mm512_cmp_epi32_mask(lower_v, vv, pred_lower);
+                const __mmask16 cmp_mask = _mm512_mask_cmp_epi32_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = size_8p; i < size16; i += 16) {
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask16 cmpl_mask = _mm512_cmp_epi32_mask(lower_v, vv, pred_lower);
+        const __mmask16 cmp_mask = _mm512_mask_cmp_epi32_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u16[i / 16] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size16 != size) {
+        // 8 elements to process
+        const __m256i vv = _mm256_loadu_si256((const __m256i*)(values + size16));
+        const __mmask8 cmpl_mask = _mm256_cmp_epi32_mask(_mm512_castsi512_si256(lower_v), vv, pred_lower);
+        const __mmask8 cmp_mask = _mm256_mask_cmp_epi32_mask(cmpl_mask, vv, _mm512_castsi512_si256(upper_v), pred_upper);
+
+        res_u8[size16 / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<int64_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const int64_t& lower,
+    const int64_t& upper,
+    const int64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512i lower_v = _mm512_set1_epi64(lower);
+    const __m512i upper_v = _mm512_set1_epi64(upper);
+    constexpr auto pred_lower = ComparePredicate<int64_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<int64_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(int64_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
+                const __mmask8 cmpl_mask = _mm512_cmp_epi64_mask(lower_v, vv, pred_lower);
+                const __mmask8 cmp_mask = _mm512_mask_cmp_epi64_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = size_8p; i < size8; i += 8) {
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask8 cmpl_mask = _mm512_cmp_epi64_mask(lower_v, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm512_mask_cmp_epi64_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint8_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint8_t& lower,
+    const uint8_t& upper,
+    const uint8_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512i lower_v = _mm512_set1_epi8(lower);
+    const __m512i upper_v = _mm512_set1_epi8(upper);
+    uint64_t* const __restrict res_u64 = reinterpret_cast<uint64_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<uint8_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<uint8_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(uint8_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 64) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
+                const __mmask64 cmpl_mask = _mm512_cmp_epu8_mask(lower_v, vv, pred_lower);
+                const __mmask64 cmp_mask = _mm512_mask_cmp_epu8_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u64[(i + p + ip * BLOCK_COUNT) / 64] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size64 = (size / 64) * 64;
+    for (size_t i = size_8p; i < size64; i += 64) {
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask64 cmpl_mask = _mm512_cmp_epu8_mask(lower_v, vv, pred_lower);
+        const __mmask64 cmp_mask = _mm512_mask_cmp_epu8_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u64[i / 64] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size64 != size) {
+        // 8, 16, 24, 32, 40, 48 or 56 elements to process
+        const uint64_t mask = get_mask(size - size64);
+        const __m512i vv = _mm512_maskz_loadu_epi8(mask, values + size64);
+        const __mmask64 cmpl_mask = _mm512_cmp_epu8_mask(lower_v, vv, pred_lower);
+        const __mmask64 cmp_mask = _mm512_mask_cmp_epu8_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        const uint16_t store_mask = get_mask((size - size64) / 8);
+        _mm_mask_storeu_epi8(
+            res_u64 + size64 / 64, 
+            store_mask, 
+            _mm_setr_epi64(__m64(cmp_mask), __m64(0ULL))
+        );
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint16_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint16_t& lower,
+    const uint16_t& upper,
+    const uint16_t* const __restrict values,
+    const size_t size
+) {
+
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512i lower_v = _mm512_set1_epi16(lower);
+    const __m512i upper_v = _mm512_set1_epi16(upper);
+    uint32_t* const __restrict res_u32 = reinterpret_cast<uint32_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<uint16_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<uint16_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(uint16_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 32) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
+                const __mmask32 cmpl_mask = _mm512_cmp_epu16_mask(lower_v, vv, pred_lower);
+                const __mmask32 cmp_mask = _mm512_mask_cmp_epu16_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u32[(i + p + ip * BLOCK_COUNT) / 32] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size32 = (size / 32) * 32;
+    for (size_t i = size_8p; i < size32; i += 32) {
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask32 cmpl_mask = _mm512_cmp_epu16_mask(lower_v, vv, pred_lower);
+        const __mmask32 cmp_mask = _mm512_mask_cmp_epu16_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u32[i / 32] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size32 != size) {
+        // 8, 16 or 24 elements to process
+        const uint32_t mask = get_mask(size - size32);
+        const __m512i vv = _mm512_maskz_loadu_epi16(mask, values + size32);
+        const __mmask32 cmpl_mask = _mm512_cmp_epu16_mask(lower_v, vv, pred_lower);
+        const __mmask32 cmp_mask = _mm512_mask_cmp_epu16_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        const uint16_t store_mask = get_mask((size - size32) / 8);
+        _mm_mask_storeu_epi8(
+            res_u32 + size32 / 32, 
+            store_mask, 
+            _mm_setr_epi32(cmp_mask, 0, 0, 0)
+        );
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint32_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint32_t& lower,
+    const uint32_t& upper,
+    const uint32_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512i lower_v = _mm512_set1_epi32(lower);
+    const __m512i upper_v = _mm512_set1_epi32(upper);
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<uint32_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<uint32_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(uint32_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
+                const __mmask16 cmpl_mask = _mm512_cmp_epu32_mask(lower_v, vv, pred_lower);
+                const __mmask16 cmp_mask = _mm512_mask_cmp_epu32_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = size_8p; i < size16; i += 16) {
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask16 cmpl_mask = _mm512_cmp_epu32_mask(lower_v, vv, pred_lower);
+        const __mmask16 cmp_mask = _mm512_mask_cmp_epu32_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u16[i / 16] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size16 != size) {
+        // 8 elements to process
+        const __m256i vv = _mm256_loadu_si256((const __m256i*)(values + size16));
+        const __mmask8 cmpl_mask = _mm256_cmp_epu32_mask(_mm512_castsi512_si256(lower_v), vv, pred_lower);
+        const __mmask8 cmp_mask = _mm256_mask_cmp_epu32_mask(cmpl_mask, vv, _mm512_castsi512_si256(upper_v), pred_upper);
+
+        res_u8[size16 / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<uint64_t, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const uint64_t& lower,
+    const uint64_t& upper,
+    const uint64_t* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512i lower_v = _mm512_set1_epi64(lower);
+    const __m512i upper_v = _mm512_set1_epi64(upper);
+    constexpr auto pred_lower = ComparePredicate<uint64_t, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<uint64_t, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(uint64_t);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512i vv = _mm512_loadu_si512(values + i + p + ip * BLOCK_COUNT);
+                const __mmask8 cmpl_mask = _mm512_cmp_epu64_mask(lower_v, vv, pred_lower);
+                const __mmask8 cmp_mask = _mm512_mask_cmp_epu64_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = size_8p; i < size8; i += 8) {
+        const __m512i vv = _mm512_loadu_si512(values + i);
+        const __mmask8 cmpl_mask = _mm512_cmp_epu64_mask(lower_v, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm512_mask_cmp_epu64_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<float, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const float& lower,
+    const float& upper,
+    const float* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512 lower_v = _mm512_set1_ps(lower);
+    const __m512 upper_v = _mm512_set1_ps(upper);
+    uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8); 
+    constexpr auto pred_lower = ComparePredicate<float, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<float, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(float);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512 vv = _mm512_loadu_ps(values + i + p + ip * BLOCK_COUNT);
+                const __mmask16 cmpl_mask = _mm512_cmp_ps_mask(lower_v, vv, pred_lower);
+                const __mmask16 cmp_mask = _mm512_mask_cmp_ps_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size16 = (size / 16) * 16;
+    for (size_t i = size_8p; i < size16; i += 16) {
+        const __m512 vv = _mm512_loadu_ps(values + i);
+        const __mmask16 cmpl_mask = _mm512_cmp_ps_mask(lower_v, vv, pred_lower);
+        const __mmask16 cmp_mask = _mm512_mask_cmp_ps_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u16[i / 16] = cmp_mask;
+    }
+
+    // process leftovers
+    if (size16 != size) {
+        // process 8 elements
+        const __m256 vv = _mm256_loadu_ps(values + size16);
+        const __mmask8 cmpl_mask = _mm256_cmp_ps_mask(_mm512_castps512_ps256(lower_v), vv, pred_lower);
+        const __mmask8 cmp_mask = _mm256_mask_cmp_ps_mask(cmpl_mask, vv, _mm512_castps512_ps256(upper_v), pred_upper);
+
+        res_u8[size16 / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+template<RangeType Op>
+bool OpWithinRangeValImpl<double, Op>::op_within_range_val(
+    uint8_t* const __restrict res_u8,
+    const double& lower,
+    const double& upper,
+    const double* const __restrict values,
+    const size_t size
+) {
+    // the restriction of the API
+    assert((size % 8) == 0);
+    
+    //
+    const __m512d lower_v = _mm512_set1_pd(lower);
+    const __m512d upper_v = _mm512_set1_pd(upper);
+    constexpr auto pred_lower = ComparePredicate<double, Range2Compare<Op>::lower>::value;
+    constexpr auto pred_upper = ComparePredicate<double, Range2Compare<Op>::upper>::value;
+
+    // todo: aligned reads & writes
+
+    // interleaved pages
+    constexpr size_t BLOCK_COUNT = PAGE_SIZE / sizeof(double);
+    const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+    for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+        for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+            for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                const __m512d vv = _mm512_loadu_pd(values + i + p + ip * BLOCK_COUNT);
+                const __mmask8 cmpl_mask = _mm512_cmp_pd_mask(lower_v, vv, pred_lower);
+                const __mmask8 cmp_mask = _mm512_mask_cmp_pd_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+                res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+
+                _mm_prefetch((const char*)(values + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+            }
+        }
+    }
+
+    // process big blocks
+    const size_t size8 = (size / 8) * 8;
+    for (size_t i = size_8p; i < size8; i += 8) {
+        const __m512d vv = _mm512_loadu_pd(values + i);
+        const __mmask8 cmpl_mask = _mm512_cmp_pd_mask(lower_v, vv, pred_lower);
+        const __mmask8 cmp_mask = _mm512_mask_cmp_pd_mask(cmpl_mask, vv, upper_v, pred_upper);
+
+        res_u8[i / 8] = cmp_mask;
+    }
+
+    return true;
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+// a broadcasted DivisorI64
+struct DivisorVecI64 {
+    DivisorI64 d;
+
+    __m512i divisor;
+    __m512i magic;
+    __m512i magic_hi;
+    // -1 if magic is negative, 0 otherwise
+    __m512i magic_sign;
+    // -1 if the divisor is negative, 0 otherwise
+    __m512i sign;
+    // -1 if the numerator needs to be added, 0 otherwise
+    __m512i add;
+    // 2^shift - 1
+    __m512i mask;
+    __m128i shift;
+
+    explicit DivisorVecI64(const int64_t right) : d{right} {
+        divisor = _mm512_set1_epi64(d.divisor);
+        magic = _mm512_set1_epi64(d.magic);
+        magic_hi = _mm512_srli_epi64(magic, 32);
+        magic_sign = _mm512_set1_epi64((d.magic < 0) ? -1 : 0);
+        sign = _mm512_set1_epi64(d.negative ? -1 : 0);
+        add = _mm512_set1_epi64(d.add ? -1 : 0);
+        mask = _mm512_set1_epi64((uint64_t(1) << d.shift) - 1);
+        shift = _mm_set_epi64x(0, d.shift);
+    }
+
+    // signed high 64 bits of x * magic
+    inline __m512i mulhi(const __m512i x) const {
+        const __m512i x_hi = _mm512_srli_epi64(x, 32);
+
+        const __m512i ll = _mm512_mul_epu32(x, magic);
+        const __m512i lh = _mm512_mul_epu32(x, magic_hi);
+        const __m512i hl = _mm512_mul_epu32(x_hi, magic);
+        const __m512i hh = _mm512_mul_epu32(x_hi, magic_hi);
+
+        const __m512i t = _mm512_add_epi64(hl, _mm512_srli_epi64(ll, 32));
+        const __m512i u = _mm512_add_epi64(lh, _mm512_and_si512(t, _mm512_set1_epi64(0xFFFFFFFF)));
+        const __m512i hi_u = _mm512_add_epi64(
+            _mm512_add_epi64(hh, _mm512_srli_epi64(t, 32)), 
+            _mm512_srli_epi64(u, 32)
+        );
+
+        // convert from unsigned to signed
+        const __m512i corr = _mm512_add_epi64(
+            _mm512_and_si512(_mm512_srai_epi64(x, 63), magic),
+            _mm512_and_si512(magic_sign, x)
+        );
+        return _mm512_sub_epi64(hi_u, corr);
+    }
+
+    // x / divisor, truncated
+    inline __m512i divide(const __m512i x) const {
+        if (d.magic == 0) {
+            // +-2^shift
+            const __m512i bias = _mm512_and_si512(_mm512_srai_epi64(x, 63), mask);
+            const __m512i q = _mm512_sra_epi64(_mm512_add_epi64(x, bias), shift);
+            return _mm512_sub_epi64(_mm512_xor_si512(q, sign), sign);
+        } else {
+            const __m512i hi = mulhi(x);
+            const __m512i x_signed = _mm512_sub_epi64(_mm512_xor_si512(x, sign), sign);
+            const __m512i uq = _mm512_add_epi64(hi, _mm512_and_si512(x_signed, add));
+            const __m512i q = _mm512_sra_epi64(uq, shift);
+            return _mm512_add_epi64(q, _mm512_srli_epi64(q, 63));
+        }
+    }
+
+    // x % divisor, the sign follows x
+    inline __m512i modulo(const __m512i x) const {
+        return _mm512_sub_epi64(x, _mm512_mullo_epi64(divide(x), divisor));
+    }
+};
+
+// Div and Mod use a precomputed divisor instead of a plain value
+template<ArithOpType AOp>
+struct ArithOperandI64 {
+    static inline __m512i make(const int64_t right) {
+        return _mm512_set1_epi64(right);
+    }
+};
+
+template<>
+struct ArithOperandI64<ArithOpType::Div> {
+    static inline DivisorVecI64 make(const int64_t right) {
+        return DivisorVecI64(right);
+    }
+};
+
+template<>
+struct ArithOperandI64<ArithOpType::Mod> {
+    static inline DivisorVecI64 make(const int64_t right) {
+        return DivisorVecI64(right);
+    }
+};
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperI64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Add, CmpOp> {
+    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
+        // left + right == value
+        constexpr auto pred = ComparePredicate<int64_t, CmpOp>::value;
+        return _mm512_cmp_epi64_mask(_mm512_add_epi64(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Sub, CmpOp> {
+    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
+        // left - right == value
+        constexpr auto pred = ComparePredicate<int64_t, CmpOp>::value;
+        return _mm512_cmp_epi64_mask(_mm512_sub_epi64(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Mul, CmpOp> {
+    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
+        // left * right == value
+        constexpr auto pred = ComparePredicate<int64_t, CmpOp>::value;
+        return _mm512_cmp_epi64_mask(_mm512_mullo_epi64(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Div, CmpOp> {
+    static inline __mmask8 op(const __m512i left, const DivisorVecI64& right, const __m512i value) {
+        // left / right == value
+        constexpr auto pred = ComparePredicate<int64_t, CmpOp>::value;
+        return _mm512_cmp_epi64_mask(right.divide(left), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperI64<ArithOpType::Mod, CmpOp> {
+    static inline __mmask8 op(const __m512i left, const DivisorVecI64& right, const __m512i value) {
+        // left % right == value
+        constexpr auto pred = ComparePredicate<int64_t, CmpOp>::value;
+        return _mm512_cmp_epi64_mask(right.modulo(left), value, pred);
+    }
+};
+
+// uint64_t uses the modular arithmetic, so only the comparison differs
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperU64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Add, CmpOp> {
+    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
+        // left + right == value
+        constexpr auto pred = ComparePredicate<uint64_t, CmpOp>::value;
+        return _mm512_cmp_epu64_mask(_mm512_add_epi64(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Sub, CmpOp> {
+    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
+        // left - right == value
+        constexpr auto pred = ComparePredicate<uint64_t, CmpOp>::value;
+        return _mm512_cmp_epu64_mask(_mm512_sub_epi64(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperU64<ArithOpType::Mul, CmpOp> {
+    static inline __mmask8 op(const __m512i left, const __m512i right, const __m512i value) {
+        // left * right == value
+        constexpr auto pred = ComparePredicate<uint64_t, CmpOp>::value;
+        return _mm512_cmp_epu64_mask(_mm512_mullo_epi64(left, right), value, pred);
+    }
+};
+
+// Narrow lanes for Add, Sub and Mul over 8-bit and 16-bit inputs.
+//   These are used instead of int64_t lanes, if ArithNarrowing
+//   guarantees that no overflow happens.
+template<typename T, typename U>
+struct ArithNarrowLanes {};
+
+template<>
+struct ArithNarrowLanes<int8_t, int16_t> {
+    // the number of elements per a register
+    static constexpr size_t N = 32;
+    using mask_type = __mmask32;
+    using store_type = uint32_t;
+
+    static inline __m512i load(const int8_t* const __restrict src) {
+        return _mm512_cvtepi8_epi16(_mm256_loadu_si256((const __m256i*)src));
+    }
+
+    static inline __m512i load_partial(const int8_t* const __restrict src, const size_t count) {
+        return _mm512_cvtepi8_epi16(_mm256_maskz_loadu_epi8(get_mask(count), src));
+    }
+
+    static inline __m512i set1(const int64_t v) {
+        return _mm512_set1_epi16(v);
+    }
+
+    template<ArithOpType AOp, CompareOpType CmpOp>
+    static inline mask_type op(const __m512i left, const __m512i right, const __m512i value) {
+        constexpr auto pred = ComparePredicate<int16_t, CmpOp>::value;
+        if constexpr (AOp == ArithOpType::Add) {
+            return _mm512_cmp_epi16_mask(_mm512_add_epi16(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Sub) {
+            return _mm512_cmp_epi16_mask(_mm512_sub_epi16(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Mul) {
+            return _mm512_cmp_epi16_mask(_mm512_mullo_epi16(left, right), value, pred);
+        } else {
+            static_assert(always_false_v<decltype(AOp)>, "unimplemented");
+        }
+    }
+};
+
+template<>
+struct ArithNarrowLanes<int8_t, int32_t> {
+    // the number of elements per a register
+    static constexpr size_t N = 16;
+    using mask_type = __mmask16;
+    using store_type = uint16_t;
+
+    static inline __m512i load(const int8_t* const __restrict src) {
+        return _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i*)src));
+    }
+
+    static inline __m512i load_partial(const int8_t* const __restrict src, const size_t count) {
+        return _mm512_cvtepi8_epi32(_mm_maskz_loadu_epi8(get_mask(count), src));
+    }
+
+    static inline __m512i set1(const int64_t v) {
+        return _mm512_set1_epi32(v);
+    }
+
+    template<ArithOpType AOp, CompareOpType CmpOp>
+    static inline mask_type op(const __m512i left, const __m512i right, const __m512i value) {
+        constexpr auto pred = ComparePredicate<int32_t, CmpOp>::value;
+        if constexpr (AOp == ArithOpType::Add) {
+            return _mm512_cmp_epi32_mask(_mm512_add_epi32(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Sub) {
+            return _mm512_cmp_epi32_mask(_mm512_sub_epi32(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Mul) {
+            return _mm512_cmp_epi32_mask(_mm512_mullo_epi32(left, right), value, pred);
+        } else {
+            static_assert(always_false_v<decltype(AOp)>, "unimplemented");
+        }
+    }
+};
+
+template<>
+struct ArithNarrowLanes<int16_t, int32_t> {
+    // the number of elements per a register
+    static constexpr size_t N = 16;
+    using mask_type = __mmask16;
+    using store_type = uint16_t;
+
+    static inline __m512i load(const int16_t* const __restrict src) {
+        return _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)src));
+    }
+
+    static inline __m512i load_partial(const int16_t* const __restrict src, const size_t count) {
+        return _mm512_cvtepi16_epi32(_mm256_maskz_loadu_epi16(get_mask(count), src));
+    }
+
+    static inline __m512i set1(const int64_t v) {
+        return _mm512_set1_epi32(v);
+    }
+
+    template<ArithOpType AOp, CompareOpType CmpOp>
+    static inline mask_type op(const __m512i left, const __m512i right, const __m512i value) {
+        constexpr auto pred = ComparePredicate<int32_t, CmpOp>::value;
+        if constexpr (AOp == ArithOpType::Add) {
+            return _mm512_cmp_epi32_mask(_mm512_add_epi32(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Sub) {
+            return _mm512_cmp_epi32_mask(_mm512_sub_epi32(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Mul) {
+            return _mm512_cmp_epi32_mask(_mm512_mullo_epi32(left, right), value, pred);
+        } else {
+            static_assert(always_false_v<decltype(AOp)>, "unimplemented");
+        }
+    }
+};
+
+template<>
+struct ArithNarrowLanes<uint8_t, int16_t> {
+    // the number of elements per a register
+    static constexpr size_t N = 32;
+    using mask_type = __mmask32;
+    using store_type = uint32_t;
+
+    static inline __m512i load(const uint8_t* const __restrict src) {
+        return _mm512_cvtepu8_epi16(_mm256_loadu_si256((const __m256i*)src));
+    }
+
+    static inline __m512i load_partial(const uint8_t* const __restrict src, const size_t count) {
+        return _mm512_cvtepu8_epi16(_mm256_maskz_loadu_epi8(get_mask(count), src));
+    }
+
+    static inline __m512i set1(const int64_t v) {
+        return _mm512_set1_epi16(v);
+    }
+
+    template<ArithOpType AOp, CompareOpType CmpOp>
+    static inline mask_type op(const __m512i left, const __m512i right, const __m512i value) {
+        constexpr auto pred = ComparePredicate<int16_t, CmpOp>::value;
+        if constexpr (AOp == ArithOpType::Add) {
+            return _mm512_cmp_epi16_mask(_mm512_add_epi16(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Sub) {
+            return _mm512_cmp_epi16_mask(_mm512_sub_epi16(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Mul) {
+            return _mm512_cmp_epi16_mask(_mm512_mullo_epi16(left, right), value, pred);
+        } else {
+            static_assert(always_false_v<decltype(AOp)>, "unimplemented");
+        }
+    }
+};
+
+template<>
+struct ArithNarrowLanes<uint8_t, int32_t> {
+    // the number of elements per a register
+    static constexpr size_t N = 16;
+    using mask_type = __mmask16;
+    using store_type = uint16_t;
+
+    static inline __m512i load(const uint8_t* const __restrict src) {
+        return _mm512_cvtepu8_epi32(_mm_loadu_si128((const __m128i*)src));
+    }
+
+    static inline __m512i load_partial(const uint8_t* const __restrict src, const size_t count) {
+        return _mm512_cvtepu8_epi32(_mm_maskz_loadu_epi8(get_mask(count), src));
+    }
+
+    static inline __m512i set1(const int64_t v) {
+        return _mm512_set1_epi32(v);
+    }
+
+    template<ArithOpType AOp, CompareOpType CmpOp>
+    static inline mask_type op(const __m512i left, const __m512i right, const __m512i value) {
+        constexpr auto pred = ComparePredicate<int32_t, CmpOp>::value;
+        if constexpr (AOp == ArithOpType::Add) {
+            return _mm512_cmp_epi32_mask(_mm512_add_epi32(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Sub) {
+            return _mm512_cmp_epi32_mask(_mm512_sub_epi32(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Mul) {
+            return _mm512_cmp_epi32_mask(_mm512_mullo_epi32(left, right), value, pred);
+        } else {
+            static_assert(always_false_v<decltype(AOp)>, "unimplemented");
+        }
+    }
+};
+
+template<>
+struct ArithNarrowLanes<uint16_t, int32_t> {
+    // the number of elements per a register
+    static constexpr size_t N = 16;
+    using mask_type = __mmask16;
+    using store_type = uint16_t;
+
+    static inline __m512i load(const uint16_t* const __restrict src) {
+        return _mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i*)src));
+    }
+
+    static inline __m512i load_partial(const uint16_t* const __restrict src, const size_t count) {
+        return _mm512_cvtepu16_epi32(_mm256_maskz_loadu_epi16(get_mask(count), src));
+    }
+
+    static inline __m512i set1(const int64_t v) {
+        return _mm512_set1_epi32(v);
+    }
+
+    template<ArithOpType AOp, CompareOpType CmpOp>
+    static inline mask_type op(const __m512i left, const __m512i right, const __m512i value) {
+        constexpr auto pred = ComparePredicate<int32_t, CmpOp>::value;
+        if constexpr (AOp == ArithOpType::Add) {
+            return _mm512_cmp_epi32_mask(_mm512_add_epi32(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Sub) {
+            return _mm512_cmp_epi32_mask(_mm512_sub_epi32(left, right), value, pred);
+        } else if constexpr (AOp == ArithOpType::Mul) {
+            return _mm512_cmp_epi32_mask(_mm512_mullo_epi32(left, right), value, pred);
+        } else {
+            static_assert(always_false_v<decltype(AOp)>, "unimplemented");
+        }
+    }
+};
+
+// processes `left AOp right ?? value` using U lanes.
+// ArithNarrowing<T, U>::fits<AOp>() must be true.
+template<typename T, typename U, ArithOpType AOp, CompareOpType CmpOp>
+inline void op_arith_compare_narrow(
+    uint8_t* const __restrict res_u8,
+    const T* const __restrict src,
+    const int64_t right_operand,
+    const int64_t value,
+    const size_t size
+) {
+    using Lanes = ArithNarrowLanes<T, U>;
+    constexpr size_t N = Lanes::N;
+
+    const __m512i right_v = Lanes::set1(right_operand);
+    const __m512i value_v = Lanes::set1(value);
+    typename Lanes::store_type* const __restrict res_m = 
+        reinterpret_cast<typename Lanes::store_type*>(res_u8);
+
+    // process big blocks
+    const size_t sizeN = (size / N) * N;
+    for (size_t i = 0; i < sizeN; i += N) {
+        const __m512i v = Lanes::load(src + i);
+        const typename Lanes::mask_type cmp_mask = 
+            Lanes::template op<AOp, CmpOp>(v, right_v, value_v);
+
+        res_m[i / N] = cmp_mask;
+    }
+
+    // process leftovers
+    if (sizeN != size) {
+        // a multiple of 8 elements to process
+        const __m512i v = Lanes::load_partial(src + sizeN, size - sizeN);
+        const typename Lanes::mask_type cmp_mask = 
+            Lanes::template op<AOp, CmpOp>(v, right_v, value_v);
+
+        for (size_t j = 0; j < (size - sizeN) / 8; j++) {
+            res_u8[sizeN / 8 + j] = uint8_t(cmp_mask >> (j * 8));
+        }
+    }
+}
+
+// std::fmod(x, y), bit for bit.
+// x - trunc(x / y) * y is computed exactly with fma, if trunc(x / y) is exact
+//   and is wrong by 1 at most, which is the case for |x / y| < 2^51 (2^22 for floats).
+//   Such a quotient is fixed by looking at the sign and the magnitude of the remainder.
+// |x| < |y| case returns x, this also handles y = +-inf.
+// The rest of lanes (NaN, Inf, zero divisor, huge quotients) are rare and
+//   are processed with std::fmod.
+inline __m512d fmod_pd(const __m512d x, const __m512d y) {
+    const __m512i sign_bit = _mm512_set1_epi64(0x8000000000000000ULL);
+    const __m512d zero = _mm512_setzero_pd();
+
+    const __m512d abs_x = _mm512_abs_pd(x);
+    const __m512d abs_y = _mm512_abs_pd(y);
+
+    const __m512d q = _mm512_roundscale_pd(
+        _mm512_div_pd(x, y), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m512d r0 = _mm512_fnmadd_pd(q, y, x);
+
+    // +1 or -1, the sign of the quotient
+    const __m512d s = _mm512_castsi512_pd(_mm512_or_si512(
+        _mm512_and_si512(_mm512_xor_si512(_mm512_castpd_si512(x), _mm512_castpd_si512(y)), sign_bit),
+        _mm512_castpd_si512(_mm512_set1_pd(1.0))));
+
+    // the quotient is too small or too large by 1
+    const __mmask8 too_small = _mm512_cmp_pd_mask(_mm512_abs_pd(r0), abs_y, _CMP_GE_OQ);
+    const __mmask8 too_large = 
+        _mm512_test_epi64_mask(_mm512_xor_si512(_mm512_castpd_si512(r0), _mm512_castpd_si512(x)), sign_bit) &
+        _mm512_cmp_pd_mask(r0, zero, _CMP_NEQ_OQ);
+    __m512d q1 = _mm512_mask_add_pd(q, too_small, q, s);
+    q1 = _mm512_mask_sub_pd(q1, too_large, q1, s);
+
+    // the sign of the remainder is the sign of x, including zeros
+    const __m512d r1 = _mm512_fnmadd_pd(q1, y, x);
+    const __m512d r = _mm512_castsi512_pd(_mm512_or_si512(
+        _mm512_andnot_si512(sign_bit, _mm512_castpd_si512(r1)),
+        _mm512_and_si512(sign_bit, _mm512_castpd_si512(x))));
+
+    const __mmask8 is_small = _mm512_cmp_pd_mask(abs_x, abs_y, _CMP_LT_OQ);
+    const __mmask8 is_fast = _mm512_cmp_pd_mask(_mm512_abs_pd(q), _mm512_set1_pd(2251799813685248.0), _CMP_LT_OQ);
+    const __m512d result = _mm512_mask_blend_pd(is_small, r, x);
+
+    const __mmask8 is_slow = ~(is_small | is_fast);
+    if (is_slow == 0) {
+        return result;
+    }
+
+    double x_s[8];
+    double y_s[8];
+    double result_s[8];
+    _mm512_storeu_pd(x_s, x);
+    _mm512_storeu_pd(y_s, y);
+    _mm512_storeu_pd(result_s, result);
+    for (size_t i = 0; i < 8; i++) {
+        if (is_slow & (1 << i)) {
+            result_s[i] = std::fmod(x_s[i], y_s[i]);
+        }
+    }
+
+    return _mm512_loadu_pd(result_s);
+}
+
+inline __m512 fmod_ps(const __m512 x, const __m512 y) {
+    const __m512i sign_bit = _mm512_set1_epi32(0x80000000);
+    const __m512 zero = _mm512_setzero_ps();
+
+    const __m512 abs_x = _mm512_abs_ps(x);
+    const __m512 abs_y = _mm512_abs_ps(y);
+
+    const __m512 q = _mm512_roundscale_ps(
+        _mm512_div_ps(x, y), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+    const __m512 r0 = _mm512_fnmadd_ps(q, y, x);
+
+    // +1 or -1, the sign of the quotient
+    const __m512 s = _mm512_castsi512_ps(_mm512_or_si512(
+        _mm512_and_si512(_mm512_xor_si512(_mm512_castps_si512(x), _mm512_castps_si512(y)), sign_bit),
+        _mm512_castps_si512(_mm512_set1_ps(1.0f))));
+
+    // the quotient is too small or too large by 1
+    const __mmask16 too_small = _mm512_cmp_ps_mask(_mm512_abs_ps(r0), abs_y, _CMP_GE_OQ);
+    const __mmask16 too_large = 
+        _mm512_test_epi32_mask(_mm512_xor_si512(_mm512_castps_si512(r0), _mm512_castps_si512(x)), sign_bit) &
+        _mm512_cmp_ps_mask(r0, zero, _CMP_NEQ_OQ);
+    __m512 q1 = _mm512_mask_add_ps(q, too_small, q, s);
+    q1 = _mm512_mask_sub_ps(q1, too_large, q1, s);
+
+    // the sign of the remainder is the sign of x, including zeros
+    const __m512 r1 = _mm512_fnmadd_ps(q1, y, x);
+    const __m512 r = _mm512_castsi512_ps(_mm512_or_si512(
+        _mm512_andnot_si512(sign_bit, _mm512_castps_si512(r1)),
+        _mm512_and_si512(sign_bit, _mm512_castps_si512(x))));
+
+    const __mmask16 is_small = _mm512_cmp_ps_mask(abs_x, abs_y, _CMP_LT_OQ);
+    const __mmask16 is_fast = _mm512_cmp_ps_mask(_mm512_abs_ps(q), _mm512_set1_ps(4194304.0f), _CMP_LT_OQ);
+    const __m512 result = _mm512_mask_blend_ps(is_small, r, x);
+
+    const __mmask16 is_slow = ~(is_small | is_fast);
+    if (is_slow == 0) {
+        return result;
+    }
+
+    float x_s[16];
+    float y_s[16];
+    float result_s[16];
+    _mm512_storeu_ps(x_s, x);
+    _mm512_storeu_ps(y_s, y);
+    _mm512_storeu_ps(result_s, result);
+    for (size_t i = 0; i < 16; i++) {
+        if (is_slow & (1 << i)) {
+            result_s[i] = std::fmod(x_s[i], y_s[i]);
+        }
+    }
+
+    return _mm512_loadu_ps(result_s);
+}
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperF32 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Add, CmpOp> {
+    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
+        // left + right == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm512_cmp_ps_mask(_mm512_add_ps(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Sub, CmpOp> {
+    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
+        // left - right == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm512_cmp_ps_mask(_mm512_sub_ps(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Mul, CmpOp> {
+    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
+        // left * right == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm512_cmp_ps_mask(_mm512_mul_ps(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Div, CmpOp> {
+    static inline __mmask16 op_special(const __m512 left, const __m512 right, const __m512 value) {
+        // this is valid for the positive denominator, == and != cases.
+        // left == right * value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm512_cmp_ps_mask(left, _mm512_mul_ps(right, value), pred);
+    }
+
+    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
+        // left / right == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm512_cmp_ps_mask(_mm512_div_ps(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF32<ArithOpType::Mod, CmpOp> {
+    static inline __mmask16 op(const __m512 left, const __m512 right, const __m512 value) {
+        // fmod(left, right) == value
+        constexpr auto pred = ComparePredicate<float, CmpOp>::value;
+        return _mm512_cmp_ps_mask(fmod_ps(left, right), value, pred);
+    }
+};
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+struct ArithHelperF64 {};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Add, CmpOp> {
+    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
+        // left + right == value
+        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
+        return _mm512_cmp_pd_mask(_mm512_add_pd(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Sub, CmpOp> {
+    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
+        // left - right == value
+        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
+        return _mm512_cmp_pd_mask(_mm512_sub_pd(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Mul, CmpOp> {
+    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
+        // left * right == value
+        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
+        return _mm512_cmp_pd_mask(_mm512_mul_pd(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Div, CmpOp> {
+    static inline __mmask8 op_special(const __m512d left, const __m512d right, const __m512d value) {
+        // this is valid for the positive denominator, == and != cases.
+        // left == right * value
+        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
+        return _mm512_cmp_pd_mask(left, _mm512_mul_pd(right, value), pred);
+    }
+
+    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
+        // left / right == value
+        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
+        return _mm512_cmp_pd_mask(_mm512_div_pd(left, right), value, pred);
+    }
+};
+
+template<CompareOpType CmpOp>
+struct ArithHelperF64<ArithOpType::Mod, CmpOp> {
+    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
+        // fmod(left, right) == value
+        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
+        return _mm512_cmp_pd_mask(fmod_pd(left, right), value, pred);
+    }
+};
+
+}
+
+//
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int8_t* const __restrict src,
+    const ArithHighPrecisionType<int8_t>& right_operand,
+    const ArithHighPrecisionType<int8_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        // int64_t lanes are not needed, if there is no overflow
+        if constexpr (AOp == ArithOpType::Add || AOp == ArithOpType::Sub || AOp == ArithOpType::Mul) {
+            if (ArithNarrowing<int8_t, int16_t>::fits<AOp>(right_operand, value)) {
+                op_arith_compare_narrow<int8_t, int16_t, AOp, CmpOp>(res_u8, src, right_operand, value, size);
+                return true;
+            } else if (ArithNarrowing<int8_t, int32_t>::fits<AOp>(right_operand, value)) {
+                op_arith_compare_narrow<int8_t, int32_t, AOp, CmpOp>(res_u8, src, right_operand, value, size);
+                return true;
+            }
+        }
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m512i value_v = _mm512_set1_epi64(value);
+
+        // interleaved pages
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int8_t));
+        const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+        for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+            for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+                for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                    const __m128i vs = _mm_loadu_si128((const __m128i*)(src + i + p + ip * BLOCK_COUNT));
+                    const __m512i v0s = _mm512_cvtepi8_epi64(_mm_unpacklo_epi64(vs, _mm_setzero_si128()));
+                    const __m512i v1s = _mm512_cvtepi8_epi64(_mm_unpackhi_epi64(vs, _mm_setzero_si128()));
+                    const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+                    const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 0] = cmp_mask0;
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 1] = cmp_mask1;
+
+                    if (p % CACHELINE_WIDTH == 0) {
+                        _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+                    }
+                }
+            }
+        }
+
+        // process big blocks
+        const size_t size16 = (size / 16) * 16;
+        for (size_t i = size_8p; i < size16; i += 16) {
+            const __m128i vs = _mm_loadu_si128((const __m128i*)(src + i));
+            const __m512i v0s = _mm512_cvtepi8_epi64(_mm_unpacklo_epi64(vs, _mm_setzero_si128()));
+            const __m512i v1s = _mm512_cvtepi8_epi64(_mm_unpackhi_epi64(vs, _mm_setzero_si128()));
+            const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+
+            res_u8[i / 8 + 0] = cmp_mask0;
+            res_u8[i / 8 + 1] = cmp_mask1;
+        }
+
+        // process leftovers
+        if (size16 != size) {
+            // process 8 elements
+            const int64_t* const __restrict src64 = (const int64_t*)(src + size16);
+            const __m128i vs = _mm_set_epi64x(0, *src64);
+            const __m512i v0s = _mm512_cvtepi8_epi64(vs);
+            const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+
+            res_u8[size16 / 8] = cmp_mask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int16_t* const __restrict src,
+    const ArithHighPrecisionType<int16_t>& right_operand,
+    const ArithHighPrecisionType<int16_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        // int64_t lanes are not needed, if there is no overflow
+        if constexpr (AOp == ArithOpType::Add || AOp == ArithOpType::Sub || AOp == ArithOpType::Mul) {
+            if (ArithNarrowing<int16_t, int32_t>::fits<AOp>(right_operand, value)) {
+                op_arith_compare_narrow<int16_t, int32_t, AOp, CmpOp>(res_u8, src, right_operand, value, size);
+                return true;
+            }
+        }
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m512i value_v = _mm512_set1_epi64(value);
+
+        // todo: aligned reads & writes
+
+        // interleaved pages
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int16_t));
+        const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+        for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+            for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+                for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                    const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i + p + ip * BLOCK_COUNT));
+                    const __m512i v0s = _mm512_cvtepi16_epi64(_mm256_extracti128_si256(vs, 0));
+                    const __m512i v1s = _mm512_cvtepi16_epi64(_mm256_extracti128_si256(vs, 1));
+                    const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+                    const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 0] = cmp_mask0;
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 1] = cmp_mask1;
+
+                    if ((2 * p) % CACHELINE_WIDTH == 0) {
+                        _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+                    }
+                }
+            }
+        }
+
+        // process big blocks
+        const size_t size16 = (size / 16) * 16;
+        for (size_t i = size_8p; i < size16; i += 16) {
+            const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i));
+            const __m512i v0s = _mm512_cvtepi16_epi64(_mm256_extracti128_si256(vs, 0));
+            const __m512i v1s = _mm512_cvtepi16_epi64(_mm256_extracti128_si256(vs, 1));
+            const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+
+            res_u8[i / 8 + 0] = cmp_mask0;
+            res_u8[i / 8 + 1] = cmp_mask1;
+        }
+
+        // process leftovers
+        if (size16 != size) {
+            // process 8 elements
+            const __m128i vs = _mm_loadu_si128((const __m128i*)(src + size16));
+            const __m512i v0s = _mm512_cvtepi16_epi64(vs);
+            const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+
+            res_u8[size16 / 8] = cmp_mask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int32_t* const __restrict src,
+    const ArithHighPrecisionType<int32_t>& right_operand,
+    const ArithHighPrecisionType<int32_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m512i value_v = _mm512_set1_epi64(value);
+
+        // todo: aligned reads & writes
+
+        // interleaved pages
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int32_t));
+        const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+        for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+            for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+                for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                    const __m512i vs = _mm512_loadu_si512((const __m512i*)(src + i + p + ip * BLOCK_COUNT));
+                    const __m512i v0s = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vs, 0));
+                    const __m512i v1s = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vs, 1));
+                    const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+                    const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 0] = cmp_mask0;
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 1] = cmp_mask1;
+
+                    _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+                }
+            }
+        }
+
+        // process big blocks
+        const size_t size16 = (size / 16) * 16;
+        for (size_t i = size_8p; i < size16; i += 16) {
+            const __m512i vs = _mm512_loadu_si512((const __m512i*)(src + i));
+            const __m512i v0s = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vs, 0));
+            const __m512i v1s = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vs, 1));
+            const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+
+            res_u8[i / 8 + 0] = cmp_mask0;
+            res_u8[i / 8 + 1] = cmp_mask1;
+        }
+
+        // process leftovers
+        if (size16 != size) {
+            // process 8 elements
+            const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + size16));
+            const __m512i v0s = _mm512_cvtepi32_epi64(vs);
+            const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+
+            res_u8[size16 / 8] = cmp_mask;
+        }
+
+        return true;
     }
-};
+}
 
-//
 template<ArithOpType AOp, CompareOpType CmpOp>
-struct ArithHelperF64 {};
+bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const int64_t* const __restrict src,
+    const ArithHighPrecisionType<int64_t>& right_operand,
+    const ArithHighPrecisionType<int64_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
 
-template<CompareOpType CmpOp>
-struct ArithHelperF64<ArithOpType::Add, CmpOp> {
-    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
-        // left + right == value
-        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
-        return _mm512_cmp_pd_mask(_mm512_add_pd(left, right), value, pred);
-    }
-};
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m512i value_v = _mm512_set1_epi64(value);
 
-template<CompareOpType CmpOp>
-struct ArithHelperF64<ArithOpType::Sub, CmpOp> {
-    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
-        // left - right == value
-        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
-        return _mm512_cmp_pd_mask(_mm512_sub_pd(left, right), value, pred);
-    }
-};
+        // todo: aligned reads & writes
 
-template<CompareOpType CmpOp>
-struct ArithHelperF64<ArithOpType::Mul, CmpOp> {
-    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
-        // left * right == value
-        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
-        return _mm512_cmp_pd_mask(_mm512_mul_pd(left, right), value, pred);
-    }
-};
+        // interleaved pages
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int64_t));
+        const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+        for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+            for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+                for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                    const __m512i v0s = _mm512_loadu_si512((const __m512i*)(src + i + p + ip * BLOCK_COUNT));
+                    const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
 
-template<CompareOpType CmpOp>
-struct ArithHelperF64<ArithOpType::Div, CmpOp> {
-    static inline __mmask8 op_special(const __m512d left, const __m512d right, const __m512d value) {
-        // this is valid for the positive denominator, == and != cases.
-        // left == right * value
-        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
-        return _mm512_cmp_pd_mask(left, _mm512_mul_pd(right, value), pred);
-    }
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
 
-    static inline __mmask8 op(const __m512d left, const __m512d right, const __m512d value) {
-        // left / right == value
-        constexpr auto pred = ComparePredicate<double, CmpOp>::value;
-        return _mm512_cmp_pd_mask(_mm512_div_pd(left, right), value, pred);
-    }
-};
+                    _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+                }
+            }
+        }
+
+        // process big blocks
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = size_8p; i < size8; i += 8) {
+            const __m512i v0s = _mm512_loadu_si512((const __m512i*)(src + i));
+            const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
 
+            res_u8[i / 8] = cmp_mask;
+        }
+
+        return true;
+    }
 }
 
-//
 template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
+bool OpArithCompareImpl<uint8_t, AOp, CmpOp>::op_arith_compare(
     uint8_t* const __restrict res_u8,
-    const int8_t* const __restrict src,
-    const ArithHighPrecisionType<int8_t>& right_operand,
-    const ArithHighPrecisionType<int8_t>& value,
+    const uint8_t* const __restrict src,
+    const ArithHighPrecisionType<uint8_t>& right_operand,
+    const ArithHighPrecisionType<uint8_t>& value,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
         return false;
     } else {
         // the restriction of the API
         assert((size % 8) == 0);
         static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
 
+        // int64_t lanes are not needed, if there is no overflow
+        if constexpr (AOp == ArithOpType::Add || AOp == ArithOpType::Sub || AOp == ArithOpType::Mul) {
+            if (ArithNarrowing<uint8_t, int16_t>::fits<AOp>(right_operand, value)) {
+                op_arith_compare_narrow<uint8_t, int16_t, AOp, CmpOp>(res_u8, src, right_operand, value, size);
+                return true;
+            } else if (ArithNarrowing<uint8_t, int32_t>::fits<AOp>(right_operand, value)) {
+                op_arith_compare_narrow<uint8_t, int32_t, AOp, CmpOp>(res_u8, src, right_operand, value, size);
+                return true;
+            }
+        }
+
         //
-        const __m512i right_v = _mm512_set1_epi64(right_operand);
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
         const __m512i value_v = _mm512_set1_epi64(value);
 
         // interleaved pages
-        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int8_t));
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(uint8_t));
         const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
         for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
             for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
                 for (size_t ip = 0; ip < N_BLOCKS; ip++) {
                     const __m128i vs = _mm_loadu_si128((const __m128i*)(src + i + p + ip * BLOCK_COUNT));
-                    const __m512i v0s = _mm512_cvtepi8_epi64(_mm_unpacklo_epi64(vs, _mm_setzero_si128()));
-                    const __m512i v1s = _mm512_cvtepi8_epi64(_mm_unpackhi_epi64(vs, _mm_setzero_si128()));
+                    const __m512i v0s = _mm512_cvtepu8_epi64(_mm_unpacklo_epi64(vs, _mm_setzero_si128()));
+                    const __m512i v1s = _mm512_cvtepu8_epi64(_mm_unpackhi_epi64(vs, _mm_setzero_si128()));
                     const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
                     const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
 
@@ -1381,8 +3454,8 @@ bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
         const size_t size16 = (size / 16) * 16;
         for (size_t i = size_8p; i < size16; i += 16) {
             const __m128i vs = _mm_loadu_si128((const __m128i*)(src + i));
-            const __m512i v0s = _mm512_cvtepi8_epi64(_mm_unpacklo_epi64(vs, _mm_setzero_si128()));
-            const __m512i v1s = _mm512_cvtepi8_epi64(_mm_unpackhi_epi64(vs, _mm_setzero_si128()));
+            const __m512i v0s = _mm512_cvtepu8_epi64(_mm_unpacklo_epi64(vs, _mm_setzero_si128()));
+            const __m512i v1s = _mm512_cvtepu8_epi64(_mm_unpackhi_epi64(vs, _mm_setzero_si128()));
             const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
             const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
 
@@ -1395,7 +3468,7 @@ bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
             // process 8 elements
             const int64_t* const __restrict src64 = (const int64_t*)(src + size16);
             const __m128i vs = _mm_set_epi64x(0, *src64);
-            const __m512i v0s = _mm512_cvtepi8_epi64(vs);
+            const __m512i v0s = _mm512_cvtepu8_epi64(vs);
             const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
 
             res_u8[size16 / 8] = cmp_mask;
@@ -1406,35 +3479,44 @@ bool OpArithCompareImpl<int8_t, AOp, CmpOp>::op_arith_compare(
 }
 
 template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
+bool OpArithCompareImpl<uint16_t, AOp, CmpOp>::op_arith_compare(
     uint8_t* const __restrict res_u8,
-    const int16_t* const __restrict src,
-    const ArithHighPrecisionType<int16_t>& right_operand,
-    const ArithHighPrecisionType<int16_t>& value,
+    const uint16_t* const __restrict src,
+    const ArithHighPrecisionType<uint16_t>& right_operand,
+    const ArithHighPrecisionType<uint16_t>& value,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
         return false;
     } else {
         // the restriction of the API
         assert((size % 8) == 0);
         static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
 
+        // int64_t lanes are not needed, if there is no overflow
+        if constexpr (AOp == ArithOpType::Add || AOp == ArithOpType::Sub || AOp == ArithOpType::Mul) {
+            if (ArithNarrowing<uint16_t, int32_t>::fits<AOp>(right_operand, value)) {
+                op_arith_compare_narrow<uint16_t, int32_t, AOp, CmpOp>(res_u8, src, right_operand, value, size);
+                return true;
+            }
+        }
+
         //
-        const __m512i right_v = _mm512_set1_epi64(right_operand);
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
         const __m512i value_v = _mm512_set1_epi64(value);
 
         // todo: aligned reads & writes
 
         // interleaved pages
-        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int16_t));
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(uint16_t));
         const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
         for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
             for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
                 for (size_t ip = 0; ip < N_BLOCKS; ip++) {
                     const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i + p + ip * BLOCK_COUNT));
-                    const __m512i v0s = _mm512_cvtepi16_epi64(_mm256_extracti128_si256(vs, 0));
-                    const __m512i v1s = _mm512_cvtepi16_epi64(_mm256_extracti128_si256(vs, 1));
+                    const __m512i v0s = _mm512_cvtepu16_epi64(_mm256_extracti128_si256(vs, 0));
+                    const __m512i v1s = _mm512_cvtepu16_epi64(_mm256_extracti128_si256(vs, 1));
                     const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
                     const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
 
@@ -1452,8 +3534,8 @@ bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
         const size_t size16 = (size / 16) * 16;
         for (size_t i = size_8p; i < size16; i += 16) {
             const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + i));
-            const __m512i v0s = _mm512_cvtepi16_epi64(_mm256_extracti128_si256(vs, 0));
-            const __m512i v1s = _mm512_cvtepi16_epi64(_mm256_extracti128_si256(vs, 1));
+            const __m512i v0s = _mm512_cvtepu16_epi64(_mm256_extracti128_si256(vs, 0));
+            const __m512i v1s = _mm512_cvtepu16_epi64(_mm256_extracti128_si256(vs, 1));
             const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
             const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
 
@@ -1465,51 +3547,226 @@ bool OpArithCompareImpl<int16_t, AOp, CmpOp>::op_arith_compare(
         if (size16 != size) {
             // process 8 elements
             const __m128i vs = _mm_loadu_si128((const __m128i*)(src + size16));
-            const __m512i v0s = _mm512_cvtepi16_epi64(vs);
+            const __m512i v0s = _mm512_cvtepu16_epi64(vs);
+            const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+
+            res_u8[size16 / 8] = cmp_mask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint32_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint32_t* const __restrict src,
+    const ArithHighPrecisionType<uint32_t>& right_operand,
+    const ArithHighPrecisionType<uint32_t>& value,
+    const size_t size
+) {
+    if ((AOp == ArithOpType::Div || AOp == ArithOpType::Mod) && right_operand == 0) {
+        // leave the division by zero to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
+
+        //
+        const auto right_v = ArithOperandI64<AOp>::make(right_operand);
+        const __m512i value_v = _mm512_set1_epi64(value);
+
+        // todo: aligned reads & writes
+
+        // interleaved pages
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(uint32_t));
+        const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+        for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+            for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+                for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                    const __m512i vs = _mm512_loadu_si512((const __m512i*)(src + i + p + ip * BLOCK_COUNT));
+                    const __m512i v0s = _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(vs, 0));
+                    const __m512i v1s = _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(vs, 1));
+                    const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+                    const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 0] = cmp_mask0;
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 1] = cmp_mask1;
+
+                    _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+                }
+            }
+        }
+
+        // process big blocks
+        const size_t size16 = (size / 16) * 16;
+        for (size_t i = size_8p; i < size16; i += 16) {
+            const __m512i vs = _mm512_loadu_si512((const __m512i*)(src + i));
+            const __m512i v0s = _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(vs, 0));
+            const __m512i v1s = _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(vs, 1));
+            const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+
+            res_u8[i / 8 + 0] = cmp_mask0;
+            res_u8[i / 8 + 1] = cmp_mask1;
+        }
+
+        // process leftovers
+        if (size16 != size) {
+            // process 8 elements
+            const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + size16));
+            const __m512i v0s = _mm512_cvtepu32_epi64(vs);
             const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
 
-            res_u8[size16 / 8] = cmp_mask;
+            res_u8[size16 / 8] = cmp_mask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<uint64_t, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const uint64_t* const __restrict src,
+    const ArithHighPrecisionType<uint64_t>& right_operand,
+    const ArithHighPrecisionType<uint64_t>& value,
+    const size_t size
+) {
+    if constexpr (AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
+        // there is no fast unsigned 64-bit division, 
+        //   so leave it to the reference implementation
+        return false;
+    } else {
+        // the restriction of the API
+        assert((size % 8) == 0);
+        static_assert(std::is_same_v<uint64_t, ArithHighPrecisionType<uint64_t>>);
+
+        //
+        const __m512i right_v = _mm512_set1_epi64(right_operand);
+        const __m512i value_v = _mm512_set1_epi64(value);
+
+        // todo: aligned reads & writes
+
+        // interleaved pages
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(uint64_t));
+        const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+        for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+            for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+                for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                    const __m512i v0s = _mm512_loadu_si512((const __m512i*)(src + i + p + ip * BLOCK_COUNT));
+                    const __mmask8 cmp_mask = ArithHelperU64<AOp, CmpOp>::op(v0s, right_v, value_v);
+
+                    res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+
+                    _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+                }
+            }
+        }
+
+        // process big blocks
+        const size_t size8 = (size / 8) * 8;
+        for (size_t i = size_8p; i < size8; i += 8) {
+            const __m512i v0s = _mm512_loadu_si512((const __m512i*)(src + i));
+            const __mmask8 cmp_mask = ArithHelperU64<AOp, CmpOp>::op(v0s, right_v, value_v);
+
+            res_u8[i / 8] = cmp_mask;
+        }
+
+        return true;
+    }
+}
+
+template<ArithOpType AOp, CompareOpType CmpOp>
+bool OpArithCompareImpl<float, AOp, CmpOp>::op_arith_compare(
+    uint8_t* const __restrict res_u8,
+    const float* const __restrict src,
+    const ArithHighPrecisionType<float>& right_operand,
+    const ArithHighPrecisionType<float>& value,
+    const size_t size
+) {
+    if constexpr (AOp == ArithOpType::Div) {
+        if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
+            // a special case that allows faster processing by using the multiplication
+            //   operation instead of the division one.
+
+            // the restriction of the API
+            assert((size % 8) == 0);
+
+            //
+            const __m512 right_v = _mm512_set1_ps(right_operand);
+            const __m512 value_v = _mm512_set1_ps(value);
+            uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+
+            // todo: aligned reads & writes
+
+            // interleaved pages
+            constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(float));
+            const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+            for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+                for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
+                    for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                        const __m512 v0s = _mm512_loadu_ps(src + i + p + ip * BLOCK_COUNT);
+                        const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+
+                        res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
+
+                        _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+                    }
+                }
+            }
+
+            // process big blocks
+            const size_t size16 = (size / 16) * 16;
+            for (size_t i = size_8p; i < size16; i += 16) {
+                const __m512 v0s = _mm512_loadu_ps(src + i);
+                const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+                res_u16[i / 16] = cmp_mask;
+            }
+
+            // process leftovers
+            if (size16 != size) {
+                // process 8 elements
+                const __m256 vs = _mm256_loadu_ps(src + size16);
+                const __m512 v0s = _mm512_castps256_ps512(vs);
+                const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+                res_u8[size16 / 8] = uint8_t(cmp_mask);
+            }
+
+            return true;
+        } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
+            // flip signs and go for the multiplication case
+            return OpArithCompareImpl<float, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
+                res_u8, src, -right_operand, -value, size
+            );
         }
 
-        return true;
+        // go with the default case
     }
-}
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const int32_t* const __restrict src,
-    const ArithHighPrecisionType<int32_t>& right_operand,
-    const ArithHighPrecisionType<int32_t>& value,
-    const size_t size
-) {
-    if constexpr(AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
-        return false;
-    } else {
+    // a default case
+    {
         // the restriction of the API
         assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
 
         //
-        const __m512i right_v = _mm512_set1_epi64(right_operand);
-        const __m512i value_v = _mm512_set1_epi64(value);
+        const __m512 right_v = _mm512_set1_ps(right_operand);
+        const __m512 value_v = _mm512_set1_ps(value);
+        uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
 
         // todo: aligned reads & writes
 
         // interleaved pages
-        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int32_t));
+        constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(float));
         const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
         for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
             for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
                 for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                    const __m512i vs = _mm512_loadu_si512((const __m512i*)(src + i + p + ip * BLOCK_COUNT));
-                    const __m512i v0s = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vs, 0));
-                    const __m512i v1s = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vs, 1));
-                    const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
-                    const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
+                    const __m512 v0s = _mm512_loadu_ps(src + i + p + ip * BLOCK_COUNT);
+                    const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op(v0s, right_v, value_v);
 
-                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 0] = cmp_mask0;
-                    res_u8[(i + p + ip * BLOCK_COUNT) / 8 + 1] = cmp_mask1;
+                    res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
 
                     _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
                 }
@@ -1519,24 +3776,18 @@ bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
         // process big blocks
         const size_t size16 = (size / 16) * 16;
         for (size_t i = size_8p; i < size16; i += 16) {
-            const __m512i vs = _mm512_loadu_si512((const __m512i*)(src + i));
-            const __m512i v0s = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vs, 0));
-            const __m512i v1s = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vs, 1));
-            const __mmask8 cmp_mask0 = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
-            const __mmask8 cmp_mask1 = ArithHelperI64<AOp, CmpOp>::op(v1s, right_v, value_v);
-
-            res_u8[i / 8 + 0] = cmp_mask0;
-            res_u8[i / 8 + 1] = cmp_mask1;
+            const __m512 v0s = _mm512_loadu_ps(src + i);
+            const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op(v0s, right_v, value_v);
+            res_u16[i / 16] = cmp_mask;
         }
 
         // process leftovers
         if (size16 != size) {
             // process 8 elements
-            const __m256i vs = _mm256_loadu_si256((const __m256i*)(src + size16));
-            const __m512i v0s = _mm512_cvtepi32_epi64(vs);
-            const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
-
-            res_u8[size16 / 8] = cmp_mask;
+            const __m256 vs = _mm256_loadu_ps(src + size16);
+            const __m512 v0s = _mm512_castps256_ps512(vs);
+            const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op(v0s, right_v, value_v);
+            res_u8[size16 / 8] = uint8_t(cmp_mask);
         }
 
         return true;
@@ -1544,23 +3795,71 @@ bool OpArithCompareImpl<int32_t, AOp, CmpOp>::op_arith_compare(
 }
 
 template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
+bool OpArithCompareImpl<double, AOp, CmpOp>::op_arith_compare(
     uint8_t* const __restrict res_u8,
-    const int64_t* const __restrict src,
-    const ArithHighPrecisionType<int64_t>& right_operand,
-    const ArithHighPrecisionType<int64_t>& value,
+    const double* const __restrict src,
+    const ArithHighPrecisionType<double>& right_operand,
+    const ArithHighPrecisionType<double>& value,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Div || AOp == ArithOpType::Mod) {
-        return false;
-    } else {
+    if constexpr (AOp == ArithOpType::Div) {
+        if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
+            // a special case that allows faster processing by using the multiplication
+            //   operation instead of the division one.
+
+            // the restriction of the API
+            assert((size % 8) == 0);
+
+            //
+            const __m512d right_v = _mm512_set1_pd(right_operand);
+            const __m512d value_v = _mm512_set1_pd(value);
+
+            // todo: aligned reads & writes
+
+            // interleaved pages
+            constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int64_t));
+            const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
+            for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
+                for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
+                    for (size_t ip = 0; ip < N_BLOCKS; ip++) {
+                        const __m512d v0s = _mm512_loadu_pd(src + i + p + ip * BLOCK_COUNT);
+                        const __mmask8 cmp_mask = ArithHelperF64<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+
+                        res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+
+                        _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
+                    }
+                }
+            }
+
+            // process big blocks
+            const size_t size8 = (size / 8) * 8;
+            for (size_t i = size_8p; i < size8; i += 8) {
+                const __m512d v0s = _mm512_loadu_pd(src + i);
+                const __mmask8 cmp_mask = ArithHelperF64<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+
+                res_u8[i / 8] = cmp_mask;
+            }
+
+            return true;
+        } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
+            // flip signs and go for the multiplication case
+            return OpArithCompareImpl<double, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
+                res_u8, src, -right_operand, -value, size
+            );
+        }
+
+        // go with the default case
+    }
+
+    // a default case
+    {
         // the restriction of the API
         assert((size % 8) == 0);
-        static_assert(std::is_same_v<int64_t, ArithHighPrecisionType<int64_t>>);
 
         //
-        const __m512i right_v = _mm512_set1_epi64(right_operand);
-        const __m512i value_v = _mm512_set1_epi64(value);
+        const __m512d right_v = _mm512_set1_pd(right_operand);
+        const __m512d value_v = _mm512_set1_pd(value);
 
         // todo: aligned reads & writes
 
@@ -1570,8 +3869,8 @@ bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
         for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
             for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
                 for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                    const __m512i v0s = _mm512_loadu_si512((const __m512i*)(src + i + p + ip * BLOCK_COUNT));
-                    const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+                    const __m512d v0s = _mm512_loadu_pd(src + i + p + ip * BLOCK_COUNT);
+                    const __mmask8 cmp_mask = ArithHelperF64<AOp, CmpOp>::op(v0s, right_v, value_v);
 
                     res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
 
@@ -1583,241 +3882,900 @@ bool OpArithCompareImpl<int64_t, AOp, CmpOp>::op_arith_compare(
         // process big blocks
         const size_t size8 = (size / 8) * 8;
         for (size_t i = size_8p; i < size8; i += 8) {
-            const __m512i v0s = _mm512_loadu_si512((const __m512i*)(src + i));
-            const __mmask8 cmp_mask = ArithHelperI64<AOp, CmpOp>::op(v0s, right_v, value_v);
+            const __m512d v0s = _mm512_loadu_pd(src + i);
+            const __mmask8 cmp_mask = ArithHelperF64<AOp, CmpOp>::op(v0s, right_v, value_v);
+
+            res_u8[i / 8] = cmp_mask;
+        }
+
+        return true;
+    }
+}
+
+
+///////////////////////////////////////////////////////////////////////////
+// forward ops
+
+namespace {
+
+// returns a register in which bits of interest are set
+template<bool IsSet>
+inline __m512i find_prepare(const __m512i v) {
+    if constexpr (IsSet) {
+        return v;
+    } else {
+        return _mm512_ternarylogic_epi64(v, v, v, 0x55);
+    }
+}
+
+// returns the index of the first set bit in a register that is known 
+//   to have at least one bit set
+inline size_t find_in_register(const __m512i v) {
+    const __mmask8 nonzero = _mm512_test_epi64_mask(v, v);
+    const size_t lane = CtzHelper<unsigned int>::ctz(nonzero);
+
+    uint64_t values[8];
+    _mm512_storeu_si512(values, v);
+
+    return lane * 64 + CtzHelper<unsigned long long>::ctz(values[lane]);
+}
+
+// Returns the index of the first bit equal to IsSet in a given number 
+//   of bytes, or size * 8 if there is none.
+template<bool IsSet>
+size_t find(
+    const uint8_t* const __restrict src, 
+    const size_t size
+) {
+    // process blocks of 4 registers
+    const size_t size256 = (size / 256) * 256;
+    for (size_t i = 0; i < size256; i += 256) {
+        const __m512i v0 = find_prepare<IsSet>(_mm512_loadu_si512(src + i + 0 * 64));
+        const __m512i v1 = find_prepare<IsSet>(_mm512_loadu_si512(src + i + 1 * 64));
+        const __m512i v2 = find_prepare<IsSet>(_mm512_loadu_si512(src + i + 2 * 64));
+        const __m512i v3 = find_prepare<IsSet>(_mm512_loadu_si512(src + i + 3 * 64));
+
+        const __m512i v0123 = _mm512_or_si512(_mm512_or_si512(v0, v1), _mm512_or_si512(v2, v3));
+        if (_mm512_test_epi64_mask(v0123, v0123) != 0) {
+            if (_mm512_test_epi64_mask(v0, v0) != 0) {
+                return (i + 0 * 64) * 8 + find_in_register(v0);
+            }
+            if (_mm512_test_epi64_mask(v1, v1) != 0) {
+                return (i + 1 * 64) * 8 + find_in_register(v1);
+            }
+            if (_mm512_test_epi64_mask(v2, v2) != 0) {
+                return (i + 2 * 64) * 8 + find_in_register(v2);
+            }
+            return (i + 3 * 64) * 8 + find_in_register(v3);
+        }
+    }
+
+    // process big blocks
+    const size_t size64 = (size / 64) * 64;
+    for (size_t i = size256; i < size64; i += 64) {
+        const __m512i v = find_prepare<IsSet>(_mm512_loadu_si512(src + i));
+        if (_mm512_test_epi64_mask(v, v) != 0) {
+            return i * 8 + find_in_register(v);
+        }
+    }
+
+    // process leftovers
+    if (size64 != size) {
+        const __mmask64 mask = get_mask(size - size64);
+        const __m512i v = _mm512_maskz_mov_epi8(
+            mask, 
+            find_prepare<IsSet>(_mm512_maskz_loadu_epi8(mask, src + size64))
+        );
+        if (_mm512_test_epi64_mask(v, v) != 0) {
+            return size64 * 8 + find_in_register(v);
+        }
+    }
+
+    return size * 8;
+}
+
+// Searches for the first bit equal to IsSet in [start + starting_idx, start + size).
+//   Partial elements at both ends are handled by the element-wise code, 
+//   the middle goes to find().
+template<typename ElementT, bool IsSet>
+std::optional<size_t> op_find_impl(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+    constexpr size_t data_bits = policy_type::data_bits;
+
+    if (starting_idx >= size) {
+        return std::nullopt;
+    }
+
+    size_t start_element = policy_type::get_element(start + starting_idx);
+    const size_t start_shift = policy_type::get_shift(start + starting_idx);
+    const size_t end_element = policy_type::get_element(start + size);
+
+    // process the first element
+    if (start_shift != 0) {
+        const size_t size_first = 
+            (size - starting_idx < data_bits - start_shift) ? 
+                (size - starting_idx) : (data_bits - start_shift);
+        const auto result = policy_type::op_find(data, start, starting_idx + size_first, starting_idx, IsSet);
+        if (result.has_value() || starting_idx + size_first == size) {
+            return result;
+        }
+
+        start_element += 1;
+    }
+
+    // process the middle
+    if (start_element < end_element) {
+        const size_t n_bytes = (end_element - start_element) * sizeof(ElementT);
+        const size_t bit_idx = find<IsSet>(
+            reinterpret_cast<const uint8_t*>(data + start_element), 
+            n_bytes
+        );
+        if (bit_idx != n_bytes * 8) {
+            return start_element * data_bits + bit_idx - start;
+        }
+    }
+
+    // process the last element
+    if (policy_type::get_shift(start + size) != 0) {
+        return policy_type::op_find(data, start, size, end_element * data_bits - start, IsSet);
+    }
+
+    return std::nullopt;
+}
+
+}
+
+namespace {
+
+// per-64-bit-lane popcount, a nibble lookup table + vpsadbw
+inline __m512i popcount_lookup_epi64(const __m512i v) {
+    const __m512i lookup = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4)
+    );
+    const __m512i low_mask = _mm512_set1_epi8(0x0F);
+
+    const __m512i lo = _mm512_and_si512(v, low_mask);
+    const __m512i hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), low_mask);
+    const __m512i cnt = _mm512_add_epi8(
+        _mm512_shuffle_epi8(lookup, lo), 
+        _mm512_shuffle_epi8(lookup, hi)
+    );
+
+    return _mm512_sad_epu8(cnt, _mm512_setzero_si512());
+}
+
+// carry-save adder: h:l = a + b + c
+inline void csa(
+    __m512i& h, 
+    __m512i& l, 
+    const __m512i a, 
+    const __m512i b, 
+    const __m512i c
+) {
+    l = _mm512_ternarylogic_epi32(c, b, a, 0x96);
+    h = _mm512_ternarylogic_epi32(c, b, a, 0xE8);
+}
+
+// Harley-Seal popcount, used if VPOPCNTDQ is not available. Counts bits 
+//   in a given number of bytes, which is a multiple of 64. Every block
+//   of 64 bytes is provided by load(offset).
+template<typename LoadT>
+inline size_t popcount_harley_seal(const size_t size, LoadT load) {
+    __m512i total = _mm512_setzero_si512();
+    __m512i ones = _mm512_setzero_si512();
+    __m512i twos = _mm512_setzero_si512();
+    __m512i fours = _mm512_setzero_si512();
+    __m512i eights = _mm512_setzero_si512();
+
+    // process blocks of 16 registers
+    const size_t size_hs = (size / (16 * 64)) * (16 * 64);
+    for (size_t i = 0; i < size_hs; i += 16 * 64) {
+        __m512i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b, sixteens;
+
+        csa(twos_a, ones, ones, load(i + 0 * 64), load(i + 1 * 64));
+        csa(twos_b, ones, ones, load(i + 2 * 64), load(i + 3 * 64));
+        csa(fours_a, twos, twos, twos_a, twos_b);
+        csa(twos_a, ones, ones, load(i + 4 * 64), load(i + 5 * 64));
+        csa(twos_b, ones, ones, load(i + 6 * 64), load(i + 7 * 64));
+        csa(fours_b, twos, twos, twos_a, twos_b);
+        csa(eights_a, fours, fours, fours_a, fours_b);
+        csa(twos_a, ones, ones, load(i + 8 * 64), load(i + 9 * 64));
+        csa(twos_b, ones, ones, load(i + 10 * 64), load(i + 11 * 64));
+        csa(fours_a, twos, twos, twos_a, twos_b);
+        csa(twos_a, ones, ones, load(i + 12 * 64), load(i + 13 * 64));
+        csa(twos_b, ones, ones, load(i + 14 * 64), load(i + 15 * 64));
+        csa(fours_b, twos, twos, twos_a, twos_b);
+        csa(eights_b, fours, fours, fours_a, fours_b);
+        csa(sixteens, eights, eights, eights_a, eights_b);
+
+        total = _mm512_add_epi64(total, popcount_lookup_epi64(sixteens));
+    }
+
+    total = _mm512_slli_epi64(total, 4);
+    total = _mm512_add_epi64(total, _mm512_slli_epi64(popcount_lookup_epi64(eights), 3));
+    total = _mm512_add_epi64(total, _mm512_slli_epi64(popcount_lookup_epi64(fours), 2));
+    total = _mm512_add_epi64(total, _mm512_slli_epi64(popcount_lookup_epi64(twos), 1));
+    total = _mm512_add_epi64(total, popcount_lookup_epi64(ones));
+
+    // process big blocks
+    for (size_t i = size_hs; i < size; i += 64) {
+        total = _mm512_add_epi64(total, popcount_lookup_epi64(load(i)));
+    }
+
+    return _mm512_reduce_add_epi64(total);
+}
+
+// VPOPCNTDQ is not a part of the baseline set of flags that is used
+//   for compiling AVX512 code, so it is enabled for this function only.
+//   Counts bits in a given number of bytes, which is a multiple of 64.
+//   Every block of 64 bytes is provided by load(offset).
+template<typename LoadT>
+__attribute__((target("avx512vpopcntdq")))
+size_t popcount_vpopcntdq(const size_t size, LoadT load) {
+    __m512i total0 = _mm512_setzero_si512();
+    __m512i total1 = _mm512_setzero_si512();
+    __m512i total2 = _mm512_setzero_si512();
+    __m512i total3 = _mm512_setzero_si512();
+
+    // process blocks of 4 registers
+    const size_t size256 = (size / 256) * 256;
+    for (size_t i = 0; i < size256; i += 256) {
+        total0 = _mm512_add_epi64(total0, _mm512_popcnt_epi64(load(i + 0 * 64)));
+        total1 = _mm512_add_epi64(total1, _mm512_popcnt_epi64(load(i + 1 * 64)));
+        total2 = _mm512_add_epi64(total2, _mm512_popcnt_epi64(load(i + 2 * 64)));
+        total3 = _mm512_add_epi64(total3, _mm512_popcnt_epi64(load(i + 3 * 64)));
+    }
+
+    // process big blocks
+    for (size_t i = size256; i < size; i += 64) {
+        total0 = _mm512_add_epi64(total0, _mm512_popcnt_epi64(load(i)));
+    }
+
+    const __m512i total = _mm512_add_epi64(
+        _mm512_add_epi64(total0, total1), 
+        _mm512_add_epi64(total2, total3)
+    );
+    return _mm512_reduce_add_epi64(total);
+}
+
+// Counts bits in a given number of bytes, which is a multiple of 64.
+//   Every block of 64 bytes is provided by load(offset).
+template<typename LoadT>
+inline size_t popcount_blocks(const size_t size, LoadT load) {
+    static const bool has_vpopcntdq = cpu_support_avx512_vpopcntdq();
+    if (has_vpopcntdq) {
+        return popcount_vpopcntdq(size, load);
+    } else {
+        return popcount_harley_seal(size, load);
+    }
+}
+
+// counts bits in a given number of bytes
+inline size_t popcount(
+    const uint8_t* const __restrict src, 
+    const size_t size
+) {
+    // process big blocks
+    const size_t size64 = (size / 64) * 64;
+    size_t count = popcount_blocks(
+        size64,
+        [src](const size_t offset) {
+            return _mm512_loadu_si512(src + offset);
+        }
+    );
+
+    // process leftovers
+    if (size64 != size) {
+        const __mmask64 mask = get_mask(size - size64);
+        const __m512i v = _mm512_maskz_loadu_epi8(mask, src + size64);
+        count += _mm512_reduce_add_epi64(popcount_lookup_epi64(v));
+    }
+
+    return count;
+}
+
+// Counts bits in [start, start + size). Partial elements at both ends are
+//   handled by the element-wise code, the middle goes to popcount().
+template<typename ElementT>
+size_t op_count_impl(
+    const ElementT* const data,
+    const size_t start,
+    const size_t size
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
+    constexpr size_t data_bits = policy_type::data_bits;
+
+    if (size == 0) {
+        return 0;
+    }
+
+    size_t count = 0;
+
+    size_t start_element = policy_type::get_element(start);
+    const size_t start_shift = policy_type::get_shift(start);
+    size_t size_left = size;
+
+    // process the first element
+    if (start_shift != 0) {
+        const size_t size_first = 
+            (size < data_bits - start_shift) ? size : (data_bits - start_shift);
+        count += policy_type::op_count(data, start, size_first);
+
+        size_left -= size_first;
+        start_element += 1;
+    }
+
+    // process the middle
+    const size_t n_elements = size_left / data_bits;
+    count += popcount(
+        reinterpret_cast<const uint8_t*>(data + start_element), 
+        n_elements * sizeof(ElementT)
+    );
+
+    // process the last element
+    const size_t size_last = size_left % data_bits;
+    if (size_last != 0) {
+        count += policy_type::op_count(data + start_element + n_elements, 0, size_last);
+    }
+
+    return count;
+}
+
+}
+
+namespace {
+
+// binary operations for op_binary_impl()
+struct BinaryOpAnd {
+    static inline __m512i op(const __m512i left, const __m512i right) {
+        return _mm512_and_si512(left, right);
+    }
+
+    // returns true if a value cannot be changed by any right operand
+    static inline bool is_saturated(const __m512i v) {
+        return (_mm512_test_epi64_mask(v, v) == 0);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_and(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpOr {
+    static inline __m512i op(const __m512i left, const __m512i right) {
+        return _mm512_or_si512(left, right);
+    }
+
+    // returns true if a value cannot be changed by any right operand
+    static inline bool is_saturated(const __m512i v) {
+        return (_mm512_cmpneq_epi64_mask(v, _mm512_set1_epi64(-1)) == 0);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_or(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpXor {
+    static inline __m512i op(const __m512i left, const __m512i right) {
+        return _mm512_xor_si512(left, right);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_xor(left, right, start_left, start_right, size);
+    }
+};
+
+struct BinaryOpSub {
+    static inline __m512i op(const __m512i left, const __m512i right) {
+        return _mm512_andnot_si512(right, left);
+    }
+
+    template<typename ElementT>
+    static inline void op_element_wise(
+        ElementT* const left,
+        const ElementT* const right,
+        const size_t start_left,
+        const size_t start_right,
+        const size_t size
+    ) {
+        ElementWiseBitsetPolicy<ElementT>::op_sub(left, right, start_left, start_right, size);
+    }
+};
+
+// Loads 64 bytes of bits that start from bit 'shift' (1..7) of src[0].
+//   Every 64-bit lane is a funnel shift of 9 consecutive bytes: 'lo' 
+//   provides bytes [0, 8) and 'hi' provides bytes [1, 9), so src[64] 
+//   is the only byte that is read past the loaded ones.
+inline __m512i load_shifted(const uint8_t* const src, const size_t shift) {
+    const __m512i lo = _mm512_loadu_si512(src);
+    const __m512i hi = _mm512_loadu_si512(src + 1);
+    return _mm512_or_si512(
+        _mm512_srl_epi64(lo, _mm_cvtsi64_si128(shift)), 
+        _mm512_sll_epi64(hi, _mm_cvtsi64_si128(8 - shift))
+    );
+}
+
+// same as above, but only bytes that are set in mask are loaded
+inline __m512i load_shifted(
+    const __mmask64 mask, 
+    const uint8_t* const src, 
+    const size_t shift
+) {
+    const __m512i lo = _mm512_maskz_loadu_epi8(mask, src);
+    const __m512i hi = _mm512_maskz_loadu_epi8(mask, src + 1);
+    return _mm512_or_si512(
+        _mm512_srl_epi64(lo, _mm_cvtsi64_si128(shift)), 
+        _mm512_sll_epi64(hi, _mm_cvtsi64_si128(8 - shift))
+    );
+}
+
+// Applies OpT to a given number of bytes of left and the same number 
+//   of bits of right, which start from bit 'shift' (0..7) of right[0].
+//   If shift is not zero, then right[size] is read as well.
+template<typename OpT>
+void op_bytes(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t size,
+    const size_t shift
+) {
+    const size_t size64 = (size / 64) * 64;
+
+    if (shift == 0) {
+        // process big blocks
+        for (size_t i = 0; i < size64; i += 64) {
+            const __m512i lv = _mm512_loadu_si512(left + i);
+            const __m512i rv = _mm512_loadu_si512(right + i);
+            _mm512_storeu_si512(left + i, OpT::op(lv, rv));
+        }
 
-            res_u8[i / 8] = cmp_mask;
+        // process leftovers
+        if (size64 != size) {
+            const __mmask64 mask = get_mask(size - size64);
+            const __m512i lv = _mm512_maskz_loadu_epi8(mask, left + size64);
+            const __m512i rv = _mm512_maskz_loadu_epi8(mask, right + size64);
+            _mm512_mask_storeu_epi8(left + size64, mask, OpT::op(lv, rv));
         }
 
-        return true;
+        return;
     }
-}
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<float, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const float* const __restrict src,
-    const ArithHighPrecisionType<float>& right_operand,
-    const ArithHighPrecisionType<float>& value,
-    const size_t size
-) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        if constexpr (AOp == ArithOpType::Div) {
-            if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
-                // a special case that allows faster processing by using the multiplication
-                //   operation instead of the division one.
-
-                // the restriction of the API
-                assert((size % 8) == 0);
-
-                //
-                const __m512 right_v = _mm512_set1_ps(right_operand);
-                const __m512 value_v = _mm512_set1_ps(value);
-                uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
-
-                // todo: aligned reads & writes
-
-                // interleaved pages
-                constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(float));
-                const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-                for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-                    for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
-                        for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                            const __m512 v0s = _mm512_loadu_ps(src + i + p + ip * BLOCK_COUNT);
-                            const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op_special(v0s, right_v, value_v);
-
-                            res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
-
-                            _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-                        }
-                    }
-                }
+    // process big blocks
+    for (size_t i = 0; i < size64; i += 64) {
+        const __m512i lv = _mm512_loadu_si512(left + i);
+        const __m512i rv = load_shifted(right + i, shift);
+        _mm512_storeu_si512(left + i, OpT::op(lv, rv));
+    }
 
-                // process big blocks
-                const size_t size16 = (size / 16) * 16;
-                for (size_t i = size_8p; i < size16; i += 16) {
-                    const __m512 v0s = _mm512_loadu_ps(src + i);
-                    const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op_special(v0s, right_v, value_v);
-                    res_u16[i / 16] = cmp_mask;
-                }
+    // process leftovers
+    if (size64 != size) {
+        const __mmask64 mask = get_mask(size - size64);
+        const __m512i lv = _mm512_maskz_loadu_epi8(mask, left + size64);
+        const __m512i rv = load_shifted(mask, right + size64, shift);
+        _mm512_mask_storeu_epi8(left + size64, mask, OpT::op(lv, rv));
+    }
+}
 
-                // process leftovers
-                if (size16 != size) {
-                    // process 8 elements
-                    const __m256 vs = _mm256_loadu_ps(src + size16);
-                    const __m512 v0s = _mm512_castps256_ps512(vs);
-                    const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op_special(v0s, right_v, value_v);
-                    res_u8[size16 / 8] = uint8_t(cmp_mask);
-                }
+// Same as op_bytes(), but also returns the number of set bits in 
+//   the result, which is counted while it is still in registers.
+template<typename OpT>
+size_t op_bytes_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t size,
+    const size_t shift
+) {
+    const size_t size64 = (size / 64) * 64;
 
-                return true;
-            } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
-                // flip signs and go for the multiplication case
-                return OpArithCompareImpl<float, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
-                    res_u8, src, -right_operand, -value, size
-                );
+    // process big blocks
+    size_t count = 0;
+    if (shift == 0) {
+        count = popcount_blocks(
+            size64,
+            [left, right](const size_t offset) {
+                const __m512i lv = _mm512_loadu_si512(left + offset);
+                const __m512i rv = _mm512_loadu_si512(right + offset);
+                const __m512i result = OpT::op(lv, rv);
+                _mm512_storeu_si512(left + offset, result);
+                return result;
             }
+        );
+    } else {
+        count = popcount_blocks(
+            size64,
+            [left, right, shift](const size_t offset) {
+                const __m512i lv = _mm512_loadu_si512(left + offset);
+                const __m512i rv = load_shifted(right + offset, shift);
+                const __m512i result = OpT::op(lv, rv);
+                _mm512_storeu_si512(left + offset, result);
+                return result;
+            }
+        );
+    }
 
-            // go with the default case
-        }
+    // process leftovers
+    if (size64 != size) {
+        const __mmask64 mask = get_mask(size - size64);
+        const __m512i lv = _mm512_maskz_loadu_epi8(mask, left + size64);
+        const __m512i rv = (shift == 0) ? 
+            _mm512_maskz_loadu_epi8(mask, right + size64) : 
+            load_shifted(mask, right + size64, shift);
+        const __m512i result = _mm512_maskz_mov_epi8(mask, OpT::op(lv, rv));
+        _mm512_mask_storeu_epi8(left + size64, mask, result);
+        count += _mm512_reduce_add_epi64(popcount_lookup_epi64(result));
+    }
 
-        // a default case
-        {
-            // the restriction of the API
-            assert((size % 8) == 0);
+    return count;
+}
 
-            //
-            const __m512 right_v = _mm512_set1_ps(right_operand);
-            const __m512 value_v = _mm512_set1_ps(value);
-            uint16_t* const __restrict res_u16 = reinterpret_cast<uint16_t*>(res_u8);
+// Applies OpT to a given number of bytes of left and every right. 
+//   Bits of rights[k] start from bit shifts[k] (0..7) of rights[k][0].
+//   Bytes are processed in cache line-sized blocks, and the remaining 
+//   rights are not loaded once a block cannot be changed by OpT anymore.
+template<typename OpT>
+void op_bytes_multiple(
+    uint8_t* const left,
+    const uint8_t* const* const rights,
+    const size_t* const shifts,
+    const size_t n_rights,
+    const size_t size
+) {
+    const size_t size64 = (size / 64) * 64;
 
-            // todo: aligned reads & writes
+    // process big blocks
+    for (size_t i = 0; i < size64; i += 64) {
+        __m512i v = _mm512_loadu_si512(left + i);
+        for (size_t k = 0; k < n_rights && !OpT::is_saturated(v); k++) {
+            const __m512i rv = (shifts[k] == 0) ? 
+                _mm512_loadu_si512(rights[k] + i) : 
+                load_shifted(rights[k] + i, shifts[k]);
+            v = OpT::op(v, rv);
+        }
 
-            // interleaved pages
-            constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(float));
-            const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-            for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-                for (size_t p = 0; p < BLOCK_COUNT; p += 16) {
-                    for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                        const __m512 v0s = _mm512_loadu_ps(src + i + p + ip * BLOCK_COUNT);
-                        const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op(v0s, right_v, value_v);
+        _mm512_storeu_si512(left + i, v);
+    }
 
-                        res_u16[(i + p + ip * BLOCK_COUNT) / 16] = cmp_mask;
+    // process leftovers
+    if (size64 != size) {
+        const __mmask64 mask = get_mask(size - size64);
+        __m512i v = _mm512_maskz_loadu_epi8(mask, left + size64);
+        for (size_t k = 0; k < n_rights; k++) {
+            const __m512i rv = (shifts[k] == 0) ? 
+                _mm512_maskz_loadu_epi8(mask, rights[k] + size64) : 
+                load_shifted(mask, rights[k] + size64, shifts[k]);
+            v = OpT::op(v, rv);
+        }
 
-                        _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-                    }
-                }
-            }
+        _mm512_mask_storeu_epi8(left + size64, mask, v);
+    }
+}
 
-            // process big blocks
-            const size_t size16 = (size / 16) * 16;
-            for (size_t i = size_8p; i < size16; i += 16) {
-                const __m512 v0s = _mm512_loadu_ps(src + i);
-                const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op(v0s, right_v, value_v);
-                res_u16[i / 16] = cmp_mask;
-            }
+// Applies OpT to [start_left, start_left + size) of left and 
+//   [start_right, start_right + size) of right. Bits are processed by 
+//   the element-wise code until left is byte-aligned, then whole bytes
+//   of left go to op_bytes() regardless of the alignment of right.
+template<typename ElementT, typename OpT>
+void op_binary_impl(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size
+) {
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        OpT::template op_element_wise<ElementT>(left, right, start_left, start_right, size_first);
+    }
 
-            // process leftovers
-            if (size16 != size) {
-                // process 8 elements
-                const __m256 vs = _mm256_loadu_ps(src + size16);
-                const __m512 v0s = _mm512_castps256_ps512(vs);
-                const __mmask16 cmp_mask = ArithHelperF32<AOp, CmpOp>::op(v0s, right_v, value_v);
-                res_u8[size16 / 8] = uint8_t(cmp_mask);
-            }
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_right_middle = start_right + size_first;
+    const size_t n_bytes = (size - size_first) / 8;
+    if (n_bytes != 0) {
+        op_bytes<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            reinterpret_cast<const uint8_t*>(right) + start_right_middle / 8,
+            n_bytes,
+            start_right_middle % 8
+        );
+    }
 
-            return true;
-        }
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        OpT::template op_element_wise<ElementT>(
+            left, 
+            right, 
+            start_left_middle + n_bytes * 8, 
+            start_right_middle + n_bytes * 8, 
+            size_last
+        );
     }
 }
 
-template<ArithOpType AOp, CompareOpType CmpOp>
-bool OpArithCompareImpl<double, AOp, CmpOp>::op_arith_compare(
-    uint8_t* const __restrict res_u8,
-    const double* const __restrict src,
-    const ArithHighPrecisionType<double>& right_operand,
-    const ArithHighPrecisionType<double>& value,
+// Same as op_binary_impl(), but also returns the number of set bits 
+//   in [start_left, start_left + size) of left after the operation.
+template<typename ElementT, typename OpT>
+size_t op_binary_with_count_impl(
+    ElementT* const left,
+    const ElementT* const right,
+    const size_t start_left,
+    const size_t start_right,
     const size_t size
 ) {
-    if constexpr(AOp == ArithOpType::Mod) {
-        return false;
-    } else {
-        if constexpr (AOp == ArithOpType::Div) {
-            if (std::isfinite(value) && std::isfinite(right_operand) && right_operand > 0) {
-                // a special case that allows faster processing by using the multiplication
-                //   operation instead of the division one.
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
 
-                // the restriction of the API
-                assert((size % 8) == 0);
+    size_t count = 0;
 
-                //
-                const __m512d right_v = _mm512_set1_pd(right_operand);
-                const __m512d value_v = _mm512_set1_pd(value);
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        OpT::template op_element_wise<ElementT>(left, right, start_left, start_right, size_first);
+        count += policy_type::op_count(left, start_left, size_first);
+    }
 
-                // todo: aligned reads & writes
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_right_middle = start_right + size_first;
+    const size_t n_bytes = (size - size_first) / 8;
+    if (n_bytes != 0) {
+        count += op_bytes_with_count<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            reinterpret_cast<const uint8_t*>(right) + start_right_middle / 8,
+            n_bytes,
+            start_right_middle % 8
+        );
+    }
 
-                // interleaved pages
-                constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int64_t));
-                const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-                for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-                    for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
-                        for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                            const __m512d v0s = _mm512_loadu_pd(src + i + p + ip * BLOCK_COUNT);
-                            const __mmask8 cmp_mask = ArithHelperF64<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        OpT::template op_element_wise<ElementT>(
+            left, 
+            right, 
+            start_left_middle + n_bytes * 8, 
+            start_right_middle + n_bytes * 8, 
+            size_last
+        );
+        count += policy_type::op_count(left, start_left_middle + n_bytes * 8, size_last);
+    }
 
-                            res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+    return count;
+}
 
-                            _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-                        }
-                    }
-                }
+// Applies OpT to [start_left, start_left + size) of left and 
+//   [start_rights[k], start_rights[k] + size) of every right. Same as 
+//   op_binary_impl(), but all rights are processed in a single pass.
+template<typename ElementT, typename OpT>
+void op_multiple_impl(
+    ElementT* const left,
+    const ElementT* const * const rights,
+    const size_t start_left,
+    const size_t* const __restrict start_rights,
+    const size_t n_rights,
+    const size_t size
+) {
+    if (n_rights == 0) {
+        return;
+    }
 
-                // process big blocks
-                const size_t size8 = (size / 8) * 8;
-                for (size_t i = size_8p; i < size8; i += 8) {
-                    const __m512d v0s = _mm512_loadu_pd(src + i);
-                    const __mmask8 cmp_mask = ArithHelperF64<AOp, CmpOp>::op_special(v0s, right_v, value_v);
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        for (size_t k = 0; k < n_rights; k++) {
+            OpT::template op_element_wise<ElementT>(left, rights[k], start_left, start_rights[k], size_first);
+        }
+    }
 
-                    res_u8[i / 8] = cmp_mask;
-                }
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t n_bytes = (size - size_first) / 8;
+    if (n_bytes != 0) {
+        MaybeVector<const uint8_t*> right_ptrs(n_rights);
+        MaybeVector<size_t> right_shifts(n_rights);
+        for (size_t k = 0; k < n_rights; k++) {
+            const size_t start_right_middle = start_rights[k] + size_first;
+            right_ptrs[k] = reinterpret_cast<const uint8_t*>(rights[k]) + start_right_middle / 8;
+            right_shifts[k] = start_right_middle % 8;
+        }
 
-                return true;
-            } else if (std::isfinite(value) && std::isfinite(right_operand) && right_operand < 0) {
-                // flip signs and go for the multiplication case
-                return OpArithCompareImpl<double, AOp, CompareOpDivFlip<CmpOp>::op>::op_arith_compare(
-                    res_u8, src, -right_operand, -value, size
-                );
-            }
+        op_bytes_multiple<OpT>(
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            right_ptrs.data(),
+            right_shifts.data(),
+            n_rights,
+            n_bytes
+        );
+    }
 
-            // go with the default case
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        for (size_t k = 0; k < n_rights; k++) {
+            OpT::template op_element_wise<ElementT>(
+                left, 
+                rights[k], 
+                start_left_middle + n_bytes * 8, 
+                start_rights[k] + size_first + n_bytes * 8, 
+                size_last
+            );
         }
+    }
+}
 
-        // a default case
-        {
-            // the restriction of the API
-            assert((size % 8) == 0);
+// loads 64 bytes of bits that start from bit 'shift' (0..7) of src[0]
+inline __m512i load_maybe_shifted(const uint8_t* const src, const size_t shift) {
+    if (shift == 0) {
+        return _mm512_loadu_si512(src);
+    } else {
+        return load_shifted(src, shift);
+    }
+}
 
-            //
-            const __m512d right_v = _mm512_set1_pd(right_operand);
-            const __m512d value_v = _mm512_set1_pd(value);
+// same as above, but only bytes that are set in mask are loaded
+inline __m512i load_maybe_shifted(
+    const __mmask64 mask, 
+    const uint8_t* const src, 
+    const size_t shift
+) {
+    if (shift == 0) {
+        return _mm512_maskz_loadu_epi8(mask, src);
+    } else {
+        return load_shifted(mask, src, shift);
+    }
+}
 
-            // todo: aligned reads & writes
+// Applies a ternary op, given by a truth table, to a given number of 
+//   bytes of left and the same number of bits of b and c, which start 
+//   from bits 'shift_b' and 'shift_c' (0..7) of b[0] and c[0]. 
+//   A single vpternlog instruction is used per 64 bytes.
+template<uint8_t TruthTable>
+void op_bytes_ternary(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t size,
+    const size_t shift_b,
+    const size_t shift_c
+) {
+    const size_t size64 = (size / 64) * 64;
 
-            // interleaved pages
-            constexpr size_t BLOCK_COUNT = PAGE_SIZE / (sizeof(int64_t));
-            const size_t size_8p = (size / (N_BLOCKS * BLOCK_COUNT)) * N_BLOCKS * BLOCK_COUNT;
-            for (size_t i = 0; i < size_8p; i += N_BLOCKS * BLOCK_COUNT) {
-                for (size_t p = 0; p < BLOCK_COUNT; p += 8) {
-                    for (size_t ip = 0; ip < N_BLOCKS; ip++) {
-                        const __m512d v0s = _mm512_loadu_pd(src + i + p + ip * BLOCK_COUNT);
-                        const __mmask8 cmp_mask = ArithHelperF64<AOp, CmpOp>::op(v0s, right_v, value_v);
+    if (shift_b == 0 && shift_c == 0) {
+        // process big blocks
+        for (size_t i = 0; i < size64; i += 64) {
+            const __m512i lv = _mm512_loadu_si512(left + i);
+            const __m512i bv = _mm512_loadu_si512(b + i);
+            const __m512i cv = _mm512_loadu_si512(c + i);
+            _mm512_storeu_si512(left + i, _mm512_ternarylogic_epi64(lv, bv, cv, TruthTable));
+        }
+    } else {
+        // process big blocks
+        for (size_t i = 0; i < size64; i += 64) {
+            const __m512i lv = _mm512_loadu_si512(left + i);
+            const __m512i bv = load_maybe_shifted(b + i, shift_b);
+            const __m512i cv = load_maybe_shifted(c + i, shift_c);
+            _mm512_storeu_si512(left + i, _mm512_ternarylogic_epi64(lv, bv, cv, TruthTable));
+        }
+    }
 
-                        res_u8[(i + p + ip * BLOCK_COUNT) / 8] = cmp_mask;
+    // process leftovers
+    if (size64 != size) {
+        const __mmask64 mask = get_mask(size - size64);
+        const __m512i lv = _mm512_maskz_loadu_epi8(mask, left + size64);
+        const __m512i bv = load_maybe_shifted(mask, b + size64, shift_b);
+        const __m512i cv = load_maybe_shifted(mask, c + size64, shift_c);
+        _mm512_mask_storeu_epi8(left + size64, mask, _mm512_ternarylogic_epi64(lv, bv, cv, TruthTable));
+    }
+}
 
-                        _mm_prefetch((const char*)(src + i + p + ip * BLOCK_COUNT) + BLOCKS_PREFETCH_AHEAD * CACHELINE_WIDTH, _MM_HINT_T0);
-                    }
-                }
-            }
+using OpBytesTernaryFunc = void(*)(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t size,
+    const size_t shift_b,
+    const size_t shift_c
+);
+
+template<size_t... TruthTables>
+constexpr std::array<OpBytesTernaryFunc, 256> make_op_bytes_ternary_table(
+    std::index_sequence<TruthTables...>
+) {
+    return {{ &op_bytes_ternary<uint8_t(TruthTables)>... }};
+}
 
-            // process big blocks
-            const size_t size8 = (size / 8) * 8;
-            for (size_t i = size_8p; i < size8; i += 8) {
-                const __m512d v0s = _mm512_loadu_pd(src + i);
-                const __mmask8 cmp_mask = ArithHelperF64<AOp, CmpOp>::op(v0s, right_v, value_v);
+// op_bytes_ternary() for every possible truth table
+constexpr std::array<OpBytesTernaryFunc, 256> op_bytes_ternary_table =
+    make_op_bytes_ternary_table(std::make_index_sequence<256>());
+
+// Applies a ternary op, given by a truth table, to [start_left, 
+//   start_left + size) of left, [start_b, start_b + size) of b and 
+//   [start_c, start_c + size) of c. Same as op_binary_impl(), bits are 
+//   processed by the element-wise code until left is byte-aligned.
+template<typename ElementT>
+void op_ternary_impl(
+    ElementT* const left,
+    const ElementT* const b,
+    const ElementT* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    using policy_type = ElementWiseBitsetPolicy<ElementT>;
 
-                res_u8[i / 8] = cmp_mask;
-            }
+    // process the first bits
+    const size_t size_to_byte = (8 - start_left % 8) % 8;
+    const size_t size_first = (size < size_to_byte) ? size : size_to_byte;
+    if (size_first != 0) {
+        policy_type::op_ternary(left, b, c, start_left, start_b, start_c, size_first, truth_table);
+    }
 
-            return true;
-        }
+    // process the middle
+    const size_t start_left_middle = start_left + size_first;
+    const size_t start_b_middle = start_b + size_first;
+    const size_t start_c_middle = start_c + size_first;
+    const size_t n_bytes = (size - size_first) / 8;
+    if (n_bytes != 0) {
+        op_bytes_ternary_table[truth_table](
+            reinterpret_cast<uint8_t*>(left) + start_left_middle / 8,
+            reinterpret_cast<const uint8_t*>(b) + start_b_middle / 8,
+            reinterpret_cast<const uint8_t*>(c) + start_c_middle / 8,
+            n_bytes,
+            start_b_middle % 8,
+            start_c_middle % 8
+        );
     }
-}
 
+    // process the last bits
+    const size_t size_last = size - size_first - n_bytes * 8;
+    if (size_last != 0) {
+        policy_type::op_ternary(
+            left, 
+            b, 
+            c, 
+            start_left_middle + n_bytes * 8, 
+            start_b_middle + n_bytes * 8, 
+            start_c_middle + n_bytes * 8, 
+            size_last,
+            truth_table
+        );
+    }
+}
 
-///////////////////////////////////////////////////////////////////////////
-// forward ops
+}
 
 //
 bool ForwardOpsImpl<uint8_t>::op_and(
@@ -1827,7 +4785,7 @@ bool ForwardOpsImpl<uint8_t>::op_and(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_and(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpAnd>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1839,7 +4797,7 @@ bool ForwardOpsImpl<uint8_t>::op_and_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_and_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint8_t, BinaryOpAnd>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1850,7 +4808,7 @@ bool ForwardOpsImpl<uint8_t>::op_or(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_or(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpOr>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1862,7 +4820,7 @@ bool ForwardOpsImpl<uint8_t>::op_or_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_or_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint8_t, BinaryOpOr>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1873,7 +4831,7 @@ bool ForwardOpsImpl<uint8_t>::op_xor(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_xor(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpXor>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1884,7 +4842,72 @@ bool ForwardOpsImpl<uint8_t>::op_sub(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint8_t>::op_sub(left, right, start_left, start_right, size);
+    op_binary_impl<uint8_t, BinaryOpSub>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_count(
+    const uint8_t* const data,
+    const size_t start,
+    const size_t size,
+    size_t& count
+) {
+    count = op_count_impl<uint8_t>(data, start, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_find(
+    const uint8_t* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+) {
+    if (is_set) {
+        result = op_find_impl<uint8_t, true>(data, start, size, starting_idx);
+    } else {
+        result = op_find_impl<uint8_t, false>(data, start, size, starting_idx);
+    }
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_and_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    count = op_binary_with_count_impl<uint8_t, BinaryOpAnd>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_or_with_count(
+    uint8_t* const left,
+    const uint8_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    // the number of inactive bits
+    count = size - op_binary_with_count_impl<uint8_t, BinaryOpOr>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint8_t>::op_ternary(
+    uint8_t* const left,
+    const uint8_t* const b,
+    const uint8_t* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    op_ternary_impl<uint8_t>(left, b, c, start_left, start_b, start_c, size, truth_table);
     return true;
 }
 
@@ -1896,7 +4919,7 @@ bool ForwardOpsImpl<uint64_t>::op_and(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_and(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpAnd>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1908,7 +4931,7 @@ bool ForwardOpsImpl<uint64_t>::op_and_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_and_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint64_t, BinaryOpAnd>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1919,7 +4942,7 @@ bool ForwardOpsImpl<uint64_t>::op_or(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_or(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpOr>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1931,7 +4954,7 @@ bool ForwardOpsImpl<uint64_t>::op_or_multiple(
     const size_t n_rights,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_or_multiple(left, rights, start_left, start_rights, n_rights, size);
+    op_multiple_impl<uint64_t, BinaryOpOr>(left, rights, start_left, start_rights, n_rights, size);
     return true;
 }
 
@@ -1942,7 +4965,7 @@ bool ForwardOpsImpl<uint64_t>::op_xor(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_xor(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpXor>(left, right, start_left, start_right, size);
     return true;
 }
 
@@ -1953,7 +4976,72 @@ bool ForwardOpsImpl<uint64_t>::op_sub(
     const size_t start_right,
     const size_t size
 ) {
-    ElementWiseBitsetPolicy<uint64_t>::op_sub(left, right, start_left, start_right, size);
+    op_binary_impl<uint64_t, BinaryOpSub>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_count(
+    const uint64_t* const data,
+    const size_t start,
+    const size_t size,
+    size_t& count
+) {
+    count = op_count_impl<uint64_t>(data, start, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_find(
+    const uint64_t* const data,
+    const size_t start,
+    const size_t size,
+    const size_t starting_idx,
+    const bool is_set,
+    std::optional<size_t>& result
+) {
+    if (is_set) {
+        result = op_find_impl<uint64_t, true>(data, start, size, starting_idx);
+    } else {
+        result = op_find_impl<uint64_t, false>(data, start, size, starting_idx);
+    }
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_and_with_count(
+    uint64_t* const left,
+    const uint64_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    count = op_binary_with_count_impl<uint64_t, BinaryOpAnd>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_or_with_count(
+    uint64_t* const left,
+    const uint64_t* const right,
+    const size_t start_left,
+    const size_t start_right,
+    const size_t size,
+    size_t& count
+) {
+    // the number of inactive bits
+    count = size - op_binary_with_count_impl<uint64_t, BinaryOpOr>(left, right, start_left, start_right, size);
+    return true;
+}
+
+bool ForwardOpsImpl<uint64_t>::op_ternary(
+    uint64_t* const left,
+    const uint64_t* const b,
+    const uint64_t* const c,
+    const size_t start_left,
+    const size_t start_b,
+    const size_t start_c,
+    const size_t size,
+    const uint8_t truth_table
+) {
+    op_ternary_impl<uint64_t>(left, b, c, start_left, start_b, start_c, size, truth_table);
     return true;
 }
 
@@ -25,6 +25,11 @@ namespace avx512 {
     FUNC(__VA_ARGS__,LT); \
     FUNC(__VA_ARGS__,NE);
 
+// a facility to run through all possible in values operations
+#define ALL_IN_VALUES_OPS(FUNC,...) \
+    FUNC(__VA_ARGS__,In); \
+    FUNC(__VA_ARGS__,NotIn);
+
 // a facility to run through all possible range operations
 #define ALL_RANGE_OPS(FUNC,...) \
     FUNC(__VA_ARGS__,IncInc); \
@@ -81,12 +86,42 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, int8_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, int16_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, int32_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, uint8_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, uint16_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, uint32_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, uint64_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, float)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_VAL_AVX512, double)
 
 #undef INSTANTIATE_COMPARE_VAL_AVX512
 
 
+///////////////////////////////////////////////////////////////////////////
+
+//
+#define INSTANTIATE_IN_VALUES_AVX512(TTYPE,OP) \
+    template bool OpInValuesImpl<TTYPE, InValuesType::OP>::op_in_values( \
+        uint8_t* const __restrict bitmask, \
+        const TTYPE* const __restrict src, \
+        const size_t size, \
+        const TTYPE* const __restrict values, \
+        const size_t n_values \
+    );
+
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, int8_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, int16_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, int32_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, int64_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, uint8_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, uint16_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, uint32_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, uint64_t)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, float)
+ALL_IN_VALUES_OPS(INSTANTIATE_IN_VALUES_AVX512, double)
+
+#undef INSTANTIATE_IN_VALUES_AVX512
+
+
 ///////////////////////////////////////////////////////////////////////////
 
 //
@@ -102,11 +137,33 @@ ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, int8_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, int16_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, int32_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, uint8_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, uint16_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, uint32_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, uint64_t)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, float)
 ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_AVX512, double)
 
 #undef INSTANTIATE_COMPARE_COLUMN_AVX512
 
+//
+#define INSTANTIATE_COMPARE_COLUMN_MIXED_AVX512(TTYPE,UTYPE,OP) \
+    template bool OpCompareColumnImpl<TTYPE, UTYPE, CompareOpType::OP>::op_compare_column( \
+        uint8_t* const __restrict bitmask, \
+        const TTYPE* const __restrict left, \
+        const UTYPE* const __restrict right, \
+        const size_t size \
+    );
+
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_AVX512, int8_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_AVX512, int16_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_AVX512, int32_t, int64_t)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_AVX512, int32_t, float)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_AVX512, int32_t, double)
+ALL_COMPARE_OPS(INSTANTIATE_COMPARE_COLUMN_MIXED_AVX512, float, double)
+
+#undef INSTANTIATE_COMPARE_COLUMN_MIXED_AVX512
+
 
 ///////////////////////////////////////////////////////////////////////////
 
@@ -124,6 +181,10 @@ ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, int8_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, int16_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, int32_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, int64_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, uint8_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, uint16_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, uint32_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, uint64_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, float)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_COLUMN_AVX512, double)
 
@@ -146,6 +207,10 @@ ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, int8_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, int16_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, int32_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, int64_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, uint8_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, uint16_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, uint32_t)
+ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, uint64_t)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, float)
 ALL_RANGE_OPS(INSTANTIATE_WITHIN_RANGE_VAL_AVX512, double)
 
@@ -168,6 +233,10 @@ ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, int8_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, int16_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, int32_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, int64_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, uint8_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, uint16_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, uint32_t)
+ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, uint64_t)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, float)
 ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, double)
 
@@ -178,6 +247,7 @@ ALL_ARITH_CMP_OPS(INSTANTIATE_ARITH_COMPARE_AVX512, double)
 
 //
 #undef ALL_COMPARE_OPS
+#undef ALL_IN_VALUES_OPS
 #undef ALL_RANGE_OPS
 #undef ALL_ARITH_CMP_OPS
 
@@ -26,6 +26,12 @@ struct VectorizedAvx512 {
     template<typename T, CompareOpType Op>
     static constexpr inline auto op_compare_val = avx512::OpCompareValImpl<T, Op>::op_compare_val;
 
+    template<typename T, InValuesType Op>
+    static constexpr inline auto op_in_values = avx512::OpInValuesImpl<T, Op>::op_in_values;
+
+    template<typename OffsetT>
+    static constexpr inline auto op_prefix_match = avx512::OpPrefixMatchImpl<OffsetT>::op_prefix_match;
+
     template<typename T, RangeType Op>
     static constexpr inline auto op_within_range_column = avx512::OpWithinRangeColumnImpl<T, Op>::op_within_range_column;
 
@@ -52,6 +58,21 @@ struct VectorizedAvx512 {
 
     template<typename ElementT>
     static constexpr inline auto forward_op_sub = avx512::ForwardOpsImpl<ElementT>::op_sub;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_count = avx512::ForwardOpsImpl<ElementT>::op_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_find = avx512::ForwardOpsImpl<ElementT>::op_find;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_and_with_count = avx512::ForwardOpsImpl<ElementT>::op_and_with_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_or_with_count = avx512::ForwardOpsImpl<ElementT>::op_or_with_count;
+
+    template<typename ElementT>
+    static constexpr inline auto forward_op_ternary = avx512::ForwardOpsImpl<ElementT>::op_ternary;
 };
 
 }
@@ -96,6 +96,13 @@ cpu_support_avx512() {
             instruction_set_inst.AVX512BW() && instruction_set_inst.AVX512VL());
 }
 
+//
+bool
+cpu_support_avx512_vpopcntdq() {
+    InstructionSet& instruction_set_inst = InstructionSet::GetInstance();
+    return (cpu_support_avx512() && instruction_set_inst.AVX512VPOPCNTDQ());
+}
+
 //
 bool
 cpu_support_avx2() {
@@ -211,6 +211,10 @@ public:
     PREFETCHWT1() {
         return f_7_ECX_[0];
     }
+    bool
+    AVX512VPOPCNTDQ() {
+        return f_7_ECX_[14];
+    }
 
     bool
     LAHF() {
@@ -276,6 +280,7 @@ public:
 };
 
 bool cpu_support_avx512();
+bool cpu_support_avx512_vpopcntdq();
 bool cpu_support_avx2();
 bool cpu_support_sse4_2();
 bool cpu_support_sse2();
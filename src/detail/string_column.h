@@ -0,0 +1,141 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "../common.h"
+
+namespace milvus {
+namespace bitset {
+namespace detail {
+
+// A column of strings in the Arrow-like layout. `offsets` contains
+//   (size + 1) elements, and i-th string occupies bytes
+//   [offsets[i], offsets[i + 1]) of `data`.
+// Both this column and `const std::string*` / `const std::string_view*`
+//   provide operator[] and operator+, so string kernels are written once.
+template<typename OffsetT>
+struct StringOffsetsColumn {
+    static_assert(std::is_integral_v<OffsetT>, "integral offsets are expected");
+
+    using offset_type = OffsetT;
+
+    const char* data;
+    const OffsetT* offsets;
+
+    inline std::string_view operator[](const size_t idx) const {
+        return std::string_view(
+            data + offsets[idx],
+            static_cast<size_t>(offsets[idx + 1] - offsets[idx])
+        );
+    }
+
+    // a column that starts from a given row
+    inline StringOffsetsColumn operator+(const size_t idx) const {
+        return StringOffsetsColumn{data, offsets + idx};
+    }
+};
+
+//
+template<typename T>
+constexpr bool is_string_offsets_column_v = false;
+
+template<typename OffsetT>
+constexpr bool is_string_offsets_column_v<StringOffsetsColumn<OffsetT>> = true;
+
+//
+template<typename T>
+constexpr bool is_string_type_v =
+    std::is_same_v<T, std::string> || std::is_same_v<T, std::string_view>;
+
+// SQL `LIKE 'prefix%'`
+inline bool string_starts_with(const std::string_view s, const std::string_view prefix) {
+    return (s.size() >= prefix.size()) && 
+        (std::memcmp(s.data(), prefix.data(), prefix.size()) == 0);
+}
+
+// The number of leading bytes of a string that are compared as an integer.
+constexpr size_t STRING_PREFIX_BYTES = sizeof(uint64_t);
+
+// Returns the first 8 bytes of a string, padded with zeros, as
+//   a big-endian integer. If prefixes of two strings differ, then
+//   the comparison of prefixes gives the same result as the
+//   lexicographic comparison of strings (bytes are unsigned, as in
+//   std::char_traits<char>). Equal prefixes require comparing
+//   the full strings.
+inline uint64_t get_string_prefix(const std::string_view s) {
+    uint64_t prefix = 0;
+    if (s.size() >= STRING_PREFIX_BYTES) {
+        std::memcpy(&prefix, s.data(), STRING_PREFIX_BYTES);
+    } else if (!s.empty()) {
+        std::memcpy(&prefix, s.data(), s.size());
+    }
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    prefix = __builtin_bswap64(prefix);
+#endif
+
+    return prefix;
+}
+
+// Same as get_string_prefix(), but 8 bytes starting from `s` are
+//   known to be readable, so no branching on the length is needed.
+inline uint64_t get_string_prefix_unchecked(const char* const s, const size_t length) {
+    uint64_t prefix = 0;
+    std::memcpy(&prefix, s, STRING_PREFIX_BYTES);
+
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    prefix = __builtin_bswap64(prefix);
+#endif
+
+    // zero the bytes past the end of the string
+    static constexpr uint64_t masks[STRING_PREFIX_BYTES + 1] = {
+        0x0000000000000000ULL, 0xFF00000000000000ULL, 0xFFFF000000000000ULL,
+        0xFFFFFF0000000000ULL, 0xFFFFFFFF00000000ULL, 0xFFFFFFFFFF000000ULL,
+        0xFFFFFFFFFFFF0000ULL, 0xFFFFFFFFFFFFFF00ULL, 0xFFFFFFFFFFFFFFFFULL
+    };
+
+    return prefix & masks[std::min(length, STRING_PREFIX_BYTES)];
+}
+
+// Gathers prefixes of rows [0, nrows) of a column.
+template<typename ColumnT>
+inline void get_string_prefixes(
+    const ColumnT column,
+    const size_t nrows,
+    uint64_t* const __restrict prefixes
+) {
+    for (size_t i = 0; i < nrows; i++) {
+        prefixes[i] = get_string_prefix(std::string_view(column[i]));
+    }
+}
+
+// Strings of the Arrow-like layout are stored back to back, so 8 bytes
+//   may be loaded unconditionally while they stay within the bytes 
+//   of rows [0, nrows).
+template<typename OffsetT>
+inline void get_string_prefixes(
+    const StringOffsetsColumn<OffsetT> column,
+    const size_t nrows,
+    uint64_t* const __restrict prefixes
+) {
+    const OffsetT end = column.offsets[nrows];
+    for (size_t i = 0; i < nrows; i++) {
+        const OffsetT begin = column.offsets[i];
+        const size_t length = static_cast<size_t>(column.offsets[i + 1] - begin);
+        if (begin + OffsetT(STRING_PREFIX_BYTES) <= end) [[likely]] {
+            prefixes[i] = get_string_prefix_unchecked(column.data + begin, length);
+        } else {
+            prefixes[i] = get_string_prefix(column[i]);
+        }
+    }
+}
+
+}
+}
+}
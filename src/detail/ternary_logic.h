@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace milvus {
+namespace bitset {
+namespace detail {
+
+// Bitwise operations over unsigned integers for ternary_logic().
+//   SIMD backends provide the same set of operations over their
+//   registers.
+template<typename T>
+struct ScalarLogicOps {
+    static inline T op_and(const T x, const T y) {
+        return x & y;
+    }
+
+    static inline T op_or(const T x, const T y) {
+        return x | y;
+    }
+
+    static inline T op_xor(const T x, const T y) {
+        return x ^ y;
+    }
+
+    // x & ~y
+    static inline T op_andnot(const T x, const T y) {
+        return x & T(~y);
+    }
+
+    static inline T op_not(const T x) {
+        return T(~x);
+    }
+
+    // (x & m) | (y & ~m)
+    static inline T op_select(const T m, const T x, const T y) {
+        return (x & m) | (y & T(~m));
+    }
+
+    static inline T zeros() {
+        return T(0);
+    }
+
+    static inline T ones() {
+        return T(~T(0));
+    }
+};
+
+// Evaluates a function of two arguments, given by a 4-bit truth table.
+//   Bit ((b << 1) | c) of the table is the result for given bits
+//   of b and c. Every function takes at most two operations.
+template<uint8_t TruthTable, typename OpsT, typename T>
+inline T binary_logic(const T b, const T c) {
+    constexpr uint8_t table = TruthTable & 0x0F;
+
+    if constexpr (table == 0x00) {
+        return OpsT::zeros();
+    } else if constexpr (table == 0x0F) {
+        return OpsT::ones();
+    } else if constexpr (table == 0x0C) {
+        return b;
+    } else if constexpr (table == 0x0A) {
+        return c;
+    } else if constexpr (table == 0x03) {
+        return OpsT::op_not(b);
+    } else if constexpr (table == 0x05) {
+        return OpsT::op_not(c);
+    } else if constexpr (table == 0x08) {
+        return OpsT::op_and(b, c);
+    } else if constexpr (table == 0x0E) {
+        return OpsT::op_or(b, c);
+    } else if constexpr (table == 0x06) {
+        return OpsT::op_xor(b, c);
+    } else if constexpr (table == 0x09) {
+        return OpsT::op_not(OpsT::op_xor(b, c));
+    } else if constexpr (table == 0x04) {
+        return OpsT::op_andnot(b, c);
+    } else if constexpr (table == 0x02) {
+        return OpsT::op_andnot(c, b);
+    } else if constexpr (table == 0x01) {
+        return OpsT::op_not(OpsT::op_or(b, c));
+    } else if constexpr (table == 0x07) {
+        return OpsT::op_not(OpsT::op_and(b, c));
+    } else if constexpr (table == 0x0B) {
+        return OpsT::op_not(OpsT::op_andnot(c, b));
+    } else {
+        // 0x0D
+        return OpsT::op_not(OpsT::op_andnot(b, c));
+    }
+}
+
+// Evaluates a function of three arguments, given by an 8-bit truth
+//   table in the format of vpternlog: bit ((a << 2) | (b << 1) | c)
+//   of the table is the result for given bits of a, b and c.
+//   The function is split into f(a, b, c) = a ? f1(b, c) : f0(b, c),
+//   and the cases when a can be combined with a single operation
+//   are recognized.
+template<uint8_t TruthTable, typename OpsT, typename T>
+inline T ternary_logic(const T a, const T b, const T c) {
+    // f(1, b, c)
+    constexpr uint8_t t1 = TruthTable >> 4;
+    // f(0, b, c)
+    constexpr uint8_t t0 = TruthTable & 0x0F;
+
+    if constexpr (t1 == t0) {
+        return binary_logic<t0, OpsT>(b, c);
+    } else if constexpr (t0 == 0x00) {
+        return OpsT::op_and(a, binary_logic<t1, OpsT>(b, c));
+    } else if constexpr (t1 == 0x00) {
+        return OpsT::op_andnot(binary_logic<t0, OpsT>(b, c), a);
+    } else if constexpr (t1 == 0x0F) {
+        return OpsT::op_or(a, binary_logic<t0, OpsT>(b, c));
+    } else if constexpr (t0 == 0x0F) {
+        return OpsT::op_not(OpsT::op_andnot(a, binary_logic<t1, OpsT>(b, c)));
+    } else if constexpr (t1 == (t0 ^ 0x0F)) {
+        return OpsT::op_xor(a, binary_logic<t0, OpsT>(b, c));
+    } else {
+        return OpsT::op_select(
+            a,
+            binary_logic<t1, OpsT>(b, c),
+            binary_logic<t0, OpsT>(b, c)
+        );
+    }
+}
+
+// Same as above, but the truth table is known in runtime only.
+//   Every minterm of the truth table is evaluated, so this one is
+//   intended for a small number of leftover bits.
+template<typename T>
+inline T ternary_logic(const T a, const T b, const T c, const uint8_t truth_table) {
+    T result = 0;
+    for (size_t i = 0; i < 8; i++) {
+        if ((truth_table >> i) & 1) {
+            const T va = (i & 4) ? a : T(~a);
+            const T vb = (i & 2) ? b : T(~b);
+            const T vc = (i & 1) ? c : T(~c);
+            result |= (va & vb & vc);
+        }
+    }
+
+    return result;
+}
+
+}
+}
+}
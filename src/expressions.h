@@ -0,0 +1,294 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+
+#include "common.h"
+
+namespace milvus {
+namespace bitset {
+
+// Lazy bitwise expressions over bitsets and bitset views, such as
+//
+//   Bitset c = (a & b) | (d - e);
+//   size_t n = (a ^ b).count();
+//
+// An expression holds references to the data of its operands and
+//   produces nothing until it is assigned to a Bitset / BitsetView
+//   or consumed by count(), all(), any(), none() or find_first().
+//   Both are done in a single blocked pass: bits of every block are
+//   evaluated into a buffer on the stack, which stays in L1 cache.
+// All operands of an expression are expected to have the same size.
+//   An expression must not outlive its operands. An expression may be
+//   assigned to one of its operands, unless they overlap at different
+//   offsets.
+
+template<typename PolicyT, typename ImplT, bool IsRangeCheckEnabled>
+class BitsetBase;
+
+enum class BitwiseOpType {
+    And,
+    Or,
+    Xor,
+    Sub
+};
+
+namespace detail {
+
+// Expressions are evaluated for blocks of bits, so that the bits
+//   of a block stay in L1 cache.
+constexpr size_t EXPR_BLOCK_BITS = 2048;
+
+// left[0, size) = left[0, size) Op right[start_right, start_right + size)
+template<typename PolicyT, BitwiseOpType Op>
+inline void apply_bitwise_op(
+    typename PolicyT::data_type* const left,
+    const typename PolicyT::data_type* const right,
+    const size_t start_right,
+    const size_t size
+) {
+    if constexpr (Op == BitwiseOpType::And) {
+        PolicyT::op_and(left, right, 0, start_right, size);
+    } else if constexpr (Op == BitwiseOpType::Or) {
+        PolicyT::op_or(left, right, 0, start_right, size);
+    } else if constexpr (Op == BitwiseOpType::Xor) {
+        PolicyT::op_xor(left, right, 0, start_right, size);
+    } else if constexpr (Op == BitwiseOpType::Sub) {
+        PolicyT::op_sub(left, right, 0, start_right, size);
+    } else {
+        // unimplemented
+        static_assert(always_false_v<PolicyT>, "unimplemented");
+    }
+}
+
+}
+
+// A bitset or a bitset view as an operand of an expression.
+template<typename PolicyT>
+class BitsetExprLeaf {
+public:
+    using policy_type = PolicyT;
+    using data_type = typename policy_type::data_type;
+
+    template<typename ImplT, bool R>
+    explicit BitsetExprLeaf(const BitsetBase<PolicyT, ImplT, R>& bitset) :
+        Data{bitset.data()}, Offset{bitset.offset()}, Size{bitset.size()} {}
+
+    inline size_t size() const {
+        return Size;
+    }
+
+    // dst[0, size) = bits [start, start + size)
+    inline void evaluate(data_type* const dst, const size_t start, const size_t size) const {
+        policy_type::op_copy(Data, Offset + start, dst, 0, size);
+    }
+
+    // dst[0, size) = dst[0, size) Op bits [start, start + size)
+    template<BitwiseOpType Op>
+    inline void apply(data_type* const dst, const size_t start, const size_t size) const {
+        detail::apply_bitwise_op<PolicyT, Op>(dst, Data, Offset + start, size);
+    }
+
+private:
+    const data_type* Data = nullptr;
+    // measured in bits
+    size_t Offset = 0;
+    // measured in bits
+    size_t Size = 0;
+};
+
+namespace detail {
+
+//
+template<typename T>
+struct is_bitset_expr : std::false_type {};
+
+template<typename PolicyT, typename ImplT, bool R>
+std::true_type is_bitset_base_impl(const BitsetBase<PolicyT, ImplT, R>*);
+std::false_type is_bitset_base_impl(...);
+
+template<typename T>
+constexpr bool is_bitset_base_v =
+    decltype(is_bitset_base_impl(std::declval<const T*>()))::value;
+
+// Either a bitset, a bitset view or an expression.
+template<typename T>
+constexpr bool is_expr_operand_v = is_bitset_base_v<T> || is_bitset_expr<T>::value;
+
+//
+template<typename T>
+inline auto as_expr_operand(const T& t) {
+    if constexpr (is_bitset_base_v<T>) {
+        return BitsetExprLeaf<typename T::policy_type>(t);
+    } else {
+        return t;
+    }
+}
+
+}
+
+// A node of an expression, which evaluates (left Op right).
+template<BitwiseOpType Op, typename LeftT, typename RightT>
+class BitsetExpr {
+public:
+    using policy_type = typename LeftT::policy_type;
+    using data_type = typename policy_type::data_type;
+
+    static_assert(
+        std::is_same_v<policy_type, typename RightT::policy_type>,
+        "operands are expected to have the same policy"
+    );
+
+    BitsetExpr(const LeftT& left, const RightT& right) :
+        Left{left}, Right{right} {}
+
+    inline size_t size() const {
+        return Left.size();
+    }
+
+    // Return the number of bits which are set to true.
+    size_t count() const {
+        size_t count = 0;
+        this->for_each_block([&count](const data_type* const block, const size_t, const size_t block_size) {
+            count += policy_type::op_count(block, 0, block_size);
+            return true;
+        });
+
+        return count;
+    }
+
+    // Return whether all bits are set to true.
+    bool all() const {
+        bool result = true;
+        this->for_each_block([&result](const data_type* const block, const size_t, const size_t block_size) {
+            result = policy_type::op_all(block, 0, block_size);
+            return result;
+        });
+
+        return result;
+    }
+
+    // Return whether any of the bits is set to true.
+    inline bool any() const {
+        return (!this->none());
+    }
+
+    // Return whether all bits are set to false.
+    bool none() const {
+        bool result = true;
+        this->for_each_block([&result](const data_type* const block, const size_t, const size_t block_size) {
+            result = policy_type::op_none(block, 0, block_size);
+            return result;
+        });
+
+        return result;
+    }
+
+    // Find the index of the first bit set to either true (default), or false.
+    std::optional<size_t> find_first(const bool is_set = true) const {
+        std::optional<size_t> result;
+        this->for_each_block(
+            [&result, is_set](const data_type* const block, const size_t block_start, const size_t block_size) {
+                const auto idx = policy_type::op_find(block, 0, block_size, 0, is_set);
+                if (idx.has_value()) {
+                    result = block_start + idx.value();
+                    return false;
+                }
+
+                return true;
+            }
+        );
+
+        return result;
+    }
+
+    // dst[0, size) = bits [start, start + size)
+    inline void evaluate(data_type* const dst, const size_t start, const size_t size) const {
+        Left.evaluate(dst, start, size);
+        Right.template apply<Op>(dst, start, size);
+    }
+
+    // dst[0, size) = dst[0, size) ParentOp bits [start, start + size)
+    template<BitwiseOpType ParentOp>
+    inline void apply(data_type* const dst, const size_t start, const size_t size) const {
+        data_type buffer[detail::EXPR_BLOCK_BITS / (sizeof(data_type) * 8)];
+        this->evaluate(buffer, start, size);
+
+        detail::apply_bitwise_op<policy_type, ParentOp>(dst, buffer, 0, size);
+    }
+
+    // Calls func(const data_type* block, const size_t block_start, const size_t block_size)
+    //   for the evaluated bits of consecutive blocks, while it returns true.
+    template<typename FuncT>
+    void for_each_block(FuncT func) const {
+        data_type buffer[detail::EXPR_BLOCK_BITS / (sizeof(data_type) * 8)];
+
+        const size_t size = this->size();
+        for (size_t block_start = 0; block_start < size; block_start += detail::EXPR_BLOCK_BITS) {
+            const size_t block_size = std::min(detail::EXPR_BLOCK_BITS, size - block_start);
+
+            this->evaluate(buffer, block_start, block_size);
+            if (!func(static_cast<const data_type*>(buffer), block_start, block_size)) {
+                return;
+            }
+        }
+    }
+
+private:
+    LeftT Left;
+    RightT Right;
+};
+
+namespace detail {
+
+template<BitwiseOpType Op, typename LeftT, typename RightT>
+struct is_bitset_expr<BitsetExpr<Op, LeftT, RightT>> : std::true_type {};
+
+//
+template<BitwiseOpType Op, typename LeftT, typename RightT>
+inline auto make_bitset_expr(const LeftT& left, const RightT& right) {
+    using left_type = decltype(as_expr_operand(left));
+    using right_type = decltype(as_expr_operand(right));
+
+    return BitsetExpr<Op, left_type, right_type>(
+        as_expr_operand(left),
+        as_expr_operand(right)
+    );
+}
+
+template<typename LeftT, typename RightT>
+using enable_if_expr_operands_t = std::enable_if_t<
+    is_expr_operand_v<LeftT> && is_expr_operand_v<RightT>
+>;
+
+}
+
+// Return an expression, equal to a & b
+template<typename LeftT, typename RightT, typename = detail::enable_if_expr_operands_t<LeftT, RightT>>
+inline auto operator&(const LeftT& a, const RightT& b) {
+    return detail::make_bitset_expr<BitwiseOpType::And>(a, b);
+}
+
+// Return an expression, equal to a | b
+template<typename LeftT, typename RightT, typename = detail::enable_if_expr_operands_t<LeftT, RightT>>
+inline auto operator|(const LeftT& a, const RightT& b) {
+    return detail::make_bitset_expr<BitwiseOpType::Or>(a, b);
+}
+
+// Return an expression, equal to a ^ b
+template<typename LeftT, typename RightT, typename = detail::enable_if_expr_operands_t<LeftT, RightT>>
+inline auto operator^(const LeftT& a, const RightT& b) {
+    return detail::make_bitset_expr<BitwiseOpType::Xor>(a, b);
+}
+
+// Return an expression, equal to a & ~b
+template<typename LeftT, typename RightT, typename = detail::enable_if_expr_operands_t<LeftT, RightT>>
+inline auto operator-(const LeftT& a, const RightT& b) {
+    return detail::make_bitset_expr<BitwiseOpType::Sub>(a, b);
+}
+
+}
+}
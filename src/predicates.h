@@ -0,0 +1,268 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include "common.h"
+
+namespace milvus {
+namespace bitset {
+
+// Predicates for BitsetBase::inplace_conjunction() and
+//   BitsetBase::inplace_disjunction(), such as
+//
+//   bitset.inplace_conjunction(
+//       size,
+//       compare_val(a, x, CompareOpType::GT),
+//       within_range_val(y, z, b, RangeType::IncInc),
+//       any_of(compare_val(c, w, CompareOpType::NE), compare_val(d, v, CompareOpType::EQ))
+//   );
+//
+// Every predicate provides
+//   template<CombineMode Mode, typename BitsetT>
+//   void evaluate(BitsetT& block, const size_t offset) const;
+//   which merges the result of the predicate for rows
+//   [offset, offset + block.size()) into the bits of a block.
+
+template<typename PolicyT, bool IsRangeCheckEnabled>
+class BitsetView;
+
+namespace detail {
+
+// Predicates are evaluated for blocks of rows, so that the bits of
+//   a block stay in L1 cache until all predicates are applied.
+constexpr size_t PREDICATE_BLOCK_BITS = 2048;
+
+// Evaluates a list of predicates for a block. The first predicate is
+//   merged using FirstMode, the rest ones are merged using NextMode,
+//   which is either And or Or. Stops once the result of a block
+//   cannot change.
+template<CombineMode FirstMode, CombineMode NextMode, typename BitsetT, typename PredicateT, typename... PredicatesT>
+inline void evaluate_predicates(
+    BitsetT& block,
+    const size_t offset,
+    const PredicateT& predicate,
+    const PredicatesT&... predicates
+) {
+    static_assert(NextMode == CombineMode::And || NextMode == CombineMode::Or);
+
+    predicate.template evaluate<FirstMode>(block, offset);
+
+    if constexpr (sizeof...(PredicatesT) != 0) {
+        if constexpr (NextMode == CombineMode::And) {
+            if (block.none()) {
+                return;
+            }
+        } else {
+            if (block.all()) {
+                return;
+            }
+        }
+
+        evaluate_predicates<NextMode, NextMode>(block, offset, predicates...);
+    }
+}
+
+// Evaluates a list of predicates, which are combined using ListMode,
+//   and merges the result into a block using Mode.
+template<CombineMode Mode, CombineMode ListMode, typename BitsetT, typename TupleT>
+inline void evaluate_predicates_tuple(
+    BitsetT& block,
+    const size_t offset,
+    const TupleT& predicates
+) {
+    if constexpr (Mode == CombineMode::Store || Mode == ListMode) {
+        // the result of the list may be accumulated in the block directly
+        std::apply(
+            [&block, offset](const auto&... p) {
+                evaluate_predicates<Mode, ListMode>(block, offset, p...);
+            },
+            predicates
+        );
+    } else {
+        // a temporary block on the stack is needed
+        using policy_type = typename BitsetT::policy_type;
+        using data_type = typename policy_type::data_type;
+
+        data_type buffer[PREDICATE_BLOCK_BITS / (sizeof(data_type) * 8)];
+        BitsetView<policy_type, false> tmp(buffer, block.size());
+
+        evaluate_predicates_tuple<CombineMode::Store, ListMode>(tmp, offset, predicates);
+
+        if constexpr (Mode == CombineMode::And) {
+            block.inplace_and(tmp, block.size());
+        } else if constexpr (Mode == CombineMode::Or) {
+            block.inplace_or(tmp, block.size());
+        } else if constexpr (Mode == CombineMode::AndNot) {
+            block.inplace_sub(tmp, block.size());
+        } else {
+            // unimplemented
+            static_assert(always_false_v<BitsetT>, "unimplemented");
+        }
+    }
+}
+
+}
+
+// t[i] ? value
+template<typename T>
+struct CompareValPredicate {
+    const T* t;
+    T value;
+    CompareOpType op;
+
+    template<CombineMode Mode, typename BitsetT>
+    inline void evaluate(BitsetT& block, const size_t offset) const {
+        block.template inplace_compare_val<T, Mode>(t + offset, block.size(), value, op);
+    }
+};
+
+// t[i] ? u[i]
+template<typename T, typename U>
+struct CompareColumnPredicate {
+    const T* t;
+    const U* u;
+    CompareOpType op;
+
+    template<CombineMode Mode, typename BitsetT>
+    inline void evaluate(BitsetT& block, const size_t offset) const {
+        block.template inplace_compare_column<T, U, Mode>(t + offset, u + offset, block.size(), op);
+    }
+};
+
+// lower ? values[i] && values[i] ? upper
+template<typename T>
+struct WithinRangeValPredicate {
+    T lower;
+    T upper;
+    const T* values;
+    RangeType op;
+
+    template<CombineMode Mode, typename BitsetT>
+    inline void evaluate(BitsetT& block, const size_t offset) const {
+        block.template inplace_within_range_val<T, Mode>(lower, upper, values + offset, block.size(), op);
+    }
+};
+
+// lower[i] ? values[i] && values[i] ? upper[i]
+template<typename T>
+struct WithinRangeColumnPredicate {
+    const T* lower;
+    const T* upper;
+    const T* values;
+    RangeType op;
+
+    template<CombineMode Mode, typename BitsetT>
+    inline void evaluate(BitsetT& block, const size_t offset) const {
+        block.template inplace_within_range_column<T, Mode>(
+            lower + offset, upper + offset, values + offset, block.size(), op
+        );
+    }
+};
+
+// (src[i] AOp right_operand) ? value
+template<typename T>
+struct ArithComparePredicate {
+    const T* src;
+    ArithHighPrecisionType<T> right_operand;
+    ArithHighPrecisionType<T> value;
+    ArithOpType a_op;
+    CompareOpType cmp_op;
+
+    template<CombineMode Mode, typename BitsetT>
+    inline void evaluate(BitsetT& block, const size_t offset) const {
+        block.template inplace_arith_compare<T, Mode>(
+            src + offset, right_operand, value, block.size(), a_op, cmp_op
+        );
+    }
+};
+
+// p0 AND p1 AND ...
+template<typename... PredicatesT>
+struct AllOfPredicate {
+    std::tuple<PredicatesT...> predicates;
+
+    template<CombineMode Mode, typename BitsetT>
+    inline void evaluate(BitsetT& block, const size_t offset) const {
+        detail::evaluate_predicates_tuple<Mode, CombineMode::And>(block, offset, predicates);
+    }
+};
+
+// p0 OR p1 OR ...
+template<typename... PredicatesT>
+struct AnyOfPredicate {
+    std::tuple<PredicatesT...> predicates;
+
+    template<CombineMode Mode, typename BitsetT>
+    inline void evaluate(BitsetT& block, const size_t offset) const {
+        detail::evaluate_predicates_tuple<Mode, CombineMode::Or>(block, offset, predicates);
+    }
+};
+
+//
+template<typename T>
+inline CompareValPredicate<T> compare_val(
+    const T* const t,
+    const T& value,
+    const CompareOpType op
+) {
+    return CompareValPredicate<T>{t, value, op};
+}
+
+template<typename T, typename U>
+inline CompareColumnPredicate<T, U> compare_column(
+    const T* const t,
+    const U* const u,
+    const CompareOpType op
+) {
+    return CompareColumnPredicate<T, U>{t, u, op};
+}
+
+template<typename T>
+inline WithinRangeValPredicate<T> within_range_val(
+    const T& lower,
+    const T& upper,
+    const T* const values,
+    const RangeType op
+) {
+    return WithinRangeValPredicate<T>{lower, upper, values, op};
+}
+
+template<typename T>
+inline WithinRangeColumnPredicate<T> within_range_column(
+    const T* const lower,
+    const T* const upper,
+    const T* const values,
+    const RangeType op
+) {
+    return WithinRangeColumnPredicate<T>{lower, upper, values, op};
+}
+
+template<typename T>
+inline ArithComparePredicate<T> arith_compare(
+    const T* const src,
+    const ArithHighPrecisionType<T>& right_operand,
+    const ArithHighPrecisionType<T>& value,
+    const ArithOpType a_op,
+    const CompareOpType cmp_op
+) {
+    return ArithComparePredicate<T>{src, right_operand, value, a_op, cmp_op};
+}
+
+template<typename... PredicatesT>
+inline AllOfPredicate<PredicatesT...> all_of(const PredicatesT&... predicates) {
+    static_assert(sizeof...(PredicatesT) > 0, "at least one predicate is expected");
+    return AllOfPredicate<PredicatesT...>{std::tuple<PredicatesT...>(predicates...)};
+}
+
+template<typename... PredicatesT>
+inline AnyOfPredicate<PredicatesT...> any_of(const PredicatesT&... predicates) {
+    static_assert(sizeof...(PredicatesT) > 0, "at least one predicate is expected");
+    return AnyOfPredicate<PredicatesT...>{std::tuple<PredicatesT...>(predicates...)};
+}
+
+}
+}
@@ -1,14 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
+#include <iterator>
 #include <limits>
 #include <optional>
 #include <random>
 #include <string>
+#include <string_view>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <bitset.h>
@@ -142,6 +147,10 @@ using Ttypes2 = ::testing::Types<
     std::tuple<int64_t, int64_t, uint8_t, uint8_t>, 
     std::tuple<float, float, uint8_t, uint8_t>,
     std::tuple<double, double, uint8_t, uint8_t>,
+    std::tuple<uint8_t, uint8_t, uint8_t, uint8_t>,
+    std::tuple<uint16_t, uint16_t, uint8_t, uint8_t>,
+    std::tuple<uint32_t, uint32_t, uint8_t, uint8_t>,
+    std::tuple<uint64_t, uint64_t, uint8_t, uint8_t>,
     std::tuple<std::string, std::string, uint8_t, uint8_t>,
 #endif
 
@@ -151,7 +160,17 @@ using Ttypes2 = ::testing::Types<
     std::tuple<int64_t, int64_t, uint64_t, uint8_t>, 
     std::tuple<float, float, uint64_t, uint8_t>,
     std::tuple<double, double, uint64_t, uint8_t>,
-    std::tuple<std::string, std::string, uint64_t, uint8_t>
+    std::tuple<uint8_t, uint8_t, uint64_t, uint8_t>,
+    std::tuple<uint16_t, uint16_t, uint64_t, uint8_t>,
+    std::tuple<uint32_t, uint32_t, uint64_t, uint8_t>,
+    std::tuple<uint64_t, uint64_t, uint64_t, uint8_t>,
+    std::tuple<std::string, std::string, uint64_t, uint8_t>,
+    std::tuple<int8_t, int64_t, uint64_t, uint8_t>,
+    std::tuple<int16_t, int64_t, uint64_t, uint8_t>,
+    std::tuple<int32_t, int64_t, uint64_t, uint8_t>,
+    std::tuple<int32_t, float, uint64_t, uint8_t>,
+    std::tuple<int32_t, double, uint64_t, uint8_t>,
+    std::tuple<float, double, uint64_t, uint8_t>
 
 #if FULL_TESTS == 1
     ,
@@ -161,6 +180,10 @@ using Ttypes2 = ::testing::Types<
     std::tuple<int64_t, int64_t, uint8_t, uint64_t>, 
     std::tuple<float, float, uint8_t, uint64_t>,
     std::tuple<double, double, uint8_t, uint64_t>,
+    std::tuple<uint8_t, uint8_t, uint8_t, uint64_t>,
+    std::tuple<uint16_t, uint16_t, uint8_t, uint64_t>,
+    std::tuple<uint32_t, uint32_t, uint8_t, uint64_t>,
+    std::tuple<uint64_t, uint64_t, uint8_t, uint64_t>,
     std::tuple<std::string, std::string, uint8_t, uint64_t>,
 
     std::tuple<int8_t, int8_t, uint64_t, uint64_t>,
@@ -169,6 +192,10 @@ using Ttypes2 = ::testing::Types<
     std::tuple<int64_t, int64_t, uint64_t, uint64_t>, 
     std::tuple<float, float, uint64_t, uint64_t>,
     std::tuple<double, double, uint64_t, uint64_t>,
+    std::tuple<uint8_t, uint8_t, uint64_t, uint64_t>,
+    std::tuple<uint16_t, uint16_t, uint64_t, uint64_t>,
+    std::tuple<uint32_t, uint32_t, uint64_t, uint64_t>,
+    std::tuple<uint64_t, uint64_t, uint64_t, uint64_t>,
     std::tuple<std::string, std::string, uint64_t, uint64_t>
 #endif
 >;
@@ -182,6 +209,10 @@ using Ttypes1 = ::testing::Types<
     std::tuple<int64_t, uint8_t, uint8_t>, 
     std::tuple<float, uint8_t, uint8_t>,
     std::tuple<double, uint8_t, uint8_t>,
+    std::tuple<uint8_t, uint8_t, uint8_t>,
+    std::tuple<uint16_t, uint8_t, uint8_t>,
+    std::tuple<uint32_t, uint8_t, uint8_t>,
+    std::tuple<uint64_t, uint8_t, uint8_t>,
     std::tuple<std::string, uint8_t, uint8_t>,
 #endif
 
@@ -191,6 +222,10 @@ using Ttypes1 = ::testing::Types<
     std::tuple<int64_t, uint64_t, uint8_t>, 
     std::tuple<float, uint64_t, uint8_t>,
     std::tuple<double, uint64_t, uint8_t>,
+    std::tuple<uint8_t, uint64_t, uint8_t>,
+    std::tuple<uint16_t, uint64_t, uint8_t>,
+    std::tuple<uint32_t, uint64_t, uint8_t>,
+    std::tuple<uint64_t, uint64_t, uint8_t>,
     std::tuple<std::string, uint64_t, uint8_t>
 
 #if FULL_TESTS == 1
@@ -201,6 +236,10 @@ using Ttypes1 = ::testing::Types<
     std::tuple<int64_t, uint8_t, uint64_t>, 
     std::tuple<float, uint8_t, uint64_t>,
     std::tuple<double, uint8_t, uint64_t>,
+    std::tuple<uint8_t, uint8_t, uint64_t>,
+    std::tuple<uint16_t, uint8_t, uint64_t>,
+    std::tuple<uint32_t, uint8_t, uint64_t>,
+    std::tuple<uint64_t, uint8_t, uint64_t>,
     std::tuple<std::string, uint8_t, uint64_t>,
 
     std::tuple<int8_t, uint64_t, uint64_t>,
@@ -209,6 +248,10 @@ using Ttypes1 = ::testing::Types<
     std::tuple<int64_t, uint64_t, uint64_t>, 
     std::tuple<float, uint64_t, uint64_t>,
     std::tuple<double, uint64_t, uint64_t>,
+    std::tuple<uint8_t, uint64_t, uint64_t>,
+    std::tuple<uint16_t, uint64_t, uint64_t>,
+    std::tuple<uint32_t, uint64_t, uint64_t>,
+    std::tuple<uint64_t, uint64_t, uint64_t>,
     std::tuple<std::string, uint64_t, uint64_t>
 #endif
 >;
@@ -291,6 +334,25 @@ std::string from_i32(const int32_t i) {
     return std::to_string(i);
 }
 
+// Moves small unsigned values to the boundary between the signed and
+//   the unsigned ranges, so that a signed comparison would fail.
+//   Other types are left intact.
+template<typename T>
+T ShiftToSignBoundary(const T& value) {
+    if constexpr (std::is_integral_v<T> && std::is_unsigned_v<T>) {
+        return T(value + T(std::numeric_limits<std::make_signed_t<T>>::max()) - T(1));
+    } else {
+        return value;
+    }
+}
+
+template<typename T>
+void ShiftToSignBoundary(std::vector<T>& t) {
+    for (size_t i = 0; i < t.size(); i++) {
+        t[i] = ShiftToSignBoundary(t[i]);
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////
 
 //
@@ -495,6 +557,9 @@ void TestInplaceCompareColumnImpl(
     FillRandom(t, rng, max_v);
     FillRandom(u, rng, max_v);
 
+    ShiftToSignBoundary(t);
+    ShiftToSignBoundary(u);
+
     StopWatch sw;
     bitset.inplace_compare_column(t.data(), u.data(), n, op);
     
@@ -521,6 +586,61 @@ void TestInplaceCompareColumnImpl(
     }
 }
 
+template<typename BitsetT, typename T, typename U>
+void TestInplaceCompareColumnMixedImpl(
+    BitsetT& bitset, CompareOpType op
+) {
+    // values of different types are compared over wide ranges, 
+    //   so that the rounding to a common type matters
+    const size_t n = bitset.size();
+
+    std::vector<T> t(n, T(0));
+    std::vector<U> u(n, U(0));
+
+    std::default_random_engine rng(123);
+    std::uniform_int_distribution<int64_t> ti(
+        int64_t(std::numeric_limits<std::conditional_t<std::is_integral_v<T>, T, int32_t>>::min()), 
+        int64_t(std::numeric_limits<std::conditional_t<std::is_integral_v<T>, T, int32_t>>::max())
+    );
+    std::uniform_real_distribution<double> tf(-1e9, 1e9);
+    for (size_t i = 0; i < n; i++) {
+        t[i] = std::is_integral_v<T> ? T(ti(rng)) : T(tf(rng));
+
+        switch (i % 4) {
+            case 0: u[i] = U(t[i]); break;
+            case 1: u[i] = U(t[i]) + U(1); break;
+            case 2: u[i] = U(t[i]) - U(1); break;
+            default: u[i] = std::is_integral_v<U> ? U(ti(rng)) : U(tf(rng)); break;
+        }
+
+        if constexpr (std::is_floating_point_v<U>) {
+            if (i % 16 == 5) {
+                u[i] = std::numeric_limits<U>::quiet_NaN();
+            }
+        }
+    }
+
+    bitset.inplace_compare_column(t.data(), u.data(), n, op);
+
+    for (size_t i = 0; i < n; i++) {
+        if (op == CompareOpType::EQ) {
+            ASSERT_EQ(t[i] == u[i], bitset[i]) << i;
+        } else if (op == CompareOpType::GE) {
+            ASSERT_EQ(t[i] >= u[i], bitset[i]) << i;
+        } else if (op == CompareOpType::GT) {
+            ASSERT_EQ(t[i] > u[i], bitset[i]) << i;
+        } else if (op == CompareOpType::LE) {
+            ASSERT_EQ(t[i] <= u[i], bitset[i]) << i;            
+        } else if (op == CompareOpType::LT) {
+            ASSERT_EQ(t[i] < u[i], bitset[i]) << i;            
+        } else if (op == CompareOpType::NE) {
+            ASSERT_EQ(t[i] != u[i], bitset[i]) << i;            
+        } else {
+            ASSERT_TRUE(false) << "Not implemented";
+        }
+    }
+}
+
 template<typename BitsetT, typename T, typename U>
 void TestInplaceCompareColumnImpl() {
     for (const size_t n : typical_sizes) {
@@ -548,6 +668,16 @@ void TestInplaceCompareColumnImpl() {
                 
                 TestInplaceCompareColumnImpl<decltype(view), T, U>(view, op);
             }
+
+            if constexpr (!std::is_same_v<T, U>) {
+                bitset.reset();
+
+                if (print_log) {
+                    printf("Testing bitset mixed, n=%zd, op=%zd\n", n, (size_t)op);
+                }
+
+                TestInplaceCompareColumnMixedImpl<BitsetT, T, U>(bitset, op);
+            }
         }
     }
 }
@@ -702,12 +832,13 @@ void TestInplaceCompareValImpl(
 ) {
     const size_t n = bitset.size();
     constexpr size_t max_v = 3;
-    const T value = from_i32<T>(1);
+    const T value = ShiftToSignBoundary(from_i32<T>(1));
 
     std::vector<T> t(n, from_i32<T>(0));
 
     std::default_random_engine rng(123);
     FillRandom(t, rng, max_v);
+    ShiftToSignBoundary(t);
 
     StopWatch sw;
     bitset.inplace_compare_val(t.data(), n, value, op);
@@ -893,6 +1024,220 @@ REGISTER_TYPED_TEST_SUITE_P(InplaceCompareValSuite, BitWise, ElementWise, Avx2,
 INSTANTIATE_TYPED_TEST_SUITE_P(InplaceCompareValTest, InplaceCompareValSuite, Ttypes1);
 
 
+//////////////////////////////////////////////////////////////////////////////////////////
+
+//
+static constexpr size_t typical_in_values_sizes[] = 
+    { 0, 1, 5, 16, 17, 100 };
+
+template<typename BitsetT, typename T>
+void TestInplaceInValuesImpl(
+    BitsetT& bitset, const size_t n_values, InValuesType op
+) {
+    const size_t n = bitset.size();
+    constexpr size_t max_v = 63;
+
+    std::vector<T> t(n, from_i32<T>(0));
+
+    std::default_random_engine rng(123);
+    FillRandom(t, rng, max_v);
+    ShiftToSignBoundary(t);
+
+    // every third value is missing from the data, some values are duplicated
+    std::vector<T> values;
+    for (size_t j = 0; j < n_values; j++) {
+        values.push_back(ShiftToSignBoundary(from_i32<T>((j * 3) % 97)));
+    }
+
+    // NaN never matches
+    if constexpr (std::is_floating_point_v<T>) {
+        if (n_values > 0) {
+            values[n_values / 2] = std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    StopWatch sw;
+    if (op == InValuesType::In) {
+        bitset.inplace_in_values(t.data(), n, values.data(), n_values);
+    } else {
+        bitset.inplace_not_in_values(t.data(), n, values.data(), n_values);
+    }
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const bool is_in = 
+            (std::find(values.begin(), values.end(), t[i]) != values.end());
+        if (op == InValuesType::In) {
+            ASSERT_EQ(is_in, bitset[i]) << i;
+        } else {
+            ASSERT_EQ(!is_in, bitset[i]) << i;
+        }
+    }
+}
+
+template<typename BitsetT, typename T>
+void TestInplaceInValuesImpl() {
+    for (const size_t n : typical_sizes) {
+        for (const size_t n_values : typical_in_values_sizes) {
+            for (const auto op : {InValuesType::In, InValuesType::NotIn}) {
+                BitsetT bitset(n);
+                bitset.reset();
+
+                if (print_log) {
+                    printf("Testing bitset, n=%zd, n_values=%zd, op=%zd\n", n, n_values, (size_t)op);
+                }
+
+                TestInplaceInValuesImpl<BitsetT, T>(bitset, n_values, op);
+
+                for (const size_t offset : typical_offsets) {
+                    if (offset >= n) {
+                        continue;
+                    }
+
+                    bitset.reset();
+                    auto view = bitset.view(offset);
+
+                    if (print_log) {
+                        printf("Testing bitset view, n=%zd, offset=%zd, n_values=%zd, op=%zd\n", n, offset, n_values, (size_t)op);
+                    }
+
+                    TestInplaceInValuesImpl<decltype(view), T>(view, n_values, op);
+                }
+            }
+        }
+    }
+}
+
+//
+template<typename T>
+class InplaceInValuesSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(InplaceInValuesSuite);
+
+
+TYPED_TEST_P(InplaceInValuesSuite, BitWise) {
+    using impl_traits = 
+        RefImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>
+        >;
+    TestInplaceInValuesImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(InplaceInValuesSuite, ElementWise) {
+    using impl_traits = 
+        ElementImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>
+        >;
+    TestInplaceInValuesImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(InplaceInValuesSuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<1, TypeParam>, 
+                std::tuple_element_t<2, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx2
+            >;
+        TestInplaceInValuesImpl<
+            typename impl_traits::bitset_type,
+            std::tuple_element_t<0, TypeParam>>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceInValuesSuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<1, TypeParam>, 
+                std::tuple_element_t<2, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx512
+            >;
+        TestInplaceInValuesImpl<
+            typename impl_traits::bitset_type,
+            std::tuple_element_t<0, TypeParam>>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceInValuesSuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedNeon
+        >;
+    TestInplaceInValuesImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+#endif
+}
+
+TYPED_TEST_P(InplaceInValuesSuite, Sve) {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedSve
+        >;
+    TestInplaceInValuesImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+#endif
+}
+
+TYPED_TEST_P(InplaceInValuesSuite, Dynamic) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::VectorizedDynamic
+        >;
+    TestInplaceInValuesImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(InplaceInValuesSuite, VecRef) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::VectorizedRef
+        >;
+    TestInplaceInValuesImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(InplaceInValuesSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(InplaceInValuesTest, InplaceInValuesSuite, Ttypes1);
+
+
 //////////////////////////////////////////////////////////////////////////////////////////
 
 //
@@ -914,6 +1259,9 @@ void TestInplaceWithinRangeColumnImpl(
     FillRandom(range, rng, max_v);
     FillRandom(values, rng, 2 * max_v);
 
+    ShiftToSignBoundary(lower);
+    ShiftToSignBoundary(values);
+
     for (size_t i = 0; i < n; i++) {
         upper[i] = lower[i] + range[i];
     }
@@ -1107,13 +1455,14 @@ void TestInplaceWithinRangeValImpl(
 ) {
     const size_t n = bitset.size();
     constexpr size_t max_v = 10;
-    const T lower_v = from_i32<T>(3);
-    const T upper_v = from_i32<T>(7);
+    const T lower_v = ShiftToSignBoundary(from_i32<T>(3));
+    const T upper_v = ShiftToSignBoundary(from_i32<T>(7));
 
     std::vector<T> values(n, from_i32<T>(0));
 
     std::default_random_engine rng(123);
     FillRandom(values, rng, max_v);
+    ShiftToSignBoundary(values);
 
 
     StopWatch sw;
@@ -1298,44 +1647,1371 @@ INSTANTIATE_TYPED_TEST_SUITE_P(InplaceWithinRangeValTest, InplaceWithinRangeValS
 
 //////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename BitsetT, typename T>
-struct TestInplaceArithCompareImplS {
-    static void process(
-        BitsetT& bitset, ArithOpType a_op, CompareOpType cmp_op, 
-        const int32_t right_operand_in, const int32_t value_in
-    ) {
-        using HT = ArithHighPrecisionType<T>;
-
-        const size_t n = bitset.size();
-        constexpr int32_t max_v = 10;
-
-        std::vector<T> left(n, 0);
-        const HT right_operand = from_i32<HT>(right_operand_in);
-        const HT value = from_i32<HT>(value_in);
+// Strings share common prefixes of various lengths, so that a lot of
+//   them are equal in the first 8 bytes. '\xff' checks that bytes are
+//   compared as unsigned ones.
+std::string RandomString(std::default_random_engine& rng) {
+    static const std::string common_prefixes[] = 
+        { "", "abab", "abababa", "abababab", "ababababab",
+          std::string(33, 'a'), std::string(70, 'b') };
+    static constexpr char alphabet[] = { '\0', 'a', 'b', '\xff' };
+
+    std::uniform_int_distribution<size_t> prefix_d(0, std::size(common_prefixes) - 1);
+    std::uniform_int_distribution<size_t> length_d(0, 4);
+    std::uniform_int_distribution<size_t> alphabet_d(0, std::size(alphabet) - 1);
+
+    std::string s = common_prefixes[prefix_d(rng)];
+    const size_t length = length_d(rng);
+    for (size_t i = 0; i < length; i++) {
+        s.push_back(alphabet[alphabet_d(rng)]);
+    }
 
-        std::default_random_engine rng(123);
-        // Generating values in (-x, x) range.
-        // This is fine, because we're operating with signed integers. 
-        FillRandomRange(left, rng, -max_v, max_v);
+    return s;
+}
 
-        StopWatch sw;
-        bitset.inplace_arith_compare(left.data(), right_operand, value, n, a_op, cmp_op);
-        
-        if (print_timing) {
-            printf("elapsed %f\n", sw.elapsed());
+// The same strings in the Arrow-like layout and as std::string_view.
+struct StringColumnData {
+    std::vector<std::string> strings;
+    std::string bytes;
+    std::vector<int32_t> offsets32;
+    std::vector<int64_t> offsets64;
+    std::vector<std::string_view> views;
+
+    StringColumnData(const size_t n, std::default_random_engine& rng) {
+        offsets32.push_back(0);
+        offsets64.push_back(0);
+        for (size_t i = 0; i < n; i++) {
+            strings.push_back(RandomString(rng));
+            bytes += strings.back();
+            offsets32.push_back(bytes.size());
+            offsets64.push_back(bytes.size());
         }
 
         for (size_t i = 0; i < n; i++) {
-            if (a_op == ArithOpType::Add) {
-                if (cmp_op == CompareOpType::EQ) {
-                    ASSERT_EQ((left[i] + right_operand) == value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
-                } else if (cmp_op == CompareOpType::GE) {
-                    ASSERT_EQ((left[i] + right_operand) >= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
-                } else if (cmp_op == CompareOpType::GT) {
-                    ASSERT_EQ((left[i] + right_operand) > value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
-                } else if (cmp_op == CompareOpType::LE) {
-                    ASSERT_EQ((left[i] + right_operand) <= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
-                } else if (cmp_op == CompareOpType::LT) {
+            views.emplace_back(bytes.data() + offsets64[i], strings[i].size());
+        }
+    }
+};
+
+bool CompareStrings(const std::string_view a, const std::string_view b, CompareOpType op) {
+    if (op == CompareOpType::EQ) {
+        return (a == b);
+    } else if (op == CompareOpType::GE) {
+        return (a >= b);
+    } else if (op == CompareOpType::GT) {
+        return (a > b);
+    } else if (op == CompareOpType::LE) {
+        return (a <= b);
+    } else if (op == CompareOpType::LT) {
+        return (a < b);
+    } else if (op == CompareOpType::NE) {
+        return (a != b);
+    } else {
+        return false;
+    }
+}
+
+bool WithinRangeStrings(const std::string_view lower, const std::string_view upper, const std::string_view v, RangeType op) {
+    if (op == RangeType::IncInc) {
+        return (lower <= v && v <= upper);
+    } else if (op == RangeType::ExcInc) {
+        return (lower < v && v <= upper);
+    } else if (op == RangeType::IncExc) {
+        return (lower <= v && v < upper);
+    } else if (op == RangeType::ExcExc) {
+        return (lower < v && v < upper);
+    } else {
+        return false;
+    }
+}
+
+template<typename BitsetT>
+void TestInplaceCompareStringImpl(
+    BitsetT& bitset, const StringColumnData& column, CompareOpType op
+) {
+    const size_t n = bitset.size();
+
+    std::default_random_engine rng(345);
+    for (size_t k = 0; k < 4; k++) {
+        const std::string value = RandomString(rng);
+
+        StopWatch sw;
+        bitset.inplace_compare_string_val(column.bytes.data(), column.offsets32.data(), n, value, op);
+
+        if (print_timing) {
+            printf("elapsed %f\n", sw.elapsed());
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(CompareStrings(column.strings[i], value, op), bitset[i]) << i;
+        }
+
+        bitset.reset();
+        bitset.inplace_compare_val(column.views.data(), n, std::string_view(value), op);
+
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(CompareStrings(column.strings[i], value, op), bitset[i]) << i;
+        }
+    }
+}
+
+template<typename BitsetT>
+void TestInplaceWithinRangeStringImpl(
+    BitsetT& bitset, const StringColumnData& column, RangeType op
+) {
+    const size_t n = bitset.size();
+
+    std::default_random_engine rng(345);
+    for (size_t k = 0; k < 4; k++) {
+        std::string lower = RandomString(rng);
+        std::string upper = RandomString(rng);
+        if (lower > upper) {
+            std::swap(lower, upper);
+        }
+
+        StopWatch sw;
+        bitset.inplace_within_range_string_val(lower, upper, column.bytes.data(), column.offsets64.data(), n, op);
+
+        if (print_timing) {
+            printf("elapsed %f\n", sw.elapsed());
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(WithinRangeStrings(lower, upper, column.strings[i], op), bitset[i]) << i;
+        }
+
+        bitset.reset();
+        bitset.inplace_within_range_val(std::string_view(lower), std::string_view(upper), column.views.data(), n, op);
+
+        for (size_t i = 0; i < n; i++) {
+            ASSERT_EQ(WithinRangeStrings(lower, upper, column.strings[i], op), bitset[i]) << i;
+        }
+    }
+}
+
+template<typename BitsetT>
+void TestInplaceCompareStringImpl() {
+    for (const size_t n : typical_sizes) {
+        std::default_random_engine rng(123);
+        const StringColumnData column(n, rng);
+
+        for (const auto op : typical_compare_ops) {
+            BitsetT bitset(n);
+            bitset.reset();
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd, op=%zd\n", n, (size_t)op);
+            }
+
+            TestInplaceCompareStringImpl(bitset, column, op);
+
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                bitset.reset();
+                auto view = bitset.view(offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                }
+
+                TestInplaceCompareStringImpl(view, column, op);
+            }
+        }
+
+        for (const auto op : typical_range_types) {
+            BitsetT bitset(n);
+            bitset.reset();
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd, op=%zd\n", n, (size_t)op);
+            }
+
+            TestInplaceWithinRangeStringImpl(bitset, column, op);
+
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                bitset.reset();
+                auto view = bitset.view(offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                }
+
+                TestInplaceWithinRangeStringImpl(view, column, op);
+            }
+        }
+    }
+}
+
+//
+template<typename T>
+class InplaceCompareStringSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(InplaceCompareStringSuite);
+
+
+TYPED_TEST_P(InplaceCompareStringSuite, BitWise) {
+    using impl_traits = 
+        RefImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>
+        >;
+    TestInplaceCompareStringImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceCompareStringSuite, ElementWise) {
+    using impl_traits = 
+        ElementImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>
+        >;
+    TestInplaceCompareStringImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceCompareStringSuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<0, TypeParam>, 
+                std::tuple_element_t<1, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx2
+            >;
+        TestInplaceCompareStringImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceCompareStringSuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<0, TypeParam>, 
+                std::tuple_element_t<1, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx512
+            >;
+        TestInplaceCompareStringImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceCompareStringSuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedNeon
+        >;
+    TestInplaceCompareStringImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplaceCompareStringSuite, Sve) {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedSve
+        >;
+    TestInplaceCompareStringImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplaceCompareStringSuite, Dynamic) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::VectorizedDynamic
+        >;
+    TestInplaceCompareStringImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceCompareStringSuite, VecRef) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::VectorizedRef
+        >;
+    TestInplaceCompareStringImpl<typename impl_traits::bitset_type>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(InplaceCompareStringSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(InplaceCompareStringTest, InplaceCompareStringSuite, Ttypes0);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+//
+template<typename BitsetT>
+void TestInplacePrefixMatchImpl(
+    BitsetT& bitset, const StringColumnData& column, const std::string& prefix
+) {
+    const size_t n = bitset.size();
+
+    StopWatch sw;
+    bitset.inplace_prefix_match(column.bytes.data(), column.offsets32.data(), n, prefix);
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = (column.strings[i].compare(0, prefix.size(), prefix) == 0);
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    bitset.reset();
+    bitset.inplace_prefix_match(column.bytes.data(), column.offsets64.data(), n, prefix);
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = (column.strings[i].compare(0, prefix.size(), prefix) == 0);
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    bitset.reset();
+    bitset.inplace_prefix_match(column.views.data(), n, prefix);
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = (column.strings[i].compare(0, prefix.size(), prefix) == 0);
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+}
+
+template<typename BitsetT>
+void TestInplacePrefixMatchImpl() {
+    // lengths around the width of SIMD registers
+    std::vector<std::string> prefixes;
+    for (const size_t length : { 0, 1, 4, 7, 8, 9, 15, 16, 17, 31, 32, 33 }) {
+        prefixes.push_back(std::string(length, 'a'));
+    }
+    for (const size_t length : { 63, 64, 65, 70, 71 }) {
+        prefixes.push_back(std::string(length, 'b'));
+    }
+    prefixes.push_back("abab\xff");
+    prefixes.push_back(std::string("ababababab\0", 11));
+
+    for (const size_t n : typical_sizes) {
+        std::default_random_engine rng(123);
+        const StringColumnData column(n, rng);
+
+        for (const auto& prefix : prefixes) {
+            BitsetT bitset(n);
+            bitset.reset();
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd, prefix_size=%zd\n", n, prefix.size());
+            }
+
+            TestInplacePrefixMatchImpl(bitset, column, prefix);
+
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                bitset.reset();
+                auto view = bitset.view(offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, prefix_size=%zd\n", n, offset, prefix.size());
+                }
+
+                TestInplacePrefixMatchImpl(view, column, prefix);
+            }
+        }
+    }
+}
+
+//
+template<typename T>
+class InplacePrefixMatchSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(InplacePrefixMatchSuite);
+
+TYPED_TEST_P(InplacePrefixMatchSuite, BitWise) {
+    using impl_traits = 
+        RefImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>
+        >;
+    TestInplacePrefixMatchImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplacePrefixMatchSuite, ElementWise) {
+    using impl_traits = 
+        ElementImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>
+        >;
+    TestInplacePrefixMatchImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplacePrefixMatchSuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<0, TypeParam>, 
+                std::tuple_element_t<1, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx2
+            >;
+        TestInplacePrefixMatchImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplacePrefixMatchSuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<0, TypeParam>, 
+                std::tuple_element_t<1, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx512
+            >;
+        TestInplacePrefixMatchImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplacePrefixMatchSuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedNeon
+        >;
+    TestInplacePrefixMatchImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplacePrefixMatchSuite, Sve) {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedSve
+        >;
+    TestInplacePrefixMatchImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplacePrefixMatchSuite, Dynamic) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::VectorizedDynamic
+        >;
+    TestInplacePrefixMatchImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplacePrefixMatchSuite, VecRef) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::VectorizedRef
+        >;
+    TestInplacePrefixMatchImpl<typename impl_traits::bitset_type>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(InplacePrefixMatchSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(InplacePrefixMatchTest, InplacePrefixMatchSuite, Ttypes0);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+//
+template<typename T>
+bool CompareValue(const T& a, const T& b, CompareOpType op) {
+    if (op == CompareOpType::EQ) {
+        return (a == b);
+    } else if (op == CompareOpType::GE) {
+        return (a >= b);
+    } else if (op == CompareOpType::GT) {
+        return (a > b);
+    } else if (op == CompareOpType::LE) {
+        return (a <= b);
+    } else if (op == CompareOpType::LT) {
+        return (a < b);
+    } else if (op == CompareOpType::NE) {
+        return (a != b);
+    } else {
+        return false;
+    }
+}
+
+template<typename T>
+bool WithinRangeValue(const T& lower, const T& upper, const T& v, RangeType op) {
+    if (op == RangeType::IncInc) {
+        return (lower <= v && v <= upper);
+    } else if (op == RangeType::ExcInc) {
+        return (lower < v && v <= upper);
+    } else if (op == RangeType::IncExc) {
+        return (lower <= v && v < upper);
+    } else if (op == RangeType::ExcExc) {
+        return (lower < v && v < upper);
+    } else {
+        return false;
+    }
+}
+
+//
+template<typename BitsetT, typename T, typename ValidityT>
+void TestNullableCompareImpl(
+    BitsetT& bitset, const ValidityT& validity, CompareOpType op, RangeType range
+) {
+    const size_t n = bitset.size();
+    constexpr size_t max_v = 3;
+    const T value = ShiftToSignBoundary(from_i32<T>(1));
+    const T lower = ShiftToSignBoundary(from_i32<T>(0));
+    const T upper = ShiftToSignBoundary(from_i32<T>(2));
+
+    std::vector<T> t(n, from_i32<T>(0));
+    std::vector<T> u(n, from_i32<T>(0));
+
+    std::default_random_engine rng(123);
+    FillRandom(t, rng, max_v);
+    FillRandom(u, rng, max_v);
+    ShiftToSignBoundary(t);
+    ShiftToSignBoundary(u);
+
+    // NULL elements must be reset, even if the target bits are set
+    bitset.set();
+
+    StopWatch sw;
+    bitset.inplace_compare_val(t.data(), n, value, op, validity);
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = CompareValue(t[i], value, op);
+        ASSERT_EQ(expected && validity[i], bitset[i]) << i;
+    }
+
+    bitset.set();
+    bitset.inplace_compare_column(t.data(), u.data(), n, op, validity);
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = CompareValue(t[i], u[i], op);
+        ASSERT_EQ(expected && validity[i], bitset[i]) << i;
+    }
+
+    bitset.set();
+    bitset.inplace_within_range_val(lower, upper, t.data(), n, range, validity);
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = WithinRangeValue(lower, upper, t[i], range);
+        ASSERT_EQ(expected && validity[i], bitset[i]) << i;
+    }
+
+    bitset.reset();
+    bitset.inplace_is_null(validity, n);
+
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(!validity[i], bitset[i]) << i;
+    }
+
+    bitset.reset();
+    bitset.inplace_is_not_null(validity, n);
+
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(validity[i], bitset[i]) << i;
+    }
+}
+
+template<typename BitsetT, typename T>
+void TestNullableCompareImpl() {
+    for (const size_t n : typical_sizes) {
+        // the validity bitmap is misaligned on purpose
+        constexpr size_t validity_offset = 3;
+
+        BitsetT validity_bitset(n + validity_offset);
+        std::default_random_engine rng(345);
+        for (size_t i = 0; i < validity_bitset.size(); i++) {
+            validity_bitset[i] = ((rng() % 4) != 0);
+        }
+
+        const auto validity = validity_bitset.view(validity_offset);
+
+        for (const auto op : typical_compare_ops) {
+            const RangeType range = typical_range_types[(size_t)op % std::size(typical_range_types)];
+
+            BitsetT bitset(n);
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd, op=%zd\n", n, (size_t)op);
+            }
+
+            TestNullableCompareImpl<BitsetT, T>(bitset, validity, op, range);
+
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                auto view = bitset.view(offset);
+                const auto validity_view = validity.view(offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                }
+
+                TestNullableCompareImpl<decltype(view), T>(view, validity_view, op, range);
+            }
+        }
+    }
+}
+
+//
+template<typename T>
+class NullableCompareSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(NullableCompareSuite);
+
+TYPED_TEST_P(NullableCompareSuite, BitWise) {
+    using impl_traits = 
+        RefImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>
+        >;
+    TestNullableCompareImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(NullableCompareSuite, ElementWise) {
+    using impl_traits = 
+        ElementImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>
+        >;
+    TestNullableCompareImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(NullableCompareSuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<1, TypeParam>, 
+                std::tuple_element_t<2, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx2
+            >;
+        TestNullableCompareImpl<
+            typename impl_traits::bitset_type,
+            std::tuple_element_t<0, TypeParam>>();
+    }
+#endif
+}
+
+TYPED_TEST_P(NullableCompareSuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<1, TypeParam>, 
+                std::tuple_element_t<2, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx512
+            >;
+        TestNullableCompareImpl<
+            typename impl_traits::bitset_type,
+            std::tuple_element_t<0, TypeParam>>();
+    }
+#endif
+}
+
+TYPED_TEST_P(NullableCompareSuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedNeon
+        >;
+    TestNullableCompareImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+#endif
+}
+
+TYPED_TEST_P(NullableCompareSuite, Sve) {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedSve
+        >;
+    TestNullableCompareImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+#endif
+}
+
+TYPED_TEST_P(NullableCompareSuite, Dynamic) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::VectorizedDynamic
+        >;
+    TestNullableCompareImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(NullableCompareSuite, VecRef) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::VectorizedRef
+        >;
+    TestNullableCompareImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(NullableCompareSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(NullableCompareTest, NullableCompareSuite, Ttypes1);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+//
+template<CombineMode Mode, typename BitsetT, typename T>
+void TestCombineModeImpl(BitsetT& bitset, CompareOpType op, RangeType range, const size_t sparsity) {
+    const size_t n = bitset.size();
+    constexpr size_t max_v = 3;
+    const T value = ShiftToSignBoundary(from_i32<T>(1));
+    const T lower = ShiftToSignBoundary(from_i32<T>(0));
+    const T upper = ShiftToSignBoundary(from_i32<T>(2));
+
+    std::vector<T> t(n, from_i32<T>(0));
+    std::vector<T> u(n, from_i32<T>(0));
+    std::vector<T> lowers(n, lower);
+    std::vector<T> uppers(n, upper);
+
+    std::default_random_engine rng(123);
+    FillRandom(t, rng, max_v);
+    FillRandom(u, rng, max_v);
+    ShiftToSignBoundary(t);
+    ShiftToSignBoundary(u);
+
+    // the existing bits, every sparsity-th one is set on average
+    std::vector<bool> existing(n);
+    auto fill_existing = [&]() {
+        for (size_t i = 0; i < n; i++) {
+            existing[i] = ((rng() % sparsity) == 0);
+            bitset[i] = existing[i];
+        }
+    };
+
+    fill_existing();
+
+    StopWatch sw;
+    bitset.template inplace_compare_val<T, Mode>(t.data(), n, value, op);
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = CombineOperator<Mode>::combine(
+            bool(existing[i]), CompareValue(t[i], value, op));
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    fill_existing();
+    bitset.template inplace_compare_column<T, T, Mode>(t.data(), u.data(), n, op);
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = CombineOperator<Mode>::combine(
+            bool(existing[i]), CompareValue(t[i], u[i], op));
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    fill_existing();
+    bitset.template inplace_within_range_val<T, Mode>(lower, upper, t.data(), n, range);
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = CombineOperator<Mode>::combine(
+            bool(existing[i]), WithinRangeValue(lower, upper, t[i], range));
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    fill_existing();
+    bitset.template inplace_within_range_column<T, Mode>(lowers.data(), uppers.data(), t.data(), n, range);
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = CombineOperator<Mode>::combine(
+            bool(existing[i]), WithinRangeValue(lower, upper, t[i], range));
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    if constexpr (std::is_arithmetic_v<T>) {
+        using HT = ArithHighPrecisionType<T>;
+        const HT right_operand = from_i32<HT>(1);
+        const HT arith_value = from_i32<HT>(2);
+
+        fill_existing();
+        bitset.template inplace_arith_compare<T, Mode>(
+            t.data(), right_operand, arith_value, n, ArithOpType::Add, op);
+
+        for (size_t i = 0; i < n; i++) {
+            const bool expected = CombineOperator<Mode>::combine(
+                bool(existing[i]), 
+                CompareValue<HT>(HT(t[i]) + right_operand, arith_value, op));
+            ASSERT_EQ(expected, bitset[i]) << i;
+        }
+    }
+}
+
+template<typename BitsetT, typename T>
+void TestCombineModeImpl(BitsetT& bitset, CompareOpType op, RangeType range) {
+    TestCombineModeImpl<CombineMode::And, BitsetT, T>(bitset, op, range, 2);
+    TestCombineModeImpl<CombineMode::Or, BitsetT, T>(bitset, op, range, 2);
+    TestCombineModeImpl<CombineMode::AndNot, BitsetT, T>(bitset, op, range, 2);
+
+    // selective evaluation of sparse bits
+    TestCombineModeImpl<CombineMode::And, BitsetT, T>(bitset, op, range, 100);
+}
+
+template<typename BitsetT, typename T>
+void TestCombineModeImpl() {
+    for (const size_t n : typical_sizes) {
+        for (const auto op : typical_compare_ops) {
+            const RangeType range = typical_range_types[(size_t)op % std::size(typical_range_types)];
+
+            BitsetT bitset(n);
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd, op=%zd\n", n, (size_t)op);
+            }
+
+            TestCombineModeImpl<BitsetT, T>(bitset, op, range);
+
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                auto view = bitset.view(offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                }
+
+                TestCombineModeImpl<decltype(view), T>(view, op, range);
+            }
+        }
+    }
+}
+
+//
+template<typename T>
+class CombineModeSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(CombineModeSuite);
+
+TYPED_TEST_P(CombineModeSuite, BitWise) {
+    using impl_traits = 
+        RefImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>
+        >;
+    TestCombineModeImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(CombineModeSuite, ElementWise) {
+    using impl_traits = 
+        ElementImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>
+        >;
+    TestCombineModeImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(CombineModeSuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<1, TypeParam>, 
+                std::tuple_element_t<2, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx2
+            >;
+        TestCombineModeImpl<
+            typename impl_traits::bitset_type,
+            std::tuple_element_t<0, TypeParam>>();
+    }
+#endif
+}
+
+TYPED_TEST_P(CombineModeSuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<1, TypeParam>, 
+                std::tuple_element_t<2, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx512
+            >;
+        TestCombineModeImpl<
+            typename impl_traits::bitset_type,
+            std::tuple_element_t<0, TypeParam>>();
+    }
+#endif
+}
+
+TYPED_TEST_P(CombineModeSuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedNeon
+        >;
+    TestCombineModeImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+#endif
+}
+
+TYPED_TEST_P(CombineModeSuite, Sve) {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedSve
+        >;
+    TestCombineModeImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+#endif
+}
+
+TYPED_TEST_P(CombineModeSuite, Dynamic) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::VectorizedDynamic
+        >;
+    TestCombineModeImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(CombineModeSuite, VecRef) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::VectorizedRef
+        >;
+    TestCombineModeImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(CombineModeSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(CombineModeTest, CombineModeSuite, Ttypes1);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+//
+template<typename BitsetT, typename T>
+void TestConjunctionImpl(BitsetT& bitset, CompareOpType op, RangeType range) {
+    const size_t n = bitset.size();
+    constexpr size_t max_v = 3;
+    const T value = ShiftToSignBoundary(from_i32<T>(1));
+    const T lower = ShiftToSignBoundary(from_i32<T>(0));
+    const T upper = ShiftToSignBoundary(from_i32<T>(2));
+
+    std::vector<T> a(n, from_i32<T>(0));
+    std::vector<T> b(n, from_i32<T>(0));
+    std::vector<T> c(n, from_i32<T>(0));
+    std::vector<T> lowers(n, lower);
+    std::vector<T> uppers(n, upper);
+
+    std::default_random_engine rng(123);
+    FillRandom(a, rng, max_v);
+    FillRandom(b, rng, max_v);
+    FillRandom(c, rng, max_v);
+    ShiftToSignBoundary(a);
+    ShiftToSignBoundary(b);
+    ShiftToSignBoundary(c);
+
+    // a ? value AND lower ? b ? upper AND c != a
+    bitset.set();
+
+    StopWatch sw;
+    bitset.inplace_conjunction(
+        n,
+        compare_val(a.data(), value, op),
+        within_range_val(lower, upper, b.data(), range),
+        compare_column(c.data(), a.data(), CompareOpType::NE)
+    );
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = 
+            CompareValue(a[i], value, op) && 
+            WithinRangeValue(lower, upper, b[i], range) &&
+            (c[i] != a[i]);
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    // a ? value OR lower ? b ? upper OR c == a
+    bitset.reset();
+    bitset.inplace_disjunction(
+        n,
+        compare_val(a.data(), value, op),
+        within_range_column(lowers.data(), uppers.data(), b.data(), range),
+        compare_column(c.data(), a.data(), CompareOpType::EQ)
+    );
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = 
+            CompareValue(a[i], value, op) ||
+            WithinRangeValue(lower, upper, b[i], range) ||
+            (c[i] == a[i]);
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    // a ? value AND (b == value OR c ? value) AND NOT (a == c AND b == c)
+    //   is written as a disjunction under a conjunction.
+    bitset.set();
+    bitset.inplace_conjunction(
+        n,
+        compare_val(a.data(), value, op),
+        any_of(
+            compare_val(b.data(), value, CompareOpType::EQ),
+            compare_val(c.data(), value, op)
+        ),
+        any_of(
+            compare_column(a.data(), c.data(), CompareOpType::NE),
+            compare_column(b.data(), c.data(), CompareOpType::NE)
+        )
+    );
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = 
+            CompareValue(a[i], value, op) && 
+            (b[i] == value || CompareValue(c[i], value, op)) &&
+            !(a[i] == c[i] && b[i] == c[i]);
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    // (a ? value AND b ? value) OR (lower ? c ? upper AND a != b)
+    bitset.reset();
+    bitset.inplace_disjunction(
+        n,
+        all_of(
+            compare_val(a.data(), value, op),
+            compare_val(b.data(), value, op)
+        ),
+        all_of(
+            within_range_val(lower, upper, c.data(), range),
+            compare_column(a.data(), b.data(), CompareOpType::NE)
+        )
+    );
+
+    for (size_t i = 0; i < n; i++) {
+        const bool expected = 
+            (CompareValue(a[i], value, op) && CompareValue(b[i], value, op)) ||
+            (WithinRangeValue(lower, upper, c[i], range) && (a[i] != b[i]));
+        ASSERT_EQ(expected, bitset[i]) << i;
+    }
+
+    if constexpr (std::is_arithmetic_v<T>) {
+        using HT = ArithHighPrecisionType<T>;
+        const HT right_operand = from_i32<HT>(1);
+        const HT arith_value = from_i32<HT>(2);
+
+        // (a + 1) ? 2 AND b != value
+        bitset.set();
+        bitset.inplace_conjunction(
+            n,
+            arith_compare(a.data(), right_operand, arith_value, ArithOpType::Add, op),
+            compare_val(b.data(), value, CompareOpType::NE)
+        );
+
+        for (size_t i = 0; i < n; i++) {
+            const bool expected = 
+                CompareValue<HT>(HT(a[i]) + right_operand, arith_value, op) &&
+                (b[i] != value);
+            ASSERT_EQ(expected, bitset[i]) << i;
+        }
+    }
+}
+
+template<typename BitsetT, typename T>
+void TestConjunctionImpl() {
+    for (const size_t n : typical_sizes) {
+        for (const auto op : typical_compare_ops) {
+            const RangeType range = typical_range_types[(size_t)op % std::size(typical_range_types)];
+
+            BitsetT bitset(n);
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd, op=%zd\n", n, (size_t)op);
+            }
+
+            TestConjunctionImpl<BitsetT, T>(bitset, op, range);
+
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                auto view = bitset.view(offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                }
+
+                TestConjunctionImpl<decltype(view), T>(view, op, range);
+            }
+        }
+    }
+}
+
+//
+template<typename T>
+class ConjunctionSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(ConjunctionSuite);
+
+TYPED_TEST_P(ConjunctionSuite, BitWise) {
+    using impl_traits = 
+        RefImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>
+        >;
+    TestConjunctionImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(ConjunctionSuite, ElementWise) {
+    using impl_traits = 
+        ElementImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>
+        >;
+    TestConjunctionImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(ConjunctionSuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<1, TypeParam>, 
+                std::tuple_element_t<2, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx2
+            >;
+        TestConjunctionImpl<
+            typename impl_traits::bitset_type,
+            std::tuple_element_t<0, TypeParam>>();
+    }
+#endif
+}
+
+TYPED_TEST_P(ConjunctionSuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<1, TypeParam>, 
+                std::tuple_element_t<2, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx512
+            >;
+        TestConjunctionImpl<
+            typename impl_traits::bitset_type,
+            std::tuple_element_t<0, TypeParam>>();
+    }
+#endif
+}
+
+TYPED_TEST_P(ConjunctionSuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedNeon
+        >;
+    TestConjunctionImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+#endif
+}
+
+TYPED_TEST_P(ConjunctionSuite, Sve) {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedSve
+        >;
+    TestConjunctionImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+#endif
+}
+
+TYPED_TEST_P(ConjunctionSuite, Dynamic) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::VectorizedDynamic
+        >;
+    TestConjunctionImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+TYPED_TEST_P(ConjunctionSuite, VecRef) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<1, TypeParam>, 
+            std::tuple_element_t<2, TypeParam>,
+            milvus::bitset::detail::VectorizedRef
+        >;
+    TestConjunctionImpl<
+        typename impl_traits::bitset_type,
+        std::tuple_element_t<0, TypeParam>>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(ConjunctionSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(ConjunctionTest, ConjunctionSuite, Ttypes1);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename BitsetT, typename T>
+struct TestInplaceArithCompareImplS {
+    static void process(
+        BitsetT& bitset, ArithOpType a_op, CompareOpType cmp_op, 
+        const int32_t right_operand_in, const int32_t value_in
+    ) {
+        using HT = ArithHighPrecisionType<T>;
+
+        const size_t n = bitset.size();
+        constexpr int32_t max_v = 10;
+
+        std::vector<T> left(n, 0);
+        const HT right_operand = from_i32<HT>(right_operand_in);
+        const HT value = from_i32<HT>(value_in);
+
+        std::default_random_engine rng(123);
+        // Generating values in (-x, x) range.
+        // This is fine, because we're operating with signed integers. 
+        FillRandomRange(left, rng, -max_v, max_v);
+
+        StopWatch sw;
+        bitset.inplace_arith_compare(left.data(), right_operand, value, n, a_op, cmp_op);
+        
+        if (print_timing) {
+            printf("elapsed %f\n", sw.elapsed());
+        }
+
+        for (size_t i = 0; i < n; i++) {
+            if (a_op == ArithOpType::Add) {
+                if (cmp_op == CompareOpType::EQ) {
+                    ASSERT_EQ((left[i] + right_operand) == value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                } else if (cmp_op == CompareOpType::GE) {
+                    ASSERT_EQ((left[i] + right_operand) >= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                } else if (cmp_op == CompareOpType::GT) {
+                    ASSERT_EQ((left[i] + right_operand) > value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                } else if (cmp_op == CompareOpType::LE) {
+                    ASSERT_EQ((left[i] + right_operand) <= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                } else if (cmp_op == CompareOpType::LT) {
                     ASSERT_EQ((left[i] + right_operand) < value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
                 } else if (cmp_op == CompareOpType::NE) {
                     ASSERT_EQ((left[i] + right_operand) != value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
@@ -1417,29 +3093,203 @@ struct TestInplaceArithCompareImplS {
     ) {
         // test a single special point for the division
 
-        using HT = ArithHighPrecisionType<T>;
+        using HT = ArithHighPrecisionType<T>;
+
+        const size_t n = bitset.size();
+
+        std::vector<T> left(n, left_v);
+        const HT right_operand = right_v;
+        const HT value = value_v;
+
+        bitset.inplace_arith_compare(left.data(), right_operand, value, n, ArithOpType::Div, cmp_op);
+
+        for (size_t i = 0; i < n; i++) {
+            if (cmp_op == CompareOpType::EQ) {
+                ASSERT_EQ((left[i] / right_operand) == value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::GE) {
+                ASSERT_EQ((left[i] / right_operand) >= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::GT) {
+                ASSERT_EQ((left[i] / right_operand) > value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::LE) {
+                ASSERT_EQ((left[i] / right_operand) <= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::LT) {
+                ASSERT_EQ((left[i] / right_operand) < value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::NE) {
+                ASSERT_EQ((left[i] / right_operand) != value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else {
+                ASSERT_TRUE(false) << "Not implemented";
+            }
+        }
+    }
+
+    static void process_mod_float(
+        BitsetT& bitset, CompareOpType cmp_op, const T right_operand, const T value
+    ) {
+        // test fmod() over a wide range of values, including special ones
+
+        const size_t n = bitset.size();
+
+        const std::vector<T> variety = {
+            0,
+            -T(0),
+            1,
+            -1,
+            std::numeric_limits<T>::denorm_min(),
+            std::numeric_limits<T>::max(),
+            std::numeric_limits<T>::quiet_NaN(), 
+            std::numeric_limits<T>::infinity(),
+            -std::numeric_limits<T>::infinity()
+        };
+
+        std::vector<T> left(n, 0);
+
+        std::default_random_engine rng(123);
+        std::uniform_real_distribution<T> u(-1000, 1000);
+        std::uniform_int_distribution<int> e(-30, 30);
+        for (size_t i = 0; i < n; i++) {
+            if (i % 16 == 3) {
+                left[i] = variety[(i / 16) % variety.size()];
+            } else if (i % 4 == 1) {
+                // integer multiples of the divisor and values around them
+                left[i] = right_operand * T(int(u(rng))) + T(i % 3) - T(1);
+            } else {
+                left[i] = std::ldexp(u(rng), e(rng));
+            }
+        }
+
+        bitset.inplace_arith_compare(left.data(), right_operand, value, n, ArithOpType::Mod, cmp_op);
+
+        for (size_t i = 0; i < n; i++) {
+            const T r = std::fmod(left[i], right_operand);
+
+            if (cmp_op == CompareOpType::EQ) {
+                ASSERT_EQ(r == value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::GE) {
+                ASSERT_EQ(r >= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::GT) {
+                ASSERT_EQ(r > value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::LE) {
+                ASSERT_EQ(r <= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::LT) {
+                ASSERT_EQ(r < value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::NE) {
+                ASSERT_EQ(r != value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+            } else {
+                ASSERT_TRUE(false) << "Not implemented";
+            }
+        }
+    }
+
+    static void process_div_mod_int(
+        BitsetT& bitset, ArithOpType a_op, CompareOpType cmp_op, const int64_t right_operand
+    ) {
+        // test Div and Mod for integer types over the full range of values,
+        //   including negative ones. C++ truncation semantics is expected.
+
+        using HT = ArithHighPrecisionType<T>;
+
+        const size_t n = bitset.size();
+
+        std::vector<T> left(n, 0);
+
+        std::default_random_engine rng(123);
+        // min() is excluded, because min() / -1 overflows
+        std::uniform_int_distribution<HT> u(
+            HT(std::numeric_limits<T>::min()) + 1, 
+            HT(std::numeric_limits<T>::max())
+        );
+        for (size_t i = 0; i < n; i++) {
+            left[i] = T(u(rng));
+        }
+
+        // uint64_t wraps negative operands around
+        const HT right = HT(right_operand);
+
+        auto reference = [a_op, right](const T v) -> HT {
+            return (a_op == ArithOpType::Div) ? 
+                (HT(v) / right) : (HT(v) % right);
+        };
+
+        // pick a value that is surely present in the result
+        const HT value = (n == 0) ? 0 : reference(left[n / 2]);
+
+        bitset.inplace_arith_compare(left.data(), right, value, n, a_op, cmp_op);
+
+        for (size_t i = 0; i < n; i++) {
+            const HT r = reference(left[i]);
+
+            if (cmp_op == CompareOpType::EQ) {
+                ASSERT_EQ(r == value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::GE) {
+                ASSERT_EQ(r >= value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::GT) {
+                ASSERT_EQ(r > value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::LE) {
+                ASSERT_EQ(r <= value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::LT) {
+                ASSERT_EQ(r < value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
+            } else if (cmp_op == CompareOpType::NE) {
+                ASSERT_EQ(r != value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
+            } else {
+                ASSERT_TRUE(false) << "Not implemented";
+            }
+        }
+    }
+
+    static void process_add_sub_mul_int(
+        BitsetT& bitset, ArithOpType a_op, CompareOpType cmp_op, const int64_t right_operand, const int64_t value_in
+    ) {
+        // test Add, Sub and Mul for integer types over the full range of values.
+        //   Operands around the limits of narrow lanes are expected.
+
+        using HT = ArithHighPrecisionType<T>;
+
+        const size_t n = bitset.size();
+
+        std::vector<T> left(n, 0);
+
+        std::default_random_engine rng(123);
+        std::uniform_int_distribution<HT> u(
+            HT(std::numeric_limits<T>::min()), 
+            HT(std::numeric_limits<T>::max())
+        );
+        for (size_t i = 0; i < n; i++) {
+            left[i] = T(u(rng));
+        }
+
+        // make sure that extreme values are present
+        if (n >= 2) {
+            left[0] = std::numeric_limits<T>::min();
+            left[n - 1] = std::numeric_limits<T>::max();
+        }
 
-        const size_t n = bitset.size();
+        // uint64_t wraps negative operands around
+        const HT right = HT(right_operand);
+        const HT value = HT(value_in);
 
-        std::vector<T> left(n, left_v);
-        const HT right_operand = right_v;
-        const HT value = value_v;
+        auto reference = [a_op, right](const T v) -> HT {
+            return (a_op == ArithOpType::Add) ? (HT(v) + right) : 
+                (a_op == ArithOpType::Sub) ? (HT(v) - right) : 
+                (HT(v) * right);
+        };
 
-        bitset.inplace_arith_compare(left.data(), right_operand, value, n, ArithOpType::Div, cmp_op);
+        bitset.inplace_arith_compare(left.data(), right, value, n, a_op, cmp_op);
 
         for (size_t i = 0; i < n; i++) {
+            const HT r = reference(left[i]);
+
             if (cmp_op == CompareOpType::EQ) {
-                ASSERT_EQ((left[i] / right_operand) == value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                ASSERT_EQ(r == value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
             } else if (cmp_op == CompareOpType::GE) {
-                ASSERT_EQ((left[i] / right_operand) >= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                ASSERT_EQ(r >= value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
             } else if (cmp_op == CompareOpType::GT) {
-                ASSERT_EQ((left[i] / right_operand) > value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                ASSERT_EQ(r > value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
             } else if (cmp_op == CompareOpType::LE) {
-                ASSERT_EQ((left[i] / right_operand) <= value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                ASSERT_EQ(r <= value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
             } else if (cmp_op == CompareOpType::LT) {
-                ASSERT_EQ((left[i] / right_operand) < value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                ASSERT_EQ(r < value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
             } else if (cmp_op == CompareOpType::NE) {
-                ASSERT_EQ((left[i] / right_operand) != value, bitset[i]) << i << " " << size_t(cmp_op) << " " << left[i] << " " << right_operand << " " << value;
+                ASSERT_EQ(r != value, bitset[i]) << i << " " << size_t(a_op) << " " << size_t(cmp_op) << " " << int64_t(left[i]) << " " << right_operand << " " << value;
             } else {
                 ASSERT_TRUE(false) << "Not implemented";
             }
@@ -1533,6 +3383,114 @@ void TestInplaceArithCompareImpl() {
             }
         }
     }
+
+    if constexpr(std::is_floating_point_v<T>) {
+        // test Mod for IEEE-754 values, including special ones
+        const std::vector<T> divisors = {
+            T(86400),
+            T(0.1),
+            T(-7.5),
+            std::numeric_limits<T>::denorm_min(),
+            0,
+            std::numeric_limits<T>::infinity(),
+            std::numeric_limits<T>::quiet_NaN()
+        };
+
+        for (const size_t n : typical_sizes) {
+            for (const auto cmp_op : typical_compare_ops) {
+                for (const T right_operand : divisors) {
+                    for (const T value : {T(0), T(1), T(-0.5)}) {
+                        BitsetT bitset(n);
+                        bitset.reset();
+
+                        if (print_log) {
+                            printf("Testing bitset mod, n=%zd, cmp_op=%zd, right_operand=%f, value=%f\n", 
+                                n, (size_t)cmp_op, right_operand, value);
+                        }
+
+                        TestInplaceArithCompareImplS<BitsetT, T>::process_mod_float(
+                            bitset, cmp_op, right_operand, value);
+                    }
+                }
+            }
+        }
+    }
+
+    if constexpr(std::is_integral_v<T>) {
+        // test Div and Mod with a variety of divisors
+        const int64_t variety[] = {
+            1, -1, 2, -2, 3, -3, 7, -8, 10, 64, -100, 12345, -1000003,
+            int64_t(std::numeric_limits<T>::max()),
+            int64_t(std::numeric_limits<T>::min()),
+            int64_t(1) << 40,
+            std::numeric_limits<int64_t>::max(),
+            std::numeric_limits<int64_t>::min()
+        };
+
+        for (const size_t n : typical_sizes) {
+            for (const auto a_op : {ArithOpType::Div, ArithOpType::Mod}) {
+                for (const auto cmp_op : typical_compare_ops) {
+                    for (const int64_t right_operand : variety) {
+                        // min() is 0 for unsigned types
+                        if (right_operand == 0) {
+                            continue;
+                        }
+
+                        BitsetT bitset(n);
+                        bitset.reset();
+
+                        if (print_log) {
+                            printf("Testing bitset div mod, n=%zd, a_op=%zd, cmp_op=%zd, right_operand=%lld\n", 
+                                n, (size_t)a_op, (size_t)cmp_op, (long long)right_operand);
+                        }
+
+                        TestInplaceArithCompareImplS<BitsetT, T>::process_div_mod_int(
+                            bitset, a_op, cmp_op, right_operand);
+                    }
+                }
+            }
+        }
+    }
+
+    if constexpr(std::is_integral_v<T>) {
+        // test Add, Sub and Mul with operands that fit or do not fit 
+        //   into int16_t and int32_t lanes
+        const std::pair<int64_t, int64_t> variety[] = {
+            {0, 0},
+            {1, 100},
+            {-7, -100},
+            {127, 32767},
+            {-128, -32768},
+            {256, 32768},
+            {-257, -32769},
+            {32767 - 127, 0},
+            {32768 - 127, 100},
+            {-32768 + 128, -100},
+            {-32769 + 128, 0},
+            {65536, int64_t(1) << 31},
+            {-(int64_t(1) << 31) - 1, 0},
+            {int64_t(1) << 40, -(int64_t(1) << 31) - 1}
+        };
+
+        for (const size_t n : typical_sizes) {
+            for (const auto a_op : {ArithOpType::Add, ArithOpType::Sub, ArithOpType::Mul}) {
+                for (const auto cmp_op : typical_compare_ops) {
+                    for (const auto& [right_operand, value] : variety) {
+                        BitsetT bitset(n);
+                        bitset.reset();
+
+                        if (print_log) {
+                            printf("Testing bitset add sub mul, n=%zd, a_op=%zd, cmp_op=%zd, right_operand=%lld, value=%lld\n", 
+                                n, (size_t)a_op, (size_t)cmp_op, (long long)right_operand, (long long)value);
+                        }
+
+                        TestInplaceArithCompareImplS<BitsetT, T>::process_add_sub_mul_int(
+                            bitset, a_op, cmp_op, right_operand, value);
+                    }
+                }
+            }
+        }
+    }
 }
 
 //
@@ -1881,7 +3839,7 @@ void TestCountImpl(BitsetT& bitset, const size_t max_v) {
 template<typename BitsetT>
 void TestCountImpl() {
     for (const size_t n : typical_sizes) {
-        for (const size_t pr : {1, 100}) {
+        for (const size_t pr : {0, 1, 100}) {
             BitsetT bitset(n);
             bitset.reset();
 
@@ -2187,58 +4145,281 @@ void TestInplaceOpImpl() {
             
             TestInplaceOpImpl<BitsetT>(bitset, bitset_2, op);
 
-            // same offsets
-            for (const size_t offset : typical_offsets) {
-                if (offset >= n) {
-                    continue;
-                }
+            // same offsets
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                bitset.reset();
+                auto view = bitset.view(offset);
+                bitset_2.reset();
+                auto view_2 = bitset_2.view(offset);
+
+                if (print_log) {
+                    printf("Testing bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                }
+                
+                TestInplaceOpImpl<decltype(view)>(view, view_2, op);
+            }
+
+            // fixed left offset
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                bitset.reset();
+                auto view = bitset.view(0, n - offset);
+                bitset_2.reset();
+                auto view_2 = bitset_2.view(offset);
+
+                if (print_log) {
+                    printf("Testing left-fixed bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                }
+                
+                TestInplaceOpImpl<decltype(view)>(view, view_2, op);
+            }
+
+            // fixed right offset
+            for (const size_t offset : typical_offsets) {
+                if (offset >= n) {
+                    continue;
+                }
+
+                bitset.reset();
+                auto view = bitset.view(offset);
+                bitset_2.reset();
+                auto view_2 = bitset_2.view(0, n - offset);
+
+                if (print_log) {
+                    printf("Testing right-fixed bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                }
+                
+                TestInplaceOpImpl<decltype(view)>(view, view_2, op);
+            }
+        }
+    }
+}
+
+//
+template<typename T>
+class InplaceOpSuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(InplaceOpSuite);
+
+
+TYPED_TEST_P(InplaceOpSuite, BitWise) {
+    using impl_traits = 
+        RefImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>
+        >;
+    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceOpSuite, ElementWise) {
+    using impl_traits = 
+        ElementImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>
+        >;
+    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceOpSuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<0, TypeParam>, 
+                std::tuple_element_t<1, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx2
+            >;
+        TestInplaceOpImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceOpSuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<0, TypeParam>, 
+                std::tuple_element_t<1, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx512
+            >;
+        TestInplaceOpImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceOpSuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedNeon
+        >;
+    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplaceOpSuite, Sve) {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedSve
+        >;
+    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplaceOpSuite, Dynamic) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::VectorizedDynamic
+        >;
+    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceOpSuite, VecRef) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::VectorizedRef
+        >;
+    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(InplaceOpSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(InplaceOpTest, InplaceOpSuite, Ttypes0);
+
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+//
+template<typename BitsetT>
+void TestExpressionImpl(BitsetT& a, BitsetT& b, BitsetT& c, BitsetT& d) {
+    const size_t n = a.size();
+
+    std::default_random_engine rng(123);
+    FillRandom(a, rng);
+    FillRandom(b, rng);
+    FillRandom(c, rng);
+    FillRandom(d, rng);
+
+    std::vector<bool> ref_a(n), ref_b(n), ref_c(n), ref_d(n);
+    for (size_t i = 0; i < n; i++) {
+        ref_a[i] = a[i];
+        ref_b[i] = b[i];
+        ref_c[i] = c[i];
+        ref_d[i] = d[i];
+    }
+
+    using bitset_type = Bitset<typename BitsetT::policy_type, std::vector<uint8_t>, false>;
+
+    // (a & b) | (c - d)
+    StopWatch sw;
+    bitset_type result = (a & b) | (c - d);
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    ASSERT_EQ(result.size(), n);
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(result[i], (ref_a[i] && ref_b[i]) || (ref_c[i] && !ref_d[i])) << i;
+    }
+
+    // a ^ (b | (c & d))
+    result = a ^ (b | (c & d));
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(result[i], ref_a[i] != (ref_b[i] || (ref_c[i] && ref_d[i]))) << i;
+    }
+
+    // terminal ops, no materialization
+    size_t ref_count = 0;
+    std::optional<size_t> ref_first;
+    std::optional<size_t> ref_first_unset;
+    for (size_t i = 0; i < n; i++) {
+        const bool value = (ref_a[i] || ref_b[i]) && ref_c[i] && ref_d[i];
+        ref_count += value ? 1 : 0;
+        if (value && !ref_first.has_value()) {
+            ref_first = i;
+        }
+        if (!value && !ref_first_unset.has_value()) {
+            ref_first_unset = i;
+        }
+    }
 
-                bitset.reset();
-                auto view = bitset.view(offset);
-                bitset_2.reset();
-                auto view_2 = bitset_2.view(offset);
+    ASSERT_EQ(((a | b) & c & d).count(), ref_count);
+    ASSERT_EQ(((a | b) & c & d).any(), ref_count != 0);
+    ASSERT_EQ(((a | b) & c & d).none(), ref_count == 0);
+    ASSERT_EQ(((a | b) & c & d).all(), ref_count == n);
+    ASSERT_EQ(((a | b) & c & d).find_first(), ref_first);
+    ASSERT_EQ(((a | b) & c & d).find_first(false), ref_first_unset);
 
-                if (print_log) {
-                    printf("Testing bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
-                }
-                
-                TestInplaceOpImpl<decltype(view)>(view, view_2, op);
-            }
+    ASSERT_TRUE((a ^ a).none());
+    ASSERT_TRUE((a | b).any() || n == 0);
 
-            // fixed left offset
-            for (const size_t offset : typical_offsets) {
-                if (offset >= n) {
-                    continue;
-                }
+    // assign to one of the operands
+    a = (a - b) | c;
+    for (size_t i = 0; i < n; i++) {
+        ASSERT_EQ(a[i], (ref_a[i] && !ref_b[i]) || ref_c[i]) << i;
+    }
+}
 
-                bitset.reset();
-                auto view = bitset.view(0, n - offset);
-                bitset_2.reset();
-                auto view_2 = bitset_2.view(offset);
+template<typename BitsetT>
+void TestExpressionImpl() {
+    for (const size_t n : typical_sizes) {
+        for (const size_t extra : {0, 2048, 4096 + 7}) {
+            const size_t n_v = n + extra;
 
-                if (print_log) {
-                    printf("Testing left-fixed bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
-                }
-                
-                TestInplaceOpImpl<decltype(view)>(view, view_2, op);
+            BitsetT a(n_v);
+            BitsetT b(n_v);
+            BitsetT c(n_v);
+            BitsetT d(n_v);
+
+            if (print_log) {
+                printf("Testing bitset, n=%zd\n", n_v);
             }
 
-            // fixed right offset
+            TestExpressionImpl(a, b, c, d);
+
+            // different offsets
             for (const size_t offset : typical_offsets) {
-                if (offset >= n) {
+                if (offset >= n_v) {
                     continue;
                 }
 
-                bitset.reset();
-                auto view = bitset.view(offset);
-                bitset_2.reset();
-                auto view_2 = bitset_2.view(0, n - offset);
+                auto view_a = a.view(offset);
+                auto view_b = b.view(0, n_v - offset);
+                auto view_c = c.view(offset / 2, n_v - offset);
+                auto view_d = d.view(offset);
 
                 if (print_log) {
-                    printf("Testing right-fixed bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                    printf("Testing bitset view, n=%zd, offset=%zd\n", n_v, offset);
                 }
-                
-                TestInplaceOpImpl<decltype(view)>(view, view_2, op);
+
+                TestExpressionImpl(view_a, view_b, view_c, view_d);
             }
         }
     }
@@ -2246,30 +4427,29 @@ void TestInplaceOpImpl() {
 
 //
 template<typename T>
-class InplaceOpSuite : public ::testing::Test {};
-
-TYPED_TEST_SUITE_P(InplaceOpSuite);
+class ExpressionSuite : public ::testing::Test {};
 
+TYPED_TEST_SUITE_P(ExpressionSuite);
 
-TYPED_TEST_P(InplaceOpSuite, BitWise) {
+TYPED_TEST_P(ExpressionSuite, BitWise) {
     using impl_traits = 
         RefImplTraits<
             std::tuple_element_t<0, TypeParam>, 
             std::tuple_element_t<1, TypeParam>
         >;
-    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+    TestExpressionImpl<typename impl_traits::bitset_type>();
 }
 
-TYPED_TEST_P(InplaceOpSuite, ElementWise) {
+TYPED_TEST_P(ExpressionSuite, ElementWise) {
     using impl_traits = 
         ElementImplTraits<
             std::tuple_element_t<0, TypeParam>, 
             std::tuple_element_t<1, TypeParam>
         >;
-    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+    TestExpressionImpl<typename impl_traits::bitset_type>();
 }
 
-TYPED_TEST_P(InplaceOpSuite, Avx2) {
+TYPED_TEST_P(ExpressionSuite, Avx2) {
 #if defined(__x86_64__)
     using namespace milvus::bitset::detail::x86;
 
@@ -2280,12 +4460,12 @@ TYPED_TEST_P(InplaceOpSuite, Avx2) {
                 std::tuple_element_t<1, TypeParam>,
                 milvus::bitset::detail::x86::VectorizedAvx2
             >;
-        TestInplaceOpImpl<typename impl_traits::bitset_type>();
+        TestExpressionImpl<typename impl_traits::bitset_type>();
     }
 #endif
 }
 
-TYPED_TEST_P(InplaceOpSuite, Avx512) {
+TYPED_TEST_P(ExpressionSuite, Avx512) {
 #if defined(__x86_64__)
     using namespace milvus::bitset::detail::x86;
 
@@ -2296,12 +4476,12 @@ TYPED_TEST_P(InplaceOpSuite, Avx512) {
                 std::tuple_element_t<1, TypeParam>,
                 milvus::bitset::detail::x86::VectorizedAvx512
             >;
-        TestInplaceOpImpl<typename impl_traits::bitset_type>();
+        TestExpressionImpl<typename impl_traits::bitset_type>();
     }
 #endif
 }
 
-TYPED_TEST_P(InplaceOpSuite, Neon) {
+TYPED_TEST_P(ExpressionSuite, Neon) {
 #if defined(__aarch64__)
     using namespace milvus::bitset::detail::arm;
 
@@ -2311,11 +4491,11 @@ TYPED_TEST_P(InplaceOpSuite, Neon) {
             std::tuple_element_t<1, TypeParam>,
             milvus::bitset::detail::arm::VectorizedNeon
         >;
-    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+    TestExpressionImpl<typename impl_traits::bitset_type>();
 #endif
 }
 
-TYPED_TEST_P(InplaceOpSuite, Sve) {
+TYPED_TEST_P(ExpressionSuite, Sve) {
 #if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
     using namespace milvus::bitset::detail::arm;
 
@@ -2325,34 +4505,34 @@ TYPED_TEST_P(InplaceOpSuite, Sve) {
             std::tuple_element_t<1, TypeParam>,
             milvus::bitset::detail::arm::VectorizedSve
         >;
-    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+    TestExpressionImpl<typename impl_traits::bitset_type>();
 #endif
 }
 
-TYPED_TEST_P(InplaceOpSuite, Dynamic) {
+TYPED_TEST_P(ExpressionSuite, Dynamic) {
     using impl_traits = 
         VectorizedImplTraits<
             std::tuple_element_t<0, TypeParam>, 
             std::tuple_element_t<1, TypeParam>,
             milvus::bitset::detail::VectorizedDynamic
         >;
-    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+    TestExpressionImpl<typename impl_traits::bitset_type>();
 }
 
-TYPED_TEST_P(InplaceOpSuite, VecRef) {
+TYPED_TEST_P(ExpressionSuite, VecRef) {
     using impl_traits = 
         VectorizedImplTraits<
             std::tuple_element_t<0, TypeParam>, 
             std::tuple_element_t<1, TypeParam>,
             milvus::bitset::detail::VectorizedRef
         >;
-    TestInplaceOpImpl<typename impl_traits::bitset_type>();
+    TestExpressionImpl<typename impl_traits::bitset_type>();
 }
 
 //
-REGISTER_TYPED_TEST_SUITE_P(InplaceOpSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+REGISTER_TYPED_TEST_SUITE_P(ExpressionSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
 
-INSTANTIATE_TYPED_TEST_SUITE_P(InplaceOpTest, InplaceOpSuite, Ttypes0);
+INSTANTIATE_TYPED_TEST_SUITE_P(ExpressionTest, ExpressionSuite, Ttypes0);
 
 
 //////////////////////////////////////////////////////////////////////////////////////////
@@ -2477,6 +4657,54 @@ void TestInplaceOpMultipleImpl() {
                     
                     TestInplaceOpMultipleImpl<decltype(view)>(view, view_others, op);
                 }
+
+                // fixed left offset
+                for (const size_t offset : typical_offsets) {
+                    if (offset >= n) {
+                        continue;
+                    }
+
+                    bitset.reset();
+                    auto view = bitset.view(0, n - offset);
+
+                    std::vector<typename BitsetT::view_type> view_others;
+                    for (size_t i = 0; i < n_ngb; i++) {
+                        bitset_others[i].reset();
+                        auto view_other = bitset_others[i].view(offset);
+
+                        view_others.push_back(std::move(view_other));
+                    }
+
+                    if (print_log) {
+                        printf("Testing left-fixed bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                    }
+                    
+                    TestInplaceOpMultipleImpl<decltype(view)>(view, view_others, op);
+                }
+
+                // fixed right offset
+                for (const size_t offset : typical_offsets) {
+                    if (offset >= n) {
+                        continue;
+                    }
+
+                    bitset.reset();
+                    auto view = bitset.view(offset);
+
+                    std::vector<typename BitsetT::view_type> view_others;
+                    for (size_t i = 0; i < n_ngb; i++) {
+                        bitset_others[i].reset();
+                        auto view_other = bitset_others[i].view(0, n - offset);
+
+                        view_others.push_back(std::move(view_other));
+                    }
+
+                    if (print_log) {
+                        printf("Testing right-fixed bitset view, n=%zd, offset=%zd, op=%zd\n", n, offset, (size_t)op);
+                    }
+                    
+                    TestInplaceOpMultipleImpl<decltype(view)>(view, view_others, op);
+                }
             }
         }
     }
@@ -2812,3 +5040,234 @@ TYPED_TEST_P(FillSuite, VecRef) {
 REGISTER_TYPED_TEST_SUITE_P(FillSuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
 
 INSTANTIATE_TYPED_TEST_SUITE_P(FillTest, FillSuite, Ttypes0);
+
+//////////////////////////////////////////////////////////////////////////////////////////
+
+//
+template<uint8_t TruthTable, typename BitsetT>
+void TestInplaceTernaryImpl(
+    BitsetT& bitset, BitsetT& bitset_b, BitsetT& bitset_c
+) {
+    const size_t n = bitset.size();
+    const size_t max_v = 2;
+
+    std::default_random_engine rng(123);
+    std::uniform_int_distribution<int8_t> u(0, max_v);
+
+    // populate bitsets
+    std::vector<bool> ref_bitset(n, false);
+    std::vector<bool> ref_bitset_b(n, false);
+    std::vector<bool> ref_bitset_c(n, false);
+    for (size_t i = 0; i < n; i++) {
+        ref_bitset[i] = (u(rng) == 0);
+        ref_bitset_b[i] = (u(rng) == 0);
+        ref_bitset_c[i] = (u(rng) == 0);
+
+        bitset[i] = ref_bitset[i];
+        bitset_b[i] = ref_bitset_b[i];
+        bitset_c[i] = ref_bitset_c[i];
+    }
+
+    // evaluate
+    StopWatch sw;
+    bitset.template inplace_ternary<TruthTable>(bitset_b, bitset_c, n);
+
+    if (print_timing) {
+        printf("elapsed %f\n", sw.elapsed());
+    }
+
+    // validate
+    for (size_t i = 0; i < n; i++) {
+        const size_t idx = 
+            ((ref_bitset[i] ? 1 : 0) << 2) | 
+            ((ref_bitset_b[i] ? 1 : 0) << 1) | 
+            (ref_bitset_c[i] ? 1 : 0);
+        const bool ref_value = ((TruthTable >> idx) & 1) != 0;
+
+        ASSERT_EQ(bitset[i], ref_value) << i;
+        ASSERT_EQ(bitset_b[i], ref_bitset_b[i]) << i;
+        ASSERT_EQ(bitset_c[i], ref_bitset_c[i]) << i;
+    }
+}
+
+template<uint8_t TruthTable, typename BitsetT>
+void TestInplaceTernaryImpl() {
+    for (const size_t n : typical_sizes) {
+        BitsetT bitset(n);
+        bitset.reset();
+        BitsetT bitset_b(n);
+        bitset_b.reset();
+        BitsetT bitset_c(n);
+        bitset_c.reset();
+
+        if (print_log) {
+            printf("Testing bitset, n=%zd, table=%d\n", n, (int)TruthTable);
+        }
+
+        TestInplaceTernaryImpl<TruthTable, BitsetT>(bitset, bitset_b, bitset_c);
+
+        for (const size_t offset : typical_offsets) {
+            if (offset >= n) {
+                continue;
+            }
+
+            // same offsets
+            bitset.reset();
+            bitset_b.reset();
+            bitset_c.reset();
+            auto view = bitset.view(offset);
+            auto view_b = bitset_b.view(offset);
+            auto view_c = bitset_c.view(offset);
+
+            if (print_log) {
+                printf("Testing bitset view, n=%zd, offset=%zd, table=%d\n", n, offset, (int)TruthTable);
+            }
+
+            TestInplaceTernaryImpl<TruthTable, decltype(view)>(view, view_b, view_c);
+
+            // different offsets
+            bitset.reset();
+            bitset_b.reset();
+            bitset_c.reset();
+            auto view_l = bitset.view(offset);
+            auto view_lb = bitset_b.view(0, n - offset);
+            auto view_lc = bitset_c.view(offset / 2, n - offset);
+
+            if (print_log) {
+                printf("Testing mixed bitset view, n=%zd, offset=%zd, table=%d\n", n, offset, (int)TruthTable);
+            }
+
+            TestInplaceTernaryImpl<TruthTable, decltype(view_l)>(view_l, view_lb, view_lc);
+        }
+    }
+}
+
+template<typename BitsetT>
+void TestInplaceTernaryImpl() {
+    using namespace milvus::bitset;
+
+    // a & (b | ~c)
+    TestInplaceTernaryImpl<uint8_t(TERNARY_A & (TERNARY_B | ~TERNARY_C)), BitsetT>();
+    // a ^ b ^ c
+    TestInplaceTernaryImpl<uint8_t(TERNARY_A ^ TERNARY_B ^ TERNARY_C), BitsetT>();
+    // a ? b : c
+    TestInplaceTernaryImpl<uint8_t((TERNARY_A & TERNARY_B) | (~TERNARY_A & TERNARY_C)), BitsetT>();
+    // majority
+    TestInplaceTernaryImpl<uint8_t((TERNARY_A & TERNARY_B) | (TERNARY_A & TERNARY_C) | (TERNARY_B & TERNARY_C)), BitsetT>();
+    // ~(a | b) & c
+    TestInplaceTernaryImpl<uint8_t(~(TERNARY_A | TERNARY_B) & TERNARY_C), BitsetT>();
+    // b & ~c
+    TestInplaceTernaryImpl<uint8_t(TERNARY_B & ~TERNARY_C), BitsetT>();
+    // constants
+    TestInplaceTernaryImpl<uint8_t(0x00), BitsetT>();
+    TestInplaceTernaryImpl<uint8_t(0xFF), BitsetT>();
+}
+
+//
+template<typename T>
+class InplaceTernarySuite : public ::testing::Test {};
+
+TYPED_TEST_SUITE_P(InplaceTernarySuite);
+
+TYPED_TEST_P(InplaceTernarySuite, BitWise) {
+    using impl_traits = 
+        RefImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>
+        >;
+    TestInplaceTernaryImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceTernarySuite, ElementWise) {
+    using impl_traits = 
+        ElementImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>
+        >;
+    TestInplaceTernaryImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceTernarySuite, Avx2) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx2()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<0, TypeParam>, 
+                std::tuple_element_t<1, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx2
+            >;
+        TestInplaceTernaryImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceTernarySuite, Avx512) {
+#if defined(__x86_64__)
+    using namespace milvus::bitset::detail::x86;
+
+    if (cpu_support_avx512()) {
+        using impl_traits = 
+            VectorizedImplTraits<
+                std::tuple_element_t<0, TypeParam>, 
+                std::tuple_element_t<1, TypeParam>,
+                milvus::bitset::detail::x86::VectorizedAvx512
+            >;
+        TestInplaceTernaryImpl<typename impl_traits::bitset_type>();
+    }
+#endif
+}
+
+TYPED_TEST_P(InplaceTernarySuite, Neon) {
+#if defined(__aarch64__)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedNeon
+        >;
+    TestInplaceTernaryImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplaceTernarySuite, Sve) {
+#if defined(__aarch64__) && defined(__ARM_FEATURE_SVE) && defined(BITSET_ENABLE_SVE_SUPPORT)
+    using namespace milvus::bitset::detail::arm;
+
+    using impl_traits =
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::arm::VectorizedSve
+        >;
+    TestInplaceTernaryImpl<typename impl_traits::bitset_type>();
+#endif
+}
+
+TYPED_TEST_P(InplaceTernarySuite, Dynamic) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::VectorizedDynamic
+        >;
+    TestInplaceTernaryImpl<typename impl_traits::bitset_type>();
+}
+
+TYPED_TEST_P(InplaceTernarySuite, VecRef) {
+    using impl_traits = 
+        VectorizedImplTraits<
+            std::tuple_element_t<0, TypeParam>, 
+            std::tuple_element_t<1, TypeParam>,
+            milvus::bitset::detail::VectorizedRef
+        >;
+    TestInplaceTernaryImpl<typename impl_traits::bitset_type>();
+}
+
+//
+REGISTER_TYPED_TEST_SUITE_P(InplaceTernarySuite, BitWise, ElementWise, Avx2, Avx512, Neon, Sve, Dynamic, VecRef);
+
+INSTANTIATE_TYPED_TEST_SUITE_P(InplaceTernaryTest, InplaceTernarySuite, Ttypes0);